@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+// Strided batches of batch n-by-n products.
+template <typename T, api A, dispatch D>
+void bm_gemm_batch_strided(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch), b(A, stride * batch), c(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n * n * batch), bytes<T>(4.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::gemm_batch,
+                   (queue, transpose::nontrans, transpose::nontrans, n, n, n, alpha, mem<A>(a), n,
+                    stride, mem<A>(b), n, stride, beta, mem<A>(c), n, stride, batch));
+    });
+}
+
+// One group of batch n-by-n products through the pointer-array API.
+template <typename T, api A, dispatch D>
+void bm_gemm_batch_group(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch), b(A, stride * batch), c(A, stride * batch);
+    usm_array<transpose> trans(1);
+    usm_array<std::int64_t> size(1), group_size(1);
+    usm_array<T> alpha(1), beta(1);
+    usm_array<const T *> a_array(batch), b_array(batch);
+    usm_array<T *> c_array(batch);
+    trans[0] = transpose::nontrans;
+    size[0] = n;
+    group_size[0] = batch;
+    alpha[0] = T(0.5);
+    beta[0] = T(0.5);
+    for (std::int64_t i = 0; i < batch; i++) {
+        a_array[i] = a.usm() + i * stride;
+        b_array[i] = b.usm() + i * stride;
+        c_array[i] = c.usm() + i * stride;
+    }
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(double(n) * n * n * batch), bytes<T>(4.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::gemm_batch,
+                   (queue, trans.data(), trans.data(), size.data(), size.data(), size.data(),
+                    alpha.data(), a_array.data(), size.data(), b_array.data(), size.data(),
+                    beta.data(), c_array.data(), size.data(), 1, group_size.data()));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_trsm_batch_strided(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch, 1.0 / n), b(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(1);
+    run(state, fma_flops<T>(n * (n + 1) / 2.0 * n * batch), bytes<T>(2.5 * stride * batch), [&] {
+        BENCH_CALL(D, blas::trsm_batch,
+                   (queue, side::left, uplo::upper, transpose::nontrans, diag::unit, n, n, alpha,
+                    mem<A>(a), n, stride, mem<A>(b), n, stride, batch));
+    });
+}
+
+// One group of batch axpy calls of length n.
+template <typename T, api A, dispatch D>
+void bm_axpy_batch_group(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1);
+    operand<T> x(A, n * batch), y(A, n * batch);
+    usm_array<std::int64_t> length(1), inc(1), group_size(1);
+    usm_array<T> alpha(1);
+    usm_array<const T *> x_array(batch);
+    usm_array<T *> y_array(batch);
+    length[0] = n;
+    inc[0] = 1;
+    group_size[0] = batch;
+    alpha[0] = T(0.5);
+    for (std::int64_t i = 0; i < batch; i++) {
+        x_array[i] = x.usm() + i * n;
+        y_array[i] = y.usm() + i * n;
+    }
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(double(n) * batch), bytes<T>(3.0 * n * batch), [&] {
+        BENCH_CALL(D, blas::axpy_batch,
+                   (queue, length.data(), alpha.data(), x_array.data(), inc.data(),
+                    y_array.data(), inc.data(), 1, group_size.data()));
+    });
+}
+
+template <typename T>
+struct add_batch {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        // Many small problems to a few large ones.
+        const auto products = shapes({ { 4, 4096 }, { 16, 1024 }, { 64, 256 }, { 256, 16 } },
+                                     { "n", "batch" });
+        const auto vectors = shapes({ { 16, 4096 }, { 256, 1024 }, { 4096, 64 } },
+                                    { "n", "batch" });
+        add("batch/gemm_batch_strided/" + t, BENCH_ALL(bm_gemm_batch_strided, T), products);
+        add("batch/gemm_batch_group/" + t, BENCH_USM(bm_gemm_batch_group, T), products);
+        add("batch/trsm_batch_strided/" + t, BENCH_BUFFER(bm_trsm_batch_strided, T), products);
+        add("batch/axpy_batch_group/" + t, BENCH_USM(bm_axpy_batch_group, T), vectors);
+    }
+};
+
+const bool registered = for_all_types<add_batch>();
+
+} // anonymous namespace
@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BENCH_COMMON_HPP_
+#define _ONEMKL_BENCH_COMMON_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "oneapi/mkl.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace bench {
+
+// Every benchmark exists for each API flavor and dispatch mode the routine
+// has: buffer or USM arguments, through the run-time dispatch library
+// (blas.hpp) or the compile-time API of the mklcpu backend (blas_ct.hpp).
+enum class api { buffer, usm };
+enum class dispatch { run_time, compile_time };
+
+// Calls func args through the dispatch mode D of the enclosing benchmark.
+// Without the run-time library, as with static builds, only the compile-time
+// variants are registered.
+#ifdef CALL_RT_API
+#define BENCH_CALL(D, func, args)                       \
+    do {                                                \
+        if constexpr (D == bench::dispatch::run_time)   \
+            func args;                                  \
+        else                                            \
+            func<oneapi::mkl::backend::mklcpu> args;    \
+    } while (0)
+#else
+#define BENCH_CALL(D, func, args) func<oneapi::mkl::backend::mklcpu> args
+#endif
+
+inline void rethrow_async(cl::sycl::exception_list exceptions) {
+    for (std::exception_ptr const &e : exceptions)
+        std::rethrow_exception(e);
+}
+
+// The queues benchmarks run on, created on first use. They share a context,
+// so that USM from either can be used on both.
+inline cl::sycl::queue &cpu_queue() {
+    static cl::sycl::queue queue(cl::sycl::cpu_selector{}, rethrow_async);
+    return queue;
+}
+
+inline cl::sycl::queue &in_order_cpu_queue() {
+    static cl::sycl::queue queue(cpu_queue().get_context(), cpu_queue().get_device(),
+                                 rethrow_async, { cl::sycl::property::queue::in_order() });
+    return queue;
+}
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+template <typename T>
+using real_t = typename real_type<T>::type;
+
+template <typename T>
+constexpr bool is_complex = !std::is_same<T, real_t<T>>::value;
+
+template <typename T>
+const char *prefix() {
+    if (std::is_same<T, float>::value)
+        return "s";
+    if (std::is_same<T, double>::value)
+        return "d";
+    if (std::is_same<T, std::complex<float>>::value)
+        return "c";
+    return "z";
+}
+
+// Floating point operations of count multiply-adds, and bytes of count
+// elements.
+template <typename T>
+double fma_flops(double count) {
+    return (is_complex<T> ? 8.0 : 2.0) * count;
+}
+
+template <typename T>
+double bytes(double count) {
+    return double(sizeof(T)) * count;
+}
+
+// A random value in [-scale, scale], or a small integer.
+template <typename T>
+T random_value(std::mt19937 &generator, double scale) {
+    if constexpr (std::is_integral<T>::value) {
+        std::uniform_int_distribution<int> distribution(-8, 8);
+        return T(std::is_signed<T>::value ? distribution(generator)
+                                          : distribution(generator) + 8);
+    }
+    else if constexpr (is_complex<T>) {
+        std::uniform_real_distribution<real_t<T>> distribution(-scale, scale);
+        return T(distribution(generator), distribution(generator));
+    }
+    else {
+        std::uniform_real_distribution<float> distribution(-scale, scale);
+        return T(distribution(generator));
+    }
+}
+
+// size random elements in shared USM or in a buffer over host memory. The
+// triangular matrices of solves take a scale of 1/n with a unit diagonal, so
+// that their solutions stay bounded.
+template <typename T>
+class operand {
+public:
+    operand(api kind, std::int64_t size, double scale = 1.0) : size_(size) {
+        if (kind == api::usm) {
+            usm_ = cl::sycl::malloc_shared<T>(size, cpu_queue());
+            if (!usm_)
+                throw std::bad_alloc();
+        }
+        else {
+            host_.resize(size);
+        }
+        T *data = usm_ ? usm_ : host_.data();
+        std::mt19937 generator(static_cast<std::uint32_t>(size));
+        for (std::int64_t i = 0; i < size; i++)
+            data[i] = random_value<T>(generator, scale);
+        if (!usm_)
+            buffer_.reset(new cl::sycl::buffer<T, 1>(host_.data(), cl::sycl::range<1>(size)));
+    }
+    operand(const operand &) = delete;
+    operand &operator=(const operand &) = delete;
+    ~operand() {
+        buffer_.reset();
+        if (usm_)
+            cl::sycl::free(usm_, cpu_queue());
+    }
+
+    T *usm() {
+        return usm_;
+    }
+    cl::sycl::buffer<T, 1> &buffer() {
+        return *buffer_;
+    }
+    std::int64_t size() const {
+        return size_;
+    }
+
+private:
+    std::int64_t size_;
+    T *usm_ = nullptr;
+    std::vector<T> host_;
+    std::unique_ptr<cl::sycl::buffer<T, 1>> buffer_;
+};
+
+// count uninitialized elements of shared USM, for the parameter arrays of
+// group APIs.
+template <typename T>
+class usm_array {
+public:
+    explicit usm_array(std::int64_t count, cl::sycl::queue &queue = cpu_queue())
+            : queue_(queue),
+              data_(cl::sycl::malloc_shared<T>(count, queue)) {
+        if (!data_)
+            throw std::bad_alloc();
+    }
+    usm_array(const usm_array &) = delete;
+    usm_array &operator=(const usm_array &) = delete;
+    ~usm_array() {
+        cl::sycl::free(data_, queue_);
+    }
+
+    T *data() {
+        return data_;
+    }
+    T &operator[](std::int64_t i) {
+        return data_[i];
+    }
+
+private:
+    cl::sycl::queue queue_;
+    T *data_;
+};
+
+// The argument an operand passes under API A.
+template <api A, typename T>
+decltype(auto) mem(operand<T> &o) {
+    if constexpr (A == api::usm)
+        return o.usm();
+    else
+        return o.buffer();
+}
+
+// Reports flops and bytes per iteration as GFLOPS and GB/s counters.
+inline void set_rates(benchmark::State &state, double flops, double bytes) {
+    if (flops > 0)
+        state.counters["GFLOPS"] =
+            benchmark::Counter(flops * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    if (bytes > 0)
+        state.counters["GB/s"] =
+            benchmark::Counter(bytes * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Times call, one per iteration, each waited for, after an untimed call that
+// also reports failures, such as routines the backend does not implement, as
+// errors of the benchmark.
+template <typename F>
+void run(benchmark::State &state, cl::sycl::queue &queue, double flops, double bytes, F call) {
+    try {
+        call();
+        queue.wait_and_throw();
+    }
+    catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    for (auto _ : state) {
+        call();
+        queue.wait_and_throw();
+    }
+    set_rates(state, flops, bytes);
+}
+
+template <typename F>
+void run(benchmark::State &state, double flops, double bytes, F call) {
+    run(state, cpu_queue(), flops, bytes, call);
+}
+
+using function = void (*)(benchmark::State &);
+
+struct variant {
+    const char *name;
+    function f;
+    dispatch mode;
+};
+
+// Registers family/<api>/<dispatch> for each variant, wall-clock timed as the
+// work runs on other threads, and lets shapes add the argument sets.
+inline void add(const std::string &family, std::initializer_list<variant> variants,
+                const std::function<void(benchmark::internal::Benchmark *)> &shapes) {
+    for (auto &v : variants) {
+#ifndef CALL_RT_API
+        if (v.mode == dispatch::run_time)
+            continue;
+#endif
+        auto *b = benchmark::RegisterBenchmark((family + "/" + v.name).c_str(), v.f);
+        b->UseRealTime();
+        shapes(b);
+    }
+}
+
+#define BENCH_VARIANT(bm, T, A, D, name)                                            \
+    bench::variant {                                                                \
+        name, bm<T, bench::api::A, bench::dispatch::D>, bench::dispatch::D          \
+    }
+
+#define BENCH_USM(bm, T)                                                            \
+    {                                                                               \
+        BENCH_VARIANT(bm, T, usm, run_time, "usm/rt"),                              \
+            BENCH_VARIANT(bm, T, usm, compile_time, "usm/ct")                       \
+    }
+
+#define BENCH_BUFFER(bm, T)                                                         \
+    {                                                                               \
+        BENCH_VARIANT(bm, T, buffer, run_time, "buffer/rt"),                        \
+            BENCH_VARIANT(bm, T, buffer, compile_time, "buffer/ct")                 \
+    }
+
+#define BENCH_ALL(bm, T)                                                            \
+    {                                                                               \
+        BENCH_VARIANT(bm, T, buffer, run_time, "buffer/rt"),                        \
+            BENCH_VARIANT(bm, T, buffer, compile_time, "buffer/ct"),                \
+            BENCH_VARIANT(bm, T, usm, run_time, "usm/rt"),                          \
+            BENCH_VARIANT(bm, T, usm, compile_time, "usm/ct")                       \
+    }
+
+// Argument sets: vector lengths, square sizes and general m, n, k shapes.
+inline std::function<void(benchmark::internal::Benchmark *)> lengths(
+    std::initializer_list<std::int64_t> values) {
+    std::vector<std::int64_t> list(values);
+    return [list](benchmark::internal::Benchmark *b) {
+        b->ArgName("n");
+        for (auto n : list)
+            b->Arg(n);
+    };
+}
+
+inline std::function<void(benchmark::internal::Benchmark *)> shapes(
+    std::initializer_list<std::vector<std::int64_t>> values, std::vector<std::string> names) {
+    std::vector<std::vector<std::int64_t>> list(values);
+    return [list, names](benchmark::internal::Benchmark *b) {
+        b->ArgNames(names);
+        for (auto &args : list)
+            b->Args(args);
+    };
+}
+
+// Runs f<T>() for each of the four BLAS types, or the two real or complex ones.
+template <template <typename> class F>
+bool for_all_types() {
+    F<float>()();
+    F<double>()();
+    F<std::complex<float>>()();
+    F<std::complex<double>>()();
+    return true;
+}
+
+template <template <typename> class F>
+bool for_real_types() {
+    F<float>()();
+    F<double>()();
+    return true;
+}
+
+} // namespace bench
+
+#endif //_ONEMKL_BENCH_COMMON_HPP_
@@ -0,0 +1,386 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Concurrency scaling on the CPU: threads that each issue small float calls
+// and wait for each one, on a set of queues in one context, swept over the
+// thread count, the queue count, in-order or out-of-order queues and the
+// problem size. Each configuration reports its aggregate call rate and the
+// percentiles of the call latency.
+//
+//  onemkl_blas_concurrency [--routine gemm|gemv|axpy] [--dispatch rt|ct]
+//                          [--threads 1,2,4,8] [--queues 1,2,4,8]
+//                          [--order in,out] [--sizes 8,32,128]
+//                          [--calls N] [--out results.json]
+//
+// Thread t uses queue t % queues, and configurations with more queues than
+// threads are skipped. Every thread has operands of its own and makes a
+// fixed number of warm-up calls, then all start their N timed calls at once.
+// The table goes to stdout and, with --out, the results and the settings
+// that affect them to a JSON file.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::transpose;
+
+namespace {
+
+constexpr std::int64_t warm_up_calls = 20;
+
+enum class routine { gemm, gemv, axpy };
+
+struct options {
+    routine r = routine::gemm;
+    dispatch mode = dispatch::compile_time;
+    std::vector<std::int64_t> threads{ 1, 2, 4, 8 };
+    std::vector<std::int64_t> queues{ 1, 2, 4, 8 };
+    std::vector<bool> in_order{ true, false };
+    std::vector<std::int64_t> sizes{ 8, 32, 128 };
+    std::int64_t calls = 2000;
+    std::string out;
+};
+
+struct config {
+    std::int64_t threads, queues;
+    bool in_order;
+    std::int64_t size;
+};
+
+struct result {
+    config c;
+    double seconds;
+    std::int64_t calls;
+    double flops;
+    // Latency percentiles in seconds: 50, 90, 99 and 99.9, then the maximum.
+    double p50, p90, p99, p999, max;
+};
+
+const char *routine_name(routine r) {
+    return r == routine::gemm ? "gemm" : (r == routine::gemv ? "gemv" : "axpy");
+}
+
+double flops_per_call(routine r, std::int64_t n) {
+    const double size = double(n);
+    return r == routine::gemm ? 2.0 * size * size * size
+                              : (r == routine::gemv ? 2.0 * size * size : 2.0 * size);
+}
+
+template <dispatch D>
+cl::sycl::event submit(routine r, cl::sycl::queue &queue, std::int64_t n, const float *a,
+                       const float *x, float *y) {
+    cl::sycl::event done;
+    switch (r) {
+        case routine::gemm:
+            BENCH_CALL(D, done = blas::gemm, (queue, transpose::nontrans, transpose::nontrans, n,
+                                              n, n, 0.5f, a, n, x, n, 0.5f, y, n));
+            break;
+        case routine::gemv:
+            BENCH_CALL(D, done = blas::gemv,
+                       (queue, transpose::nontrans, n, n, 0.5f, a, n, x, 1, 0.5f, y, 1));
+            break;
+        case routine::axpy:
+            BENCH_CALL(D, done = blas::axpy, (queue, n, 0.5f, x, 1, y, 1));
+            break;
+    }
+    return done;
+}
+
+cl::sycl::event submit(const options &o, cl::sycl::queue &queue, std::int64_t n, const float *a,
+                       const float *x, float *y) {
+#ifdef CALL_RT_API
+    if (o.mode == dispatch::run_time)
+        return submit<dispatch::run_time>(o.r, queue, n, a, x, y);
+#endif
+    return submit<dispatch::compile_time>(o.r, queue, n, a, x, y);
+}
+
+double percentile(const std::vector<double> &sorted, double fraction) {
+    const std::size_t i = static_cast<std::size_t>(fraction * sorted.size());
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+// Runs one configuration: the threads make their warm-up calls, wait for
+// each other, then make their timed calls, each timed on its own.
+result run(const options &o, const config &c, const cl::sycl::context &context,
+           const cl::sycl::device &device) {
+    std::vector<cl::sycl::queue> queues;
+    for (std::int64_t q = 0; q < c.queues; q++) {
+        if (c.in_order)
+            queues.emplace_back(context, device, rethrow_async,
+                                cl::sycl::property_list{ cl::sycl::property::queue::in_order() });
+        else
+            queues.emplace_back(context, device, rethrow_async);
+    }
+
+    const std::int64_t n = c.size, count = o.r == routine::axpy ? n : n * n;
+    std::vector<std::vector<double>> latencies(c.threads);
+    std::vector<std::exception_ptr> errors(c.threads);
+    std::atomic<std::int64_t> ready(0);
+    std::atomic<bool> go(false);
+
+    auto work = [&](std::int64_t t) {
+        auto &queue = queues[t % c.queues];
+        auto &latency = latencies[t];
+        bool started = false;
+        try {
+            usm_array<float> a(count, queue), x(count, queue), y(count, queue);
+            std::mt19937 generator(static_cast<std::uint32_t>(t));
+            for (std::int64_t i = 0; i < count; i++) {
+                a[i] = random_value<float>(generator, 1.0);
+                x[i] = random_value<float>(generator, 1.0);
+                y[i] = random_value<float>(generator, 1.0);
+            }
+            for (std::int64_t i = 0; i < warm_up_calls; i++)
+                submit(o, queue, n, a.data(), x.data(), y.data()).wait_and_throw();
+            latency.reserve(o.calls);
+            started = true;
+            ready++;
+            while (!go)
+                std::this_thread::yield();
+            for (std::int64_t i = 0; i < o.calls; i++) {
+                const auto start = std::chrono::steady_clock::now();
+                submit(o, queue, n, a.data(), x.data(), y.data()).wait_and_throw();
+                latency.push_back(
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                        .count());
+            }
+        }
+        catch (...) {
+            errors[t] = std::current_exception();
+            if (!started)
+                ready++;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (std::int64_t t = 0; t < c.threads; t++)
+        pool.emplace_back(work, t);
+    while (ready < c.threads)
+        std::this_thread::yield();
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto &thread : pool)
+        thread.join();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (auto &e : errors) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+
+    std::vector<double> all;
+    for (auto &l : latencies)
+        all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    const std::int64_t calls = all.size();
+    return { c,
+             seconds,
+             calls,
+             flops_per_call(o.r, n) * calls,
+             percentile(all, 0.5),
+             percentile(all, 0.9),
+             percentile(all, 0.99),
+             percentile(all, 0.999),
+             all.back() };
+}
+
+std::string json_string(const std::string &s) {
+    std::string quoted = "\"";
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\')
+            quoted += '\\';
+        if (static_cast<unsigned char>(ch) >= 0x20)
+            quoted += ch;
+    }
+    return quoted + "\"";
+}
+
+std::string environment(const char *name) {
+    const char *value = std::getenv(name);
+    return value ? value : "";
+}
+
+void write_json(const std::string &path, const options &o, const std::string &device_name,
+                const std::vector<result> &results) {
+    std::ofstream out(path);
+    out << std::setprecision(9);
+    out << "{\n  \"context\": {\n"
+        << "    \"device\": " << json_string(device_name) << ",\n"
+        << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"routine\": \"" << routine_name(o.r) << "\",\n"
+        << "    \"dispatch\": \"" << (o.mode == dispatch::run_time ? "rt" : "ct") << "\",\n"
+        << "    \"calls_per_thread\": " << o.calls << ",\n";
+    for (const char *name : { "MKL_NUM_THREADS", "OMP_NUM_THREADS", "ONEMKL_CPU_TUNING_FILE",
+                              "SYCL_DEVICE_FILTER" })
+        out << "    " << json_string(name) << ": " << json_string(environment(name)) << ",\n";
+    out << "    \"type\": \"s\"\n  },\n  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const result &r = results[i];
+        out << (i ? ",\n" : "\n") << "    { \"threads\": " << r.c.threads
+            << ", \"queues\": " << r.c.queues << ", \"order\": \""
+            << (r.c.in_order ? "in" : "out") << "\", \"size\": " << r.c.size
+            << ", \"calls\": " << r.calls << ", \"seconds\": " << r.seconds
+            << ", \"calls_per_second\": " << r.calls / r.seconds
+            << ", \"gflops\": " << r.flops / r.seconds * 1e-9 << ", \"p50_us\": " << r.p50 * 1e6
+            << ", \"p90_us\": " << r.p90 * 1e6 << ", \"p99_us\": " << r.p99 * 1e6
+            << ", \"p999_us\": " << r.p999 * 1e6 << ", \"max_us\": " << r.max * 1e6 << " }";
+    }
+    out << "\n  ]\n}\n";
+    if (!out)
+        throw std::runtime_error("cannot write " + path);
+}
+
+// Parses a comma-separated list of positive integers, or of in and out.
+bool parse_list(const std::string &text, std::vector<std::int64_t> &list) {
+    list.clear();
+    std::istringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const std::int64_t value = std::atoll(item.c_str());
+        if (value <= 0)
+            return false;
+        list.push_back(value);
+    }
+    return !list.empty();
+}
+
+bool parse_orders(const std::string &text, std::vector<bool> &list) {
+    list.clear();
+    std::istringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (item != "in" && item != "out")
+            return false;
+        list.push_back(item == "in");
+    }
+    return !list.empty();
+}
+
+int usage() {
+    std::cerr << "usage: onemkl_blas_concurrency [--routine gemm|gemv|axpy] [--dispatch rt|ct]\n"
+                 "                               [--threads LIST] [--queues LIST]\n"
+                 "                               [--order in,out] [--sizes LIST]\n"
+                 "                               [--calls N] [--out file.json]"
+              << std::endl;
+    return 2;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+    options o;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const std::string value = (i + 1 < argc) ? argv[i + 1] : "";
+        bool valid = i + 1 < argc;
+        if (arg == "--routine") {
+            valid = valid && (value == "gemm" || value == "gemv" || value == "axpy");
+            o.r = value == "gemm" ? routine::gemm
+                                  : (value == "gemv" ? routine::gemv : routine::axpy);
+        }
+        else if (arg == "--dispatch") {
+#ifdef CALL_RT_API
+            valid = valid && (value == "rt" || value == "ct");
+#else
+            valid = valid && value == "ct";
+#endif
+            o.mode = value == "rt" ? dispatch::run_time : dispatch::compile_time;
+        }
+        else if (arg == "--threads")
+            valid = valid && parse_list(value, o.threads);
+        else if (arg == "--queues")
+            valid = valid && parse_list(value, o.queues);
+        else if (arg == "--order")
+            valid = valid && parse_orders(value, o.in_order);
+        else if (arg == "--sizes")
+            valid = valid && parse_list(value, o.sizes);
+        else if (arg == "--calls") {
+            o.calls = std::atoll(value.c_str());
+            valid = valid && o.calls > 0;
+        }
+        else if (arg == "--out")
+            o.out = value;
+        else
+            valid = false;
+        if (!valid)
+            return usage();
+        i++;
+    }
+
+    try {
+        const cl::sycl::device device{ cl::sycl::cpu_selector() };
+        const cl::sycl::context context(device, rethrow_async);
+        const std::string device_name = device.get_info<cl::sycl::info::device::name>();
+
+        std::cout << "device: " << device_name << ", routine: " << routine_name(o.r)
+                  << ", dispatch: " << (o.mode == dispatch::run_time ? "rt" : "ct") << std::endl;
+        std::cout << std::setw(8) << "threads" << std::setw(8) << "queues" << std::setw(7)
+                  << "order" << std::setw(7) << "size" << std::setw(13) << "calls/s"
+                  << std::setw(10) << "GFLOPS" << std::setw(10) << "p50_us" << std::setw(10)
+                  << "p90_us" << std::setw(10) << "p99_us" << std::setw(11) << "p99.9_us"
+                  << std::setw(10) << "max_us" << std::endl;
+
+        std::vector<result> results;
+        for (auto size : o.sizes) {
+            for (auto in_order : o.in_order) {
+                for (auto threads : o.threads) {
+                    for (auto queues : o.queues) {
+                        if (queues > threads)
+                            continue;
+                        const result r =
+                            run(o, { threads, queues, in_order, size }, context, device);
+                        std::cout << std::fixed << std::setprecision(1) << std::setw(8)
+                                  << threads << std::setw(8) << queues << std::setw(7)
+                                  << (in_order ? "in" : "out") << std::setw(7) << size
+                                  << std::setw(13) << r.calls / r.seconds << std::setw(10)
+                                  << std::setprecision(3) << r.flops / r.seconds * 1e-9
+                                  << std::setprecision(1) << std::setw(10) << r.p50 * 1e6
+                                  << std::setw(10) << r.p90 * 1e6 << std::setw(10)
+                                  << r.p99 * 1e6 << std::setw(11) << r.p999 * 1e6
+                                  << std::setw(10) << r.max * 1e6 << std::endl;
+                        results.push_back(r);
+                    }
+                }
+            }
+        }
+        if (!o.out.empty())
+            write_json(o.out, o, device_name, results);
+    }
+    catch (std::exception const &e) {
+        std::cerr << "onemkl_blas_concurrency: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Concurrent requests, each an axpy then a scal on a slice of its own: as
+// coroutines awaiting the calls, all in flight at once, or one request at a
+// time with a wait after each call. items_per_second is the request rate.
+// Built as C++20 where the compiler supports it, and with CALL_RT_API only.
+
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+
+#if defined(CALL_RT_API) && defined(__cpp_impl_coroutine)
+#include "oneapi/mkl/blas/coroutine.hpp"
+#endif
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+
+namespace {
+
+#if defined(CALL_RT_API) && defined(__cpp_impl_coroutine)
+
+// A coroutine that starts eagerly and reports its end through a promise.
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() {
+            return {};
+        }
+        std::suspend_never initial_suspend() {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+template <typename T>
+detached_task request(cl::sycl::queue &queue, std::int64_t n, T *x, T *y,
+                      std::promise<void> &finished) {
+    try {
+        co_await blas::axpy_async(queue, n, T(0.5), x, 1, y, 1);
+        co_await blas::scal_async(queue, n, T(0.5), y, 1);
+        finished.set_value();
+    }
+    catch (...) {
+        finished.set_exception(std::current_exception());
+    }
+}
+
+template <typename T>
+void bm_coroutines(benchmark::State &state) {
+    const std::int64_t n = state.range(0), tasks = state.range(1);
+    operand<T> x(api::usm, n * tasks), y(api::usm, n * tasks);
+    run(state, 0, bytes<T>(5.0 * n * tasks), [&] {
+        std::vector<std::promise<void>> finished(tasks);
+        for (std::int64_t t = 0; t < tasks; t++)
+            request(cpu_queue(), n, x.usm() + t * n, y.usm() + t * n, finished[t]);
+        for (auto &f : finished)
+            f.get_future().get();
+    });
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+template <typename T>
+void bm_blocking(benchmark::State &state) {
+    const std::int64_t n = state.range(0), tasks = state.range(1);
+    operand<T> x(api::usm, n * tasks), y(api::usm, n * tasks);
+    auto &queue = cpu_queue();
+    run(state, 0, bytes<T>(5.0 * n * tasks), [&] {
+        for (std::int64_t t = 0; t < tasks; t++) {
+            blas::axpy(queue, n, T(0.5), x.usm() + t * n, 1, y.usm() + t * n, 1)
+                .wait_and_throw();
+            blas::scal(queue, n, T(0.5), y.usm() + t * n, 1).wait_and_throw();
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+template <typename T>
+struct add_requests {
+    void operator()() const {
+        const std::string family = std::string("scenario/requests/") + prefix<T>();
+        const auto requests = shapes({ { 4096, 1 }, { 4096, 16 }, { 4096, 256 } },
+                                     { "n", "tasks" });
+        add(family + "/coroutines",
+            { variant{ "usm/rt", bm_coroutines<T>, dispatch::run_time } }, requests);
+        add(family + "/blocking", { variant{ "usm/rt", bm_blocking<T>, dispatch::run_time } },
+            requests);
+    }
+};
+
+const bool registered = for_real_types<add_requests>();
+
+#endif
+
+} // anonymous namespace
@@ -0,0 +1,258 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::offset;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+// gemm_ext with the operand types of T.
+template <typename T, api A, dispatch D>
+void bm_gemm_ext(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), b(A, n * n), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n * n), bytes<T>(4.0 * n * n), [&] {
+        BENCH_CALL(D, blas::gemm_ext, (queue, transpose::nontrans, transpose::nontrans, n, n, n,
+                                       alpha, mem<A>(a), n, mem<A>(b), n, beta, mem<A>(c), n));
+    });
+}
+
+// Half inputs with a float result.
+template <typename T, api A, dispatch D>
+void bm_gemm_ext_half_float(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<cl::sycl::half> a(A, n * n), b(A, n * n);
+    operand<float> c(A, n * n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<float>(double(n) * n * n), bytes<float>(3.0 * n * n), [&] {
+        BENCH_CALL(D, blas::gemm_ext, (queue, transpose::nontrans, transpose::nontrans, n, n, n,
+                                       0.5f, mem<A>(a), n, mem<A>(b), n, 0.5f, mem<A>(c), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gemm_ext_half(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<cl::sycl::half> a(A, n * n), b(A, n * n), c(A, n * n);
+    auto &queue = cpu_queue();
+    const cl::sycl::half alpha = 0.5f, beta = 0.5f;
+    run(state, fma_flops<float>(double(n) * n * n), bytes<cl::sycl::half>(4.0 * n * n), [&] {
+        BENCH_CALL(D, blas::gemm_ext, (queue, transpose::nontrans, transpose::nontrans, n, n, n,
+                                       alpha, mem<A>(a), n, mem<A>(b), n, beta, mem<A>(c), n));
+    });
+}
+
+// Signed by unsigned 8-bit integers into 32-bit integers.
+template <typename T, api A, dispatch D>
+void bm_gemm_ext_int8(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<std::int8_t> a(A, n * n);
+    operand<std::uint8_t> b(A, n * n);
+    operand<std::int32_t> c(A, n * n), co(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<float>(double(n) * n * n), 2.0 * n * n + bytes<std::int32_t>(2.0 * n * n),
+        [&] {
+            BENCH_CALL(D, blas::gemm_ext,
+                       (queue, transpose::nontrans, transpose::nontrans, offset::fix, n, n, n,
+                        1.0f, mem<A>(a), n, std::int8_t(0), mem<A>(b), n, std::uint8_t(0), 0.0f,
+                        mem<A>(c), n, mem<A>(co)));
+        });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gemmt(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    operand<T> a(A, n * k), b(A, k * n), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1) / 2.0 * k), bytes<T>(2.0 * n * k + n * (n + 1.0)), [&] {
+        BENCH_CALL(D, blas::gemmt,
+                   (queue, uplo::upper, transpose::nontrans, transpose::nontrans, n, k, alpha,
+                    mem<A>(a), n, mem<A>(b), k, beta, mem<A>(c), n));
+    });
+}
+
+// GFLOPS count the 8mnk real operations of a standard complex product, so
+// that gemm3m compares directly with gemm.
+template <typename T, api A, dispatch D>
+void bm_gemm3m(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1), k = state.range(2);
+    operand<T> a(A, m * k), b(A, k * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * n * k), bytes<T>(double(m) * k + k * n + 2.0 * m * n),
+        [&] {
+            BENCH_CALL(D, blas::gemm3m, (queue, transpose::nontrans, transpose::nontrans, m, n, k,
+                                         alpha, mem<A>(a), m, mem<A>(b), k, beta, mem<A>(c), m));
+        });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gemm3m_batch_strided(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch), b(A, stride * batch), c(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n * n * batch), bytes<T>(4.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::gemm3m_batch,
+                   (queue, transpose::nontrans, transpose::nontrans, n, n, n, alpha, mem<A>(a), n,
+                    stride, mem<A>(b), n, stride, beta, mem<A>(c), n, stride, batch));
+    });
+}
+
+// Copies of m-by-n matrices, transposed when the third argument is 1.
+template <typename T, api A, dispatch D>
+void bm_omatcopy(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    const transpose trans = state.range(2) ? transpose::trans : transpose::nontrans;
+    const std::int64_t ldb = state.range(2) ? n : m;
+    operand<T> a(A, m * n), b(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, 0, bytes<T>(2.0 * m * n), [&] {
+        BENCH_CALL(D, blas::omatcopy,
+                   (queue, trans, m, n, alpha, mem<A>(a), m, mem<A>(b), ldb));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_imatcopy(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    const transpose trans = state.range(2) ? transpose::trans : transpose::nontrans;
+    const std::int64_t ldb = state.range(2) ? n : m;
+    operand<T> ab(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(1);
+    // Transposing twice per iteration brings the matrix back to its shape.
+    run(state, 0, bytes<T>(4.0 * m * n), [&] {
+        BENCH_CALL(D, blas::imatcopy, (queue, trans, m, n, alpha, mem<A>(ab), m, ldb));
+        BENCH_CALL(D, blas::imatcopy,
+                   (queue, trans, state.range(2) ? n : m, state.range(2) ? m : n, alpha,
+                    mem<A>(ab), ldb, m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_omatadd(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    const transpose trans = state.range(2) ? transpose::trans : transpose::nontrans;
+    const std::int64_t ldb = state.range(2) ? n : m;
+    operand<T> a(A, m * n), b(A, m * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * n), bytes<T>(3.0 * m * n), [&] {
+        BENCH_CALL(D, blas::omatadd, (queue, transpose::nontrans, trans, m, n, alpha, mem<A>(a),
+                                      m, beta, mem<A>(b), ldb, mem<A>(c), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_omatcopy_batch(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch), b(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, 0, bytes<T>(2.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::omatcopy_batch, (queue, transpose::trans, n, n, alpha, mem<A>(a), n,
+                                             stride, mem<A>(b), n, stride, batch));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_imatcopy_batch(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> ab(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(1);
+    run(state, 0, bytes<T>(2.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::imatcopy_batch,
+                   (queue, transpose::trans, n, n, alpha, mem<A>(ab), n, n, stride, batch));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_omatadd_batch(benchmark::State &state) {
+    const std::int64_t n = state.range(0), batch = state.range(1), stride = n * n;
+    operand<T> a(A, stride * batch), b(A, stride * batch), c(A, stride * batch);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(stride) * batch), bytes<T>(3.0 * stride * batch), [&] {
+        BENCH_CALL(D, blas::omatadd_batch,
+                   (queue, transpose::nontrans, transpose::trans, n, n, alpha, mem<A>(a), n,
+                    stride, beta, mem<A>(b), n, stride, mem<A>(c), n, stride, batch));
+    });
+}
+
+template <typename T>
+struct add_extensions {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        const auto n = lengths({ 64, 256, 1024, 2048 });
+        const auto nk = shapes({ { 64, 64 }, { 256, 256 }, { 1024, 1024 }, { 2048, 64 } },
+                               { "n", "k" });
+        // Square, tall and wide, each as a copy and as a transposition.
+        const auto matrices = shapes({ { 1024, 1024, 0 },
+                                       { 1024, 1024, 1 },
+                                       { 4096, 4096, 0 },
+                                       { 4096, 4096, 1 },
+                                       { 65536, 64, 0 },
+                                       { 65536, 64, 1 },
+                                       { 64, 65536, 0 },
+                                       { 64, 65536, 1 } },
+                                     { "m", "n", "trans" });
+        const auto batches = shapes({ { 16, 1024 }, { 64, 256 }, { 256, 16 } },
+                                    { "n", "batch" });
+        add("extensions/gemm_ext/" + t, BENCH_BUFFER(bm_gemm_ext, T), n);
+        add("extensions/gemmt/" + t, BENCH_ALL(bm_gemmt, T), nk);
+        add("extensions/omatcopy/" + t, BENCH_ALL(bm_omatcopy, T), matrices);
+        add("extensions/imatcopy/" + t, BENCH_ALL(bm_imatcopy, T), matrices);
+        add("extensions/omatadd/" + t, BENCH_ALL(bm_omatadd, T), matrices);
+        add("extensions/omatcopy_batch/" + t, BENCH_ALL(bm_omatcopy_batch, T), batches);
+        add("extensions/imatcopy_batch/" + t, BENCH_ALL(bm_imatcopy_batch, T), batches);
+        add("extensions/omatadd_batch/" + t, BENCH_ALL(bm_omatadd_batch, T), batches);
+        if constexpr (is_complex<T>) {
+            const auto mnk = shapes({ { 256, 256, 256 }, { 1024, 1024, 1024 },
+                                      { 2048, 2048, 2048 }, { 4096, 256, 256 } },
+                                    { "m", "n", "k" });
+            add("extensions/gemm3m/" + t, BENCH_ALL(bm_gemm3m, T), mnk);
+            add("extensions/gemm3m_batch_strided/" + t, BENCH_ALL(bm_gemm3m_batch_strided, T),
+                batches);
+        }
+        if constexpr (std::is_same<T, float>::value) {
+            add("extensions/gemm_ext/hhs", BENCH_BUFFER(bm_gemm_ext_half_float, T), n);
+            add("extensions/gemm_ext/hhh", BENCH_BUFFER(bm_gemm_ext_half, T), n);
+            add("extensions/gemm_ext/bbi", BENCH_BUFFER(bm_gemm_ext_int8, T), n);
+        }
+    }
+};
+
+const bool registered = for_all_types<add_extensions>();
+
+} // anonymous namespace
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+
+namespace {
+
+template <typename T, api A, dispatch D>
+void bm_asum(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n);
+    operand<real_t<T>> result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, (is_complex<T> ? 2.0 : 1.0) * n, bytes<T>(n),
+        [&] { BENCH_CALL(D, blas::asum, (queue, n, mem<A>(x), 1, mem<A>(result))); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_axpy(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n), bytes<T>(3 * n),
+        [&] { BENCH_CALL(D, blas::axpy, (queue, n, alpha, mem<A>(x), 1, mem<A>(y), 1)); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_copy(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    run(state, 0, bytes<T>(2 * n),
+        [&] { BENCH_CALL(D, blas::copy, (queue, n, mem<A>(x), 1, mem<A>(y), 1)); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_dot(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n), result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n), bytes<T>(2 * n), [&] {
+        BENCH_CALL(D, blas::dot, (queue, n, mem<A>(x), 1, mem<A>(y), 1, mem<A>(result)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_dotc(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n), result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n), bytes<T>(2 * n), [&] {
+        BENCH_CALL(D, blas::dotc, (queue, n, mem<A>(x), 1, mem<A>(y), 1, mem<A>(result)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_dotu(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n), result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n), bytes<T>(2 * n), [&] {
+        BENCH_CALL(D, blas::dotu, (queue, n, mem<A>(x), 1, mem<A>(y), 1, mem<A>(result)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_sdsdot(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<float> x(A, n), y(A, n), result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<float>(n), bytes<float>(2 * n), [&] {
+        BENCH_CALL(D, blas::sdsdot,
+                   (queue, n, 0.5f, mem<A>(x), 1, mem<A>(y), 1, mem<A>(result)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_iamax(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n);
+    operand<std::int64_t> result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, 0, bytes<T>(n),
+        [&] { BENCH_CALL(D, blas::iamax, (queue, n, mem<A>(x), 1, mem<A>(result))); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_iamin(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n);
+    operand<std::int64_t> result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, 0, bytes<T>(n),
+        [&] { BENCH_CALL(D, blas::iamin, (queue, n, mem<A>(x), 1, mem<A>(result))); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_nrm2(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n);
+    operand<real_t<T>> result(A, 1);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n) / 2, bytes<T>(n),
+        [&] { BENCH_CALL(D, blas::nrm2, (queue, n, mem<A>(x), 1, mem<A>(result))); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_rot(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const real_t<T> c = 0.6, s = 0.8;
+    run(state, 6.0 * n * (is_complex<T> ? 2 : 1), bytes<T>(4 * n),
+        [&] { BENCH_CALL(D, blas::rot, (queue, n, mem<A>(x), 1, mem<A>(y), 1, c, s)); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_rotg(benchmark::State &state) {
+    operand<T> a(A, 1), b(A, 1), s(A, 1);
+    operand<real_t<T>> c(A, 1);
+    auto &queue = cpu_queue();
+    run(state, 0, 0, [&] {
+        BENCH_CALL(D, blas::rotg, (queue, mem<A>(a), mem<A>(b), mem<A>(c), mem<A>(s)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_rotm(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n), param(A, 5);
+    // The full 2-by-2 matrix, flag -1.
+    if constexpr (A == api::usm)
+        param.usm()[0] = T(-1);
+    else
+        param.buffer().template get_access<cl::sycl::access::mode::write>()[0] = T(-1);
+    auto &queue = cpu_queue();
+    run(state, 6.0 * n, bytes<T>(4 * n), [&] {
+        BENCH_CALL(D, blas::rotm, (queue, n, mem<A>(x), 1, mem<A>(y), 1, mem<A>(param)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_rotmg(benchmark::State &state) {
+    operand<T> d1(A, 1), d2(A, 1), x1(A, 1), param(A, 5);
+    auto &queue = cpu_queue();
+    run(state, 0, 0, [&] {
+        BENCH_CALL(D, blas::rotmg,
+                   (queue, mem<A>(d1), mem<A>(d2), mem<A>(x1), T(0.5), mem<A>(param)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_scal(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n) / 2, bytes<T>(2 * n),
+        [&] { BENCH_CALL(D, blas::scal, (queue, n, alpha, mem<A>(x), 1)); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_swap(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    run(state, 0, bytes<T>(4 * n),
+        [&] { BENCH_CALL(D, blas::swap, (queue, n, mem<A>(x), 1, mem<A>(y), 1)); });
+}
+
+template <typename T>
+struct add_level1 {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        const auto n = lengths({ 1 << 10, 1 << 14, 1 << 18, 1 << 22 });
+        add("level1/asum/" + t, BENCH_ALL(bm_asum, T), n);
+        add("level1/axpy/" + t, BENCH_ALL(bm_axpy, T), n);
+        add("level1/copy/" + t, BENCH_ALL(bm_copy, T), n);
+        add("level1/iamax/" + t, BENCH_ALL(bm_iamax, T), n);
+        add("level1/iamin/" + t, BENCH_ALL(bm_iamin, T), n);
+        add("level1/nrm2/" + t, BENCH_ALL(bm_nrm2, T), n);
+        add("level1/rot/" + t, BENCH_ALL(bm_rot, T), n);
+        add("level1/rotg/" + t, BENCH_ALL(bm_rotg, T), [](benchmark::internal::Benchmark *) {});
+        add("level1/scal/" + t, BENCH_ALL(bm_scal, T), n);
+        add("level1/swap/" + t, BENCH_ALL(bm_swap, T), n);
+        if constexpr (is_complex<T>) {
+            add("level1/dotc/" + t, BENCH_ALL(bm_dotc, T), n);
+            add("level1/dotu/" + t, BENCH_ALL(bm_dotu, T), n);
+        }
+        else {
+            add("level1/dot/" + t, BENCH_ALL(bm_dot, T), n);
+            add("level1/rotm/" + t, BENCH_ALL(bm_rotm, T), n);
+            add("level1/rotmg/" + t, BENCH_ALL(bm_rotmg, T),
+                [](benchmark::internal::Benchmark *) {});
+        }
+        if constexpr (std::is_same<T, float>::value)
+            add("level1/sdsdot/s", BENCH_ALL(bm_sdsdot, T), n);
+    }
+};
+
+const bool registered = for_all_types<add_level1>();
+
+} // anonymous namespace
@@ -0,0 +1,369 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::diag;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+// Half bandwidth of the band routines.
+constexpr std::int64_t band = 16;
+
+template <typename T, api A, dispatch D>
+void bm_gemv(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * n), x(A, n), y(A, m);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * n), bytes<T>(double(m) * n + n + 2 * m), [&] {
+        BENCH_CALL(D, blas::gemv, (queue, transpose::nontrans, m, n, alpha, mem<A>(a), m,
+                                   mem<A>(x), 1, beta, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gbmv(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1), lda = 2 * band + 1;
+    operand<T> a(A, lda * n), x(A, n), y(A, m);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * lda), bytes<T>(double(lda) * n + n + 2 * m), [&] {
+        BENCH_CALL(D, blas::gbmv, (queue, transpose::nontrans, m, n, band, band, alpha,
+                                   mem<A>(a), lda, mem<A>(x), 1, beta, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_ger(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * n), x(A, m), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(double(m) * n), bytes<T>(2.0 * m * n + m + n), [&] {
+        BENCH_CALL(D, blas::ger,
+                   (queue, m, n, alpha, mem<A>(x), 1, mem<A>(y), 1, mem<A>(a), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gerc(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * n), x(A, m), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(double(m) * n), bytes<T>(2.0 * m * n + m + n), [&] {
+        BENCH_CALL(D, blas::gerc,
+                   (queue, m, n, alpha, mem<A>(x), 1, mem<A>(y), 1, mem<A>(a), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_geru(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * n), x(A, m), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(double(m) * n), bytes<T>(2.0 * m * n + m + n), [&] {
+        BENCH_CALL(D, blas::geru,
+                   (queue, m, n, alpha, mem<A>(x), 1, mem<A>(y), 1, mem<A>(a), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hbmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0), lda = band + 1;
+    operand<T> a(A, lda * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * (2 * band + 1)), bytes<T>(double(lda) * n + 3 * n), [&] {
+        BENCH_CALL(D, blas::hbmv, (queue, uplo::upper, n, band, alpha, mem<A>(a), lda, mem<A>(x),
+                                   1, beta, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hemv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n), bytes<T>(n * (n + 1) / 2.0 + 3 * n), [&] {
+        BENCH_CALL(D, blas::hemv, (queue, uplo::upper, n, alpha, mem<A>(a), n, mem<A>(x), 1, beta,
+                                   mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_her(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n);
+    auto &queue = cpu_queue();
+    const real_t<T> alpha = 0.5;
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1.0) + n), [&] {
+        BENCH_CALL(D, blas::her, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(a), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_her2(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1.0)), bytes<T>(n * (n + 1.0) + 2 * n), [&] {
+        BENCH_CALL(D, blas::her2, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(y), 1,
+                                   mem<A>(a), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hpmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n), bytes<T>(n * (n + 1) / 2.0 + 3 * n), [&] {
+        BENCH_CALL(D, blas::hpmv, (queue, uplo::upper, n, alpha, mem<A>(a), mem<A>(x), 1, beta,
+                                   mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hpr(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n);
+    auto &queue = cpu_queue();
+    const real_t<T> alpha = 0.5;
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1.0) + n), [&] {
+        BENCH_CALL(D, blas::hpr, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(a)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hpr2(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1.0)), bytes<T>(n * (n + 1.0) + 2 * n), [&] {
+        BENCH_CALL(D, blas::hpr2,
+                   (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(y), 1, mem<A>(a)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_sbmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0), lda = band + 1;
+    operand<T> a(A, lda * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * (2 * band + 1)), bytes<T>(double(lda) * n + 3 * n), [&] {
+        BENCH_CALL(D, blas::sbmv, (queue, uplo::upper, n, band, alpha, mem<A>(a), lda, mem<A>(x),
+                                   1, beta, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_spmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n), bytes<T>(n * (n + 1) / 2.0 + 3 * n), [&] {
+        BENCH_CALL(D, blas::spmv, (queue, uplo::upper, n, alpha, mem<A>(a), mem<A>(x), 1, beta,
+                                   mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_spr(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1.0) + n), [&] {
+        BENCH_CALL(D, blas::spr, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(a)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_spr2(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1.0)), bytes<T>(n * (n + 1.0) + 2 * n), [&] {
+        BENCH_CALL(D, blas::spr2,
+                   (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(y), 1, mem<A>(a)));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_symv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(n) * n), bytes<T>(n * (n + 1) / 2.0 + 3 * n), [&] {
+        BENCH_CALL(D, blas::symv, (queue, uplo::upper, n, alpha, mem<A>(a), n, mem<A>(x), 1, beta,
+                                   mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_syr(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1.0) + n), [&] {
+        BENCH_CALL(D, blas::syr, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(a), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_syr2(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1.0)), bytes<T>(n * (n + 1.0) + 2 * n), [&] {
+        BENCH_CALL(D, blas::syr2, (queue, uplo::upper, n, alpha, mem<A>(x), 1, mem<A>(y), 1,
+                                   mem<A>(a), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_tbmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0), lda = band + 1;
+    operand<T> a(A, lda * n), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(double(n) * lda), bytes<T>(double(lda) * n + 2 * n), [&] {
+        BENCH_CALL(D, blas::tbmv, (queue, uplo::upper, transpose::nontrans, diag::nonunit, n,
+                                   band, mem<A>(a), lda, mem<A>(x), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_tbsv(benchmark::State &state) {
+    const std::int64_t n = state.range(0), lda = band + 1;
+    operand<T> a(A, lda * n, 1.0 / band), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(double(n) * lda), bytes<T>(double(lda) * n + 2 * n), [&] {
+        BENCH_CALL(D, blas::tbsv, (queue, uplo::upper, transpose::nontrans, diag::unit, n, band,
+                                   mem<A>(a), lda, mem<A>(x), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_tpmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1) / 2.0 + 2 * n), [&] {
+        BENCH_CALL(D, blas::tpmv, (queue, uplo::upper, transpose::nontrans, diag::nonunit, n,
+                                   mem<A>(a), mem<A>(x), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_tpsv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * (n + 1) / 2, 1.0 / n), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1) / 2.0 + 2 * n), [&] {
+        BENCH_CALL(D, blas::tpsv, (queue, uplo::upper, transpose::nontrans, diag::unit, n,
+                                   mem<A>(a), mem<A>(x), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_trmv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1) / 2.0 + 2 * n), [&] {
+        BENCH_CALL(D, blas::trmv, (queue, uplo::upper, transpose::nontrans, diag::nonunit, n,
+                                   mem<A>(a), n, mem<A>(x), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_trsv(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(A, n * n, 1.0 / n), x(A, n);
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(n * (n + 1) / 2.0), bytes<T>(n * (n + 1) / 2.0 + 2 * n), [&] {
+        BENCH_CALL(D, blas::trsv, (queue, uplo::upper, transpose::nontrans, diag::unit, n,
+                                   mem<A>(a), n, mem<A>(x), 1));
+    });
+}
+
+template <typename T>
+struct add_level2 {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        const auto mn = shapes({ { 64, 64 }, { 256, 256 }, { 1024, 1024 }, { 4096, 4096 },
+                                 { 16384, 256 }, { 256, 16384 } },
+                               { "m", "n" });
+        const auto n = lengths({ 64, 256, 1024, 4096 });
+        add("level2/gemv/" + t, BENCH_ALL(bm_gemv, T), mn);
+        add("level2/gbmv/" + t, BENCH_ALL(bm_gbmv, T), mn);
+        add("level2/tbmv/" + t, BENCH_ALL(bm_tbmv, T), n);
+        add("level2/tbsv/" + t, BENCH_ALL(bm_tbsv, T), n);
+        add("level2/tpmv/" + t, BENCH_ALL(bm_tpmv, T), n);
+        add("level2/tpsv/" + t, BENCH_ALL(bm_tpsv, T), n);
+        add("level2/trmv/" + t, BENCH_ALL(bm_trmv, T), n);
+        add("level2/trsv/" + t, BENCH_ALL(bm_trsv, T), n);
+        if constexpr (is_complex<T>) {
+            add("level2/gerc/" + t, BENCH_ALL(bm_gerc, T), mn);
+            add("level2/geru/" + t, BENCH_ALL(bm_geru, T), mn);
+            add("level2/hbmv/" + t, BENCH_ALL(bm_hbmv, T), n);
+            add("level2/hemv/" + t, BENCH_ALL(bm_hemv, T), n);
+            add("level2/her/" + t, BENCH_ALL(bm_her, T), n);
+            add("level2/her2/" + t, BENCH_ALL(bm_her2, T), n);
+            add("level2/hpmv/" + t, BENCH_ALL(bm_hpmv, T), n);
+            add("level2/hpr/" + t, BENCH_ALL(bm_hpr, T), n);
+            add("level2/hpr2/" + t, BENCH_ALL(bm_hpr2, T), n);
+        }
+        else {
+            add("level2/ger/" + t, BENCH_ALL(bm_ger, T), mn);
+            add("level2/sbmv/" + t, BENCH_ALL(bm_sbmv, T), n);
+            add("level2/spmv/" + t, BENCH_ALL(bm_spmv, T), n);
+            add("level2/spr/" + t, BENCH_ALL(bm_spr, T), n);
+            add("level2/spr2/" + t, BENCH_ALL(bm_spr2, T), n);
+            add("level2/symv/" + t, BENCH_ALL(bm_symv, T), n);
+            add("level2/syr/" + t, BENCH_ALL(bm_syr, T), n);
+            add("level2/syr2/" + t, BENCH_ALL(bm_syr2, T), n);
+        }
+    }
+};
+
+const bool registered = for_all_types<add_level2>();
+
+} // anonymous namespace
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+template <typename T, api A, dispatch D>
+void bm_gemm(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1), k = state.range(2);
+    operand<T> a(A, m * k), b(A, k * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * n * k), bytes<T>(double(m) * k + k * n + 2.0 * m * n),
+        [&] {
+            BENCH_CALL(D, blas::gemm, (queue, transpose::nontrans, transpose::nontrans, m, n, k,
+                                       alpha, mem<A>(a), m, mem<A>(b), k, beta, mem<A>(c), m));
+        });
+}
+
+template <typename T, api A, dispatch D>
+void bm_hemm(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * m), b(A, m * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * m * n), bytes<T>(m * (m + 1) / 2.0 + 3.0 * m * n), [&] {
+        BENCH_CALL(D, blas::hemm, (queue, side::left, uplo::upper, m, n, alpha, mem<A>(a), m,
+                                   mem<A>(b), m, beta, mem<A>(c), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_herk(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    operand<T> a(A, n * k), c(A, n * n);
+    auto &queue = cpu_queue();
+    const real_t<T> alpha = 0.5, beta = 0.5;
+    run(state, fma_flops<T>(n * (n + 1) / 2.0 * k), bytes<T>(double(n) * k + n * (n + 1.0)), [&] {
+        BENCH_CALL(D, blas::herk, (queue, uplo::upper, transpose::nontrans, n, k, alpha,
+                                   mem<A>(a), n, beta, mem<A>(c), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_her2k(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    operand<T> a(A, n * k), b(A, n * k), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    const real_t<T> beta = 0.5;
+    run(state, fma_flops<T>(n * (n + 1.0) * k), bytes<T>(2.0 * n * k + n * (n + 1.0)), [&] {
+        BENCH_CALL(D, blas::her2k, (queue, uplo::upper, transpose::nontrans, n, k, alpha,
+                                    mem<A>(a), n, mem<A>(b), n, beta, mem<A>(c), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_symm(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * m), b(A, m * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * m * n), bytes<T>(m * (m + 1) / 2.0 + 3.0 * m * n), [&] {
+        BENCH_CALL(D, blas::symm, (queue, side::left, uplo::upper, m, n, alpha, mem<A>(a), m,
+                                   mem<A>(b), m, beta, mem<A>(c), m));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_syrk(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    operand<T> a(A, n * k), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1) / 2.0 * k), bytes<T>(double(n) * k + n * (n + 1.0)), [&] {
+        BENCH_CALL(D, blas::syrk, (queue, uplo::upper, transpose::nontrans, n, k, alpha,
+                                   mem<A>(a), n, beta, mem<A>(c), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_syr2k(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    operand<T> a(A, n * k), b(A, n * k), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(n * (n + 1.0) * k), bytes<T>(2.0 * n * k + n * (n + 1.0)), [&] {
+        BENCH_CALL(D, blas::syr2k, (queue, uplo::upper, transpose::nontrans, n, k, alpha,
+                                    mem<A>(a), n, mem<A>(b), n, beta, mem<A>(c), n));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_trmm(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * m), b(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run(state, fma_flops<T>(m * (m + 1) / 2.0 * n), bytes<T>(m * (m + 1) / 2.0 + 2.0 * m * n),
+        [&] {
+            BENCH_CALL(D, blas::trmm,
+                       (queue, side::left, uplo::upper, transpose::nontrans, diag::nonunit, m, n,
+                        alpha, mem<A>(a), m, mem<A>(b), m));
+        });
+}
+
+template <typename T, api A, dispatch D>
+void bm_trsm(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1);
+    operand<T> a(A, m * m, 1.0 / m), b(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(1);
+    run(state, fma_flops<T>(m * (m + 1) / 2.0 * n), bytes<T>(m * (m + 1) / 2.0 + 2.0 * m * n),
+        [&] {
+            BENCH_CALL(D, blas::trsm,
+                       (queue, side::left, uplo::upper, transpose::nontrans, diag::unit, m, n,
+                        alpha, mem<A>(a), m, mem<A>(b), m));
+        });
+}
+
+template <typename T>
+struct add_level3 {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        // Cubes, then tall, wide, K-dominant and rank-k update shapes.
+        const auto mnk = shapes({ { 64, 64, 64 },
+                                  { 256, 256, 256 },
+                                  { 1024, 1024, 1024 },
+                                  { 2048, 2048, 2048 },
+                                  { 8192, 64, 64 },
+                                  { 64, 8192, 64 },
+                                  { 64, 64, 65536 },
+                                  { 2048, 2048, 32 } },
+                                { "m", "n", "k" });
+        const auto mn = shapes({ { 64, 64 }, { 256, 256 }, { 1024, 1024 }, { 2048, 2048 },
+                                 { 2048, 64 }, { 64, 2048 } },
+                               { "m", "n" });
+        const auto nk = shapes({ { 64, 64 }, { 256, 256 }, { 1024, 1024 }, { 2048, 2048 },
+                                 { 2048, 64 }, { 64, 2048 } },
+                               { "n", "k" });
+        add("level3/gemm/" + t, BENCH_ALL(bm_gemm, T), mnk);
+        add("level3/symm/" + t, BENCH_ALL(bm_symm, T), mn);
+        add("level3/syrk/" + t, BENCH_ALL(bm_syrk, T), nk);
+        add("level3/syr2k/" + t, BENCH_ALL(bm_syr2k, T), nk);
+        add("level3/trmm/" + t, BENCH_ALL(bm_trmm, T), mn);
+        add("level3/trsm/" + t, BENCH_ALL(bm_trsm, T), mn);
+        if constexpr (is_complex<T>) {
+            add("level3/hemm/" + t, BENCH_ALL(bm_hemm, T), mn);
+            add("level3/herk/" + t, BENCH_ALL(bm_herk, T), nk);
+            add("level3/her2k/" + t, BENCH_ALL(bm_her2k, T), nk);
+        }
+    }
+};
+
+const bool registered = for_all_types<add_level3>();
+
+} // anonymous namespace
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Per-call overhead: calls on one-element problems, so that the time is that
+// of dispatch, submission and the host task. The argument is the number of
+// calls per wait: with 1 the time of an iteration is the latency of a call,
+// and with more items_per_second is the rate at which calls can be issued.
+
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+
+class bench_empty_kernel;
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::transpose;
+
+namespace {
+
+template <typename F>
+void run_calls(benchmark::State &state, F call) {
+    const std::int64_t calls = state.range(0);
+    run(state, 0, 0, [&] {
+        for (std::int64_t i = 0; i < calls; i++)
+            call();
+    });
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+
+template <typename T, api A, dispatch D>
+void bm_axpy(benchmark::State &state) {
+    operand<T> x(A, 1), y(A, 1);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    run_calls(state, [&] {
+        BENCH_CALL(D, blas::axpy, (queue, 1, alpha, mem<A>(x), 1, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gemv(benchmark::State &state) {
+    operand<T> a(A, 1), x(A, 1), y(A, 1);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run_calls(state, [&] {
+        BENCH_CALL(D, blas::gemv, (queue, transpose::nontrans, 1, 1, alpha, mem<A>(a), 1,
+                                   mem<A>(x), 1, beta, mem<A>(y), 1));
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_gemm(benchmark::State &state) {
+    operand<T> a(A, 1), b(A, 1), c(A, 1);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run_calls(state, [&] {
+        BENCH_CALL(D, blas::gemm, (queue, transpose::nontrans, transpose::nontrans, 1, 1, 1,
+                                   alpha, mem<A>(a), 1, mem<A>(b), 1, beta, mem<A>(c), 1));
+    });
+}
+
+// The floor set by the SYCL runtime: an empty kernel per call.
+void bm_empty_kernel(benchmark::State &state) {
+    auto &queue = cpu_queue();
+    run_calls(state, [&] {
+        queue.submit([&](cl::sycl::handler &cgh) { cgh.single_task<bench_empty_kernel>([] {}); });
+    });
+}
+
+template <typename T>
+struct add_overhead {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        const auto calls = shapes({ { 1 }, { 64 } }, { "calls" });
+        add("overhead/axpy/" + t, BENCH_ALL(bm_axpy, T), calls);
+        add("overhead/gemv/" + t, BENCH_ALL(bm_gemv, T), calls);
+        add("overhead/gemm/" + t, BENCH_ALL(bm_gemm, T), calls);
+    }
+};
+
+bool add_all() {
+    benchmark::RegisterBenchmark("overhead/empty_kernel", bm_empty_kernel)
+        ->UseRealTime()
+        ->ArgName("calls")
+        ->Arg(1)
+        ->Arg(64);
+    return for_real_types<add_overhead>();
+}
+
+const bool registered = add_all();
+
+} // anonymous namespace
@@ -0,0 +1,575 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Performance regression harness: times BLAS routines on the CPU through
+// oneMKL and through the reference CBLAS the functional tests check against
+// (reference_blas_templates.hpp), and compares the oneMKL times with those of
+// an earlier run.
+//
+//  onemkl_blas_regression [--baseline old.json] [--threshold 0.1]
+//                         [--out new.json] [--dispatch rt|ct]
+//                         [--filter text] [--min-time seconds]
+//
+// Each case is a routine, a type and a shape, named routine/type/shape, and
+// runs on the same shared USM operands in both libraries. Its time is the
+// median of at least five runs filling --min-time, after an untimed run.
+// With --baseline, a case whose oneMKL time exceeds the baseline one by more
+// than --threshold (a fraction, 0.1 by default) is a regression, and the
+// program exits with status 1 if there is any. --out writes the results in
+// the schema below, which is also the baseline format, one result per line:
+//
+//  { "schema": "onemkl-blas-regression/1",
+//    "context": { "device": ..., "dispatch": ..., "threshold": ... },
+//    "results": [
+//      { "name": ..., "routine": ..., "type": ..., "shape": ..., "flops": ...,
+//        "onemkl_seconds": ..., "reference_seconds": ...,
+//        "baseline_seconds": ... or null, "change": ... or null,
+//        "regression": true|false },
+//      ... ] }
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "reference_blas_templates.hpp"
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+const char *schema = "onemkl-blas-regression/1";
+
+struct bench_case {
+    std::string routine, type, shape;
+    double flops;
+    // Each call runs the routine once and returns when it is complete.
+    std::function<void()> onemkl, reference;
+
+    std::string name() const {
+        return routine + "/" + type + "/" + shape;
+    }
+};
+
+struct result {
+    const bench_case *c;
+    double onemkl_seconds, reference_seconds;
+    bool has_baseline;
+    double baseline_seconds, change;
+    bool regression;
+};
+
+// count random elements of shared USM, in [-scale, scale], shared by the
+// calls of a case.
+template <typename T>
+std::shared_ptr<usm_array<T>> random_array(std::int64_t count, double scale = 1.0) {
+    auto array = std::make_shared<usm_array<T>>(count);
+    std::mt19937 generator(static_cast<std::uint32_t>(count));
+    for (std::int64_t i = 0; i < count; i++)
+        (*array)[i] = random_value<T>(generator, scale);
+    return array;
+}
+
+template <dispatch D, typename T>
+void add_level1(std::vector<bench_case> &cases, int n) {
+    using R = real_t<T>;
+    const std::string t = prefix<T>(), shape = "n=" + std::to_string(n);
+    auto x = random_array<T>(n), y = random_array<T>(n);
+    auto result = std::make_shared<usm_array<T>>(1);
+    auto real_result = std::make_shared<usm_array<R>>(1);
+    auto index = std::make_shared<usm_array<std::int64_t>>(1);
+    const T alpha = T(0.5);
+    const int one = 1;
+    auto &q = cpu_queue();
+
+    cases.push_back({ "asum", t, shape, double(n),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::asum, (q, n, x->data(), 1, real_result->data()));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::asum<T, R>(&n, x->data(), &one); } });
+    cases.push_back({ "axpy", t, shape, fma_flops<T>(n),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::axpy, (q, n, alpha, x->data(), 1, y->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::axpy(&n, &alpha, x->data(), &one, y->data(), &one); } });
+    cases.push_back({ "copy", t, shape, 0,
+                      [=, &q] {
+                          BENCH_CALL(D, blas::copy, (q, n, x->data(), 1, y->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::copy(&n, x->data(), &one, y->data(), &one); } });
+    if constexpr (is_complex<T>) {
+        cases.push_back({ "dotc", t, shape, fma_flops<T>(n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::dotc,
+                                         (q, n, x->data(), 1, y->data(), 1, result->data()));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              T dot;
+                              ::dotc(&dot, &n, x->data(), &one, y->data(), &one);
+                          } });
+    }
+    else {
+        cases.push_back({ "dot", t, shape, fma_flops<T>(n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::dot,
+                                         (q, n, x->data(), 1, y->data(), 1, result->data()));
+                              q.wait_and_throw();
+                          },
+                          [=] { ::dot<T, T>(&n, x->data(), &one, y->data(), &one); } });
+    }
+    cases.push_back({ "iamax", t, shape, 0,
+                      [=, &q] {
+                          BENCH_CALL(D, blas::iamax, (q, n, x->data(), 1, index->data()));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::iamax(&n, x->data(), &one); } });
+    cases.push_back({ "nrm2", t, shape, fma_flops<T>(n),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::nrm2, (q, n, x->data(), 1, real_result->data()));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::nrm2<T, R>(&n, x->data(), &one); } });
+    cases.push_back({ "scal", t, shape, fma_flops<T>(n) / 2,
+                      [=, &q] {
+                          BENCH_CALL(D, blas::scal, (q, n, alpha, y->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::scal(&n, &alpha, y->data(), &one); } });
+    cases.push_back({ "swap", t, shape, 0,
+                      [=, &q] {
+                          BENCH_CALL(D, blas::swap, (q, n, x->data(), 1, y->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] { ::swap(&n, x->data(), &one, y->data(), &one); } });
+}
+
+template <dispatch D, typename T>
+void add_level2(std::vector<bench_case> &cases, int n) {
+    const std::string t = prefix<T>(), shape = "n=" + std::to_string(n);
+    auto a = random_array<T>(std::int64_t(n) * n), x = random_array<T>(n),
+         y = random_array<T>(n);
+    // The triangular solves take a scale of 1/n with a unit diagonal.
+    auto triangle = random_array<T>(std::int64_t(n) * n, 1.0 / n);
+    const T alpha = T(0.5), beta = T(0.5);
+    const int one = 1;
+    auto &q = cpu_queue();
+
+    cases.push_back({ "gemv", t, shape, fma_flops<T>(double(n) * n),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::gemv, (q, transpose::nontrans, n, n, alpha,
+                                                     a->data(), n, x->data(), 1, beta,
+                                                     y->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::gemv(CblasNoTrans, &n, &n, &alpha, a->data(), &n, x->data(), &one,
+                                 &beta, y->data(), &one);
+                      } });
+    if constexpr (is_complex<T>) {
+        cases.push_back({ "gerc", t, shape, fma_flops<T>(double(n) * n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::gerc, (q, n, n, alpha, x->data(), 1, y->data(),
+                                                         1, a->data(), n));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::gerc(&n, &n, &alpha, x->data(), &one, y->data(), &one, a->data(),
+                                     &n);
+                          } });
+        cases.push_back({ "hemv", t, shape, fma_flops<T>(double(n) * n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::hemv, (q, uplo::upper, n, alpha, a->data(), n,
+                                                         x->data(), 1, beta, y->data(), 1));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::hemv(CblasUpper, &n, &alpha, a->data(), &n, x->data(), &one,
+                                     &beta, y->data(), &one);
+                          } });
+    }
+    else {
+        cases.push_back({ "ger", t, shape, fma_flops<T>(double(n) * n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::ger, (q, n, n, alpha, x->data(), 1, y->data(),
+                                                        1, a->data(), n));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::ger(&n, &n, &alpha, x->data(), &one, y->data(), &one, a->data(),
+                                    &n);
+                          } });
+        cases.push_back({ "symv", t, shape, fma_flops<T>(double(n) * n),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::symv, (q, uplo::upper, n, alpha, a->data(), n,
+                                                         x->data(), 1, beta, y->data(), 1));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::symv(CblasUpper, &n, &alpha, a->data(), &n, x->data(), &one,
+                                     &beta, y->data(), &one);
+                          } });
+    }
+    cases.push_back({ "trmv", t, shape, fma_flops<T>(n * (n + 1) / 2.0),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::trmv, (q, uplo::upper, transpose::nontrans,
+                                                     diag::unit, n, triangle->data(), n,
+                                                     x->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::trmv(CblasUpper, CblasNoTrans, CblasUnit, &n, triangle->data(), &n,
+                                 x->data(), &one);
+                      } });
+    cases.push_back({ "trsv", t, shape, fma_flops<T>(n * (n + 1) / 2.0),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::trsv, (q, uplo::upper, transpose::nontrans,
+                                                     diag::unit, n, triangle->data(), n,
+                                                     x->data(), 1));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::trsv(CblasUpper, CblasNoTrans, CblasUnit, &n, triangle->data(), &n,
+                                 x->data(), &one);
+                      } });
+}
+
+template <dispatch D, typename T>
+void add_level3(std::vector<bench_case> &cases, int n) {
+    using R = real_t<T>;
+    const std::string t = prefix<T>(), shape = "n=" + std::to_string(n);
+    const std::int64_t size = std::int64_t(n) * n;
+    auto a = random_array<T>(size), b = random_array<T>(size), c = random_array<T>(size);
+    auto triangle = random_array<T>(size, 1.0 / n);
+    const T alpha = T(0.5), beta = T(0.5), unit = T(1);
+    const R real_alpha = 0.5, real_beta = 0.5;
+    auto &q = cpu_queue();
+    const double cube = double(n) * n * n;
+
+    cases.push_back({ "gemm", t, shape, fma_flops<T>(cube),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::gemm, (q, transpose::nontrans, transpose::nontrans,
+                                                     n, n, n, alpha, a->data(), n, b->data(), n,
+                                                     beta, c->data(), n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::gemm(CblasNoTrans, CblasNoTrans, &n, &n, &n, &alpha, a->data(), &n,
+                                 b->data(), &n, &beta, c->data(), &n);
+                      } });
+    cases.push_back({ "symm", t, shape, fma_flops<T>(cube),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::symm, (q, side::left, uplo::upper, n, n, alpha,
+                                                     a->data(), n, b->data(), n, beta, c->data(),
+                                                     n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::symm(CblasLeft, CblasUpper, &n, &n, &alpha, a->data(), &n, b->data(),
+                                 &n, &beta, c->data(), &n);
+                      } });
+    cases.push_back({ "syrk", t, shape, fma_flops<T>(cube / 2),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::syrk, (q, uplo::upper, transpose::nontrans, n, n,
+                                                     alpha, a->data(), n, beta, c->data(), n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::syrk(CblasUpper, CblasNoTrans, &n, &n, &alpha, a->data(), &n, &beta,
+                                 c->data(), &n);
+                      } });
+    cases.push_back({ "syr2k", t, shape, fma_flops<T>(cube),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::syr2k, (q, uplo::upper, transpose::nontrans, n, n,
+                                                      alpha, a->data(), n, b->data(), n, beta,
+                                                      c->data(), n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::syr2k(CblasUpper, CblasNoTrans, &n, &n, &alpha, a->data(), &n,
+                                  b->data(), &n, &beta, c->data(), &n);
+                      } });
+    cases.push_back({ "trmm", t, shape, fma_flops<T>(cube / 2),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::trmm, (q, side::left, uplo::upper,
+                                                     transpose::nontrans, diag::unit, n, n, unit,
+                                                     triangle->data(), n, b->data(), n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::trmm(CblasLeft, CblasUpper, CblasNoTrans, CblasUnit, &n, &n, &unit,
+                                 triangle->data(), &n, b->data(), &n);
+                      } });
+    cases.push_back({ "trsm", t, shape, fma_flops<T>(cube / 2),
+                      [=, &q] {
+                          BENCH_CALL(D, blas::trsm, (q, side::left, uplo::upper,
+                                                     transpose::nontrans, diag::unit, n, n, unit,
+                                                     triangle->data(), n, b->data(), n));
+                          q.wait_and_throw();
+                      },
+                      [=] {
+                          ::trsm(CblasLeft, CblasUpper, CblasNoTrans, CblasUnit, &n, &n, &unit,
+                                 triangle->data(), &n, b->data(), &n);
+                      } });
+    if constexpr (is_complex<T>) {
+        cases.push_back({ "hemm", t, shape, fma_flops<T>(cube),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::hemm, (q, side::left, uplo::upper, n, n, alpha,
+                                                         a->data(), n, b->data(), n, beta,
+                                                         c->data(), n));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::hemm(CblasLeft, CblasUpper, &n, &n, &alpha, a->data(), &n,
+                                     b->data(), &n, &beta, c->data(), &n);
+                          } });
+        cases.push_back({ "herk", t, shape, fma_flops<T>(cube / 2),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::herk, (q, uplo::upper, transpose::nontrans, n,
+                                                         n, real_alpha, a->data(), n, real_beta,
+                                                         c->data(), n));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::herk(CblasUpper, CblasNoTrans, &n, &n, &real_alpha, a->data(),
+                                     &n, &real_beta, c->data(), &n);
+                          } });
+        cases.push_back({ "her2k", t, shape, fma_flops<T>(cube),
+                          [=, &q] {
+                              BENCH_CALL(D, blas::her2k, (q, uplo::upper, transpose::nontrans, n,
+                                                          n, alpha, a->data(), n, b->data(), n,
+                                                          real_beta, c->data(), n));
+                              q.wait_and_throw();
+                          },
+                          [=] {
+                              ::her2k(CblasUpper, CblasNoTrans, &n, &n, &alpha, a->data(), &n,
+                                      b->data(), &n, &real_beta, c->data(), &n);
+                          } });
+    }
+}
+
+template <dispatch D, typename T>
+void add_cases(std::vector<bench_case> &cases) {
+    add_level1<D, T>(cases, 1 << 20);
+    add_level2<D, T>(cases, 2048);
+    add_level3<D, T>(cases, 64);
+    add_level3<D, T>(cases, 512);
+}
+
+template <dispatch D>
+std::vector<bench_case> make_cases() {
+    std::vector<bench_case> cases;
+    add_cases<D, float>(cases);
+    add_cases<D, double>(cases);
+    add_cases<D, std::complex<float>>(cases);
+    add_cases<D, std::complex<double>>(cases);
+    return cases;
+}
+
+// Median time of call in seconds, over at least five runs filling about
+// min_time seconds, after an untimed run.
+double median_time(const std::function<void()> &call, double min_time) {
+    using clock = std::chrono::steady_clock;
+    call();
+    std::vector<double> times;
+    double total = 0.0;
+    while (times.size() < 5 || (total < min_time && times.size() < 10000)) {
+        const auto start = clock::now();
+        call();
+        times.push_back(std::chrono::duration<double>(clock::now() - start).count());
+        total += times.back();
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// Reads the oneMKL times of a results file, keyed by case name. Results are
+// found one per line, as write_results puts them.
+std::map<std::string, double> read_baseline(const std::string &path) {
+    std::ifstream in(path);
+    if (!in)
+        throw std::runtime_error("cannot read baseline " + path);
+    std::map<std::string, double> baseline;
+    std::string line;
+    bool schema_found = false;
+    const std::string name_key = "\"name\": \"", seconds_key = "\"onemkl_seconds\": ";
+    while (std::getline(in, line)) {
+        if (line.find(schema) != std::string::npos)
+            schema_found = true;
+        const auto name = line.find(name_key), seconds = line.find(seconds_key);
+        if (name == std::string::npos || seconds == std::string::npos)
+            continue;
+        const auto begin = name + name_key.size(), end = line.find('"', begin);
+        baseline[line.substr(begin, end - begin)] =
+            std::atof(line.c_str() + seconds + seconds_key.size());
+    }
+    if (!schema_found)
+        throw std::runtime_error(path + " is not a " + schema + " results file");
+    return baseline;
+}
+
+void write_results(const std::string &path, const std::string &device_name, dispatch mode,
+                   double threshold, const std::vector<result> &results) {
+    std::ofstream out(path);
+    out << std::setprecision(9);
+    out << "{ \"schema\": \"" << schema << "\",\n"
+        << "  \"context\": { \"device\": \"" << device_name << "\", \"hardware_threads\": "
+        << std::thread::hardware_concurrency() << ", \"dispatch\": \""
+        << (mode == dispatch::run_time ? "rt" : "ct") << "\", \"threshold\": " << threshold
+        << " },\n  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const result &r = results[i];
+        out << (i ? ",\n" : "\n") << "    { \"name\": \"" << r.c->name() << "\", \"routine\": \""
+            << r.c->routine << "\", \"type\": \"" << r.c->type << "\", \"shape\": \""
+            << r.c->shape << "\", \"flops\": " << r.c->flops
+            << ", \"onemkl_seconds\": " << r.onemkl_seconds
+            << ", \"reference_seconds\": " << r.reference_seconds << ", \"baseline_seconds\": ";
+        if (r.has_baseline)
+            out << r.baseline_seconds << ", \"change\": " << r.change;
+        else
+            out << "null, \"change\": null";
+        out << ", \"regression\": " << (r.regression ? "true" : "false") << " }";
+    }
+    out << "\n  ] }\n";
+    if (!out)
+        throw std::runtime_error("cannot write " + path);
+}
+
+int usage() {
+    std::cerr << "usage: onemkl_blas_regression [--baseline old.json] [--threshold 0.1]\n"
+                 "                              [--out new.json] [--dispatch rt|ct]\n"
+                 "                              [--filter text] [--min-time seconds]"
+              << std::endl;
+    return 2;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+    std::string baseline_path, out_path, filter;
+    double threshold = 0.1, min_time = 0.2;
+#ifdef CALL_RT_API
+    dispatch mode = dispatch::run_time;
+#else
+    dispatch mode = dispatch::compile_time;
+#endif
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string arg = argv[i], value = argv[i + 1];
+        if (arg == "--baseline")
+            baseline_path = value;
+        else if (arg == "--out")
+            out_path = value;
+        else if (arg == "--filter")
+            filter = value;
+        else if (arg == "--threshold")
+            threshold = std::atof(value.c_str());
+        else if (arg == "--min-time")
+            min_time = std::atof(value.c_str());
+#ifdef CALL_RT_API
+        else if (arg == "--dispatch" && (value == "rt" || value == "ct"))
+            mode = (value == "rt") ? dispatch::run_time : dispatch::compile_time;
+#else
+        else if (arg == "--dispatch" && value == "ct")
+            mode = dispatch::compile_time;
+#endif
+        else
+            return usage();
+    }
+    if (argc % 2 == 0 || threshold <= 0 || min_time < 0)
+        return usage();
+
+    if (cblas_library() == NULL) {
+        std::cerr << "onemkl_blas_regression: cannot load the reference BLAS library"
+                  << std::endl;
+        return 1;
+    }
+
+    bool regressed = false;
+    try {
+        const std::string device_name =
+            cpu_queue().get_device().get_info<cl::sycl::info::device::name>();
+        std::map<std::string, double> baseline;
+        if (!baseline_path.empty())
+            baseline = read_baseline(baseline_path);
+
+#ifdef CALL_RT_API
+        auto cases = (mode == dispatch::run_time) ? make_cases<dispatch::run_time>()
+                                                  : make_cases<dispatch::compile_time>();
+#else
+        auto cases = make_cases<dispatch::compile_time>();
+#endif
+
+        std::cout << "device: " << device_name << std::endl;
+        std::cout << std::left << std::setw(22) << "case" << std::right << std::setw(13)
+                  << "onemkl_us" << std::setw(14) << "reference_us" << std::setw(9) << "speedup"
+                  << std::setw(13) << "baseline_us" << std::setw(9) << "change" << std::endl;
+        std::vector<result> results;
+        for (auto &c : cases) {
+            if (c.name().find(filter) == std::string::npos)
+                continue;
+            result r{ &c, median_time(c.onemkl, min_time), median_time(c.reference, min_time),
+                      false, 0.0, 0.0, false };
+            auto it = baseline.find(c.name());
+            if (it != baseline.end() && it->second > 0) {
+                r.has_baseline = true;
+                r.baseline_seconds = it->second;
+                r.change = r.onemkl_seconds / r.baseline_seconds - 1.0;
+                r.regression = r.change > threshold;
+                regressed = regressed || r.regression;
+            }
+            std::cout << std::left << std::setw(22) << c.name() << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(13) << r.onemkl_seconds * 1e6
+                      << std::setw(14) << r.reference_seconds * 1e6 << std::setw(9)
+                      << std::setprecision(2) << r.reference_seconds / r.onemkl_seconds;
+            if (r.has_baseline)
+                std::cout << std::setprecision(1) << std::setw(13) << r.baseline_seconds * 1e6
+                          << std::setw(8) << r.change * 100 << "%"
+                          << (r.regression ? "  REGRESSION" : "");
+            std::cout << std::endl;
+            results.push_back(r);
+        }
+        if (!out_path.empty())
+            write_results(out_path, device_name, mode, threshold, results);
+    }
+    catch (std::exception const &e) {
+        std::cerr << "onemkl_blas_regression: " << e.what() << std::endl;
+        return 1;
+    }
+    return regressed ? 1 : 0;
+}
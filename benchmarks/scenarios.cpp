@@ -0,0 +1,767 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Scenarios: the extensions and settings of the library, each next to the
+// plain calls it replaces, on the problems they were meant for. Those of the
+// run-time library alone are registered with CALL_RT_API only.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+
+#ifdef CALL_RT_API
+#include "oneapi/mkl/blas/contraction.hpp"
+#include "oneapi/mkl/blas/in_order.hpp"
+#include "oneapi/mkl/blas/multi_queue.hpp"
+#include "oneapi/mkl/blas/out_of_core.hpp"
+#endif
+#include "oneapi/mkl/blas/expressions.hpp"
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+template <typename T>
+class bench_cg_alpha;
+template <typename T>
+class bench_cg_beta;
+
+using namespace bench;
+namespace blas = oneapi::mkl::blas;
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+namespace {
+
+// Buffer gemm with beta of 0 or 1. With beta == 0 the output is only
+// written, so C is not read; the gap is largest for small k.
+template <typename T, api A, dispatch D>
+void bm_gemm_beta(benchmark::State &state) {
+    const std::int64_t n = state.range(0), k = state.range(1);
+    const T beta = T(state.range(2));
+    operand<T> a(A, n * k), b(A, k * n), c(A, n * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5);
+    const double c_traffic = (state.range(2) == 0 ? 1.0 : 2.0) * n * n;
+    run(state, fma_flops<T>(double(n) * n * k), bytes<T>(2.0 * n * k + c_traffic), [&] {
+        BENCH_CALL(D, blas::gemm, (queue, transpose::nontrans, transpose::nontrans, n, n, k,
+                                   alpha, mem<A>(a), n, mem<A>(b), k, beta, mem<A>(c), n));
+    });
+}
+
+// gemm on size classes and K-dominant shapes, whose thread counts and
+// split-K thresholds the mklcpu tuning file and ONEMKL_CPU_GEMM_SPLIT_K_*
+// change. The backend reads those once, so they are compared across runs.
+template <typename T, api A, dispatch D>
+void bm_gemm_settings(benchmark::State &state) {
+    const std::int64_t m = state.range(0), n = state.range(1), k = state.range(2);
+    operand<T> a(A, m * k), b(A, k * n), c(A, m * n);
+    auto &queue = cpu_queue();
+    const T alpha = T(0.5), beta = T(0.5);
+    run(state, fma_flops<T>(double(m) * n * k), bytes<T>(double(m) * k + k * n + 2.0 * m * n),
+        [&] {
+            BENCH_CALL(D, blas::gemm, (queue, transpose::nontrans, transpose::nontrans, m, n, k,
+                                       alpha, mem<A>(a), m, mem<A>(b), k, beta, mem<A>(c), m));
+        });
+}
+
+// A network of layers h_l = W_l*h_(l-1) + B_l on n-by-n matrices, as calls
+// chained by events or as replays of a graph recorded once.
+template <typename T, api A, dispatch D>
+void bm_layers_eager(benchmark::State &state) {
+    const std::int64_t n = state.range(0), layers = state.range(1), nn = n * n;
+    operand<T> w(api::usm, layers * nn, 1.0 / n), bias(api::usm, layers * nn),
+        h(api::usm, (layers + 1) * nn);
+    auto &queue = cpu_queue();
+    run(state, layers * (fma_flops<T>(double(nn) * n) + nn), 0, [&] {
+        cl::sycl::event done;
+        for (std::int64_t l = 0; l < layers; l++) {
+            BENCH_CALL(D, done = blas::gemm,
+                       (queue, transpose::nontrans, transpose::nontrans, n, n, n, T(1),
+                        w.usm() + l * nn, n, h.usm() + l * nn, n, T(0), h.usm() + (l + 1) * nn,
+                        n, { done }));
+            BENCH_CALL(D, done = blas::axpy, (queue, nn, T(1), bias.usm() + l * nn, 1,
+                                              h.usm() + (l + 1) * nn, 1, { done }));
+        }
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_layers_graph(benchmark::State &state) {
+    const std::int64_t n = state.range(0), layers = state.range(1), nn = n * n;
+    operand<T> w(api::usm, layers * nn, 1.0 / n), bias(api::usm, layers * nn),
+        h(api::usm, (layers + 1) * nn);
+    blas::graph<T> g;
+    for (std::int64_t l = 0; l < layers; l++) {
+        g.gemm(transpose::nontrans, transpose::nontrans, n, n, n, T(1), w.usm() + l * nn, n,
+               h.usm() + l * nn, n, T(0), h.usm() + (l + 1) * nn, n);
+        g.axpy(nn, T(1), bias.usm() + l * nn, 1, h.usm() + (l + 1) * nn, 1);
+    }
+    auto &queue = cpu_queue();
+    run(state, layers * (fma_flops<T>(double(nn) * n) + nn), 0,
+        [&] { BENCH_CALL(D, blas::replay, (queue, g)); });
+}
+
+// Conjugate gradient iterations on a dense symmetric positive definite
+// matrix, ten per benchmark iteration, restarted from x = 0 each time: with
+// the scalars read back on the host after each dot, kept in USM for the
+// device-scalar overloads so that nothing waits within the iterations, or
+// with the vector updates fused by expressions. Bytes count the traffic of
+// the calls, n^2 + 17n elements per iteration unfused and n^2 + 15n fused.
+constexpr std::int64_t cg_iterations = 10;
+
+template <typename T>
+struct cg_problem {
+    explicit cg_problem(std::int64_t n)
+            : n(n),
+              a(api::usm, n * n, 1.0 / n),
+              b(api::usm, n),
+              x(api::usm, n),
+              r(api::usm, n),
+              p(api::usm, n),
+              q(api::usm, n),
+              s(8) {
+        T *m = a.usm();
+        for (std::int64_t j = 0; j < n; j++) {
+            for (std::int64_t i = j + 1; i < n; i++)
+                m[j + i * n] = m[i + j * n];
+            m[j + j * n] = T(2);
+        }
+    }
+
+    // x = 0 and r = p = b, with s[0] = r.r.
+    void restart() {
+        for (std::int64_t i = 0; i < n; i++) {
+            x.usm()[i] = T(0);
+            r.usm()[i] = p.usm()[i] = b.usm()[i];
+        }
+        s[0] = T(0);
+        for (std::int64_t i = 0; i < n; i++)
+            s[0] += b.usm()[i] * b.usm()[i];
+    }
+
+    double bytes(double vectors) const {
+        return bench::bytes<T>(cg_iterations * (double(n) * n + vectors * n));
+    }
+
+    std::int64_t n;
+    operand<T> a, b, x, r, p, q;
+    usm_array<T> s;
+};
+
+template <typename T, api A, dispatch D>
+void bm_cg_host_scalars(benchmark::State &state) {
+    cg_problem<T> cg(state.range(0));
+    const std::int64_t n = cg.n;
+    T *x = cg.x.usm(), *r = cg.r.usm(), *p = cg.p.usm(), *q = cg.q.usm(), *s = cg.s.data();
+    auto &queue = cpu_queue();
+    run(state, cg_iterations * fma_flops<T>(double(n) * n + 5.0 * n), cg.bytes(17), [&] {
+        cg.restart();
+        cl::sycl::event done;
+        for (std::int64_t it = 0; it < cg_iterations; it++) {
+            BENCH_CALL(D, done = blas::gemv, (queue, transpose::nontrans, n, n, T(1), cg.a.usm(),
+                                              n, p, 1, T(0), q, 1, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, p, 1, q, 1, s + 1, { done }));
+            done.wait_and_throw();
+            const T alpha = s[0] / s[1];
+            BENCH_CALL(D, done = blas::axpy, (queue, n, alpha, p, 1, x, 1));
+            BENCH_CALL(D, done = blas::axpy, (queue, n, -alpha, q, 1, r, 1, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, r, 1, r, 1, s + 2, { done }));
+            done.wait_and_throw();
+            const T beta = s[2] / s[0];
+            s[0] = s[2];
+            BENCH_CALL(D, done = blas::scal, (queue, n, beta, p, 1));
+            BENCH_CALL(D, done = blas::axpy, (queue, n, T(1), r, 1, p, 1, { done }));
+        }
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_cg_device_scalars(benchmark::State &state) {
+    cg_problem<T> cg(state.range(0));
+    const std::int64_t n = cg.n;
+    T *x = cg.x.usm(), *r = cg.r.usm(), *p = cg.p.usm(), *q = cg.q.usm(), *s = cg.s.data();
+    // s holds r.r, p.q, the new r.r, alpha, -alpha, beta, 1 and 0.
+    s[6] = T(1);
+    s[7] = T(0);
+    auto &queue = cpu_queue();
+    run(state, cg_iterations * fma_flops<T>(double(n) * n + 5.0 * n), cg.bytes(17), [&] {
+        cg.restart();
+        cl::sycl::event done;
+        for (std::int64_t it = 0; it < cg_iterations; it++) {
+            BENCH_CALL(D, done = blas::gemv, (queue, transpose::nontrans, n, n, s + 6,
+                                              cg.a.usm(), n, p, 1, s + 7, q, 1, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, p, 1, q, 1, s + 1, { done }));
+            done = queue.submit([&](cl::sycl::handler &cgh) {
+                cgh.depends_on(done);
+                cgh.single_task<bench_cg_alpha<T>>([=]() {
+                    s[3] = s[0] / s[1];
+                    s[4] = -s[3];
+                });
+            });
+            BENCH_CALL(D, done = blas::axpy, (queue, n, s + 3, p, 1, x, 1, { done }));
+            BENCH_CALL(D, done = blas::axpy, (queue, n, s + 4, q, 1, r, 1, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, r, 1, r, 1, s + 2, { done }));
+            done = queue.submit([&](cl::sycl::handler &cgh) {
+                cgh.depends_on(done);
+                cgh.single_task<bench_cg_beta<T>>([=]() {
+                    s[5] = s[2] / s[0];
+                    s[0] = s[2];
+                });
+            });
+            BENCH_CALL(D, done = blas::scal, (queue, n, s + 5, p, 1, { done }));
+            BENCH_CALL(D, done = blas::axpy, (queue, n, T(1), r, 1, p, 1, { done }));
+        }
+    });
+}
+
+template <typename T, api A, dispatch D>
+void bm_cg_expressions(benchmark::State &state) {
+    namespace expr = blas::expr;
+    cg_problem<T> cg(state.range(0));
+    const std::int64_t n = cg.n;
+    T *s = cg.s.data();
+    expr::matrix_view<T> a(cg.a.usm(), n, n, n);
+    expr::vector_view<T> x(cg.x.usm(), n), r(cg.r.usm(), n), p(cg.p.usm(), n),
+        q(cg.q.usm(), n);
+    auto &queue = cpu_queue();
+    run(state, cg_iterations * fma_flops<T>(double(n) * n + 5.0 * n), cg.bytes(15), [&] {
+        cg.restart();
+        cl::sycl::event done;
+        for (std::int64_t it = 0; it < cg_iterations; it++) {
+            BENCH_CALL(D, done = expr::evaluate, (queue, q, a * p, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, p.data, 1, q.data, 1, s + 1, { done }));
+            done.wait_and_throw();
+            const T alpha = s[0] / s[1];
+            BENCH_CALL(D, done = expr::evaluate, (queue, x, x + alpha * p));
+            BENCH_CALL(D, done = expr::evaluate, (queue, r, r - alpha * q, { done }));
+            BENCH_CALL(D, done = blas::dot, (queue, n, r.data, 1, r.data, 1, s + 2, { done }));
+            done.wait_and_throw();
+            const T beta = s[2] / s[0];
+            s[0] = s[2];
+            BENCH_CALL(D, done = expr::evaluate, (queue, p, r + beta * p, { done }));
+        }
+    });
+}
+
+// Blocked LU without pivoting of a diagonally dominant n-by-n matrix stored
+// as nb-by-nb tiles, each contiguous: at each step the diagonal tile is
+// factored on the host, trsm forms the tiles of L below it and of U to its
+// right, and gemm updates the trailing tiles. The offset variant passes the
+// whole matrix with the element offset of each tile, the sub-buffer variant
+// one sub-buffer per tile, created at each factorization, which also lets
+// the host wait for the diagonal tile alone rather than for the whole
+// matrix. Tiles rather than column-major panels are used because the blocks
+// of a column-major matrix overlap as element ranges, and overlapping
+// sub-buffers must not be accessed by one call.
+template <typename T, bool offsets, dispatch D>
+void bm_lu(benchmark::State &state) {
+    const std::int64_t n = state.range(0), nb = state.range(1), nt = n / nb, size = nb * nb;
+    std::vector<T> initial(n * n), work(n * n);
+    std::mt19937 generator(static_cast<std::uint32_t>(n));
+    for (auto &v : initial)
+        v = random_value<T>(generator, 1.0);
+    for (std::int64_t i = 0; i < n; i++)
+        initial[(i / nb) * (nt + 1) * size + (i % nb) * (nb + 1)] += T(n);
+    cl::sycl::buffer<T, 1> matrix(work.data(), cl::sycl::range<1>(n * n));
+    auto &queue = cpu_queue();
+    auto tile = [=](std::int64_t i, std::int64_t j) { return (i + j * nt) * size; };
+
+    auto factor = [&] {
+        std::vector<cl::sycl::buffer<T, 1>> tiles;
+        if (!offsets) {
+            for (std::int64_t t = 0; t < nt * nt; t++)
+                tiles.emplace_back(matrix, cl::sycl::id<1>(t * size), cl::sycl::range<1>(size));
+        }
+        auto sub = [&](std::int64_t i, std::int64_t j) -> cl::sycl::buffer<T, 1> & {
+            return tiles[i + j * nt];
+        };
+        for (std::int64_t k = 0; k < nt; k++) {
+            {
+                auto &diagonal = offsets ? matrix : sub(k, k);
+                auto m = diagonal.template get_access<cl::sycl::access::mode::read_write>();
+                const std::int64_t base = offsets ? tile(k, k) : 0;
+                for (std::int64_t j = 0; j < nb; j++) {
+                    for (std::int64_t i = j + 1; i < nb; i++) {
+                        m[base + i + j * nb] /= m[base + j + j * nb];
+                        for (std::int64_t l = j + 1; l < nb; l++)
+                            m[base + i + l * nb] -= m[base + i + j * nb] * m[base + j + l * nb];
+                    }
+                }
+            }
+            for (std::int64_t i = k + 1; i < nt; i++) {
+                if (offsets) {
+                    BENCH_CALL(D, blas::trsm,
+                               (queue, side::right, uplo::upper, transpose::nontrans,
+                                diag::nonunit, nb, nb, T(1), matrix, tile(k, k), nb, matrix,
+                                tile(i, k), nb));
+                    BENCH_CALL(D, blas::trsm,
+                               (queue, side::left, uplo::lower, transpose::nontrans, diag::unit,
+                                nb, nb, T(1), matrix, tile(k, k), nb, matrix, tile(k, i), nb));
+                }
+                else {
+                    BENCH_CALL(D, blas::trsm,
+                               (queue, side::right, uplo::upper, transpose::nontrans,
+                                diag::nonunit, nb, nb, T(1), sub(k, k), nb, sub(i, k), nb));
+                    BENCH_CALL(D, blas::trsm,
+                               (queue, side::left, uplo::lower, transpose::nontrans, diag::unit,
+                                nb, nb, T(1), sub(k, k), nb, sub(k, i), nb));
+                }
+            }
+            for (std::int64_t j = k + 1; j < nt; j++) {
+                for (std::int64_t i = k + 1; i < nt; i++) {
+                    if (offsets)
+                        BENCH_CALL(D, blas::gemm,
+                                   (queue, transpose::nontrans, transpose::nontrans, nb, nb, nb,
+                                    T(-1), matrix, tile(i, k), nb, matrix, tile(k, j), nb, T(1),
+                                    matrix, tile(i, j), nb));
+                    else
+                        BENCH_CALL(D, blas::gemm,
+                                   (queue, transpose::nontrans, transpose::nontrans, nb, nb, nb,
+                                    T(-1), sub(i, k), nb, sub(k, j), nb, T(1), sub(i, j), nb));
+                }
+            }
+        }
+        queue.wait_and_throw();
+    };
+    auto reset = [&] {
+        auto m = matrix.template get_access<cl::sycl::access::mode::discard_write>();
+        for (std::int64_t i = 0; i < n * n; i++)
+            m[i] = initial[i];
+    };
+
+    try {
+        reset();
+        factor();
+    }
+    catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        reset();
+        state.ResumeTiming();
+        factor();
+    }
+    set_rates(state, fma_flops<T>(double(n) * n * n / 3.0), 0);
+}
+
+// axpy and dot on vectors of more than 2^31 elements, which the LP64 build
+// splits into several MKL calls. They need 16 GB or more, so they are only
+// registered when ONEMKL_BENCH_LARGE is set.
+template <typename T, api A, dispatch D>
+void bm_large_axpy(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    auto &queue = cpu_queue();
+    run(state, 2.0 * n, bytes<T>(3.0 * n),
+        [&] { BENCH_CALL(D, blas::axpy, (queue, n, T(0.5), mem<A>(x), 1, mem<A>(y), 1)); });
+}
+
+template <typename T, api A, dispatch D>
+void bm_large_dot(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(A, n), y(A, n);
+    usm_array<T> result(1);
+    auto &queue = cpu_queue();
+    run(state, 2.0 * n, bytes<T>(2.0 * n), [&] {
+        BENCH_CALL(D, blas::dot, (queue, n, mem<A>(x), 1, mem<A>(y), 1, result.data()));
+    });
+}
+
+#ifdef CALL_RT_API
+
+// Strassen-Winograd recursion against the backend gemm, cutoff 0 standing
+// for the latter. GFLOPS count the 2n^3 flops of the standard product.
+template <typename T>
+void bm_strassen(benchmark::State &state) {
+    const std::int64_t n = state.range(0), cutoff = state.range(1);
+    operand<T> a(api::usm, n * n), b(api::usm, n * n), c(api::usm, n * n);
+    auto &queue = cpu_queue();
+    if (cutoff > 0)
+        blas::set_gemm_algorithm(queue, oneapi::mkl::gemm_algorithm::strassen, cutoff);
+    run(state, fma_flops<T>(double(n) * n * n), 0, [&] {
+        blas::gemm(queue, transpose::nontrans, transpose::nontrans, n, n, n, T(0.5), a.usm(), n,
+                   b.usm(), n, T(0.5), c.usm(), n);
+    });
+    blas::set_gemm_algorithm(queue, oneapi::mkl::gemm_algorithm::standard);
+}
+
+// Small USM gemm calls from several threads, each waiting for its own, with
+// coalescing into batches of up to 16 on or off.
+void set_coalescing(const benchmark::State &state) {
+    blas::set_gemm_coalescing(state.range(1) ? 16 : 0);
+}
+
+void reset_coalescing(const benchmark::State &) {
+    blas::set_gemm_coalescing(0);
+}
+
+template <typename T>
+void bm_coalescing(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> a(api::usm, n * n), b(api::usm, n * n), c(api::usm, n * n);
+    auto &queue = cpu_queue();
+    auto call = [&] {
+        blas::gemm(queue, transpose::nontrans, transpose::nontrans, n, n, n, T(0.5), a.usm(), n,
+                   b.usm(), n, T(0.5), c.usm(), n)
+            .wait_and_throw();
+    };
+    try {
+        call();
+    }
+    catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    for (auto _ : state)
+        call();
+    state.SetItemsProcessed(state.iterations());
+    set_rates(state, fma_flops<T>(double(n) * n * n), 0);
+}
+
+// A chain of calls dependent on each other: through in_order:: on an
+// in-order queue, or with the event of each passed to the next.
+template <typename T>
+void bm_chain_in_order(benchmark::State &state) {
+    const std::int64_t n = state.range(0), calls = state.range(1);
+    operand<T> x(api::usm, n), y(api::usm, n);
+    auto &queue = in_order_cpu_queue();
+    run(state, queue, 0, 0, [&] {
+        for (std::int64_t i = 0; i < calls; i++)
+            blas::in_order::axpy(queue, n, T(0.5), x.usm(), 1, y.usm(), 1);
+    });
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+
+template <typename T>
+void bm_chain_events(benchmark::State &state) {
+    const std::int64_t n = state.range(0), calls = state.range(1);
+    operand<T> x(api::usm, n), y(api::usm, n);
+    auto &queue = cpu_queue();
+    run(state, queue, 0, 0, [&] {
+        cl::sycl::event done;
+        for (std::int64_t i = 0; i < calls; i++)
+            done = blas::axpy(queue, n, T(0.5), x.usm(), 1, y.usm(), 1, { done });
+    });
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+
+// The reductions that reproducibility modes replace, by mode: off, on and
+// strict.
+template <typename T, int routine>
+void bm_reproducible(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    operand<T> x(api::usm, n), y(api::usm, n);
+    usm_array<T> result(1);
+    auto &queue = cpu_queue();
+    blas::set_reproducibility(queue, oneapi::mkl::reproducibility(state.range(1)));
+    run(state, routine == 1 ? n : 2.0 * n, bytes<T>(routine == 0 ? 2.0 * n : n), [&] {
+        if constexpr (routine == 0)
+            blas::dot(queue, n, x.usm(), 1, y.usm(), 1, result.data());
+        else if constexpr (routine == 1)
+            blas::asum(queue, n, x.usm(), 1, result.data());
+        else
+            blas::nrm2(queue, n, x.usm(), 1, result.data());
+    });
+    blas::set_reproducibility(queue, oneapi::mkl::reproducibility::off);
+}
+
+// The cost of hardware performance counters on a call, with the records
+// taken after each.
+template <typename T>
+void bm_perf_counters(benchmark::State &state) {
+    const std::int64_t n = state.range(0);
+    const bool counters = state.range(1);
+    operand<T> x(api::usm, n), y(api::usm, n);
+    auto &queue = cpu_queue();
+    try {
+        blas::set_perf_counters(queue, counters);
+    }
+    catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    run(state, 2.0 * n, bytes<T>(3.0 * n), [&] {
+        blas::axpy(queue, n, T(0.5), x.usm(), 1, y.usm(), 1).wait_and_throw();
+        if (counters)
+            blas::get_perf_counters(queue);
+    });
+    blas::set_perf_counters(queue, false);
+}
+
+// gemm spread over the first count queues of the sub-devices of the CPU.
+// Counts above the number of sub-devices are skipped.
+cl::sycl::vector_class<cl::sycl::queue> &sub_device_queues() {
+    static auto queues = blas::make_sub_device_queues(cpu_queue().get_device());
+    return queues;
+}
+
+template <typename T>
+void bm_multi_queue(benchmark::State &state) {
+    const std::int64_t n = state.range(0), count = state.range(1);
+    auto &all = sub_device_queues();
+    if (count > static_cast<std::int64_t>(all.size())) {
+        state.SkipWithError("fewer sub-devices than queues");
+        return;
+    }
+    cl::sycl::vector_class<cl::sycl::queue> queues(all.begin(), all.begin() + count);
+    usm_array<T> a(n * n, queues[0]), b(n * n, queues[0]), c(n * n, queues[0]);
+    std::mt19937 generator(static_cast<std::uint32_t>(n));
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = random_value<T>(generator, 1.0);
+        b[i] = random_value<T>(generator, 1.0);
+        c[i] = random_value<T>(generator, 1.0);
+    }
+    run(state, queues[0], fma_flops<T>(double(n) * n * n), 0, [&] {
+        blas::gemm_multi_queue(queues, transpose::nontrans, transpose::nontrans, n, n, n, T(0.5),
+                               a.data(), n, b.data(), n, T(0.5), c.data(), n)
+            .wait_and_throw();
+    });
+}
+
+// Contractions of attention scores and of the CCSD ladder and ring terms on
+// dense tensors whose first mode is contiguous. The ring term needs a
+// permutation before its gemm.
+blas::tensor_desc dense(const std::string &modes, const std::map<char, std::int64_t> &extents) {
+    blas::tensor_desc desc{ modes, {}, {} };
+    std::int64_t stride = 1;
+    for (char mode : modes) {
+        desc.extents.push_back(extents.at(mode));
+        desc.strides.push_back(stride);
+        stride *= extents.at(mode);
+    }
+    return desc;
+}
+
+template <typename T>
+void bm_contraction(benchmark::State &state, std::string a_modes, std::string b_modes,
+                    std::string c_modes, std::map<char, std::int64_t> extents) {
+    auto a_desc = dense(a_modes, extents), b_desc = dense(b_modes, extents),
+         c_desc = dense(c_modes, extents);
+    auto count = [](const blas::tensor_desc &d) {
+        std::int64_t size = 1;
+        for (auto e : d.extents)
+            size *= e;
+        return size;
+    };
+    double products = 1;
+    for (auto &e : extents) {
+        if ((a_modes + b_modes).find(e.first) != std::string::npos)
+            products *= e.second;
+    }
+    operand<T> a(api::usm, count(a_desc)), b(api::usm, count(b_desc)), c(api::usm, count(c_desc));
+    auto &queue = cpu_queue();
+    run(state, fma_flops<T>(products),
+        bytes<T>(double(a.size()) + double(b.size()) + 2.0 * c.size()), [&] {
+            blas::contract(queue, T(1), a_desc, a.usm(), b_desc, b.usm(), T(0), c_desc, c.usm());
+        });
+}
+
+#ifdef __unix__
+
+// Out-of-core gemm on n-by-n matrices in temporary files. GB/s counts the
+// file traffic: A and B read once per tile row and column of C, which is
+// read and written once.
+std::string temporary_matrix(std::int64_t count) {
+    char path[] = "/tmp/onemkl_bench_XXXXXX";
+    const int fd = mkstemp(path);
+    if (fd < 0)
+        throw std::runtime_error("cannot create a temporary file");
+    close(fd);
+    std::mt19937 generator(static_cast<std::uint32_t>(count));
+    std::vector<double> data(count);
+    for (auto &v : data)
+        v = random_value<double>(generator, 1.0);
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(data.data()), count * sizeof(double));
+    if (!out)
+        throw std::runtime_error("cannot write a temporary file");
+    return path;
+}
+
+void bm_out_of_core(benchmark::State &state) {
+    const std::int64_t n = state.range(0), tile = state.range(1), tiles = (n + tile - 1) / tile;
+    std::vector<std::string> paths;
+    try {
+        for (int i = 0; i < 3; i++)
+            paths.push_back(temporary_matrix(n * n));
+        blas::file_matrix a{ paths[0], n, 0 }, b{ paths[1], n, 0 }, c{ paths[2], n, 0 };
+        auto &queue = cpu_queue();
+        run(state, fma_flops<double>(double(n) * n * n),
+            bytes<double>(2.0 * tiles * n * n + 2.0 * n * n), [&] {
+                blas::gemm_out_of_core(queue, transpose::nontrans, transpose::nontrans, n, n, n,
+                                       0.5, a, b, 0.5, c, tile);
+            });
+    }
+    catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+    }
+    for (auto &path : paths)
+        std::remove(path.c_str());
+}
+
+#endif
+
+#endif
+
+template <typename T>
+struct add_scenarios {
+    void operator()() const {
+        const std::string t = prefix<T>();
+        add("scenario/gemm_beta/" + t, BENCH_BUFFER(bm_gemm_beta, T),
+            shapes({ { 2048, 16, 0 }, { 2048, 16, 1 }, { 2048, 64, 0 }, { 2048, 64, 1 } },
+                   { "n", "k", "beta" }));
+        add("scenario/gemm_settings/" + t, BENCH_USM(bm_gemm_settings, T),
+            shapes({ { 16, 16, 16 },
+                     { 48, 48, 48 },
+                     { 128, 128, 128 },
+                     { 384, 384, 384 },
+                     { 1024, 1024, 1024 },
+                     { 64, 64, 16384 },
+                     { 64, 64, 131072 },
+                     { 256, 256, 65536 },
+                     { 16, 16, 1048576 } },
+                   { "m", "n", "k" }));
+
+        const auto layers = shapes({ { 16, 16 }, { 64, 16 }, { 256, 16 } }, { "n", "layers" });
+        add("scenario/layers/" + t + "/eager", BENCH_USM(bm_layers_eager, T), layers);
+        add("scenario/layers/" + t + "/graph", BENCH_USM(bm_layers_graph, T), layers);
+
+        const auto cg = lengths({ 1024, 4096 });
+        add("scenario/cg/" + t + "/host_scalars", BENCH_USM(bm_cg_host_scalars, T), cg);
+        add("scenario/cg/" + t + "/device_scalars", BENCH_USM(bm_cg_device_scalars, T), cg);
+        add("scenario/cg/" + t + "/expressions", BENCH_USM(bm_cg_expressions, T), cg);
+
+        const auto lu = shapes({ { 1024, 128 }, { 2048, 128 } }, { "n", "nb" });
+        add("scenario/lu/" + t + "/offsets",
+            { variant{ "buffer/rt", bm_lu<T, true, dispatch::run_time>, dispatch::run_time },
+              variant{ "buffer/ct", bm_lu<T, true, dispatch::compile_time>,
+                       dispatch::compile_time } },
+            lu);
+        add("scenario/lu/" + t + "/sub_buffers",
+            { variant{ "buffer/rt", bm_lu<T, false, dispatch::run_time>, dispatch::run_time },
+              variant{ "buffer/ct", bm_lu<T, false, dispatch::compile_time>,
+                       dispatch::compile_time } },
+            lu);
+
+        if (std::getenv("ONEMKL_BENCH_LARGE")) {
+            const auto large = lengths({ (std::int64_t(1) << 31) + (1 << 20) });
+            add("scenario/large/axpy/" + t, BENCH_USM(bm_large_axpy, T), large);
+            add("scenario/large/dot/" + t, BENCH_USM(bm_large_dot, T), large);
+        }
+
+#ifdef CALL_RT_API
+        benchmark::RegisterBenchmark(("scenario/strassen/" + t).c_str(), bm_strassen<T>)
+            ->UseRealTime()
+            ->ArgNames({ "n", "cutoff" })
+            ->Args({ 2048, 0 })
+            ->Args({ 2048, 512 })
+            ->Args({ 4096, 0 })
+            ->Args({ 4096, 512 })
+            ->Args({ 4096, 1024 });
+
+        auto *coalescing =
+            benchmark::RegisterBenchmark(("scenario/coalescing/" + t).c_str(), bm_coalescing<T>)
+                ->UseRealTime()
+                ->ArgNames({ "n", "on" })
+                ->Setup(set_coalescing)
+                ->Teardown(reset_coalescing)
+                ->ThreadRange(1, 8);
+        for (std::int64_t n : { 8, 16, 32, 64 })
+            coalescing->Args({ n, 0 })->Args({ n, 1 });
+
+        for (auto *chain :
+             { benchmark::RegisterBenchmark(("scenario/chain/" + t + "/in_order").c_str(),
+                                            bm_chain_in_order<T>),
+               benchmark::RegisterBenchmark(("scenario/chain/" + t + "/events").c_str(),
+                                            bm_chain_events<T>) })
+            chain->UseRealTime()->ArgNames({ "n", "calls" })->Args({ 1, 64 })->Args({ 4096, 64 });
+
+        const char *reductions[] = { "dot", "asum", "nrm2" };
+        const function reproducible[] = {
+            bm_reproducible<T, 0>, bm_reproducible<T, 1>, bm_reproducible<T, 2>
+        };
+        for (int r = 0; r < 3; r++) {
+            auto *b = benchmark::RegisterBenchmark(
+                          ("scenario/reproducibility/" + t + "/" + reductions[r]).c_str(),
+                          reproducible[r])
+                          ->UseRealTime()
+                          ->ArgNames({ "n", "mode" });
+            for (std::int64_t n : { 1 << 16, 1 << 22 })
+                b->Args({ n, 0 })->Args({ n, 1 })->Args({ n, 2 });
+        }
+
+        benchmark::RegisterBenchmark(("scenario/perf_counters/" + t).c_str(), bm_perf_counters<T>)
+            ->UseRealTime()
+            ->ArgNames({ "n", "counters" })
+            ->Args({ 1, 0 })
+            ->Args({ 1, 1 })
+            ->Args({ 1 << 16, 0 })
+            ->Args({ 1 << 16, 1 });
+
+        benchmark::RegisterBenchmark(("scenario/multi_queue/" + t).c_str(), bm_multi_queue<T>)
+            ->UseRealTime()
+            ->ArgNames({ "n", "queues" })
+            ->ArgsProduct({ { 2048, 4096 }, { 1, 2, 4, 8 } });
+
+        std::map<char, std::int64_t> attention{ { 'd', 64 }, { 'q', 512 }, { 'k', 512 },
+                                                { 'h', 8 },  { 'b', 2 } };
+        std::map<char, std::int64_t> ccsd{ { 'i', 16 }, { 'j', 16 }, { 'k', 16 }, { 'a', 48 },
+                                           { 'b', 48 }, { 'c', 48 }, { 'd', 48 } };
+        benchmark::RegisterBenchmark(("scenario/contraction/" + t + "/attention").c_str(),
+                                     bm_contraction<T>, "dqhb", "dkhb", "qkhb", attention)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("scenario/contraction/" + t + "/ccsd_ladder").c_str(),
+                                     bm_contraction<T>, "ijab", "abcd", "ijcd", ccsd)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("scenario/contraction/" + t + "/ccsd_ring").c_str(),
+                                     bm_contraction<T>, "ijab", "jkbc", "ikac", ccsd)
+            ->UseRealTime();
+#endif
+
+    }
+};
+
+bool add_all() {
+#if defined(CALL_RT_API) && defined(__unix__)
+    benchmark::RegisterBenchmark("scenario/out_of_core/d", bm_out_of_core)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond)
+        ->ArgNames({ "n", "tile" })
+        ->Args({ 2048, 512 })
+        ->Args({ 2048, 1024 });
+#endif
+    return for_real_types<add_scenarios>();
+}
+
+const bool registered = add_all();
+
+} // anonymous namespace
@@ -19,9 +19,9 @@
 
 include_guard()
 
-find_library(CBLAS_file NAMES cblas.dll.lib cblas.lib cblas HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
+find_library(CBLAS_file NAMES cblas.dll.lib cblas.lib cblas openblas blis NAMES_PER_DIR HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
 find_package_handle_standard_args(CBLAS REQUIRED_VARS CBLAS_file)
-find_library(BLAS_file NAMES blas.dll.lib blas.lib blas HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
+find_library(BLAS_file NAMES blas.dll.lib blas.lib blas openblas blis NAMES_PER_DIR HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
 find_package_handle_standard_args(CBLAS REQUIRED_VARS BLAS_file)
 
 get_filename_component(CBLAS_LIB_DIR ${CBLAS_file} DIRECTORY)
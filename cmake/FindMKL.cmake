@@ -19,7 +19,11 @@
 
 include_guard()
 set(MKL_SYCL mkl_sycl)
-set(MKL_IFACE mkl_intel_ilp64)
+if(ENABLE_MKLCPU_LP64)
+  set(MKL_IFACE mkl_intel_lp64)
+else()
+  set(MKL_IFACE mkl_intel_ilp64)
+endif()
 set(MKL_SEQ mkl_sequential)
 set(MKL_TBB mkl_tbb_thread)
 set(MKL_CORE mkl_core)
@@ -55,7 +59,7 @@ find_path(MKL_INCLUDE mkl.h
           HINTS $ENV{MKLROOT} ${MKL_ROOT}
           PATH_SUFFIXES include)
 
-if(${CMAKE_SIZEOF_VOID_P} EQUAL 8)
+if(${CMAKE_SIZEOF_VOID_P} EQUAL 8 AND NOT ENABLE_MKLCPU_LP64)
   set(MKL_COPT "-DMKL_ILP64")
 else()
   set(MKL_COPT "")
@@ -29,6 +29,8 @@
 
 #include "oneapi/mkl/detail/get_device_id.hpp"
 
+#include "oneapi/mkl/blas/graph.hpp"
+#include "oneapi/mkl/blas/perf_counters.hpp"
 #include "oneapi/mkl/blas/predicates.hpp"
 
 #include "oneapi/mkl/blas/detail/blas_loader.hpp"
@@ -110,6 +112,74 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<dou
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    detail::axpy(get_device_id(queue), queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
 static inline void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     copy_precondition(queue, n, x, incx, y, incy);
@@ -301,6 +371,113 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                        std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                        std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, float beta,
+                        cl::sycl::buffer<float, 1> &c, std::int64_t offset_c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                 offset_b, ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+                        double beta, cl::sycl::buffer<double, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                 offset_b, ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                 offset_b, ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                 offset_b, ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
 static inline void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
                               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
@@ -500,6 +677,330 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                         ldc);
 }
 
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                          std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                            std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                            std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                            std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c,
+                           std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c,
+                           std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                    c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                           batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, float alpha,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, double alpha,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                          stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
 static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
                         float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
@@ -538,6 +1039,104 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                        std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x,
+                 incx, beta, y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x,
+                 incx, beta, y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x,
+                 incx, beta, y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x,
+                 incx, beta, y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
 static inline void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -1048,6 +1647,50 @@ static inline void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+static inline void scal(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+static inline void scal(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    detail::scal(get_device_id(queue), queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
 static inline void sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb,
                           cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -1585,6 +2228,56 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                        ldb);
 }
 
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    detail::trsm(get_device_id(queue), queue, left_right, upper_lower, transa, unit_diag, m, n,
+                 alpha, a, offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    detail::trsm(get_device_id(queue), queue, left_right, upper_lower, transa, unit_diag, m, n,
+                 alpha, a, offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    detail::trsm(get_device_id(queue), queue, left_right, upper_lower, transa, unit_diag, m, n,
+                 alpha, a, offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    detail::trsm(get_device_id(queue), queue, left_right, upper_lower, transa, unit_diag, m, n,
+                 alpha, a, offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
 static inline void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                               transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
                               float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
@@ -1750,6 +2443,45 @@ static inline cl::sycl::event axpy(
     return done;
 }
 
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+    double *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = detail::axpy(get_device_id(queue), queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event axpy_batch(
     cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
     float **y, std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
@@ -2032,14 +2764,72 @@ static inline cl::sycl::event gemm(
     return done;
 }
 
-static inline cl::sycl::event gemm_batch(
-    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
-    std::int64_t *k, float *alpha, const float **a, std::int64_t *lda, const float **b,
-    std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc, std::int64_t group_count,
-    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
-    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-                            group_count, group_size, dependencies);
-    auto done =
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *alpha, const float *a, std::int64_t lda, const float *b,
+    std::int64_t ldb, const float *beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, const double *beta, double *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+    const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm_batch(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, float *alpha, const float **a, std::int64_t *lda, const float **b,
+    std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc, std::int64_t group_count,
+    std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size, dependencies);
+    auto done =
         detail::gemm_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
                            ldb, beta, c, ldc, group_count, group_size, dependencies);
     gemm_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
@@ -2216,6 +3006,421 @@ static inline cl::sycl::event gemmt(
     return done;
 }
 
+static inline cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                        dependencies);
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                        dependencies);
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+    const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
+    std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              group_count, group_size, dependencies);
+    auto done = detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                     lda, b, ldb, beta, c, ldc, group_count, group_size,
+                                     dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+    const std::complex<double> **b, std::int64_t *ldb, std::complex<double> *beta,
+    std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              group_count, group_size, dependencies);
+    auto done = detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                     lda, b, ldb, beta, c, ldc, group_count, group_size,
+                                     dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               group_count, group_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                     lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                     batch_size, dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::gemm3m_batch(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                     lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                     batch_size, dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb,
+                                 dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, double *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb,
+                                 dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb,
+                                 dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = detail::omatcopy(get_device_id(queue), queue, trans, m, n, alpha, a, lda, b, ldb,
+                                 dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb,
+                                 dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb,
+                                 dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb,
+                                 dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = detail::imatcopy(get_device_id(queue), queue, trans, m, n, alpha, ab, lda, ldb,
+                                 dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, float beta, const float *b, std::int64_t ldb,
+    float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                                beta, b, ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, double beta, const double *b, std::int64_t ldb,
+    double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                                beta, b, ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                                beta, b, ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = detail::omatadd(get_device_id(queue), queue, transa, transb, m, n, alpha, a, lda,
+                                beta, b, ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = detail::omatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda,
+                                       ldb, stride, batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda,
+                                       ldb, stride, batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda,
+                                       ldb, stride, batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = detail::imatcopy_batch(get_device_id(queue), queue, trans, m, n, alpha, ab, lda,
+                                       ldb, stride, batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float beta,
+    const float *b, std::int64_t ldb, std::int64_t stride_b, float *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a,
+                                      lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                                      batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
+    const double *b, std::int64_t ldb, std::int64_t stride_b, double *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a,
+                                      lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                                      batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a,
+                                      lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                                      batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, const std::complex<double> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = detail::omatadd_batch(get_device_id(queue), queue, transa, transb, m, n, alpha, a,
+                                      lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                                      batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event gemv(
     cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
     const float *a, std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
@@ -2264,6 +3469,55 @@ static inline cl::sycl::event gemv(
     return done;
 }
 
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, const float *alpha,
+    const float *a, std::int64_t lda, const float *x, std::int64_t incx, const float *beta,
+    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, const double *alpha,
+    const double *a, std::int64_t lda, const double *x, std::int64_t incx, const double *beta,
+    double *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+    std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+    std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = detail::gemv(get_device_id(queue), queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                             y, incy, dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event ger(
     cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha, const float *x,
     std::int64_t incx, const float *y, std::int64_t incy, float *a, std::int64_t lda,
@@ -2887,6 +4141,62 @@ static inline cl::sycl::event scal(
     return done;
 }
 
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, std::complex<float> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, std::complex<double> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = detail::scal(get_device_id(queue), queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
 static inline cl::sycl::event sdsdot(
     cl::sycl::queue &queue, std::int64_t n, float sb, const float *x, std::int64_t incx,
     const float *y, std::int64_t incy, float *result,
@@ -3597,6 +4907,87 @@ static inline cl::sycl::event trsv(
     return done;
 }
 
+// Graph APIs
+
+static inline cl::sycl::event replay(
+    cl::sycl::queue &queue, const graph<float> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    replay_precondition(queue, g, dependencies);
+    auto done = detail::replay(get_device_id(queue), queue, g, dependencies);
+    replay_postcondition(queue, g, dependencies);
+    return done;
+}
+
+static inline cl::sycl::event replay(
+    cl::sycl::queue &queue, const graph<double> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    replay_precondition(queue, g, dependencies);
+    auto done = detail::replay(get_device_id(queue), queue, g, dependencies);
+    replay_postcondition(queue, g, dependencies);
+    return done;
+}
+
+// Run-time dispatch settings
+
+// Coalesces USM gemm calls with m, n and k all at most max_size that are issued
+// on the same out-of-order queue into one gemm_batch, submitted once max_batch
+// calls are pending, window_us microseconds after the first of them, or on
+// flush_gemm_coalescing(). Calls return once their batch is submitted, at most
+// window_us later, with an event of their own; the batch depends on the events
+// passed to all of its calls. A max_batch below 2 submits the pending calls
+// and turns coalescing off.
+static inline void set_gemm_coalescing(std::int64_t max_batch, std::int64_t window_us = 100,
+                                       std::int64_t max_size = 64) {
+    detail::set_gemm_coalescing(max_batch, window_us, max_size);
+}
+
+// Submits the gemm calls held for coalescing without waiting for their window.
+// Call it, or turn coalescing off, before the program exits.
+static inline void flush_gemm_coalescing() {
+    detail::flush_gemm_coalescing();
+}
+
+// Selects the algorithm used by real gemm calls on queue. With
+// gemm_algorithm::strassen, products whose m, n and k all exceed cutoff use
+// Strassen-Winograd recursion down to cutoff on backends that implement it,
+// trading some accuracy for fewer flops; those backends throw
+// InvalidArgumentsException for a cutoff below 1. gemm_algorithm::standard
+// restores the backend gemm.
+static inline void set_gemm_algorithm(cl::sycl::queue &queue, gemm_algorithm algorithm,
+                                      std::int64_t cutoff = 2048) {
+    detail::set_gemm_algorithm(get_device_id(queue), queue, algorithm, cutoff);
+}
+
+// Makes the real dot, sdsdot, asum and nrm2 calls on queue return the same
+// result, to the bit, whatever the number of threads, using fixed-order
+// parallel reductions. With reproducibility::on this holds for data at the
+// same alignment on the same machine; reproducibility::strict also drops
+// those conditions, at a higher cost. reproducibility::off restores the
+// faster backend reductions. Backends other than mklcpu throw for modes
+// other than off.
+static inline void set_reproducibility(cl::sycl::queue &queue, reproducibility mode) {
+    detail::set_reproducibility(get_device_id(queue), queue, mode);
+}
+
+// Turns hardware performance counters on or off for the calls on queue. While
+// they are on, each task of a call runs between two readings of the cycle,
+// instruction and last-level cache miss counters, and a perf_counter_record
+// of the call is kept until get_perf_counters takes it, up to the last 65536
+// records. Counted tasks run on a single thread, so that the counters of that
+// thread cover all of their work. Setting the environment variable
+// ONEMKL_CPU_PERF_COUNTERS to a file path turns them on for every queue and
+// appends each record to that file as CSV when its task completes. Backends
+// other than mklcpu throw when enable is true.
+static inline void set_perf_counters(cl::sycl::queue &queue, bool enable) {
+    detail::set_perf_counters(get_device_id(queue), queue, enable);
+}
+
+// Returns the records of the calls on queue completed since the last call,
+// oldest first, and forgets them.
+static inline std::vector<perf_counter_record> get_perf_counters(cl::sycl::queue &queue) {
+    return detail::get_perf_counters(get_device_id(queue), queue);
+}
+
 } //namespace blas
 } //namespace mkl
 } //namespace oneapi
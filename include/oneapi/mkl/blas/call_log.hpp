@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_CALL_LOG_HPP_
+#define _ONEMKL_BLAS_CALL_LOG_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+// Starts recording every BLAS call made through run-time dispatch to the
+// file at path, replacing it. Each call is logged with its routine, backend,
+// queue, time and arguments: flags, dimensions, strides and scalars by value,
+// buffer operands by element count and USM operands by address. With
+// samples > 0, the first samples elements of each buffer operand are logged
+// as well. They are read through a host accessor, which waits for the
+// kernels writing the buffer, so every buffer call becomes synchronous while
+// sampling. Setting the environment variable ONEMKL_BLAS_RECORD to a path,
+// and optionally ONEMKL_BLAS_RECORD_SAMPLES to a sample count, starts
+// recording when the library is loaded; if the file cannot be opened, the
+// error is printed to stderr and recording stays off. Only available through
+// run-time dispatch.
+ONEMKL_EXPORT void start_call_recording(const std::string &path, std::int64_t samples = 0);
+
+// Stops recording and closes the file.
+ONEMKL_EXPORT void stop_call_recording();
+
+// The binary format of a call log, in native byte order. The file starts with
+// call_log_header, followed by one record per call: call_record_header, the
+// routine name, then each argument as its call_arg_kind and call_value_type,
+// one byte each, and a payload:
+//
+//  scalar         the value, call_value_size(type) bytes
+//  buffer         element count and number of samples, 8 bytes each, then
+//                 the samples
+//  pointer,
+//  pointer_array  the address, 8 bytes
+//  events         the number of dependencies, 8 bytes
+//  opaque         nothing
+enum class call_arg_kind : std::uint8_t {
+    scalar = 0,
+    buffer = 1,
+    pointer = 2,
+    pointer_array = 3,
+    events = 4,
+    opaque = 5
+};
+
+enum class call_value_type : std::uint8_t {
+    none = 0,
+    int8 = 1,
+    uint8 = 2,
+    int32 = 3,
+    int64 = 4,
+    real_half = 5,
+    real_float = 6,
+    real_double = 7,
+    complex_float = 8,
+    complex_double = 9,
+    transpose = 10,
+    uplo = 11,
+    diag = 12,
+    side = 13,
+    offset = 14
+};
+
+inline std::size_t call_value_size(call_value_type type) {
+    static const std::size_t sizes[] = { 0, 1, 1, 4, 8, 2, 4, 8, 8, 16, 1, 1, 1, 1, 1 };
+    return (std::size_t(type) < sizeof(sizes) / sizeof(sizes[0])) ? sizes[std::size_t(type)] : 0;
+}
+
+struct call_log_header {
+    char magic[8]; // "OMKLCALL"
+    std::uint32_t version;
+    std::uint32_t samples;
+};
+
+struct call_record_header {
+    std::uint32_t size; // of the whole record, header included
+    std::uint8_t device; // oneapi::mkl::device
+    std::uint8_t num_args;
+    std::uint16_t name_length;
+    std::uint32_t queue; // numbered in order of first use
+    std::uint64_t time_ns; // since recording started
+};
+
+constexpr std::uint32_t call_log_version = 1;
+
+// One decoded argument. The arguments of a call are those of the run-time
+// API routine, starting after the queue.
+struct call_arg {
+    call_arg_kind kind;
+    call_value_type type;
+    const char *data; // scalar value, or buffer samples
+    std::int64_t count; // buffer elements, or dependencies
+    std::int64_t num_samples;
+    std::uint64_t address;
+
+    // The scalar value as T, which must have the recorded size.
+    template <typename T>
+    T value() const {
+        T v;
+        std::memcpy(&v, data, sizeof(T));
+        return v;
+    }
+};
+
+struct call_entry {
+    std::string routine; // function table entry, such as sgemm or sgemm_usm
+    oneapi::mkl::device device;
+    std::uint32_t queue;
+    std::uint64_t time_ns;
+    std::vector<call_arg> args;
+};
+
+// Reads a call log, memory-mapped, one call at a time. The data of the
+// arguments points into the mapping and lives as long as the reader. Only
+// available on POSIX systems.
+class ONEMKL_EXPORT call_log {
+public:
+    explicit call_log(const std::string &path);
+    call_log(const call_log &) = delete;
+    call_log &operator=(const call_log &) = delete;
+    ~call_log();
+
+    // Decodes the next call into entry; returns false at the end of the log.
+    // A truncated last record, as left by a process that did not stop
+    // recording, is treated as the end.
+    bool next(call_entry &entry);
+    void rewind();
+
+    std::int64_t samples() const;
+
+private:
+    std::string path_;
+    int fd_ = -1;
+    const char *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t position_ = 0;
+};
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_CALL_LOG_HPP_
@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_CONTRACTION_HPP_
+#define _ONEMKL_BLAS_CONTRACTION_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+// A tensor operand of contract: one character label per mode, with the
+// extent of each mode and its stride in elements.
+struct tensor_desc {
+    std::string modes;
+    std::vector<std::int64_t> extents;
+    std::vector<std::int64_t> strides;
+};
+
+// Computes C = alpha*contraction(A, B) + beta*C, summing over the modes of A
+// and B that C lacks, in the manner of einsum("a,b->c"). Every mode of C
+// must appear in A or B, and every other mode in both.
+//
+// Modes found in A, B and C index a batch, modes found in A and C or in B and
+// C the rows and columns of a matrix product, and the remaining modes are
+// summed over. Whenever the strides let each group of modes fold into one
+// dimension, the contraction is a single gemm or strided gemm_batch on the
+// operands in place; otherwise the operands that prevent it, picked to copy
+// as few elements as possible, are permuted into workspace first. Plans are
+// cached by descriptor, so repeated contractions only pay for the lookup.
+ONEMKL_EXPORT cl::sycl::event contract(
+    cl::sycl::queue &queue, float alpha, const tensor_desc &a_desc, const float *a,
+    const tensor_desc &b_desc, const float *b, float beta, const tensor_desc &c_desc, float *c,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event contract(
+    cl::sycl::queue &queue, double alpha, const tensor_desc &a_desc, const double *a,
+    const tensor_desc &b_desc, const double *b, double beta, const tensor_desc &c_desc, double *c,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+// Waits for the contractions submitted in the context of queue and frees the
+// workspace they permuted operands into. Workspace is otherwise freed by later
+// contractions once the ones using it complete; call this before destroying
+// the context, or to return the memory after the last contraction.
+ONEMKL_EXPORT void release_contraction_workspace(cl::sycl::queue &queue);
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_CONTRACTION_HPP_
@@ -0,0 +1,250 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_COROUTINE_HPP_
+#define _ONEMKL_BLAS_COROUTINE_HPP_
+
+// Awaitable wrappers over the USM routines of blas.hpp. The header is
+// self-contained and needs C++20 coroutines only in the code including it;
+// the library itself is built without them.
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "oneapi/mkl/blas/coroutine.hpp requires C++20 coroutine support"
+#endif
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/blas/blas.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+namespace detail {
+
+inline bool is_complete(const cl::sycl::event &event) {
+    return event.get_info<cl::sycl::info::event::command_execution_status>() ==
+           cl::sycl::info::event_command_status::complete;
+}
+
+// One thread per process that resumes coroutines once the events they wait
+// for complete. SYCL 1.2.1 events have no completion callbacks, so the
+// thread polls the status of every pending event, backing off while none
+// completes, and sleeps while nothing is pending. Thousands of operations
+// in flight thus cost one thread rather than one blocked thread each.
+class completion_thread {
+public:
+    static completion_thread &instance() {
+        static completion_thread thread;
+        return thread;
+    }
+
+    void watch(cl::sycl::event event, std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            incoming_.push_back({ std::move(event), handle });
+        }
+        wake_.notify_one();
+    }
+
+    ~completion_thread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+private:
+    struct waiter {
+        cl::sycl::event event;
+        std::coroutine_handle<> handle;
+    };
+
+    static constexpr std::chrono::microseconds min_backoff{ 1 };
+    static constexpr std::chrono::microseconds max_backoff{ 128 };
+
+    completion_thread() : thread_([this] { run(); }) {}
+
+    void run() {
+        std::vector<waiter> pending, ready;
+        auto backoff = min_backoff;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (pending.empty())
+                    wake_.wait(lock, [this] { return stop_ || !incoming_.empty(); });
+                else if (ready.empty())
+                    wake_.wait_for(lock, backoff, [this] { return !incoming_.empty(); });
+                if (stop_ && pending.empty() && incoming_.empty())
+                    return;
+                std::move(incoming_.begin(), incoming_.end(), std::back_inserter(pending));
+                incoming_.clear();
+            }
+
+            auto done = std::stable_partition(pending.begin(), pending.end(), [](const waiter &w) {
+                return !is_complete(w.event);
+            });
+            ready.assign(std::make_move_iterator(done), std::make_move_iterator(pending.end()));
+            pending.erase(done, pending.end());
+            backoff = ready.empty() ? std::min(2 * backoff, max_backoff) : min_backoff;
+
+            // Resumed coroutines may submit and await further operations,
+            // which only takes the lock in watch.
+            for (auto &w : ready)
+                w.handle.resume();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<waiter> incoming_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+} // namespace detail
+
+// Suspends the awaiting coroutine until event completes. The coroutine is
+// resumed on the completion thread, so it should hand long-running work to
+// its own executor rather than run it there. An event already complete when
+// awaited does not suspend at all.
+class event_awaitable {
+public:
+    explicit event_awaitable(cl::sycl::event event) : event_(std::move(event)) {}
+
+    bool await_ready() const {
+        return detail::is_complete(event_);
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        detail::completion_thread::instance().watch(event_, handle);
+    }
+
+    // Asynchronous errors reach the handler of the queue, as with wait.
+    cl::sycl::event await_resume() {
+        event_.wait_and_throw();
+        return event_;
+    }
+
+private:
+    cl::sycl::event event_;
+};
+
+// X_async(queue, args...) submits the USM routine X(queue, args...) and
+// returns an awaitable for its event. Synchronous errors are thrown by the
+// call itself. Arguments are forwarded, so dependencies must be passed as a
+// vector_class<event> rather than as a braced list.
+#define ONEMKL_BLAS_DECLARE_ASYNC(name)                                                     \
+    template <typename... Args>                                                             \
+    event_awaitable name##_async(cl::sycl::queue &queue, Args &&... args) {                 \
+        return event_awaitable(oneapi::mkl::blas::name(queue, std::forward<Args>(args)...)); \
+    }
+
+// Level 1
+
+ONEMKL_BLAS_DECLARE_ASYNC(asum)
+ONEMKL_BLAS_DECLARE_ASYNC(axpy)
+ONEMKL_BLAS_DECLARE_ASYNC(axpy_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(copy)
+ONEMKL_BLAS_DECLARE_ASYNC(dot)
+ONEMKL_BLAS_DECLARE_ASYNC(dotc)
+ONEMKL_BLAS_DECLARE_ASYNC(dotu)
+ONEMKL_BLAS_DECLARE_ASYNC(iamax)
+ONEMKL_BLAS_DECLARE_ASYNC(iamin)
+ONEMKL_BLAS_DECLARE_ASYNC(nrm2)
+ONEMKL_BLAS_DECLARE_ASYNC(rot)
+ONEMKL_BLAS_DECLARE_ASYNC(rotg)
+ONEMKL_BLAS_DECLARE_ASYNC(rotm)
+ONEMKL_BLAS_DECLARE_ASYNC(rotmg)
+ONEMKL_BLAS_DECLARE_ASYNC(scal)
+ONEMKL_BLAS_DECLARE_ASYNC(sdsdot)
+ONEMKL_BLAS_DECLARE_ASYNC(swap)
+
+// Level 2
+
+ONEMKL_BLAS_DECLARE_ASYNC(gbmv)
+ONEMKL_BLAS_DECLARE_ASYNC(gemv)
+ONEMKL_BLAS_DECLARE_ASYNC(ger)
+ONEMKL_BLAS_DECLARE_ASYNC(gerc)
+ONEMKL_BLAS_DECLARE_ASYNC(geru)
+ONEMKL_BLAS_DECLARE_ASYNC(hbmv)
+ONEMKL_BLAS_DECLARE_ASYNC(hemv)
+ONEMKL_BLAS_DECLARE_ASYNC(her)
+ONEMKL_BLAS_DECLARE_ASYNC(her2)
+ONEMKL_BLAS_DECLARE_ASYNC(hpmv)
+ONEMKL_BLAS_DECLARE_ASYNC(hpr)
+ONEMKL_BLAS_DECLARE_ASYNC(hpr2)
+ONEMKL_BLAS_DECLARE_ASYNC(sbmv)
+ONEMKL_BLAS_DECLARE_ASYNC(spmv)
+ONEMKL_BLAS_DECLARE_ASYNC(spr)
+ONEMKL_BLAS_DECLARE_ASYNC(spr2)
+ONEMKL_BLAS_DECLARE_ASYNC(symv)
+ONEMKL_BLAS_DECLARE_ASYNC(syr)
+ONEMKL_BLAS_DECLARE_ASYNC(syr2)
+ONEMKL_BLAS_DECLARE_ASYNC(tbmv)
+ONEMKL_BLAS_DECLARE_ASYNC(tbsv)
+ONEMKL_BLAS_DECLARE_ASYNC(tpmv)
+ONEMKL_BLAS_DECLARE_ASYNC(tpsv)
+ONEMKL_BLAS_DECLARE_ASYNC(trmv)
+ONEMKL_BLAS_DECLARE_ASYNC(trsv)
+
+// Level 3
+
+ONEMKL_BLAS_DECLARE_ASYNC(gemm)
+ONEMKL_BLAS_DECLARE_ASYNC(gemm_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(hemm)
+ONEMKL_BLAS_DECLARE_ASYNC(her2k)
+ONEMKL_BLAS_DECLARE_ASYNC(herk)
+ONEMKL_BLAS_DECLARE_ASYNC(symm)
+ONEMKL_BLAS_DECLARE_ASYNC(syr2k)
+ONEMKL_BLAS_DECLARE_ASYNC(syrk)
+ONEMKL_BLAS_DECLARE_ASYNC(trmm)
+ONEMKL_BLAS_DECLARE_ASYNC(trsm)
+
+// BLAS-like extensions
+
+ONEMKL_BLAS_DECLARE_ASYNC(gemm3m)
+ONEMKL_BLAS_DECLARE_ASYNC(gemm3m_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(gemmt)
+ONEMKL_BLAS_DECLARE_ASYNC(imatcopy)
+ONEMKL_BLAS_DECLARE_ASYNC(imatcopy_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(omatadd)
+ONEMKL_BLAS_DECLARE_ASYNC(omatadd_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(omatcopy)
+ONEMKL_BLAS_DECLARE_ASYNC(omatcopy_batch)
+ONEMKL_BLAS_DECLARE_ASYNC(replay)
+
+#undef ONEMKL_BLAS_DECLARE_ASYNC
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_COROUTINE_HPP_
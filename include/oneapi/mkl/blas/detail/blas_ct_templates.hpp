@@ -30,6 +30,7 @@
 
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/blas/graph.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -73,6 +74,32 @@ template <oneapi::mkl::backend backend>
 static inline void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+
+template <oneapi::mkl::backend backend>
+static inline void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+
 template <oneapi::mkl::backend backend>
 static inline void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                         std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
@@ -235,6 +262,50 @@ static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<dou
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy);
+
 template <oneapi::mkl::backend backend>
 static inline void gerc(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -303,6 +374,68 @@ static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m,
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                        std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t offset_y, std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+
+template <oneapi::mkl::backend backend>
+static inline void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+
 template <oneapi::mkl::backend backend>
 static inline void her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -529,6 +662,73 @@ static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose tran
                         std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
 
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                        std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                        std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, float beta,
+                        cl::sycl::buffer<float, 1> &c, std::int64_t offset_c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+                        double beta, cl::sycl::buffer<double, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc);
+
 template <oneapi::mkl::backend backend>
 static inline void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n,
                         std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
@@ -577,6 +777,32 @@ static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lowe
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
+template <oneapi::mkl::backend backend>
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+                        diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
+
 template <oneapi::mkl::backend backend>
 static inline void dotu(cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -857,6 +1083,206 @@ static inline void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose tra
                          std::int64_t ldb, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
+template <oneapi::mkl::backend backend>
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                          std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb,
+                          std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                            std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                            std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                            std::int64_t lda, std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                            std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c,
+                           std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+                           std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c,
+                           std::int64_t ldc);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                  std::int64_t lda, std::int64_t stride_a,
+                                  cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                  std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                  std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                  std::int64_t n, std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, float alpha,
+                                 cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, double alpha,
+                                 cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+
+template <oneapi::mkl::backend backend>
+static inline void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+
 template <oneapi::mkl::backend backend>
 static inline void sbmv(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k,
                         float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
@@ -1092,6 +1518,38 @@ static inline cl::sycl::event scal(
     cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
     std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, std::complex<float> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event scal(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, std::complex<double> *x,
+    std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <oneapi::mkl::backend backend>
 static inline cl::sycl::event trmv(
     cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
@@ -1265,6 +1723,28 @@ static inline cl::sycl::event axpy(
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x, std::int64_t incx,
+    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x, std::int64_t incx,
+    double *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event axpy(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <oneapi::mkl::backend backend>
 static inline cl::sycl::event axpy_batch(
     cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
@@ -1361,6 +1841,34 @@ static inline cl::sycl::event gemv(
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, const float *alpha,
+    const float *a, std::int64_t lda, const float *x, std::int64_t incx, const float *beta,
+    float *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, const double *alpha,
+    const double *a, std::int64_t lda, const double *x, std::int64_t incx, const double *beta,
+    double *y, std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+    std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemv(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+    std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <oneapi::mkl::backend backend>
 static inline cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                                   float alpha, const std::complex<float> *x, std::int64_t incx,
@@ -1565,6 +2073,36 @@ static inline cl::sycl::event gemm(
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *alpha, const float *a, std::int64_t lda, const float *b,
+    std::int64_t ldb, const float *beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, const double *beta, double *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<float> *alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<double> *alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+    const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <oneapi::mkl::backend backend>
 static inline cl::sycl::event herk(
     cl::sycl::queue &queue, uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
@@ -1914,6 +2452,219 @@ static inline cl::sycl::event gemmt(
     std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+    const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
+    std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+    const std::complex<double> **b, std::int64_t *ldb, std::complex<double> *beta,
+    std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event gemm3m_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, double *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, float beta, const float *b, std::int64_t ldb,
+    float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, double beta, const double *b, std::int64_t ldb,
+    double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event imatcopy_batch(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float beta,
+    const float *b, std::int64_t ldb, std::int64_t stride_b, float *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
+    const double *b, std::int64_t ldb, std::int64_t stride_b, double *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event omatadd_batch(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, const std::complex<double> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 template <oneapi::mkl::backend backend>
 static inline cl::sycl::event sbmv(
     cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, std::int64_t k, float alpha,
@@ -2084,6 +2835,18 @@ static inline cl::sycl::event symv(
     std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+// Graph APIs
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event replay(
+    cl::sycl::queue &queue, const graph<float> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+template <oneapi::mkl::backend backend>
+static inline cl::sycl::event replay(
+    cl::sycl::queue &queue, const graph<double> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 } //namespace blas
 } //namespace mkl
 } //namespace oneapi
@@ -26,6 +26,8 @@
 
 #include "oneapi/mkl/types.hpp"
 
+#include "oneapi/mkl/blas/graph.hpp"
+#include "oneapi/mkl/blas/perf_counters.hpp"
 #include "oneapi/mkl/detail/export.hpp"
 #include "oneapi/mkl/detail/get_device_id.hpp"
 
@@ -61,6 +63,24 @@ ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std:
 ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                         double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
 ONEMKL_EXPORT void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
@@ -206,6 +226,38 @@ ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std:
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t offset_x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
 
 ONEMKL_EXPORT void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<float> alpha,
@@ -262,6 +314,57 @@ ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, tran
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+                        cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+                        std::int64_t offset_x, std::int64_t incx, float beta,
+                        cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, double alpha,
+                        cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                        double beta, cl::sycl::buffer<double, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                        std::int64_t offset_x, std::int64_t incx, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
+ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                        std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                        std::int64_t offset_x, std::int64_t incx, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                        std::int64_t incy);
 
 ONEMKL_EXPORT void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, float alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -423,6 +526,159 @@ ONEMKL_EXPORT void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, upl
                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                          std::int64_t ldb, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                          std::int64_t ldb, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<float> alpha,
+                                cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                                cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+ONEMKL_EXPORT void gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<double> alpha,
+                                cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                                std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                                cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                std::int64_t stride_c, std::int64_t batch_size);
+ONEMKL_EXPORT void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, float alpha,
+                            cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, double alpha,
+                            cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, float alpha,
+                            cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb);
+ONEMKL_EXPORT void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, double alpha,
+                            cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb);
+ONEMKL_EXPORT void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                            cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+ONEMKL_EXPORT void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                            std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                            cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                            std::int64_t ldb);
+ONEMKL_EXPORT void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                           transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                           transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                           transpose transb, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t lda, std::complex<float> beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                           transpose transb, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t lda, std::complex<double> beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n, float alpha,
+                                  cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                  std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n, double alpha,
+                                  cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                  std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n,
+                                  std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n,
+                                  std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                  std::int64_t stride_a,
+                                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                  std::int64_t stride_b, std::int64_t batch_size);
+ONEMKL_EXPORT void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n, float alpha,
+                                  cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+ONEMKL_EXPORT void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n, double alpha,
+                                  cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+ONEMKL_EXPORT void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n,
+                                  std::complex<float> alpha,
+                                  cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+ONEMKL_EXPORT void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                  transpose trans, std::int64_t m, std::int64_t n,
+                                  std::complex<double> alpha,
+                                  cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+ONEMKL_EXPORT void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                 transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+ONEMKL_EXPORT void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                 transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                                 std::int64_t ldb, std::int64_t stride_b,
+                                 cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
+ONEMKL_EXPORT void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                 transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                 std::complex<float> alpha,
+                                 cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<float> beta,
+                                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+ONEMKL_EXPORT void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                 transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                                 std::complex<double> alpha,
+                                 cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                 std::int64_t stride_a, std::complex<double> beta,
+                                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                 std::int64_t stride_b,
+                                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                 std::int64_t stride_c, std::int64_t batch_size);
 
 ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -451,6 +707,60 @@ ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, tran
                         half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                        std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                        std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<float>, 1> &beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                        cl::sycl::buffer<std::complex<double>, 1> &beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t offset_b,
+                        std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
+                        std::int64_t offset_c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t offset_b,
+                        std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
+                        std::int64_t offset_c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b,
+                        std::int64_t ldb, std::complex<float> beta,
+                        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc);
+ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda,
+                        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b,
+                        std::int64_t ldb, std::complex<double> beta,
+                        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t offset_c,
+                        std::int64_t ldc);
 
 ONEMKL_EXPORT void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
@@ -488,6 +798,28 @@ ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+                        uplo upper_lower, transpose transa, diag unit_diag, std::int64_t m,
+                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
+ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+                        uplo upper_lower, transpose transa, diag unit_diag, std::int64_t m,
+                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                        std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
+ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+                        uplo upper_lower, transpose transa, diag unit_diag, std::int64_t m,
+                        std::int64_t n, std::complex<float> alpha,
+                        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
+ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+                        uplo upper_lower, transpose transa, diag unit_diag, std::int64_t m,
+                        std::int64_t n, std::complex<double> alpha,
+                        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                        std::int64_t offset_b, std::int64_t ldb);
 
 ONEMKL_EXPORT void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -866,6 +1198,28 @@ ONEMKL_EXPORT cl::sycl::event scal(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
     std::complex<double> *x, std::int64_t incx,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+    float *x, std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+    double *x, std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+    const std::complex<float> *alpha, std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+    std::complex<float> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+    const std::complex<double> *alpha, std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+    std::complex<double> *x, std::int64_t incx,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event trmv(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1041,6 +1395,24 @@ ONEMKL_EXPORT cl::sycl::event axpy(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+    const float *x, std::int64_t incx, float *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+    const double *x, std::int64_t incx, double *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+    const std::complex<float> *alpha, const std::complex<float> *x, std::int64_t incx,
+    std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+    const std::complex<double> *alpha, const std::complex<double> *x, std::int64_t incx,
+    std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event axpy_batch(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n, float *alpha,
@@ -1117,6 +1489,28 @@ ONEMKL_EXPORT cl::sycl::event gemv(
     const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
     std::complex<double> *y, std::int64_t incy,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemv(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, const float *alpha, const float *a, std::int64_t lda, const float *x,
+    std::int64_t incx, const float *beta, float *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemv(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, const double *alpha, const double *a, std::int64_t lda, const double *x,
+    std::int64_t incx, const double *beta, double *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemv(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, const std::complex<float> *alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+    const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemv(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, const std::complex<double> *alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+    const std::complex<double> *beta, std::complex<double> *y, std::int64_t incy,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, float alpha,
@@ -1250,6 +1644,167 @@ ONEMKL_EXPORT cl::sycl::event gemmt(
     const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
     std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa, transpose *transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<float> *alpha,
+    const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **b,
+    std::int64_t *ldb, std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+    std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa, transpose *transb,
+    std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> *alpha,
+    const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
+    std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, float alpha, float *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, double alpha, double *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda,
+    std::int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda, float beta,
+    const float *b, std::int64_t ldb, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda, double beta,
+    const double *b, std::int64_t ldb, double *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, double alpha, const double *a, std::int64_t lda, std::int64_t stride_a,
+    double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, float alpha, float *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, double alpha, double *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda,
+    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event imatcopy_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    std::int64_t n, std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda,
+    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+    std::int64_t stride_a, float beta, const float *b, std::int64_t ldb, std::int64_t stride_b,
+    float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+    std::int64_t stride_a, double beta, const double *b, std::int64_t ldb, std::int64_t stride_b,
+    double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<float> beta, const std::complex<float> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<float> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event omatadd_batch(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+    const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *c,
+    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event gemm(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -1273,6 +1828,28 @@ ONEMKL_EXPORT cl::sycl::event gemm(
     const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
     std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+    std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+    std::int64_t lda, const double *b, std::int64_t ldb, const double *beta, double *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
 ONEMKL_EXPORT cl::sycl::event syr2(
     oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -1660,6 +2237,29 @@ ONEMKL_EXPORT cl::sycl::event rotg(
     std::complex<double> *b, double *c, std::complex<double> *s,
     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+// Graph APIs
+
+ONEMKL_EXPORT cl::sycl::event replay(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, const graph<float> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event replay(
+    oneapi::mkl::device libkey, cl::sycl::queue &queue, const graph<double> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+// Run-time dispatch settings
+
+ONEMKL_EXPORT void set_gemm_coalescing(std::int64_t max_batch, std::int64_t window_us,
+                                       std::int64_t max_size);
+ONEMKL_EXPORT void flush_gemm_coalescing();
+ONEMKL_EXPORT void set_gemm_algorithm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                      gemm_algorithm algorithm, std::int64_t cutoff);
+ONEMKL_EXPORT void set_reproducibility(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                       reproducibility mode);
+ONEMKL_EXPORT void set_perf_counters(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                                     bool enable);
+ONEMKL_EXPORT std::vector<perf_counter_record> get_perf_counters(oneapi::mkl::device libkey,
+                                                                 cl::sycl::queue &queue);
+
 } //namespace detail
 } //namespace blas
 } //namespace mkl
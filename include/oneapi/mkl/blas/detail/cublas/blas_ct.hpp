@@ -107,6 +107,60 @@ void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, double alpha,
     scal_postcondition(queue, n, alpha, x, incx);
 }
 
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                           std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                           std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
+template <>
+void scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    scal_precondition(queue, n, alpha, x, incx);
+    oneapi::mkl::cublas::scal(queue, n, alpha, x, incx);
+    scal_postcondition(queue, n, alpha, x, incx);
+}
+
 template <>
 void trmv<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                            diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
@@ -428,6 +482,84 @@ void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, std::complex<
     axpy_postcondition(queue, n, alpha, x, incx, y, incy);
 }
 
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x,
+                           std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x,
+                           std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                           cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                           cl::sycl::buffer<float, 1> &y, std::int64_t offset_y,
+                           std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                           cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx,
+                           cl::sycl::buffer<double, 1> &y, std::int64_t offset_y,
+                           std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+                           std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
+template <>
+void axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+                           std::int64_t offset_y, std::int64_t incy) {
+    axpy_precondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    oneapi::mkl::cublas::axpy(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    axpy_postcondition(queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+}
+
 template <>
 void sdsdot<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, float sb,
                              cl::sycl::buffer<float, 1> &x, std::int64_t incx,
@@ -552,6 +684,112 @@ void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t
     gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y,
+                           std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y,
+                           std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<std::complex<float>, 1> &beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<std::complex<double>, 1> &beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
+                           std::int64_t offset_y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta,
+                              y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
+                           std::int64_t offset_y, std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta,
+                              y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, std::complex<float> beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                           std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta,
+                              y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
+template <>
+void gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                           std::int64_t incx, std::complex<double> beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                           std::int64_t incy) {
+    gemv_precondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                      offset_y, incy);
+    oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta,
+                              y, offset_y, incy);
+    gemv_postcondition(queue, trans, m, n, alpha, a, offset_a, lda, x, offset_x, incx, beta, y,
+                       offset_y, incy);
+}
+
 template <>
 void her<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -902,6 +1140,120 @@ void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose t
     gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<float>, 1> &beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                           cl::sycl::buffer<std::complex<double>, 1> &beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                           cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+                           float beta, cl::sycl::buffer<float, 1> &c, std::int64_t offset_c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b,
+                              ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                           cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+                           double beta, cl::sycl::buffer<double, 1> &c, std::int64_t offset_c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b,
+                              ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb, std::complex<float> beta,
+                           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t offset_c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b,
+                              ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
+template <>
+void gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb, std::complex<double> beta,
+                           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t offset_c,
+                           std::int64_t ldc) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                      beta, c, offset_c, ldc);
+    oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b,
+                              ldb, beta, c, offset_c, ldc);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b, offset_b, ldb,
+                       beta, c, offset_c, ldc);
+}
+
 template <>
 void syr2<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
@@ -996,6 +1348,64 @@ void trsm<backend::cublas>(cl::sycl::queue &queue, side left_right, uplo upper_l
                        ldb);
 }
 
+template <>
+void trsm<backend::cublas>(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+                           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    oneapi::mkl::cublas::trsm(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                              offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+template <>
+void trsm<backend::cublas>(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+                           double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    oneapi::mkl::cublas::trsm(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                              offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+template <>
+void trsm<backend::cublas>(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+                           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    oneapi::mkl::cublas::trsm(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                              offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
+template <>
+void trsm<backend::cublas>(cl::sycl::queue &queue, side left_right, uplo upper_lower,
+                           transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+                           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                           std::int64_t offset_a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b,
+                           std::int64_t ldb) {
+    trsm_precondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                      lda, b, offset_b, ldb);
+    oneapi::mkl::cublas::trsm(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                              offset_a, lda, b, offset_b, ldb);
+    trsm_postcondition(queue, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, offset_a,
+                       lda, b, offset_b, ldb);
+}
+
 template <>
 void dotu<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
                            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
@@ -1500,28 +1910,385 @@ void gemmt<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, transpose
 }
 
 template <>
-void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
-                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-                           cl::sycl::buffer<float, 1> &result) {
-    asum_precondition(queue, n, x, incx, result);
-    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
-    asum_postcondition(queue, n, x, incx, result);
+void gemm3m<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                             std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                             std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                             std::int64_t ldb, std::complex<float> beta,
+                             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 template <>
-void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
-                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-                           cl::sycl::buffer<double, 1> &result) {
-    asum_precondition(queue, n, x, incx, result);
-    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
-    asum_postcondition(queue, n, x, incx, result);
+void gemm3m<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                             std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<double> alpha,
+                             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                             cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                             std::complex<double> beta,
+                             cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    oneapi::mkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 template <>
-void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
-                           std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
-    asum_precondition(queue, n, x, incx, result);
-    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
+void gemm3m_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   std::int64_t m, std::int64_t n, std::int64_t k,
+                                   std::complex<float> alpha,
+                                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a,
+                                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::complex<float> beta,
+                                   cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                   std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                                      ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void gemm3m_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                   std::int64_t m, std::int64_t n, std::int64_t k,
+                                   std::complex<double> alpha,
+                                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                   std::int64_t stride_a,
+                                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::complex<double> beta,
+                                   cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                   std::int64_t stride_c, std::int64_t batch_size) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                                      ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void omatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <>
+void omatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                               std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <>
+void omatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha,
+                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <>
+void omatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha,
+                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                               cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+    oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+template <>
+void imatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                               std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <>
+void imatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                               std::int64_t lda, std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <>
+void imatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha,
+                               cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                               std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <>
+void imatcopy<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha,
+                               cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                               std::int64_t ldb) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb);
+    oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+template <>
+void omatadd<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                              cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <>
+void omatadd<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+                              cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                              cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <>
+void omatadd<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+                              std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c,
+                              std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <>
+void omatadd<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                              std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+template <>
+void omatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb,
+                                        stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <>
+void omatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                                     std::int64_t lda, std::int64_t stride_a,
+                                     cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb,
+                                        stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <>
+void omatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb,
+                                        stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <>
+void omatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     std::int64_t stride_a,
+                                     cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+    oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb,
+                                        stride_b, batch_size);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+}
+
+template <>
+void imatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                     std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                        batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <>
+void imatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                     std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                        batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <>
+void imatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, std::complex<float> alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                                     std::int64_t ldb, std::int64_t stride,
+                                     std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                        batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <>
+void imatcopy_batch<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                     std::int64_t n, std::complex<double> alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                     std::int64_t batch_size) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                        batch_size);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+}
+
+template <>
+void omatadd_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, float alpha,
+                                    cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, float beta,
+                                    cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                    std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                                    std::int64_t ldc, std::int64_t stride_c,
+                                    std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta,
+                                       b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void omatadd_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, double alpha,
+                                    cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, double beta,
+                                    cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                    std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                                    std::int64_t ldc, std::int64_t stride_c,
+                                    std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta,
+                                       b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void omatadd_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::complex<float> beta,
+                                    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                    std::int64_t stride_b,
+                                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta,
+                                       b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void omatadd_batch<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                    std::int64_t stride_a, std::complex<double> beta,
+                                    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                    std::int64_t stride_b,
+                                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                                    std::int64_t stride_c, std::int64_t batch_size) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size);
+    oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta,
+                                       b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size);
+}
+
+template <>
+void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<float, 1> &result) {
+    asum_precondition(queue, n, x, incx, result);
+    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+}
+
+template <>
+void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                           cl::sycl::buffer<double, 1> &result) {
+    asum_precondition(queue, n, x, incx, result);
+    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
+    asum_postcondition(queue, n, x, incx, result);
+}
+
+template <>
+void asum<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
+                           std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
+    asum_precondition(queue, n, x, incx, result);
+    oneapi::mkl::cublas::asum(queue, n, x, incx, result);
     asum_postcondition(queue, n, x, incx, result);
 }
 
@@ -1924,6 +2691,68 @@ cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, do
     return done;
 }
 
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                      float *x, std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                      double *x, std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                                      const std::complex<float> *alpha, std::complex<float> *x,
+                                      std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                      std::complex<float> *x, std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                                      const std::complex<double> *alpha, std::complex<double> *x,
+                                      std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event scal<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                      std::complex<double> *x, std::int64_t incx,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    scal_precondition(queue, n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::cublas::scal(queue, n, alpha, x, incx, dependencies);
+    scal_postcondition(queue, n, alpha, x, incx, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event trmv<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                                       diag unit_diag, std::int64_t n, const float *a,
@@ -2268,6 +3097,52 @@ cl::sycl::event axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
     return done;
 }
 
+template <>
+cl::sycl::event axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                      const float *x, std::int64_t incx, float *y,
+                                      std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                      const double *x, std::int64_t incx, double *y,
+                                      std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                                      const std::complex<float> *alpha,
+                                      const std::complex<float> *x, std::int64_t incx,
+                                      std::complex<float> *y, std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event axpy<backend::cublas>(cl::sycl::queue &queue, std::int64_t n,
+                                      const std::complex<double> *alpha,
+                                      const std::complex<double> *x, std::int64_t incx,
+                                      std::complex<double> *y, std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    axpy_precondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    axpy_postcondition(queue, n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event axpy_batch<backend::cublas>(
     cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
@@ -2468,6 +3343,62 @@ cl::sycl::event gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, s
     return done;
 }
 
+template <>
+cl::sycl::event gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                      std::int64_t n, const float *alpha, const float *a,
+                                      std::int64_t lda, const float *x, std::int64_t incx,
+                                      const float *beta, float *y, std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                          dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                      std::int64_t n, const double *alpha, const double *a,
+                                      std::int64_t lda, const double *x, std::int64_t incx,
+                                      const double *beta, double *y, std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                          dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                      std::int64_t n, const std::complex<float> *alpha,
+                                      const std::complex<float> *a, std::int64_t lda,
+                                      const std::complex<float> *x, std::int64_t incx,
+                                      const std::complex<float> *beta, std::complex<float> *y,
+                                      std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                          dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemv<backend::cublas>(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                                      std::int64_t n, const std::complex<double> *alpha,
+                                      const std::complex<double> *a, std::int64_t lda,
+                                      const std::complex<double> *x, std::int64_t incx,
+                                      const std::complex<double> *beta, std::complex<double> *y,
+                                      std::int64_t incy,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemv_precondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    auto done = oneapi::mkl::cublas::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                          dependencies);
+    gemv_postcondition(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event her<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                                      float alpha, const std::complex<float> *x, std::int64_t incx,
@@ -2886,6 +3817,74 @@ cl::sycl::event gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa,
     return done;
 }
 
+template <>
+cl::sycl::event gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      const float *alpha, const float *a, std::int64_t lda,
+                                      const float *b, std::int64_t ldb, const float *beta, float *c,
+                                      std::int64_t ldc,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      const double *alpha, const double *a, std::int64_t lda,
+                                      const double *b, std::int64_t ldb, const double *beta,
+                                      double *c, std::int64_t ldc,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      const std::complex<float> *alpha,
+                                      const std::complex<float> *a, std::int64_t lda,
+                                      const std::complex<float> *b, std::int64_t ldb,
+                                      const std::complex<float> *beta, std::complex<float> *c,
+                                      std::int64_t ldc,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm<backend::cublas>(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                      std::int64_t m, std::int64_t n, std::int64_t k,
+                                      const std::complex<double> *alpha,
+                                      const std::complex<double> *a, std::int64_t lda,
+                                      const std::complex<double> *b, std::int64_t ldb,
+                                      const std::complex<double> *beta, std::complex<double> *c,
+                                      std::int64_t ldc,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    auto done = oneapi::mkl::cublas::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                          beta, c, ldc, dependencies);
+    gemm_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                       dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event herk<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                                       std::int64_t n, std::int64_t k, float alpha,
@@ -3621,6 +4620,451 @@ cl::sycl::event gemmt<backend::cublas>(
     return done;
 }
 
+template <>
+cl::sycl::event gemm3m<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                        dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                            beta, c, ldc, dependencies);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm3m<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                        dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                            beta, c, ldc, dependencies);
+    gemm3m_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm3m_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+    const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
+    std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              group_count, group_size, dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                  ldb, beta, c, ldc, group_count, group_size,
+                                                  dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm3m_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+    const std::complex<double> **b, std::int64_t *ldb, std::complex<double> *beta,
+    std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                              group_count, group_size, dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                  ldb, beta, c, ldc, group_count, group_size,
+                                                  dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               group_count, group_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm3m_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                  stride_a, b, ldb, stride_b, beta, c, ldc,
+                                                  stride_c, batch_size, dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event gemm3m_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    gemm3m_batch_precondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                              stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::gemm3m_batch(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                  stride_a, b, ldb, stride_b, beta, c, ldc,
+                                                  stride_c, batch_size, dependencies);
+    gemm3m_batch_postcondition(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                              dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, double *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                              dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                              dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *b, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_precondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                              dependencies);
+    omatcopy_postcondition(queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb,
+                                              dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb,
+                                              dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb,
+                                              dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_precondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy(queue, trans, m, n, alpha, ab, lda, ldb,
+                                              dependencies);
+    imatcopy_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, float beta, const float *b, std::int64_t ldb,
+    float *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                                             ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, double beta, const double *b, std::int64_t ldb,
+    double *c, std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                                             ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                                             ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_precondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                         dependencies);
+    auto done = oneapi::mkl::cublas::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                                             ldb, c, ldc, dependencies);
+    omatadd_postcondition(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                          dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+    const float *a, std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b,
+                                                    ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    const double *a, std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b,
+                                                    ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b,
+                                                    ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatcopy_batch_precondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatcopy_batch(queue, trans, m, n, alpha, a, lda, stride_a, b,
+                                                    ldb, stride_b, batch_size, dependencies);
+    omatcopy_batch_postcondition(queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha, float *ab,
+    std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                                    batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+    double *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                                    batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                                    batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event imatcopy_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+    std::int64_t stride, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    imatcopy_batch_precondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
+    auto done = oneapi::mkl::cublas::imatcopy_batch(queue, trans, m, n, alpha, ab, lda, ldb, stride,
+                                                    batch_size, dependencies);
+    imatcopy_batch_postcondition(queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                 dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float beta,
+    const float *b, std::int64_t ldb, std::int64_t stride_b, float *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda,
+                                                   stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                   stride_c, batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    double alpha, const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
+    const double *b, std::int64_t ldb, std::int64_t stride_b, double *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda,
+                                                   stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                   stride_c, batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+    std::int64_t stride_b, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+    std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda,
+                                                   stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                   stride_c, batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event omatadd_batch<backend::cublas>(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> beta, const std::complex<double> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t stride_c, std::int64_t batch_size,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    omatadd_batch_precondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                               stride_b, c, ldc, stride_c, batch_size, dependencies);
+    auto done = oneapi::mkl::cublas::omatadd_batch(queue, transa, transb, m, n, alpha, a, lda,
+                                                   stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                   stride_c, batch_size, dependencies);
+    omatadd_batch_postcondition(queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
+    return done;
+}
+
 template <>
 cl::sycl::event sbmv<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
                                       std::int64_t k, float alpha, const float *a, std::int64_t lda,
@@ -3968,6 +5412,28 @@ cl::sycl::event symv<backend::cublas>(cl::sycl::queue &queue, uplo upper_lower,
     return done;
 }
 
+// Graph APIs
+
+template <>
+cl::sycl::event replay<backend::cublas>(
+    cl::sycl::queue &queue, const graph<float> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    replay_precondition(queue, g, dependencies);
+    auto done = oneapi::mkl::cublas::replay(queue, g, dependencies);
+    replay_postcondition(queue, g, dependencies);
+    return done;
+}
+
+template <>
+cl::sycl::event replay<backend::cublas>(
+    cl::sycl::queue &queue, const graph<double> &g,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    replay_precondition(queue, g, dependencies);
+    auto done = oneapi::mkl::cublas::replay(queue, g, dependencies);
+    replay_postcondition(queue, g, dependencies);
+    return done;
+}
+
 } // namespace blas
 } // namespace mkl
 } // namespace oneapi
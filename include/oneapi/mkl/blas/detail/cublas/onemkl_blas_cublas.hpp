@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <string>
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas/graph.hpp"
+#include "oneapi/mkl/blas/perf_counters.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -61,6 +63,38 @@ void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t offset_y, std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t offset_y, std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
 void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy);
 
@@ -192,6 +226,24 @@ void scal(cl::sycl::queue &queue, std::int64_t n, float alpha,
 void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+
 void sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb, cl::sycl::buffer<float, 1> &x,
             std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
             cl::sycl::buffer<float, 1> &result);
@@ -248,6 +300,52 @@ void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy);
 
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &beta,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx, double beta,
+          cl::sycl::buffer<double, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
+void gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y, std::int64_t incy);
+
 void ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<float, 1> &a, std::int64_t lda);
@@ -518,6 +616,58 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64
           std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
           cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
 
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+          std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+          std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+          std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
 void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
@@ -646,6 +796,26 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b, std::int64_t ldb);
+
 void gemm_batch(cl::sycl::queue &queue, cl::sycl::buffer<transpose, 1> &transa,
                 cl::sycl::buffer<transpose, 1> &transb, cl::sycl::buffer<std::int64_t, 1> &m,
                 cl::sycl::buffer<std::int64_t, 1> &n, cl::sycl::buffer<std::int64_t, 1> &k,
@@ -796,6 +966,155 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc);
 
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc);
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                  cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size);
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                  std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                  std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                  std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size);
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+              std::int64_t ldb);
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+              std::int64_t ldb);
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb);
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb);
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb);
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb);
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+             float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+             double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+             std::int64_t lda, std::complex<float> beta,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a,
+                    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size);
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb,
+                    std::int64_t stride, std::int64_t batch_size);
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size);
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size);
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size);
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
+
 void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
               std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<half, 1> &a,
               std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
@@ -894,6 +1213,24 @@ cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+                     std::int64_t incx, float *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+                     std::int64_t incx, double *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event copy(cl::sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
                      float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
@@ -1060,6 +1397,30 @@ cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, double alpha, std::
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                     std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x,
+                     std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb, const float *x,
                        std::int64_t incx, const float *y, std::int64_t incy, float *result,
                        const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
@@ -1128,6 +1489,28 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, st
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                     const float *alpha, const float *a, std::int64_t lda, const float *x,
+                     std::int64_t incx, const float *beta, float *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                     const double *alpha, const double *a, std::int64_t lda, const double *x,
+                     std::int64_t incx, const double *beta, double *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                     const std::complex<float> *alpha, const std::complex<float> *a,
+                     std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+                     const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                     const std::complex<double> *alpha, const std::complex<double> *a,
+                     std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                     const std::complex<double> *beta, std::complex<double> *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event ger(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy, float *a,
                     std::int64_t lda,
@@ -1441,6 +1824,32 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                     std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+                     std::int64_t lda, const float *b, std::int64_t ldb, const float *beta,
+                     float *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                     std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+                     std::int64_t lda, const double *b, std::int64_t ldb, const double *beta,
+                     double *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                     std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+                     const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                     std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c,
+                     std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                     std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+                     const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                     std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+                     std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
@@ -1673,6 +2082,213 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                       std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, std::int64_t lda,
+                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                       std::complex<double> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                             std::complex<float> *alpha, const std::complex<float> **a,
+                             std::int64_t *lda, const std::complex<float> **b, std::int64_t *ldb,
+                             std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+                             std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                             std::complex<double> *alpha, const std::complex<double> **a,
+                             std::int64_t *lda, const std::complex<double> **b, std::int64_t *ldb,
+                             std::complex<double> *beta, std::complex<double> **c,
+                             std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                             std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<float> alpha, const std::complex<float> *a,
+                             std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b,
+                             std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                             std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                             std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<double> alpha, const std::complex<double> *a,
+                             std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b,
+                             std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                             std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         float alpha, const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         double alpha, const double *a, std::int64_t lda, double *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         std::complex<float> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         float alpha, float *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         double alpha, double *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, float alpha, const float *a, std::int64_t lda, float beta,
+                        const float *b, std::int64_t ldb, float *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, double alpha, const double *a, std::int64_t lda,
+                        double beta, const double *b, std::int64_t ldb, double *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                        std::int64_t lda, std::complex<float> beta, const std::complex<float> *b,
+                        std::int64_t ldb, std::complex<float> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                        std::int64_t lda, std::complex<double> beta, const std::complex<double> *b,
+                        std::int64_t ldb, std::complex<double> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, const float *a, std::int64_t lda,
+                               std::int64_t stride_a, float *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, const double *a, std::int64_t lda,
+                               std::int64_t stride_a, double *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha,
+                               const std::complex<float> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha,
+                               const std::complex<double> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, float *ab, std::int64_t lda,
+                               std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, double *ab, std::int64_t lda,
+                               std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha, std::complex<float> *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha, std::complex<double> *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, float alpha, const float *a,
+                              std::int64_t lda, std::int64_t stride_a, float beta, const float *b,
+                              std::int64_t ldb, std::int64_t stride_b, float *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, double alpha, const double *a,
+                              std::int64_t lda, std::int64_t stride_a, double beta, const double *b,
+                              std::int64_t ldb, std::int64_t stride_b, double *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                              const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                              std::complex<float> beta, const std::complex<float> *b,
+                              std::int64_t ldb, std::int64_t stride_b, std::complex<float> *c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb,
+                              std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                              const std::complex<double> *a, std::int64_t lda,
+                              std::int64_t stride_a, std::complex<double> beta,
+                              const std::complex<double> *b, std::int64_t ldb,
+                              std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+// Graph APIs
+
+cl::sycl::event replay(cl::sycl::queue &queue, const oneapi::mkl::blas::graph<float> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+cl::sycl::event replay(cl::sycl::queue &queue, const oneapi::mkl::blas::graph<double> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies = {});
+
+// Gemm algorithm hints
+
+void set_gemm_algorithm(cl::sycl::queue &queue, gemm_algorithm algorithm, std::int64_t cutoff);
+
+// Reproducibility
+
+void set_reproducibility(cl::sycl::queue &queue, reproducibility mode);
+
+// Performance counters
+
+void set_perf_counters(cl::sycl::queue &queue, bool enable);
+std::vector<oneapi::mkl::blas::perf_counter_record> get_perf_counters(
+    cl::sycl::queue &queue);
+
 } // namespace cublas
 } // namespace mkl
 } // namespace oneapi
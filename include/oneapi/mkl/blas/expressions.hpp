@@ -0,0 +1,416 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_EXPRESSIONS_HPP_
+#define _ONEMKL_BLAS_EXPRESSIONS_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/mkl/blas/blas.hpp"
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace expr {
+
+// Lazy expressions over USM vectors and matrices. Arithmetic on views only
+// records a linear combination
+//
+//     alpha*op(A)*x + c_0*v_0 + ... + c_k*v_k
+//
+// and nothing runs until evaluate() assigns it to a vector. evaluate() folds
+// repeated vectors together and then runs at most one streaming kernel for the
+// vector terms plus one gemv for the matrix-vector product, so that e.g.
+// y = alpha*A*x + beta*y is a single gemv and r = b - y is a single pass over
+// r, b and y. Supported element types are float and double.
+
+template <typename T>
+struct vector_view {
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                  "BLAS expressions support float and double only");
+
+    vector_view(T *data, std::int64_t n, std::int64_t inc = 1) : data(data), n(n), inc(inc) {}
+
+    T *data;
+    std::int64_t n;
+    std::int64_t inc;
+};
+
+template <typename T>
+struct matrix_view {
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                  "BLAS expressions support float and double only");
+
+    matrix_view(const T *data, std::int64_t m, std::int64_t n, std::int64_t ld,
+                transpose trans = transpose::nontrans, T alpha = T(1))
+            : data(data),
+              m(m),
+              n(n),
+              ld(ld),
+              trans(trans),
+              alpha(alpha) {}
+
+    const T *data;
+    std::int64_t m, n, ld;
+    transpose trans;
+    T alpha;
+};
+
+template <typename T>
+class linear_expr {
+public:
+    struct term {
+        T coeff;
+        const T *data;
+        std::int64_t inc;
+    };
+
+    linear_expr(vector_view<T> v) : n_(v.n), has_matvec_(false), a_(nullptr, 0, 0, 0) {
+        add_term({ T(1), v.data, v.inc });
+    }
+
+    linear_expr(std::int64_t n, matrix_view<T> a, const T *x, std::int64_t incx)
+            : n_(n),
+              has_matvec_(true),
+              a_(a),
+              x_(x),
+              incx_(incx) {}
+
+    std::int64_t size() const {
+        return n_;
+    }
+
+    const std::vector<term> &terms() const {
+        return terms_;
+    }
+
+    bool has_matvec() const {
+        return has_matvec_;
+    }
+
+    const matrix_view<T> &matrix() const {
+        return a_;
+    }
+
+    const T *matvec_x() const {
+        return x_;
+    }
+
+    std::int64_t matvec_incx() const {
+        return incx_;
+    }
+
+    linear_expr &operator*=(T alpha) {
+        for (auto &t : terms_)
+            t.coeff *= alpha;
+        a_.alpha *= alpha;
+        return *this;
+    }
+
+    linear_expr &operator+=(const linear_expr &other) {
+        if (n_ != other.n_)
+            throw InvalidArgumentsException("BLAS expression operands have different sizes");
+        if (other.has_matvec_) {
+            if (has_matvec_)
+                throw InvalidArgumentsException(
+                    "BLAS expression holds more than one matrix-vector product");
+            has_matvec_ = true;
+            a_ = other.a_;
+            x_ = other.x_;
+            incx_ = other.incx_;
+        }
+        for (auto &t : other.terms_)
+            add_term(t);
+        return *this;
+    }
+
+private:
+    // Repeated vectors are folded into one term so that they are read once.
+    void add_term(const term &t) {
+        for (auto &u : terms_) {
+            if (u.data == t.data && u.inc == t.inc) {
+                u.coeff += t.coeff;
+                return;
+            }
+        }
+        terms_.push_back(t);
+    }
+
+    std::int64_t n_;
+    std::vector<term> terms_;
+    bool has_matvec_;
+    matrix_view<T> a_;
+    const T *x_ = nullptr;
+    std::int64_t incx_ = 0;
+};
+
+// Building expressions. Scalars take the element type of the view they
+// scale, so that literals such as 2.0 or 2 also scale float views.
+
+namespace detail {
+
+template <typename T>
+struct scalar_of {
+    typedef T type;
+};
+
+} // namespace detail
+
+template <typename T>
+matrix_view<T> operator*(typename detail::scalar_of<T>::type alpha, matrix_view<T> a) {
+    a.alpha *= alpha;
+    return a;
+}
+
+template <typename T>
+linear_expr<T> operator*(matrix_view<T> a, vector_view<T> x) {
+    const std::int64_t rows = (a.trans == transpose::nontrans) ? a.m : a.n;
+    const std::int64_t cols = (a.trans == transpose::nontrans) ? a.n : a.m;
+    if (x.n != cols)
+        throw InvalidArgumentsException("BLAS expression operands have different sizes");
+    return linear_expr<T>(rows, a, x.data, x.inc);
+}
+
+template <typename T>
+linear_expr<T> operator*(typename detail::scalar_of<T>::type alpha, linear_expr<T> e) {
+    e *= alpha;
+    return e;
+}
+
+template <typename T>
+linear_expr<T> operator*(typename detail::scalar_of<T>::type alpha, vector_view<T> v) {
+    return alpha * linear_expr<T>(v);
+}
+
+template <typename T>
+linear_expr<T> operator-(linear_expr<T> e) {
+    e *= T(-1);
+    return e;
+}
+
+template <typename T>
+linear_expr<T> operator-(vector_view<T> v) {
+    return -linear_expr<T>(v);
+}
+
+template <typename T>
+linear_expr<T> operator+(linear_expr<T> l, const linear_expr<T> &r) {
+    l += r;
+    return l;
+}
+
+template <typename T>
+linear_expr<T> operator+(linear_expr<T> l, vector_view<T> r) {
+    return l + linear_expr<T>(r);
+}
+
+template <typename T>
+linear_expr<T> operator+(vector_view<T> l, const linear_expr<T> &r) {
+    return linear_expr<T>(l) + r;
+}
+
+template <typename T>
+linear_expr<T> operator+(vector_view<T> l, vector_view<T> r) {
+    return linear_expr<T>(l) + linear_expr<T>(r);
+}
+
+template <typename T>
+linear_expr<T> operator-(linear_expr<T> l, const linear_expr<T> &r) {
+    return l + (-r);
+}
+
+template <typename T>
+linear_expr<T> operator-(linear_expr<T> l, vector_view<T> r) {
+    return l + (-r);
+}
+
+template <typename T>
+linear_expr<T> operator-(vector_view<T> l, const linear_expr<T> &r) {
+    return linear_expr<T>(l) + (-r);
+}
+
+template <typename T>
+linear_expr<T> operator-(vector_view<T> l, vector_view<T> r) {
+    return linear_expr<T>(l) + (-r);
+}
+
+namespace detail {
+
+// Number of vectors one streaming pass reads; longer combinations are
+// accumulated into the destination over several passes.
+constexpr int max_stream_terms = 4;
+
+template <typename T>
+struct stream_terms {
+    T coeff[max_stream_terms];
+    const T *data[max_stream_terms];
+    std::int64_t inc[max_stream_terms];
+    int count;
+};
+
+template <typename T>
+class expr_stream_kernel;
+
+// Element i of a BLAS vector of length n, including for negative increments.
+inline std::int64_t element(std::int64_t i, std::int64_t n, std::int64_t inc) {
+    return (inc > 0) ? i * inc : (n - 1 - i) * (-inc);
+}
+
+template <typename T>
+cl::sycl::event stream(cl::sycl::queue &queue, vector_view<T> y, const stream_terms<T> &terms,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        std::int64_t num_events = dependencies.size();
+        for (std::int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        const stream_terms<T> t = terms;
+        T *y_data = y.data;
+        const std::int64_t n = y.n, incy = y.inc;
+        cgh.parallel_for<expr_stream_kernel<T>>(cl::sycl::range<1>(n), [=](cl::sycl::id<1> id) {
+            const std::int64_t i = id[0];
+            T sum = T(0);
+            for (int k = 0; k < t.count; k++)
+                sum += t.coeff[k] * t.data[k][element(i, n, t.inc[k])];
+            y_data[element(i, n, incy)] = sum;
+        });
+    });
+}
+
+// Routes the single BLAS call an expression needs through the run-time API,
+// or through the compile-time API of one backend.
+struct run_time_dispatch {
+    template <typename... Args>
+    static cl::sycl::event gemv(cl::sycl::queue &queue, Args... args) {
+        return oneapi::mkl::blas::gemv(queue, args...);
+    }
+};
+
+template <oneapi::mkl::backend backend>
+struct compile_time_dispatch {
+    template <typename... Args>
+    static cl::sycl::event gemv(cl::sycl::queue &queue, Args... args) {
+        return oneapi::mkl::blas::gemv<backend>(queue, args...);
+    }
+};
+
+template <typename Dispatch, typename T>
+cl::sycl::event evaluate(cl::sycl::queue &queue, vector_view<T> y, const linear_expr<T> &e,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    if (y.n != e.size())
+        throw InvalidArgumentsException("BLAS expression assigned to a vector of another size");
+    if (e.has_matvec() && e.matvec_x() == y.data)
+        throw InvalidArgumentsException("BLAS expression multiplies its destination by a matrix");
+
+    // The destination goes first so each pass reads it before overwriting it.
+    std::vector<typename linear_expr<T>::term> terms;
+    T beta = T(0);
+    bool reads_y = false;
+    for (auto &t : e.terms()) {
+        if (t.data == y.data) {
+            if (t.inc != y.inc)
+                throw InvalidArgumentsException(
+                    "BLAS expression reads its destination with another increment");
+            beta = t.coeff;
+            reads_y = true;
+            terms.insert(terms.begin(), t);
+        }
+        else if (t.coeff != T(0)) {
+            terms.push_back(t);
+        }
+    }
+
+    cl::sycl::vector_class<cl::sycl::event> deps(dependencies);
+    cl::sycl::event done;
+
+    // With a product, a lone beta*y term is left to gemv.
+    const bool stream_all = !e.has_matvec() || terms.size() > (reads_y ? 1u : 0u);
+    if (stream_all) {
+        std::size_t next = 0;
+        do {
+            stream_terms<T> chunk;
+            chunk.count = 0;
+            if (next > 0) {
+                chunk.coeff[0] = T(1);
+                chunk.data[0] = y.data;
+                chunk.inc[0] = y.inc;
+                chunk.count = 1;
+            }
+            while (chunk.count < max_stream_terms && next < terms.size()) {
+                chunk.coeff[chunk.count] = terms[next].coeff;
+                chunk.data[chunk.count] = terms[next].data;
+                chunk.inc[chunk.count] = terms[next].inc;
+                chunk.count++;
+                next++;
+            }
+            done = stream(queue, y, chunk, deps);
+            deps = { done };
+        } while (next < terms.size());
+        beta = T(1);
+    }
+
+    if (e.has_matvec()) {
+        auto &a = e.matrix();
+        done = Dispatch::gemv(queue, a.trans, a.m, a.n, a.alpha, a.data, a.ld, e.matvec_x(),
+                              e.matvec_incx(), beta, y.data, y.inc, deps);
+    }
+    return done;
+}
+
+} // namespace detail
+
+// Evaluates e into y through the run-time dispatch API. x in alpha*op(A)*x
+// must not alias y.
+template <typename T>
+cl::sycl::event evaluate(cl::sycl::queue &queue, vector_view<T> y, const linear_expr<T> &e,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    return detail::evaluate<detail::run_time_dispatch>(queue, y, e, dependencies);
+}
+
+template <typename T>
+cl::sycl::event evaluate(cl::sycl::queue &queue, vector_view<T> y, vector_view<T> v,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    return evaluate(queue, y, linear_expr<T>(v), dependencies);
+}
+
+// Evaluates e into y through the compile-time dispatch API of one backend.
+template <oneapi::mkl::backend backend, typename T>
+cl::sycl::event evaluate(cl::sycl::queue &queue, vector_view<T> y, const linear_expr<T> &e,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    return detail::evaluate<detail::compile_time_dispatch<backend>>(queue, y, e, dependencies);
+}
+
+template <oneapi::mkl::backend backend, typename T>
+cl::sycl::event evaluate(cl::sycl::queue &queue, vector_view<T> y, vector_view<T> v,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}) {
+    return evaluate<backend>(queue, y, linear_expr<T>(v), dependencies);
+}
+
+} // namespace expr
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_EXPRESSIONS_HPP_
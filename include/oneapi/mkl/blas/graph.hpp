@@ -0,0 +1,261 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GRAPH_HPP_
+#define _ONEMKL_BLAS_GRAPH_HPP_
+
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "oneapi/mkl/detail/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+enum class graph_routine : char { axpy, scal, copy, dot, gemv, gemm };
+
+// A graph records a fixed sequence of BLAS calls once so that it can be
+// replayed many times with blas::replay. Arguments are bound to USM pointers
+// or to buffers, but not both within one graph. Scalars are either constants
+// or handles from add_scalar, whose values may change between replays; a
+// handle is only valid for the graph that created it, or copies of it.
+// Supported element types are float and double.
+template <typename T>
+class graph {
+public:
+    class scalar {
+    public:
+        scalar(T value) : value_(value), id_(-1), graph_id_(0) {}
+
+    private:
+        friend class graph;
+        scalar(T value, std::int64_t id, std::uint64_t graph_id)
+                : value_(value),
+                  id_(id),
+                  graph_id_(graph_id) {}
+
+        T value_;
+        std::int64_t id_;
+        std::uint64_t graph_id_;
+    };
+
+    class operand {
+    public:
+        operand(T *ptr) : ptr_(ptr) {}
+        operand(const T *ptr) : ptr_(const_cast<T *>(ptr)) {}
+        operand(cl::sycl::buffer<T, 1> &buf)
+                : ptr_(nullptr),
+                  buf_(std::make_shared<cl::sycl::buffer<T, 1>>(buf)) {}
+
+    private:
+        friend class graph;
+
+        T *ptr_;
+        std::shared_ptr<cl::sycl::buffer<T, 1>> buf_;
+    };
+
+    // One recorded call. Vector routines keep x, y and the dot result in a, b
+    // and c, with incx and incy in lda and ldb; gemv keeps x and y in b and c.
+    // buffer_a, buffer_b and buffer_c index buffers() and are -1 for USM or
+    // unused operands; alpha and beta index scalars().
+    struct node {
+        graph_routine routine;
+        transpose transa, transb;
+        std::int64_t m, n, k;
+        std::int64_t alpha, beta;
+        T *a, *b, *c;
+        std::int64_t buffer_a, buffer_b, buffer_c;
+        std::int64_t lda, ldb, ldc;
+    };
+
+    graph() : id_(next_id()) {}
+
+    scalar add_scalar(T value) {
+        scalars_.push_back(value);
+        return scalar(value, scalars_.size() - 1, id_);
+    }
+
+    void set_scalar(const scalar &s, T value) {
+        check_owned(s);
+        scalars_[s.id_] = value;
+    }
+
+    void axpy(std::int64_t n, scalar alpha, operand x, std::int64_t incx, operand y,
+              std::int64_t incy) {
+        node nd = make_node(graph_routine::axpy);
+        nd.n = n;
+        nd.alpha = slot(alpha);
+        bind(x, nd.a, nd.buffer_a);
+        nd.lda = incx;
+        bind(y, nd.b, nd.buffer_b);
+        nd.ldb = incy;
+        nodes_.push_back(nd);
+    }
+
+    void scal(std::int64_t n, scalar alpha, operand x, std::int64_t incx) {
+        node nd = make_node(graph_routine::scal);
+        nd.n = n;
+        nd.alpha = slot(alpha);
+        bind(x, nd.a, nd.buffer_a);
+        nd.lda = incx;
+        nodes_.push_back(nd);
+    }
+
+    void copy(std::int64_t n, operand x, std::int64_t incx, operand y, std::int64_t incy) {
+        node nd = make_node(graph_routine::copy);
+        nd.n = n;
+        bind(x, nd.a, nd.buffer_a);
+        nd.lda = incx;
+        bind(y, nd.b, nd.buffer_b);
+        nd.ldb = incy;
+        nodes_.push_back(nd);
+    }
+
+    void dot(std::int64_t n, operand x, std::int64_t incx, operand y, std::int64_t incy,
+             operand result) {
+        node nd = make_node(graph_routine::dot);
+        nd.n = n;
+        bind(x, nd.a, nd.buffer_a);
+        nd.lda = incx;
+        bind(y, nd.b, nd.buffer_b);
+        nd.ldb = incy;
+        bind(result, nd.c, nd.buffer_c);
+        nodes_.push_back(nd);
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, scalar alpha, operand a,
+              std::int64_t lda, operand x, std::int64_t incx, scalar beta, operand y,
+              std::int64_t incy) {
+        node nd = make_node(graph_routine::gemv);
+        nd.transa = trans;
+        nd.m = m;
+        nd.n = n;
+        nd.alpha = slot(alpha);
+        bind(a, nd.a, nd.buffer_a);
+        nd.lda = lda;
+        bind(x, nd.b, nd.buffer_b);
+        nd.ldb = incx;
+        nd.beta = slot(beta);
+        bind(y, nd.c, nd.buffer_c);
+        nd.ldc = incy;
+        nodes_.push_back(nd);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              scalar alpha, operand a, std::int64_t lda, operand b, std::int64_t ldb, scalar beta,
+              operand c, std::int64_t ldc) {
+        node nd = make_node(graph_routine::gemm);
+        nd.transa = transa;
+        nd.transb = transb;
+        nd.m = m;
+        nd.n = n;
+        nd.k = k;
+        nd.alpha = slot(alpha);
+        bind(a, nd.a, nd.buffer_a);
+        nd.lda = lda;
+        bind(b, nd.b, nd.buffer_b);
+        nd.ldb = ldb;
+        nd.beta = slot(beta);
+        bind(c, nd.c, nd.buffer_c);
+        nd.ldc = ldc;
+        nodes_.push_back(nd);
+    }
+
+    const std::vector<node> &nodes() const {
+        return nodes_;
+    }
+
+    const std::vector<T> &scalars() const {
+        return scalars_;
+    }
+
+    const std::vector<std::shared_ptr<cl::sycl::buffer<T, 1>>> &buffers() const {
+        return buffers_;
+    }
+
+    bool uses_buffers() const {
+        return !buffers_.empty();
+    }
+
+private:
+    static node make_node(graph_routine routine) {
+        node nd = { routine, transpose::nontrans, transpose::nontrans, 0, 0, 0, -1, -1,
+                    nullptr, nullptr, nullptr, -1, -1, -1, 0, 0, 0 };
+        return nd;
+    }
+
+    void check_owned(const scalar &s) const {
+        if (s.id_ < 0)
+            throw InvalidArgumentsException("graph scalar was not created by add_scalar");
+        if (s.graph_id_ != id_ || s.id_ >= static_cast<std::int64_t>(scalars_.size()))
+            throw InvalidArgumentsException("graph scalar belongs to another graph");
+    }
+
+    // Graph ids start at 1, so that no graph owns constant scalars.
+    static std::uint64_t next_id() {
+        static std::atomic<std::uint64_t> last_id{ 0 };
+        return ++last_id;
+    }
+
+    std::int64_t slot(const scalar &s) {
+        if (s.id_ >= 0) {
+            check_owned(s);
+            return s.id_;
+        }
+        scalars_.push_back(s.value_);
+        return scalars_.size() - 1;
+    }
+
+    void bind(const operand &op, T *&ptr, std::int64_t &buffer) {
+        if (!op.buf_) {
+            if (uses_buffers())
+                throw InvalidArgumentsException("graph mixes USM pointers and buffers");
+            uses_usm_ = true;
+            ptr = op.ptr_;
+            return;
+        }
+        if (uses_usm_)
+            throw InvalidArgumentsException("graph mixes USM pointers and buffers");
+        for (std::size_t i = 0; i < buffers_.size(); i++) {
+            if (*buffers_[i] == *op.buf_) {
+                buffer = i;
+                return;
+            }
+        }
+        buffers_.push_back(op.buf_);
+        buffer = buffers_.size() - 1;
+    }
+
+    std::uint64_t id_;
+    std::vector<node> nodes_;
+    std::vector<T> scalars_;
+    std::vector<std::shared_ptr<cl::sycl::buffer<T, 1>>> buffers_;
+    bool uses_usm_ = false;
+};
+
+} //namespace blas
+} //namespace mkl
+} //namespace oneapi
+
+#endif //_ONEMKL_BLAS_GRAPH_HPP_
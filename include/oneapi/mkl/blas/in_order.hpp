@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_IN_ORDER_HPP_
+#define _ONEMKL_BLAS_IN_ORDER_HPP_
+
+#include <CL/sycl.hpp>
+#include <utility>
+
+#include "oneapi/mkl/blas/blas.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace in_order {
+
+namespace detail {
+
+inline void check_in_order(const cl::sycl::queue &queue) {
+    if (!queue.has_property<cl::sycl::property::queue::in_order>())
+        throw oneapi::mkl::InvalidArgumentsException(
+            "in_order: the queue does not have the in_order property");
+}
+
+} // namespace detail
+
+// in_order::X(queue, args...) submits the routine X(queue, args...) to an
+// in-order queue without dependencies and without returning its event, for
+// pipelines that rely on the order of the queue and only synchronize with
+// queue.wait(). Each submission then depends on the previous one alone,
+// which the backends do not need to register. Queues without the in_order
+// property throw oneapi::mkl::InvalidArgumentsException, as the calls would
+// not be ordered.
+#define ONEMKL_BLAS_DECLARE_IN_ORDER(name)                                     \
+    template <typename... Args>                                                \
+    void name(cl::sycl::queue &queue, Args &&... args) {                       \
+        detail::check_in_order(queue);                                         \
+        (void)oneapi::mkl::blas::name(queue, std::forward<Args>(args)...);     \
+    }
+
+// Level 1
+
+ONEMKL_BLAS_DECLARE_IN_ORDER(asum)
+ONEMKL_BLAS_DECLARE_IN_ORDER(axpy)
+ONEMKL_BLAS_DECLARE_IN_ORDER(axpy_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(copy)
+ONEMKL_BLAS_DECLARE_IN_ORDER(dot)
+ONEMKL_BLAS_DECLARE_IN_ORDER(dotc)
+ONEMKL_BLAS_DECLARE_IN_ORDER(dotu)
+ONEMKL_BLAS_DECLARE_IN_ORDER(iamax)
+ONEMKL_BLAS_DECLARE_IN_ORDER(iamin)
+ONEMKL_BLAS_DECLARE_IN_ORDER(nrm2)
+ONEMKL_BLAS_DECLARE_IN_ORDER(rot)
+ONEMKL_BLAS_DECLARE_IN_ORDER(rotg)
+ONEMKL_BLAS_DECLARE_IN_ORDER(rotm)
+ONEMKL_BLAS_DECLARE_IN_ORDER(rotmg)
+ONEMKL_BLAS_DECLARE_IN_ORDER(scal)
+ONEMKL_BLAS_DECLARE_IN_ORDER(sdsdot)
+ONEMKL_BLAS_DECLARE_IN_ORDER(swap)
+
+// Level 2
+
+ONEMKL_BLAS_DECLARE_IN_ORDER(gbmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(ger)
+ONEMKL_BLAS_DECLARE_IN_ORDER(gerc)
+ONEMKL_BLAS_DECLARE_IN_ORDER(geru)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hbmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hemv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(her)
+ONEMKL_BLAS_DECLARE_IN_ORDER(her2)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hpmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hpr)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hpr2)
+ONEMKL_BLAS_DECLARE_IN_ORDER(sbmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(spmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(spr)
+ONEMKL_BLAS_DECLARE_IN_ORDER(spr2)
+ONEMKL_BLAS_DECLARE_IN_ORDER(symv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(syr)
+ONEMKL_BLAS_DECLARE_IN_ORDER(syr2)
+ONEMKL_BLAS_DECLARE_IN_ORDER(tbmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(tbsv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(tpmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(tpsv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(trmv)
+ONEMKL_BLAS_DECLARE_IN_ORDER(trsv)
+
+// Level 3
+
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemm)
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemm_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(hemm)
+ONEMKL_BLAS_DECLARE_IN_ORDER(her2k)
+ONEMKL_BLAS_DECLARE_IN_ORDER(herk)
+ONEMKL_BLAS_DECLARE_IN_ORDER(symm)
+ONEMKL_BLAS_DECLARE_IN_ORDER(syr2k)
+ONEMKL_BLAS_DECLARE_IN_ORDER(syrk)
+ONEMKL_BLAS_DECLARE_IN_ORDER(trmm)
+ONEMKL_BLAS_DECLARE_IN_ORDER(trsm)
+
+// BLAS-like extensions
+
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemm3m)
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemm3m_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(gemmt)
+ONEMKL_BLAS_DECLARE_IN_ORDER(imatcopy)
+ONEMKL_BLAS_DECLARE_IN_ORDER(imatcopy_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(omatadd)
+ONEMKL_BLAS_DECLARE_IN_ORDER(omatadd_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(omatcopy)
+ONEMKL_BLAS_DECLARE_IN_ORDER(omatcopy_batch)
+ONEMKL_BLAS_DECLARE_IN_ORDER(replay)
+
+#undef ONEMKL_BLAS_DECLARE_IN_ORDER
+
+} // namespace in_order
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_IN_ORDER_HPP_
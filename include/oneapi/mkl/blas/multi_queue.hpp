@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_MULTI_QUEUE_HPP_
+#define _ONEMKL_BLAS_MULTI_QUEUE_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+// Returns one queue per NUMA sub-device of device, all sharing one context
+// so that USM allocated on it is usable from every queue. Devices that
+// cannot be partitioned get a single queue.
+ONEMKL_EXPORT cl::sycl::vector_class<cl::sycl::queue> make_sub_device_queues(
+    const cl::sycl::device &device);
+
+// Computes C = alpha*op(A)*op(B) + beta*C as independent C tiles of at most
+// tile rows and columns, spread over queues, which must share one context.
+// Each queue starts with a contiguous share of the tiles and keeps two of
+// them in flight with the run-time gemm; a queue that runs out takes tiles
+// from the end of the largest remaining share. The call returns once every
+// tile has been submitted, with an event that completes after all of them.
+ONEMKL_EXPORT cl::sycl::event gemm_multi_queue(
+    cl::sycl::vector_class<cl::sycl::queue> &queues, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    const cl::sycl::vector_class<cl::sycl::event> &dependencies = {}, std::int64_t tile = 1024);
+
+ONEMKL_EXPORT cl::sycl::event gemm_multi_queue(
+    cl::sycl::vector_class<cl::sycl::queue> &queues, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+    std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+    std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies = {},
+    std::int64_t tile = 1024);
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_MULTI_QUEUE_HPP_
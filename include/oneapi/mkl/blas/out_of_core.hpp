@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_OUT_OF_CORE_HPP_
+#define _ONEMKL_BLAS_OUT_OF_CORE_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+// A column-major matrix stored in a file, with leading dimension ld and its
+// first element offset bytes into the file. Its size is implied by the
+// routine it is passed to, as for a pointer argument.
+struct file_matrix {
+    std::string path;
+    std::int64_t ld;
+    std::int64_t offset;
+};
+
+// Computes C = alpha*op(A)*op(B) + beta*C for operands too large for memory.
+// The files are memory-mapped; C is updated in place, tile by tile, and must
+// not share a file with A or B. Square tiles of at most tile rows and columns
+// are computed in turn by gemm on queue, while the next panels of A and B are
+// read ahead into a second set of buffers and the previous C tile is written
+// back. Working memory is about 6*tile*tile elements of shared USM. The call
+// returns once C has been written. Only available through run-time dispatch
+// on POSIX systems.
+ONEMKL_EXPORT void gemm_out_of_core(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    const file_matrix &a, const file_matrix &b, float beta,
+                                    const file_matrix &c, std::int64_t tile = 4096);
+
+ONEMKL_EXPORT void gemm_out_of_core(cl::sycl::queue &queue, transpose transa, transpose transb,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                    const file_matrix &a, const file_matrix &b, double beta,
+                                    const file_matrix &c, std::int64_t tile = 4096);
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_OUT_OF_CORE_HPP_
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_PERF_COUNTERS_HPP_
+#define _ONEMKL_BLAS_PERF_COUNTERS_HPP_
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+// Hardware counters of one task of a BLAS call, collected on queues where
+// set_perf_counters turned them on. Dimensions the routine does not have
+// are 0; for group APIs m, n and k are 0 and batch is the group count.
+// Counters cover the thread running the task, in user mode, which runs
+// all of the task's work alone while it is counted, and are -1
+// when the system does not make them available, as is common in
+// containers and virtual machines. memory_bytes estimates the memory
+// traffic as one 64-byte line per last-level cache miss.
+struct perf_counter_record {
+    std::string routine;
+    std::int64_t m;
+    std::int64_t n;
+    std::int64_t k;
+    std::int64_t batch;
+    std::uint64_t start_ns;
+    std::uint64_t duration_ns;
+    std::int64_t cycles;
+    std::int64_t instructions;
+    std::int64_t llc_misses;
+    std::int64_t memory_bytes;
+};
+
+// Writes the header line of the CSV format of write_perf_counters_csv.
+inline void write_perf_counters_csv_header(std::ostream &out) {
+    out << "routine,m,n,k,batch,start_ns,duration_ns,cycles,instructions,llc_misses,"
+           "memory_bytes,ipc,memory_gb_per_s\n";
+}
+
+// Writes one record as a CSV line, adding instructions per cycle and memory
+// bandwidth in GB/s where the counters they derive from are available.
+inline void write_perf_counters_csv_line(std::ostream &out, const perf_counter_record &r) {
+    out << r.routine << ',' << r.m << ',' << r.n << ',' << r.k << ',' << r.batch << ','
+        << r.start_ns << ',' << r.duration_ns << ',' << r.cycles << ',' << r.instructions << ','
+        << r.llc_misses << ',' << r.memory_bytes << ',';
+    if (r.cycles > 0 && r.instructions >= 0)
+        out << double(r.instructions) / double(r.cycles);
+    out << ',';
+    if (r.duration_ns > 0 && r.memory_bytes >= 0)
+        out << double(r.memory_bytes) / double(r.duration_ns);
+    out << '\n';
+}
+
+// Writes records as CSV, one line per record after a header line.
+inline void write_perf_counters_csv(std::ostream &out,
+                                    const std::vector<perf_counter_record> &records) {
+    write_perf_counters_csv_header(out);
+    for (auto &r : records)
+        write_perf_counters_csv_line(out, r);
+}
+
+} //namespace blas
+} //namespace mkl
+} //namespace oneapi
+
+#endif //_ONEMKL_BLAS_PERF_COUNTERS_HPP_
@@ -34,6 +34,10 @@ enum class side : char { left = 0, right = 1, L = 0, R = 1 };
 
 enum class offset : char { row = 0, column = 1, fix = 2, R = 0, C = 1, F = 2 };
 
+enum class gemm_algorithm : char { standard = 0, strassen = 1 };
+
+enum class reproducibility : char { off = 0, on = 1, strict = 2 };
+
 // LAPACK flag types.
 enum class job : char {
     novec = 0,
@@ -0,0 +1,836 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+// The MKL BLAS entry points that have a CBLAS counterpart, as column-major
+//  CBLAS calls. The others are in cblas_extensions.cpp.
+
+#include "cblas_compat.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+// Level 1
+
+float sasum(const MKL_INT *n, const float *x, const MKL_INT *incx) {
+    return cblas_sasum(*n, x, *incx);
+}
+
+double dasum(const MKL_INT *n, const double *x, const MKL_INT *incx) {
+    return cblas_dasum(*n, x, *incx);
+}
+
+float scasum(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx) {
+    return cblas_scasum(*n, x, *incx);
+}
+
+double dzasum(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx) {
+    return cblas_dzasum(*n, x, *incx);
+}
+
+void saxpy(const MKL_INT *n, const float *alpha, const float *x, const MKL_INT *incx, float *y,
+           const MKL_INT *incy) {
+    cblas_saxpy(*n, *alpha, x, *incx, y, *incy);
+}
+
+void daxpy(const MKL_INT *n, const double *alpha, const double *x, const MKL_INT *incx, double *y,
+           const MKL_INT *incy) {
+    cblas_daxpy(*n, *alpha, x, *incx, y, *incy);
+}
+
+void caxpy(const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x, const MKL_INT *incx,
+           MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_caxpy(*n, alpha, x, *incx, y, *incy);
+}
+
+void zaxpy(const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zaxpy(*n, alpha, x, *incx, y, *incy);
+}
+
+void scopy(const MKL_INT *n, const float *x, const MKL_INT *incx, float *y, const MKL_INT *incy) {
+    cblas_scopy(*n, x, *incx, y, *incy);
+}
+
+void dcopy(const MKL_INT *n, const double *x, const MKL_INT *incx, double *y, const MKL_INT *incy) {
+    cblas_dcopy(*n, x, *incx, y, *incy);
+}
+
+void ccopy(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy) {
+    cblas_ccopy(*n, x, *incx, y, *incy);
+}
+
+void zcopy(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy) {
+    cblas_zcopy(*n, x, *incx, y, *incy);
+}
+
+float sdot(const MKL_INT *n, const float *x, const MKL_INT *incx, const float *y,
+           const MKL_INT *incy) {
+    return cblas_sdot(*n, x, *incx, y, *incy);
+}
+
+double ddot(const MKL_INT *n, const double *x, const MKL_INT *incx, const double *y,
+            const MKL_INT *incy) {
+    return cblas_ddot(*n, x, *incx, y, *incy);
+}
+
+double dsdot(const MKL_INT *n, const float *x, const MKL_INT *incx, const float *y,
+             const MKL_INT *incy) {
+    return cblas_dsdot(*n, x, *incx, y, *incy);
+}
+
+float sdsdot(const MKL_INT *n, const float *sb, const float *x, const MKL_INT *incx, const float *y,
+             const MKL_INT *incy) {
+    return cblas_sdsdot(*n, *sb, x, *incx, y, *incy);
+}
+
+void cdotc(MKL_Complex8 *result, const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_cdotc_sub(*n, x, *incx, y, *incy, result);
+}
+
+void zdotc(MKL_Complex16 *result, const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zdotc_sub(*n, x, *incx, y, *incy, result);
+}
+
+void cdotu(MKL_Complex8 *result, const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_cdotu_sub(*n, x, *incx, y, *incy, result);
+}
+
+void zdotu(MKL_Complex16 *result, const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zdotu_sub(*n, x, *incx, y, *incy, result);
+}
+
+float snrm2(const MKL_INT *n, const float *x, const MKL_INT *incx) {
+    return cblas_snrm2(*n, x, *incx);
+}
+
+double dnrm2(const MKL_INT *n, const double *x, const MKL_INT *incx) {
+    return cblas_dnrm2(*n, x, *incx);
+}
+
+float scnrm2(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx) {
+    return cblas_scnrm2(*n, x, *incx);
+}
+
+double dznrm2(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx) {
+    return cblas_dznrm2(*n, x, *incx);
+}
+
+void srot(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy,
+          const float *c, const float *s) {
+    cblas_srot(*n, x, *incx, y, *incy, *c, *s);
+}
+
+void drot(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy,
+          const double *c, const double *s) {
+    cblas_drot(*n, x, *incx, y, *incy, *c, *s);
+}
+
+void srotg(float *a, float *b, float *c, float *s) {
+    cblas_srotg(a, b, c, s);
+}
+
+void drotg(double *a, double *b, double *c, double *s) {
+    cblas_drotg(a, b, c, s);
+}
+
+void srotm(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy,
+           const float *param) {
+    cblas_srotm(*n, x, *incx, y, *incy, param);
+}
+
+void drotm(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy,
+           const double *param) {
+    cblas_drotm(*n, x, *incx, y, *incy, param);
+}
+
+void srotmg(float *d1, float *d2, float *x1, const float *y1, float *param) {
+    cblas_srotmg(d1, d2, x1, *y1, param);
+}
+
+void drotmg(double *d1, double *d2, double *x1, const double *y1, double *param) {
+    cblas_drotmg(d1, d2, x1, *y1, param);
+}
+
+void sscal(const MKL_INT *n, const float *alpha, float *x, const MKL_INT *incx) {
+    cblas_sscal(*n, *alpha, x, *incx);
+}
+
+void dscal(const MKL_INT *n, const double *alpha, double *x, const MKL_INT *incx) {
+    cblas_dscal(*n, *alpha, x, *incx);
+}
+
+void cscal(const MKL_INT *n, const MKL_Complex8 *alpha, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_cscal(*n, alpha, x, *incx);
+}
+
+void zscal(const MKL_INT *n, const MKL_Complex16 *alpha, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_zscal(*n, alpha, x, *incx);
+}
+
+void csscal(const MKL_INT *n, const float *alpha, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_csscal(*n, *alpha, x, *incx);
+}
+
+void zdscal(const MKL_INT *n, const double *alpha, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_zdscal(*n, *alpha, x, *incx);
+}
+
+void sswap(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy) {
+    cblas_sswap(*n, x, *incx, y, *incy);
+}
+
+void dswap(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy) {
+    cblas_dswap(*n, x, *incx, y, *incy);
+}
+
+void cswap(const MKL_INT *n, MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy) {
+    cblas_cswap(*n, x, *incx, y, *incy);
+}
+
+void zswap(const MKL_INT *n, MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy) {
+    cblas_zswap(*n, x, *incx, y, *incy);
+}
+
+// Level 2
+
+void sgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const float *alpha, const float *a, const MKL_INT *lda,
+           const float *x, const MKL_INT *incx, const float *beta, float *y, const MKL_INT *incy) {
+    cblas_sgbmv(CblasColMajor, transpose_of(trans), *m, *n, *kl, *ku, *alpha, a, *lda, x, *incx,
+                *beta, y, *incy);
+}
+
+void dgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const double *alpha, const double *a, const MKL_INT *lda,
+           const double *x, const MKL_INT *incx, const double *beta, double *y,
+           const MKL_INT *incy) {
+    cblas_dgbmv(CblasColMajor, transpose_of(trans), *m, *n, *kl, *ku, *alpha, a, *lda, x, *incx,
+                *beta, y, *incy);
+}
+
+void cgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *x, const MKL_INT *incx, const MKL_Complex8 *beta, MKL_Complex8 *y,
+           const MKL_INT *incy) {
+    cblas_cgbmv(CblasColMajor, transpose_of(trans), *m, *n, *kl, *ku, alpha, a, *lda, x, *incx,
+                beta, y, *incy);
+}
+
+void zgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zgbmv(CblasColMajor, transpose_of(trans), *m, *n, *kl, *ku, alpha, a, *lda, x, *incx,
+                beta, y, *incy);
+}
+
+void sgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const float *alpha,
+           const float *a, const MKL_INT *lda, const float *x, const MKL_INT *incx,
+           const float *beta, float *y, const MKL_INT *incy) {
+    cblas_sgemv(CblasColMajor, transpose_of(trans), *m, *n, *alpha, a, *lda, x, *incx, *beta, y,
+                *incy);
+}
+
+void dgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const double *alpha,
+           const double *a, const MKL_INT *lda, const double *x, const MKL_INT *incx,
+           const double *beta, double *y, const MKL_INT *incy) {
+    cblas_dgemv(CblasColMajor, transpose_of(trans), *m, *n, *alpha, a, *lda, x, *incx, *beta, y,
+                *incy);
+}
+
+void cgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha,
+           const MKL_Complex8 *a, const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_cgemv(CblasColMajor, transpose_of(trans), *m, *n, alpha, a, *lda, x, *incx, beta, y,
+                *incy);
+}
+
+void zgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zgemv(CblasColMajor, transpose_of(trans), *m, *n, alpha, a, *lda, x, *incx, beta, y,
+                *incy);
+}
+
+void sger(const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, const float *y, const MKL_INT *incy, float *a, const MKL_INT *lda) {
+    cblas_sger(CblasColMajor, *m, *n, *alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void dger(const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, const double *y, const MKL_INT *incy, double *a,
+          const MKL_INT *lda) {
+    cblas_dger(CblasColMajor, *m, *n, *alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void cgerc(const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda) {
+    cblas_cgerc(CblasColMajor, *m, *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void zgerc(const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *y, const MKL_INT *incy, MKL_Complex16 *a,
+           const MKL_INT *lda) {
+    cblas_zgerc(CblasColMajor, *m, *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void cgeru(const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda) {
+    cblas_cgeru(CblasColMajor, *m, *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void zgeru(const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *y, const MKL_INT *incy, MKL_Complex16 *a,
+           const MKL_INT *lda) {
+    cblas_zgeru(CblasColMajor, *m, *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void chbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const MKL_Complex8 *alpha,
+           const MKL_Complex8 *a, const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_chbmv(CblasColMajor, uplo_of(uplo), *n, *k, alpha, a, *lda, x, *incx, beta, y, *incy);
+}
+
+void zhbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zhbmv(CblasColMajor, uplo_of(uplo), *n, *k, alpha, a, *lda, x, *incx, beta, y, *incy);
+}
+
+void ssbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const float *alpha, const float *a,
+           const MKL_INT *lda, const float *x, const MKL_INT *incx, const float *beta, float *y,
+           const MKL_INT *incy) {
+    cblas_ssbmv(CblasColMajor, uplo_of(uplo), *n, *k, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+}
+
+void dsbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const double *alpha,
+           const double *a, const MKL_INT *lda, const double *x, const MKL_INT *incx,
+           const double *beta, double *y, const MKL_INT *incy) {
+    cblas_dsbmv(CblasColMajor, uplo_of(uplo), *n, *k, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+}
+
+void chemv(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx, const MKL_Complex8 *beta,
+           MKL_Complex8 *y, const MKL_INT *incy) {
+    cblas_chemv(CblasColMajor, uplo_of(uplo), *n, alpha, a, *lda, x, *incx, beta, y, *incy);
+}
+
+void zhemv(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy) {
+    cblas_zhemv(CblasColMajor, uplo_of(uplo), *n, alpha, a, *lda, x, *incx, beta, y, *incy);
+}
+
+void ssymv(const char *uplo, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, const float *x, const MKL_INT *incx, const float *beta, float *y,
+           const MKL_INT *incy) {
+    cblas_ssymv(CblasColMajor, uplo_of(uplo), *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+}
+
+void dsymv(const char *uplo, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, const double *x, const MKL_INT *incx, const double *beta, double *y,
+           const MKL_INT *incy) {
+    cblas_dsymv(CblasColMajor, uplo_of(uplo), *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+}
+
+void cher(const char *uplo, const MKL_INT *n, const float *alpha, const MKL_Complex8 *x,
+          const MKL_INT *incx, MKL_Complex8 *a, const MKL_INT *lda) {
+    cblas_cher(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, a, *lda);
+}
+
+void zher(const char *uplo, const MKL_INT *n, const double *alpha, const MKL_Complex16 *x,
+          const MKL_INT *incx, MKL_Complex16 *a, const MKL_INT *lda) {
+    cblas_zher(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, a, *lda);
+}
+
+void ssyr(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, float *a, const MKL_INT *lda) {
+    cblas_ssyr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, a, *lda);
+}
+
+void dsyr(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, double *a, const MKL_INT *lda) {
+    cblas_dsyr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, a, *lda);
+}
+
+void cher2(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda) {
+    cblas_cher2(CblasColMajor, uplo_of(uplo), *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void zher2(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *y, const MKL_INT *incy, MKL_Complex16 *a,
+           const MKL_INT *lda) {
+    cblas_zher2(CblasColMajor, uplo_of(uplo), *n, alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void ssyr2(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+           const MKL_INT *incx, const float *y, const MKL_INT *incy, float *a, const MKL_INT *lda) {
+    cblas_ssyr2(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void dsyr2(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+           const MKL_INT *incx, const double *y, const MKL_INT *incy, double *a,
+           const MKL_INT *lda) {
+    cblas_dsyr2(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, y, *incy, a, *lda);
+}
+
+void chpmv(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *ap,
+           const MKL_Complex8 *x, const MKL_INT *incx, const MKL_Complex8 *beta, MKL_Complex8 *y,
+           const MKL_INT *incy) {
+    cblas_chpmv(CblasColMajor, uplo_of(uplo), *n, alpha, ap, x, *incx, beta, y, *incy);
+}
+
+void zhpmv(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *ap,
+           const MKL_Complex16 *x, const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+           const MKL_INT *incy) {
+    cblas_zhpmv(CblasColMajor, uplo_of(uplo), *n, alpha, ap, x, *incx, beta, y, *incy);
+}
+
+void sspmv(const char *uplo, const MKL_INT *n, const float *alpha, const float *ap, const float *x,
+           const MKL_INT *incx, const float *beta, float *y, const MKL_INT *incy) {
+    cblas_sspmv(CblasColMajor, uplo_of(uplo), *n, *alpha, ap, x, *incx, *beta, y, *incy);
+}
+
+void dspmv(const char *uplo, const MKL_INT *n, const double *alpha, const double *ap,
+           const double *x, const MKL_INT *incx, const double *beta, double *y,
+           const MKL_INT *incy) {
+    cblas_dspmv(CblasColMajor, uplo_of(uplo), *n, *alpha, ap, x, *incx, *beta, y, *incy);
+}
+
+void chpr(const char *uplo, const MKL_INT *n, const float *alpha, const MKL_Complex8 *x,
+          const MKL_INT *incx, MKL_Complex8 *ap) {
+    cblas_chpr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, ap);
+}
+
+void zhpr(const char *uplo, const MKL_INT *n, const double *alpha, const MKL_Complex16 *x,
+          const MKL_INT *incx, MKL_Complex16 *ap) {
+    cblas_zhpr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, ap);
+}
+
+void sspr(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, float *ap) {
+    cblas_sspr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, ap);
+}
+
+void dspr(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, double *ap) {
+    cblas_dspr(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, ap);
+}
+
+void chpr2(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *ap) {
+    cblas_chpr2(CblasColMajor, uplo_of(uplo), *n, alpha, x, *incx, y, *incy, ap);
+}
+
+void zhpr2(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *y, const MKL_INT *incy, MKL_Complex16 *ap) {
+    cblas_zhpr2(CblasColMajor, uplo_of(uplo), *n, alpha, x, *incx, y, *incy, ap);
+}
+
+void sspr2(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+           const MKL_INT *incx, const float *y, const MKL_INT *incy, float *ap) {
+    cblas_sspr2(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, y, *incy, ap);
+}
+
+void dspr2(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+           const MKL_INT *incx, const double *y, const MKL_INT *incy, double *ap) {
+    cblas_dspr2(CblasColMajor, uplo_of(uplo), *n, *alpha, x, *incx, y, *incy, ap);
+}
+
+void stbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx) {
+    cblas_stbmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void dtbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const double *a, const MKL_INT *lda, double *x, const MKL_INT *incx) {
+    cblas_dtbmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void ctbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x,
+           const MKL_INT *incx) {
+    cblas_ctbmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void ztbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x,
+           const MKL_INT *incx) {
+    cblas_ztbmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void stbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx) {
+    cblas_stbsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void dtbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const double *a, const MKL_INT *lda, double *x, const MKL_INT *incx) {
+    cblas_dtbsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void ctbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x,
+           const MKL_INT *incx) {
+    cblas_ctbsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void ztbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x,
+           const MKL_INT *incx) {
+    cblas_ztbsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, *k, a, *lda,
+                x, *incx);
+}
+
+void stpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const float *ap,
+           float *x, const MKL_INT *incx) {
+    cblas_stpmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void dtpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *ap, double *x, const MKL_INT *incx) {
+    cblas_dtpmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void ctpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *ap, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_ctpmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void ztpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *ap, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_ztpmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void stpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const float *ap,
+           float *x, const MKL_INT *incx) {
+    cblas_stpsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void dtpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *ap, double *x, const MKL_INT *incx) {
+    cblas_dtpsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void ctpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *ap, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_ctpsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void ztpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *ap, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_ztpsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, ap, x, *incx);
+}
+
+void strmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const float *a,
+           const MKL_INT *lda, float *x, const MKL_INT *incx) {
+    cblas_strmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void dtrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const double *a,
+           const MKL_INT *lda, double *x, const MKL_INT *incx) {
+    cblas_dtrmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void ctrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_ctrmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void ztrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_ztrmv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void strsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const float *a,
+           const MKL_INT *lda, float *x, const MKL_INT *incx) {
+    cblas_strsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void dtrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n, const double *a,
+           const MKL_INT *lda, double *x, const MKL_INT *incx) {
+    cblas_dtrsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void ctrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x, const MKL_INT *incx) {
+    cblas_ctrsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+void ztrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x, const MKL_INT *incx) {
+    cblas_ztrsv(CblasColMajor, uplo_of(uplo), transpose_of(trans), diag_of(diag), *n, a, *lda, x,
+                *incx);
+}
+
+// Level 3
+
+void sgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const float *alpha, const float *a, const MKL_INT *lda, const float *b,
+           const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc) {
+    cblas_sgemm(CblasColMajor, transpose_of(transa), transpose_of(transb), *m, *n, *k, *alpha, a,
+                *lda, b, *ldb, *beta, c, *ldc);
+}
+
+void dgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const double *alpha, const double *a, const MKL_INT *lda,
+           const double *b, const MKL_INT *ldb, const double *beta, double *c, const MKL_INT *ldc) {
+    cblas_dgemm(CblasColMajor, transpose_of(transa), transpose_of(transb), *m, *n, *k, *alpha, a,
+                *lda, b, *ldb, *beta, c, *ldc);
+}
+
+void cgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+           const MKL_INT *ldc) {
+    cblas_cgemm(CblasColMajor, transpose_of(transa), transpose_of(transb), *m, *n, *k, alpha, a,
+                *lda, b, *ldb, beta, c, *ldc);
+}
+
+void zgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta, MKL_Complex16 *c,
+           const MKL_INT *ldc) {
+    cblas_zgemm(CblasColMajor, transpose_of(transa), transpose_of(transb), *m, *n, *k, alpha, a,
+                *lda, b, *ldb, beta, c, *ldc);
+}
+
+void chemm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+           const MKL_INT *ldc) {
+    cblas_chemm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, alpha, a, *lda, b, *ldb, beta,
+                c, *ldc);
+}
+
+void zhemm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta, MKL_Complex16 *c,
+           const MKL_INT *ldc) {
+    cblas_zhemm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, alpha, a, *lda, b, *ldb, beta,
+                c, *ldc);
+}
+
+void ssymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const float *alpha, const float *a, const MKL_INT *lda, const float *b,
+           const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc) {
+    cblas_ssymm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, *alpha, a, *lda, b, *ldb,
+                *beta, c, *ldc);
+}
+
+void dsymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const double *alpha, const double *a, const MKL_INT *lda, const double *b,
+           const MKL_INT *ldb, const double *beta, double *c, const MKL_INT *ldc) {
+    cblas_dsymm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, *alpha, a, *lda, b, *ldb,
+                *beta, c, *ldc);
+}
+
+void csymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+           const MKL_INT *ldc) {
+    cblas_csymm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, alpha, a, *lda, b, *ldb, beta,
+                c, *ldc);
+}
+
+void zsymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta, MKL_Complex16 *c,
+           const MKL_INT *ldc) {
+    cblas_zsymm(CblasColMajor, side_of(side), uplo_of(uplo), *m, *n, alpha, a, *lda, b, *ldb, beta,
+                c, *ldc);
+}
+
+void cherk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const float *alpha, const MKL_Complex8 *a, const MKL_INT *lda, const float *beta,
+           MKL_Complex8 *c, const MKL_INT *ldc) {
+    cblas_cherk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, *beta,
+                c, *ldc);
+}
+
+void zherk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const double *alpha, const MKL_Complex16 *a, const MKL_INT *lda, const double *beta,
+           MKL_Complex16 *c, const MKL_INT *ldc) {
+    cblas_zherk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, *beta,
+                c, *ldc);
+}
+
+void ssyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const float *alpha, const float *a, const MKL_INT *lda, const float *beta, float *c,
+           const MKL_INT *ldc) {
+    cblas_ssyrk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, *beta,
+                c, *ldc);
+}
+
+void dsyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const double *alpha, const double *a, const MKL_INT *lda, const double *beta, double *c,
+           const MKL_INT *ldc) {
+    cblas_dsyrk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, *beta,
+                c, *ldc);
+}
+
+void csyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc) {
+    cblas_csyrk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, beta, c,
+                *ldc);
+}
+
+void zsyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc) {
+    cblas_zsyrk(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, beta, c,
+                *ldc);
+}
+
+void cher2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+            const MKL_Complex8 *b, const MKL_INT *ldb, const float *beta, MKL_Complex8 *c,
+            const MKL_INT *ldc) {
+    cblas_cher2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, b, *ldb,
+                 *beta, c, *ldc);
+}
+
+void zher2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+            const MKL_Complex16 *b, const MKL_INT *ldb, const double *beta, MKL_Complex16 *c,
+            const MKL_INT *ldc) {
+    cblas_zher2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, b, *ldb,
+                 *beta, c, *ldc);
+}
+
+void ssyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const float *alpha, const float *a, const MKL_INT *lda, const float *b,
+            const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc) {
+    cblas_ssyr2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, b,
+                 *ldb, *beta, c, *ldc);
+}
+
+void dsyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const double *alpha, const double *a, const MKL_INT *lda, const double *b,
+            const MKL_INT *ldb, const double *beta, double *c, const MKL_INT *ldc) {
+    cblas_dsyr2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, *alpha, a, *lda, b,
+                 *ldb, *beta, c, *ldc);
+}
+
+void csyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+            const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+            const MKL_INT *ldc) {
+    cblas_csyr2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, b, *ldb,
+                 beta, c, *ldc);
+}
+
+void zsyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+            const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta, MKL_Complex16 *c,
+            const MKL_INT *ldc) {
+    cblas_zsyr2k(CblasColMajor, uplo_of(uplo), transpose_of(trans), *n, *k, alpha, a, *lda, b, *ldb,
+                 beta, c, *ldc);
+}
+
+void strmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, float *b, const MKL_INT *ldb) {
+    cblas_strmm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+void dtrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, double *b, const MKL_INT *ldb) {
+    cblas_dtrmm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+void ctrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, MKL_Complex8 *b, const MKL_INT *ldb) {
+    cblas_ctrmm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, alpha, a, *lda, b, *ldb);
+}
+
+void ztrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, MKL_Complex16 *b, const MKL_INT *ldb) {
+    cblas_ztrmm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, alpha, a, *lda, b, *ldb);
+}
+
+void strsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, float *b, const MKL_INT *ldb) {
+    cblas_strsm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+void dtrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, double *b, const MKL_INT *ldb) {
+    cblas_dtrsm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+void ctrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, MKL_Complex8 *b, const MKL_INT *ldb) {
+    cblas_ctrsm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, alpha, a, *lda, b, *ldb);
+}
+
+void ztrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, MKL_Complex16 *b, const MKL_INT *ldb) {
+    cblas_ztrsm(CblasColMajor, side_of(side), uplo_of(uplo), transpose_of(transa), diag_of(diag),
+                *m, *n, alpha, a, *lda, b, *ldb);
+}
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
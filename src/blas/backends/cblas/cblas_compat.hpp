@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CBLAS_COMPAT_HPP_
+#define _ONEMKL_CBLAS_COMPAT_HPP_
+
+#include <cblas.h>
+#include <complex>
+#include <cstddef>
+
+#include "mkl_blas.h"
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+
+// The BLAS character arguments as CBLAS enums. Anything unrecognized takes the
+//  default a Fortran BLAS would, as MKL does not check them either.
+
+inline CBLAS_TRANSPOSE transpose_of(const char *trans) {
+    switch (*trans) {
+        case 'T':
+        case 't': return CblasTrans;
+        case 'C':
+        case 'c': return CblasConjTrans;
+        default: return CblasNoTrans;
+    }
+}
+
+inline CBLAS_UPLO uplo_of(const char *uplo) {
+    return (*uplo == 'U' || *uplo == 'u') ? CblasUpper : CblasLower;
+}
+
+inline CBLAS_DIAG diag_of(const char *diag) {
+    return (*diag == 'U' || *diag == 'u') ? CblasUnit : CblasNonUnit;
+}
+
+inline CBLAS_SIDE side_of(const char *side) {
+    return (*side == 'L' || *side == 'l') ? CblasLeft : CblasRight;
+}
+
+inline bool is_transposed(char trans) {
+    return trans == 'T' || trans == 't' || trans == 'C' || trans == 'c';
+}
+
+inline bool is_conjugated(char trans) {
+    return trans == 'C' || trans == 'c' || trans == 'R' || trans == 'r';
+}
+
+inline bool is_row_major(char ordering) {
+    return ordering == 'R' || ordering == 'r';
+}
+
+template <typename T>
+inline T conjugate(T x) {
+    return x;
+}
+
+template <typename T>
+inline std::complex<T> conjugate(std::complex<T> x) {
+    return std::conj(x);
+}
+
+// The gemm of each type, for the templates of cblas_extensions.cpp.
+
+inline void gemm(const char *transa, const char *transb, MKL_INT m, MKL_INT n, MKL_INT k,
+                 float alpha, const float *a, MKL_INT lda, const float *b, MKL_INT ldb,
+                 float beta, float *c, MKL_INT ldc) {
+    ::sgemm(transa, transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+inline void gemm(const char *transa, const char *transb, MKL_INT m, MKL_INT n, MKL_INT k,
+                 double alpha, const double *a, MKL_INT lda, const double *b, MKL_INT ldb,
+                 double beta, double *c, MKL_INT ldc) {
+    ::dgemm(transa, transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+inline void gemm(const char *transa, const char *transb, MKL_INT m, MKL_INT n, MKL_INT k,
+                 MKL_Complex8 alpha, const MKL_Complex8 *a, MKL_INT lda, const MKL_Complex8 *b,
+                 MKL_INT ldb, MKL_Complex8 beta, MKL_Complex8 *c, MKL_INT ldc) {
+    ::cgemm(transa, transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+inline void gemm(const char *transa, const char *transb, MKL_INT m, MKL_INT n, MKL_INT k,
+                 MKL_Complex16 alpha, const MKL_Complex16 *a, MKL_INT lda,
+                 const MKL_Complex16 *b, MKL_INT ldb, MKL_Complex16 beta, MKL_Complex16 *c,
+                 MKL_INT ldc) {
+    ::zgemm(transa, transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CBLAS_COMPAT_HPP_
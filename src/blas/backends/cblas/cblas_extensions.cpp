@@ -0,0 +1,724 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// The MKL entry points with no CBLAS counterpart: axpby and the complex
+//  rotations, i?amin, gemmt, gemm3m, the group batches, the integer gemm and
+//  the matrix copies and additions of mkl_trans.h. The level 3 ones are blocked
+//  over CBLAS gemm calls so that they run at the speed of the CBLAS underneath.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cblas_compat.hpp"
+#include "mkl_cblas.h"
+#include "mkl_service.h"
+#include "mkl_trans.h"
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+
+// First element of a strided vector, from its end when the increment is
+//  negative as in the reference BLAS.
+template <typename T>
+inline T *first_element(T *x, MKL_INT n, MKL_INT incx) {
+    return (incx < 0) ? x + static_cast<int64_t>(1 - n) * incx : x;
+}
+
+template <typename T>
+void axpby(MKL_INT n, T alpha, const T *x, MKL_INT incx, T beta, T *y, MKL_INT incy) {
+    if (n <= 0)
+        return;
+    x = first_element(x, n, incx);
+    y = first_element(y, n, incy);
+    if (beta == T(0)) {
+        for (MKL_INT i = 0; i < n; i++)
+            y[static_cast<int64_t>(i) * incy] = alpha * x[static_cast<int64_t>(i) * incx];
+        return;
+    }
+    for (MKL_INT i = 0; i < n; i++) {
+        T &yi = y[static_cast<int64_t>(i) * incy];
+        yi = alpha * x[static_cast<int64_t>(i) * incx] + beta * yi;
+    }
+}
+
+template <typename T, typename R>
+void rot(MKL_INT n, T *x, MKL_INT incx, T *y, MKL_INT incy, R c, R s) {
+    if (n <= 0)
+        return;
+    x = first_element(x, n, incx);
+    y = first_element(y, n, incy);
+    for (MKL_INT i = 0; i < n; i++) {
+        T &xi = x[static_cast<int64_t>(i) * incx];
+        T &yi = y[static_cast<int64_t>(i) * incy];
+        const T temp = c * xi + s * yi;
+        yi = c * yi - s * xi;
+        xi = temp;
+    }
+}
+
+// The complex Givens rotation of the reference BLAS.
+template <typename R>
+void rotg(std::complex<R> *a, const std::complex<R> *b, R *c, std::complex<R> *s) {
+    const R abs_a = std::abs(*a);
+    if (abs_a == R(0)) {
+        *c = R(0);
+        *s = std::complex<R>(1);
+        *a = *b;
+        return;
+    }
+    const R scale = abs_a + std::abs(*b);
+    const R a_scaled = std::abs(*a / scale);
+    const R b_scaled = std::abs(*b / scale);
+    const R norm = scale * std::sqrt(a_scaled * a_scaled + b_scaled * b_scaled);
+    const std::complex<R> alpha = *a / abs_a;
+    *c = abs_a / norm;
+    *s = alpha * std::conj(*b) / norm;
+    *a = alpha * norm;
+}
+
+template <typename T>
+inline T abs1(T x) {
+    return std::abs(x);
+}
+
+template <typename T>
+inline T abs1(std::complex<T> x) {
+    return std::abs(x.real()) + std::abs(x.imag());
+}
+
+// Index of the first element of least magnitude, counted from 0.
+template <typename T>
+CBLAS_INDEX iamin(MKL_INT n, const T *x, MKL_INT incx) {
+    if (n <= 0 || incx <= 0)
+        return 0;
+    CBLAS_INDEX index = 0;
+    auto smallest = abs1(x[0]);
+    for (MKL_INT i = 1; i < n; i++) {
+        const auto value = abs1(x[static_cast<int64_t>(i) * incx]);
+        if (value < smallest) {
+            smallest = value;
+            index = i;
+        }
+    }
+    return index;
+}
+
+// gemmt runs one gemm per block column of C for its part off the diagonal,
+//  and one more into a buffer for the diagonal block, whose triangle is then
+//  merged into C. Only a gemmt_block / n fraction of the flops is wasted.
+constexpr MKL_INT gemmt_block = 256;
+
+template <typename T>
+void gemmt(const char *uplo, const char *transa, const char *transb, MKL_INT n, MKL_INT k,
+           T alpha, const T *a, MKL_INT lda, const T *b, MKL_INT ldb, T beta, T *c,
+           MKL_INT ldc) {
+    if (n <= 0)
+        return;
+    const bool upper = uplo_of(uplo) == CblasUpper;
+    const bool a_trans = transpose_of(transa) != CblasNoTrans;
+    const bool b_trans = transpose_of(transb) != CblasNoTrans;
+    // Row i of op(A) and column j of op(B)
+    auto a_row = [=](MKL_INT i) { return a_trans ? a + static_cast<int64_t>(i) * lda : a + i; };
+    auto b_col = [=](MKL_INT j) { return b_trans ? b + j : b + static_cast<int64_t>(j) * ldb; };
+
+    std::vector<T> diagonal(static_cast<size_t>(std::min(n, gemmt_block)) *
+                            std::min(n, gemmt_block));
+    for (MKL_INT j = 0; j < n; j += gemmt_block) {
+        const MKL_INT nb = std::min(gemmt_block, n - j);
+        T *c_block = c + j + static_cast<int64_t>(j) * ldc;
+        gemm(transa, transb, nb, nb, k, alpha, a_row(j), lda, b_col(j), ldb, T(0),
+             diagonal.data(), nb);
+        for (MKL_INT jj = 0; jj < nb; jj++) {
+            const MKL_INT first = upper ? 0 : jj;
+            const MKL_INT last = upper ? jj + 1 : nb;
+            T *c_col = c_block + static_cast<int64_t>(jj) * ldc;
+            const T *d_col = diagonal.data() + static_cast<int64_t>(jj) * nb;
+            for (MKL_INT i = first; i < last; i++)
+                c_col[i] = (beta == T(0)) ? d_col[i] : d_col[i] + beta * c_col[i];
+        }
+        if (upper && j > 0)
+            gemm(transa, transb, j, nb, k, alpha, a_row(0), lda, b_col(j), ldb, beta,
+                 c + static_cast<int64_t>(j) * ldc, ldc);
+        if (!upper && j + nb < n)
+            gemm(transa, transb, n - j - nb, nb, k, alpha, a_row(j + nb), lda, b_col(j), ldb,
+                 beta, c_block + nb, ldc);
+    }
+}
+
+template <typename T>
+void gemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                const MKL_INT *k, const T *alpha, const T **a, const MKL_INT *lda, const T **b,
+                const MKL_INT *ldb, const T *beta, T **c, const MKL_INT *ldc,
+                const MKL_INT *group_count, const MKL_INT *group_size) {
+    int64_t offset = 0;
+    for (MKL_INT i = 0; i < *group_count; i++) {
+        for (MKL_INT j = 0; j < group_size[i]; j++, offset++)
+            gemm(transa + i, transb + i, m[i], n[i], k[i], alpha[i], a[offset], lda[i], b[offset],
+                 ldb[i], beta[i], c[offset], ldc[i]);
+    }
+}
+
+template <typename T, typename F>
+void trsm_batch(F trsm, const char *side, const char *uplo, const char *transa, const char *diag,
+                const MKL_INT *m, const MKL_INT *n, const T *alpha, const T **a,
+                const MKL_INT *lda, T **b, const MKL_INT *ldb, const MKL_INT *group_count,
+                const MKL_INT *group_size) {
+    int64_t offset = 0;
+    for (MKL_INT i = 0; i < *group_count; i++) {
+        for (MKL_INT j = 0; j < group_size[i]; j++, offset++)
+            trsm(side + i, uplo + i, transa + i, diag + i, m + i, n + i, alpha + i, a[offset],
+                 lda + i, b[offset], ldb + i);
+    }
+}
+
+// The integer gemm converts block columns of op(B) and blocks of op(A), with
+//  their offsets added, to double and accumulates them with dgemm. Products
+//  of 8-bit integers sum exactly in double for any k that fits in MKL_INT.
+constexpr MKL_INT s8u8s32_block_n = 512;
+constexpr MKL_INT s8u8s32_block_k = 256;
+
+inline MKL_INT32 saturate_int32(double value) {
+    const double rounded = std::nearbyint(value);
+    if (rounded >= static_cast<double>(std::numeric_limits<MKL_INT32>::max()))
+        return std::numeric_limits<MKL_INT32>::max();
+    if (rounded <= static_cast<double>(std::numeric_limits<MKL_INT32>::min()))
+        return std::numeric_limits<MKL_INT32>::min();
+    return static_cast<MKL_INT32>(rounded);
+}
+
+// Matrix copies and additions work on square tiles so that both the rows and
+//  the columns of a transposed operand stay in cache.
+constexpr size_t matrix_tile = 32;
+
+template <typename T>
+struct operand {
+    const T *data;
+    size_t ld;
+    bool trans;
+    bool conj;
+
+    operand(const T *data, size_t ld, char op)
+            : data(data),
+              ld(ld),
+              trans(is_transposed(op)),
+              conj(is_conjugated(op)) {}
+
+    T operator()(size_t i, size_t j) const {
+        const T value = trans ? data[j + i * ld] : data[i + j * ld];
+        return conj ? conjugate(value) : value;
+    }
+};
+
+template <typename T>
+void omatcopy(char ordering, char trans, size_t rows, size_t cols, T alpha, const T *a, size_t lda,
+              T *b, size_t ldb) {
+    if (is_row_major(ordering))
+        std::swap(rows, cols);
+    const bool transposed = is_transposed(trans);
+    const operand<T> op_a(a, lda, is_conjugated(trans) ? 'R' : 'N');
+    for (size_t j0 = 0; j0 < cols; j0 += matrix_tile) {
+        const size_t j1 = std::min(cols, j0 + matrix_tile);
+        for (size_t i0 = 0; i0 < rows; i0 += matrix_tile) {
+            const size_t i1 = std::min(rows, i0 + matrix_tile);
+            for (size_t j = j0; j < j1; j++) {
+                for (size_t i = i0; i < i1; i++) {
+                    T &out = transposed ? b[j + i * ldb] : b[i + j * ldb];
+                    out = alpha * op_a(i, j);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void imatcopy(char ordering, char trans, size_t rows, size_t cols, T alpha, T *ab, size_t lda,
+              size_t ldb) {
+    if (is_row_major(ordering))
+        std::swap(rows, cols);
+    if (!is_transposed(trans) && lda == ldb) {
+        const bool conj = is_conjugated(trans);
+        for (size_t j = 0; j < cols; j++) {
+            for (size_t i = 0; i < rows; i++) {
+                T &value = ab[i + j * lda];
+                value = alpha * (conj ? conjugate(value) : value);
+            }
+        }
+        return;
+    }
+    std::vector<T> copy(rows * cols);
+    for (size_t j = 0; j < cols; j++)
+        std::copy(ab + j * lda, ab + j * lda + rows, copy.begin() + j * rows);
+    omatcopy('C', trans, rows, cols, alpha, copy.data(), rows, ab, ldb);
+}
+
+template <typename T>
+void omatadd(char ordering, char transa, char transb, size_t rows, size_t cols, T alpha,
+             const T *a, size_t lda, T beta, const T *b, size_t ldb, T *c, size_t ldc) {
+    if (is_row_major(ordering))
+        std::swap(rows, cols);
+    const operand<T> op_a(a, lda, transa);
+    const operand<T> op_b(b, ldb, transb);
+    for (size_t j0 = 0; j0 < cols; j0 += matrix_tile) {
+        const size_t j1 = std::min(cols, j0 + matrix_tile);
+        for (size_t i0 = 0; i0 < rows; i0 += matrix_tile) {
+            const size_t i1 = std::min(rows, i0 + matrix_tile);
+            for (size_t j = j0; j < j1; j++) {
+                for (size_t i = i0; i < i1; i++)
+                    c[i + j * ldc] = alpha * op_a(i, j) + beta * op_b(i, j);
+            }
+        }
+    }
+}
+
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+// Level 1
+
+void saxpby(const MKL_INT *n, const float *alpha, const float *x, const MKL_INT *incx,
+            const float *beta, float *y, const MKL_INT *incy) {
+    axpby(*n, *alpha, x, *incx, *beta, y, *incy);
+}
+
+void daxpby(const MKL_INT *n, const double *alpha, const double *x, const MKL_INT *incx,
+            const double *beta, double *y, const MKL_INT *incy) {
+    axpby(*n, *alpha, x, *incx, *beta, y, *incy);
+}
+
+void caxpby(const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+            const MKL_INT *incx, const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy) {
+    axpby(*n, *alpha, x, *incx, *beta, y, *incy);
+}
+
+void zaxpby(const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+            const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+            const MKL_INT *incy) {
+    axpby(*n, *alpha, x, *incx, *beta, y, *incy);
+}
+
+void csrot(const MKL_INT *n, MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy, const float *c, const float *s) {
+    rot(*n, x, *incx, y, *incy, *c, *s);
+}
+
+void zdrot(const MKL_INT *n, MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy, const double *c, const double *s) {
+    rot(*n, x, *incx, y, *incy, *c, *s);
+}
+
+void crotg(MKL_Complex8 *a, const MKL_Complex8 *b, float *c, MKL_Complex8 *s) {
+    rotg(a, b, c, s);
+}
+
+void zrotg(MKL_Complex16 *a, const MKL_Complex16 *b, double *c, MKL_Complex16 *s) {
+    rotg(a, b, c, s);
+}
+
+CBLAS_INDEX cblas_isamin(const MKL_INT n, const float *x, const MKL_INT incx) {
+    return iamin(n, x, incx);
+}
+
+CBLAS_INDEX cblas_idamin(const MKL_INT n, const double *x, const MKL_INT incx) {
+    return iamin(n, x, incx);
+}
+
+CBLAS_INDEX cblas_icamin(const MKL_INT n, const void *x, const MKL_INT incx) {
+    return iamin(n, static_cast<const MKL_Complex8 *>(x), incx);
+}
+
+CBLAS_INDEX cblas_izamin(const MKL_INT n, const void *x, const MKL_INT incx) {
+    return iamin(n, static_cast<const MKL_Complex16 *>(x), incx);
+}
+
+// Level 3
+
+void cgemm3m(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+             const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+             const MKL_INT *lda, const MKL_Complex8 *b, const MKL_INT *ldb,
+             const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc) {
+    ::cgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void zgemm3m(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+             const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+             const MKL_INT *lda, const MKL_Complex16 *b, const MKL_INT *ldb,
+             const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc) {
+    ::zgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void sgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const float *alpha, const float *a, const MKL_INT *lda,
+            const float *b, const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc) {
+    gemmt(uplo, transa, transb, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+void dgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const double *alpha, const double *a, const MKL_INT *lda,
+            const double *b, const MKL_INT *ldb, const double *beta, double *c,
+            const MKL_INT *ldc) {
+    gemmt(uplo, transa, transb, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+void cgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+            const MKL_INT *lda, const MKL_Complex8 *b, const MKL_INT *ldb,
+            const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc) {
+    gemmt(uplo, transa, transb, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+void zgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+            const MKL_INT *lda, const MKL_Complex16 *b, const MKL_INT *ldb,
+            const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc) {
+    gemmt(uplo, transa, transb, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+// Batches
+
+void sgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const float *alpha, const float **a, const MKL_INT *lda,
+                 const float **b, const MKL_INT *ldb, const float *beta, float **c,
+                 const MKL_INT *ldc, const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void dgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const double *alpha, const double **a, const MKL_INT *lda,
+                 const double **b, const MKL_INT *ldb, const double *beta, double **c,
+                 const MKL_INT *ldc, const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void cgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 **a,
+                 const MKL_INT *lda, const MKL_Complex8 **b, const MKL_INT *ldb,
+                 const MKL_Complex8 *beta, MKL_Complex8 **c, const MKL_INT *ldc,
+                 const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void zgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 **a,
+                 const MKL_INT *lda, const MKL_Complex16 **b, const MKL_INT *ldb,
+                 const MKL_Complex16 *beta, MKL_Complex16 **c, const MKL_INT *ldc,
+                 const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void cgemm3m_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                   const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 **a,
+                   const MKL_INT *lda, const MKL_Complex8 **b, const MKL_INT *ldb,
+                   const MKL_Complex8 *beta, MKL_Complex8 **c, const MKL_INT *ldc,
+                   const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void zgemm3m_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                   const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 **a,
+                   const MKL_INT *lda, const MKL_Complex16 **b, const MKL_INT *ldb,
+                   const MKL_Complex16 *beta, MKL_Complex16 **c, const MKL_INT *ldc,
+                   const MKL_INT *group_count, const MKL_INT *group_size) {
+    gemm_batch(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+               group_size);
+}
+
+void strsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const float *alpha, const float **a,
+                 const MKL_INT *lda, float **b, const MKL_INT *ldb, const MKL_INT *group_count,
+                 const MKL_INT *group_size) {
+    trsm_batch(::strsm, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, group_count,
+               group_size);
+}
+
+void dtrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const double *alpha, const double **a,
+                 const MKL_INT *lda, double **b, const MKL_INT *ldb, const MKL_INT *group_count,
+                 const MKL_INT *group_size) {
+    trsm_batch(::dtrsm, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, group_count,
+               group_size);
+}
+
+void ctrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha,
+                 const MKL_Complex8 **a, const MKL_INT *lda, MKL_Complex8 **b,
+                 const MKL_INT *ldb, const MKL_INT *group_count, const MKL_INT *group_size) {
+    trsm_batch(::ctrsm, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, group_count,
+               group_size);
+}
+
+void ztrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+                 const MKL_Complex16 **a, const MKL_INT *lda, MKL_Complex16 **b,
+                 const MKL_INT *ldb, const MKL_INT *group_count, const MKL_INT *group_size) {
+    trsm_batch(::ztrsm, side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, group_count,
+               group_size);
+}
+
+// Integer gemm
+
+void gemm_s8u8s32(const char *transa, const char *transb, const char *offsetc, const MKL_INT *m,
+                  const MKL_INT *n, const MKL_INT *k, const float *alpha, const MKL_INT8 *a,
+                  const MKL_INT *lda, const MKL_INT8 *ao, const MKL_UINT8 *b, const MKL_INT *ldb,
+                  const MKL_INT8 *bo, const float *beta, MKL_INT32 *c, const MKL_INT *ldc,
+                  const MKL_INT32 *co) {
+    const MKL_INT rows = *m, cols = *n, depth = *k;
+    if (rows <= 0 || cols <= 0)
+        return;
+    const bool a_trans = transpose_of(transa) != CblasNoTrans;
+    const bool b_trans = transpose_of(transb) != CblasNoTrans;
+    const bool row_offset = (*offsetc == 'R' || *offsetc == 'r');
+    const bool col_offset = (*offsetc == 'C' || *offsetc == 'c');
+    const MKL_INT kb_max = std::max<MKL_INT>(1, std::min(depth, s8u8s32_block_k));
+    const MKL_INT nb_max = std::min(cols, s8u8s32_block_n);
+
+    std::vector<double> a_block(static_cast<size_t>(rows) * kb_max);
+    std::vector<double> b_block(static_cast<size_t>(kb_max) * nb_max);
+    std::vector<double> c_block(static_cast<size_t>(rows) * nb_max, 0.0);
+    for (MKL_INT j0 = 0; j0 < cols; j0 += s8u8s32_block_n) {
+        const MKL_INT nb = std::min(s8u8s32_block_n, cols - j0);
+        std::fill(c_block.begin(), c_block.end(), 0.0);
+        for (MKL_INT p0 = 0; p0 < depth; p0 += s8u8s32_block_k) {
+            const MKL_INT kb = std::min(s8u8s32_block_k, depth - p0);
+            for (MKL_INT p = 0; p < kb; p++) {
+                for (MKL_INT i = 0; i < rows; i++) {
+                    const int64_t index = a_trans ? (p0 + p) + static_cast<int64_t>(i) * *lda
+                                                  : i + static_cast<int64_t>(p0 + p) * *lda;
+                    a_block[i + static_cast<size_t>(p) * rows] = double(a[index]) + *ao;
+                }
+            }
+            for (MKL_INT j = 0; j < nb; j++) {
+                for (MKL_INT p = 0; p < kb; p++) {
+                    const int64_t index = b_trans ? (j0 + j) + static_cast<int64_t>(p0 + p) * *ldb
+                                                  : (p0 + p) + static_cast<int64_t>(j0 + j) * *ldb;
+                    b_block[p + static_cast<size_t>(j) * kb] = double(b[index]) + *bo;
+                }
+            }
+            cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, rows, nb, kb, 1.0,
+                        a_block.data(), rows, b_block.data(), kb, 1.0, c_block.data(), rows);
+        }
+        for (MKL_INT j = 0; j < nb; j++) {
+            MKL_INT32 *c_col = c + static_cast<int64_t>(j0 + j) * *ldc;
+            const double *acc = c_block.data() + static_cast<size_t>(j) * rows;
+            for (MKL_INT i = 0; i < rows; i++) {
+                const double offset = row_offset ? co[j0 + j] : (col_offset ? co[i] : co[0]);
+                const double scaled = (*beta == 0.0f) ? 0.0 : double(*beta) * c_col[i];
+                c_col[i] = saturate_int32(double(*alpha) * acc[i] + scaled + offset);
+            }
+        }
+    }
+}
+
+// Matrix copies and additions
+
+void mkl_somatcopy(char ordering, char trans, size_t rows, size_t cols, float alpha, const float *a,
+                   size_t lda, float *b, size_t ldb) {
+    omatcopy(ordering, trans, rows, cols, alpha, a, lda, b, ldb);
+}
+
+void mkl_domatcopy(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                   const double *a, size_t lda, double *b, size_t ldb) {
+    omatcopy(ordering, trans, rows, cols, alpha, a, lda, b, ldb);
+}
+
+void mkl_comatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex8 alpha,
+                   const MKL_Complex8 *a, size_t lda, MKL_Complex8 *b, size_t ldb) {
+    omatcopy(ordering, trans, rows, cols, alpha, a, lda, b, ldb);
+}
+
+void mkl_zomatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex16 alpha,
+                   const MKL_Complex16 *a, size_t lda, MKL_Complex16 *b, size_t ldb) {
+    omatcopy(ordering, trans, rows, cols, alpha, a, lda, b, ldb);
+}
+
+void mkl_simatcopy(char ordering, char trans, size_t rows, size_t cols, float alpha, float *ab,
+                   size_t lda, size_t ldb) {
+    imatcopy(ordering, trans, rows, cols, alpha, ab, lda, ldb);
+}
+
+void mkl_dimatcopy(char ordering, char trans, size_t rows, size_t cols, double alpha, double *ab,
+                   size_t lda, size_t ldb) {
+    imatcopy(ordering, trans, rows, cols, alpha, ab, lda, ldb);
+}
+
+void mkl_cimatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex8 alpha,
+                   MKL_Complex8 *ab, size_t lda, size_t ldb) {
+    imatcopy(ordering, trans, rows, cols, alpha, ab, lda, ldb);
+}
+
+void mkl_zimatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex16 alpha,
+                   MKL_Complex16 *ab, size_t lda, size_t ldb) {
+    imatcopy(ordering, trans, rows, cols, alpha, ab, lda, ldb);
+}
+
+void mkl_somatadd(char ordering, char transa, char transb, size_t rows, size_t cols, float alpha,
+                  const float *a, size_t lda, float beta, const float *b, size_t ldb, float *c,
+                  size_t ldc) {
+    omatadd(ordering, transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+void mkl_domatadd(char ordering, char transa, char transb, size_t rows, size_t cols, double alpha,
+                  const double *a, size_t lda, double beta, const double *b, size_t ldb, double *c,
+                  size_t ldc) {
+    omatadd(ordering, transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+void mkl_comatadd(char ordering, char transa, char transb, size_t rows, size_t cols,
+                  MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda, MKL_Complex8 beta,
+                  const MKL_Complex8 *b, size_t ldb, MKL_Complex8 *c, size_t ldc) {
+    omatadd(ordering, transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+void mkl_zomatadd(char ordering, char transa, char transb, size_t rows, size_t cols,
+                  MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda, MKL_Complex16 beta,
+                  const MKL_Complex16 *b, size_t ldb, MKL_Complex16 *c, size_t ldc) {
+    omatadd(ordering, transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+void mkl_somatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, float alpha,
+                                 const float *a, size_t lda, size_t stride_a, float *b, size_t ldb,
+                                 size_t stride_b, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatcopy(ordering, trans, rows, cols, alpha, a + i * stride_a, lda, b + i * stride_b, ldb);
+}
+
+void mkl_domatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                                 const double *a, size_t lda, size_t stride_a, double *b,
+                                 size_t ldb, size_t stride_b, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatcopy(ordering, trans, rows, cols, alpha, a + i * stride_a, lda, b + i * stride_b, ldb);
+}
+
+void mkl_comatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda,
+                                 size_t stride_a, MKL_Complex8 *b, size_t ldb, size_t stride_b,
+                                 size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatcopy(ordering, trans, rows, cols, alpha, a + i * stride_a, lda, b + i * stride_b, ldb);
+}
+
+void mkl_zomatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda,
+                                 size_t stride_a, MKL_Complex16 *b, size_t ldb, size_t stride_b,
+                                 size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatcopy(ordering, trans, rows, cols, alpha, a + i * stride_a, lda, b + i * stride_b, ldb);
+}
+
+void mkl_simatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, float alpha,
+                                 float *ab, size_t lda, size_t ldb, size_t stride,
+                                 size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        imatcopy(ordering, trans, rows, cols, alpha, ab + i * stride, lda, ldb);
+}
+
+void mkl_dimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                                 double *ab, size_t lda, size_t ldb, size_t stride,
+                                 size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        imatcopy(ordering, trans, rows, cols, alpha, ab + i * stride, lda, ldb);
+}
+
+void mkl_cimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex8 alpha, MKL_Complex8 *ab, size_t lda, size_t ldb,
+                                 size_t stride, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        imatcopy(ordering, trans, rows, cols, alpha, ab + i * stride, lda, ldb);
+}
+
+void mkl_zimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex16 alpha, MKL_Complex16 *ab, size_t lda, size_t ldb,
+                                 size_t stride, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        imatcopy(ordering, trans, rows, cols, alpha, ab + i * stride, lda, ldb);
+}
+
+void mkl_somatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                float alpha, const float *a, size_t lda, size_t stride_a,
+                                float beta, const float *b, size_t ldb, size_t stride_b, float *c,
+                                size_t ldc, size_t stride_c, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatadd(ordering, transa, transb, rows, cols, alpha, a + i * stride_a, lda, beta,
+                b + i * stride_b, ldb, c + i * stride_c, ldc);
+}
+
+void mkl_domatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                double alpha, const double *a, size_t lda, size_t stride_a,
+                                double beta, const double *b, size_t ldb, size_t stride_b,
+                                double *c, size_t ldc, size_t stride_c, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatadd(ordering, transa, transb, rows, cols, alpha, a + i * stride_a, lda, beta,
+                b + i * stride_b, ldb, c + i * stride_c, ldc);
+}
+
+void mkl_comatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda,
+                                size_t stride_a, MKL_Complex8 beta, const MKL_Complex8 *b,
+                                size_t ldb, size_t stride_b, MKL_Complex8 *c, size_t ldc,
+                                size_t stride_c, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatadd(ordering, transa, transb, rows, cols, alpha, a + i * stride_a, lda, beta,
+                b + i * stride_b, ldb, c + i * stride_c, ldc);
+}
+
+void mkl_zomatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda,
+                                size_t stride_a, MKL_Complex16 beta, const MKL_Complex16 *b,
+                                size_t ldb, size_t stride_b, MKL_Complex16 *c, size_t ldc,
+                                size_t stride_c, size_t batch_size) {
+    for (size_t i = 0; i < batch_size; i++)
+        omatadd(ordering, transa, transb, rows, cols, alpha, a + i * stride_a, lda, beta,
+                b + i * stride_b, ldb, c + i * stride_c, ldc);
+}
+
+// Service
+
+int mkl_get_max_threads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Per-thread requests are only recorded, and returned as MKL would, 0 when
+//  the calling thread had none.
+int mkl_set_num_threads_local(int nt) {
+    static thread_local int requested = 0;
+    const int previous = requested;
+    requested = std::max(nt, 0);
+    return previous;
+}
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,532 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Stands in for the MKL header of the same name when the mklcpu sources are
+//  built as the cblas backend. It declares the MKL BLAS entry points they
+//  call, with LP64 integers to match a standard CBLAS, and cblas_compat.cpp
+//  and cblas_extensions.cpp define them on top of the CBLAS. The stand-ins of
+//  all four headers live in oneapi::mkl::cblas::compat, which a using-directive
+//  makes visible to the mklcpu sources, so the library defines no global
+//  function with an MKL name.
+
+#ifndef _ONEMKL_CBLAS_MKL_BLAS_H_
+#define _ONEMKL_CBLAS_MKL_BLAS_H_
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef MKL_Complex8
+#define MKL_Complex8 std::complex<float>
+#endif
+#ifndef MKL_Complex16
+#define MKL_Complex16 std::complex<double>
+#endif
+
+typedef int MKL_INT;
+typedef int32_t MKL_INT32;
+typedef int8_t MKL_INT8;
+typedef uint8_t MKL_UINT8;
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+// Level 1
+
+float sasum(const MKL_INT *n, const float *x, const MKL_INT *incx);
+double dasum(const MKL_INT *n, const double *x, const MKL_INT *incx);
+float scasum(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx);
+double dzasum(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx);
+
+void saxpy(const MKL_INT *n, const float *alpha, const float *x, const MKL_INT *incx, float *y,
+           const MKL_INT *incy);
+void daxpy(const MKL_INT *n, const double *alpha, const double *x, const MKL_INT *incx, double *y,
+           const MKL_INT *incy);
+void caxpy(const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, MKL_Complex8 *y, const MKL_INT *incy);
+void zaxpy(const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+           const MKL_INT *incx, MKL_Complex16 *y, const MKL_INT *incy);
+
+void saxpby(const MKL_INT *n, const float *alpha, const float *x, const MKL_INT *incx,
+            const float *beta, float *y, const MKL_INT *incy);
+void daxpby(const MKL_INT *n, const double *alpha, const double *x, const MKL_INT *incx,
+            const double *beta, double *y, const MKL_INT *incy);
+void caxpby(const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+            const MKL_INT *incx, const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy);
+void zaxpby(const MKL_INT *n, const MKL_Complex16 *alpha, const MKL_Complex16 *x,
+            const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+            const MKL_INT *incy);
+
+void scopy(const MKL_INT *n, const float *x, const MKL_INT *incx, float *y, const MKL_INT *incy);
+void dcopy(const MKL_INT *n, const double *x, const MKL_INT *incx, double *y, const MKL_INT *incy);
+void ccopy(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy);
+void zcopy(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy);
+
+float sdot(const MKL_INT *n, const float *x, const MKL_INT *incx, const float *y,
+           const MKL_INT *incy);
+double ddot(const MKL_INT *n, const double *x, const MKL_INT *incx, const double *y,
+            const MKL_INT *incy);
+double dsdot(const MKL_INT *n, const float *x, const MKL_INT *incx, const float *y,
+             const MKL_INT *incy);
+float sdsdot(const MKL_INT *n, const float *sb, const float *x, const MKL_INT *incx,
+             const float *y, const MKL_INT *incy);
+void cdotc(MKL_Complex8 *result, const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *y, const MKL_INT *incy);
+void zdotc(MKL_Complex16 *result, const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *y, const MKL_INT *incy);
+void cdotu(MKL_Complex8 *result, const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *y, const MKL_INT *incy);
+void zdotu(MKL_Complex16 *result, const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *y, const MKL_INT *incy);
+
+float snrm2(const MKL_INT *n, const float *x, const MKL_INT *incx);
+double dnrm2(const MKL_INT *n, const double *x, const MKL_INT *incx);
+float scnrm2(const MKL_INT *n, const MKL_Complex8 *x, const MKL_INT *incx);
+double dznrm2(const MKL_INT *n, const MKL_Complex16 *x, const MKL_INT *incx);
+
+void srot(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy,
+          const float *c, const float *s);
+void drot(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy,
+          const double *c, const double *s);
+void csrot(const MKL_INT *n, MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy, const float *c, const float *s);
+void zdrot(const MKL_INT *n, MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy, const double *c, const double *s);
+
+void srotg(float *a, float *b, float *c, float *s);
+void drotg(double *a, double *b, double *c, double *s);
+void crotg(MKL_Complex8 *a, const MKL_Complex8 *b, float *c, MKL_Complex8 *s);
+void zrotg(MKL_Complex16 *a, const MKL_Complex16 *b, double *c, MKL_Complex16 *s);
+
+void srotm(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy,
+           const float *param);
+void drotm(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy,
+           const double *param);
+void srotmg(float *d1, float *d2, float *x1, const float *y1, float *param);
+void drotmg(double *d1, double *d2, double *x1, const double *y1, double *param);
+
+void sscal(const MKL_INT *n, const float *alpha, float *x, const MKL_INT *incx);
+void dscal(const MKL_INT *n, const double *alpha, double *x, const MKL_INT *incx);
+void cscal(const MKL_INT *n, const MKL_Complex8 *alpha, MKL_Complex8 *x, const MKL_INT *incx);
+void zscal(const MKL_INT *n, const MKL_Complex16 *alpha, MKL_Complex16 *x, const MKL_INT *incx);
+void csscal(const MKL_INT *n, const float *alpha, MKL_Complex8 *x, const MKL_INT *incx);
+void zdscal(const MKL_INT *n, const double *alpha, MKL_Complex16 *x, const MKL_INT *incx);
+
+void sswap(const MKL_INT *n, float *x, const MKL_INT *incx, float *y, const MKL_INT *incy);
+void dswap(const MKL_INT *n, double *x, const MKL_INT *incx, double *y, const MKL_INT *incy);
+void cswap(const MKL_INT *n, MKL_Complex8 *x, const MKL_INT *incx, MKL_Complex8 *y,
+           const MKL_INT *incy);
+void zswap(const MKL_INT *n, MKL_Complex16 *x, const MKL_INT *incx, MKL_Complex16 *y,
+           const MKL_INT *incy);
+
+// Level 2
+
+void sgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const float *alpha, const float *a, const MKL_INT *lda,
+           const float *x, const MKL_INT *incx, const float *beta, float *y, const MKL_INT *incy);
+void dgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const double *alpha, const double *a, const MKL_INT *lda,
+           const double *x, const MKL_INT *incx, const double *beta, double *y,
+           const MKL_INT *incy);
+void cgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy);
+void zgbmv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_INT *kl,
+           const MKL_INT *ku, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy);
+
+void sgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const float *alpha,
+           const float *a, const MKL_INT *lda, const float *x, const MKL_INT *incx,
+           const float *beta, float *y, const MKL_INT *incy);
+void dgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const double *alpha,
+           const double *a, const MKL_INT *lda, const double *x, const MKL_INT *incx,
+           const double *beta, double *y, const MKL_INT *incy);
+void cgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha,
+           const MKL_Complex8 *a, const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy);
+void zgemv(const char *trans, const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+           const MKL_INT *incy);
+
+void sger(const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, const float *y, const MKL_INT *incy, float *a, const MKL_INT *lda);
+void dger(const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, const double *y, const MKL_INT *incy, double *a,
+          const MKL_INT *lda);
+void cgerc(const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda);
+void zgerc(const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *x, const MKL_INT *incx, const MKL_Complex16 *y,
+           const MKL_INT *incy, MKL_Complex16 *a, const MKL_INT *lda);
+void cgeru(const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda);
+void zgeru(const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *x, const MKL_INT *incx, const MKL_Complex16 *y,
+           const MKL_INT *incy, MKL_Complex16 *a, const MKL_INT *lda);
+
+void chbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const MKL_Complex8 *alpha,
+           const MKL_Complex8 *a, const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy);
+void zhbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+           const MKL_INT *incy);
+void ssbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const float *alpha,
+           const float *a, const MKL_INT *lda, const float *x, const MKL_INT *incx,
+           const float *beta, float *y, const MKL_INT *incy);
+void dsbmv(const char *uplo, const MKL_INT *n, const MKL_INT *k, const double *alpha,
+           const double *a, const MKL_INT *lda, const double *x, const MKL_INT *incx,
+           const double *beta, double *y, const MKL_INT *incy);
+
+void chemv(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, const MKL_Complex8 *x, const MKL_INT *incx,
+           const MKL_Complex8 *beta, MKL_Complex8 *y, const MKL_INT *incy);
+void zhemv(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, const MKL_Complex16 *x,
+           const MKL_INT *incx, const MKL_Complex16 *beta, MKL_Complex16 *y,
+           const MKL_INT *incy);
+void ssymv(const char *uplo, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, const float *x, const MKL_INT *incx, const float *beta, float *y,
+           const MKL_INT *incy);
+void dsymv(const char *uplo, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, const double *x, const MKL_INT *incx, const double *beta,
+           double *y, const MKL_INT *incy);
+
+void cher(const char *uplo, const MKL_INT *n, const float *alpha, const MKL_Complex8 *x,
+          const MKL_INT *incx, MKL_Complex8 *a, const MKL_INT *lda);
+void zher(const char *uplo, const MKL_INT *n, const double *alpha, const MKL_Complex16 *x,
+          const MKL_INT *incx, MKL_Complex16 *a, const MKL_INT *lda);
+void ssyr(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, float *a, const MKL_INT *lda);
+void dsyr(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, double *a, const MKL_INT *lda);
+
+void cher2(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *a,
+           const MKL_INT *lda);
+void zher2(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *x, const MKL_INT *incx, const MKL_Complex16 *y,
+           const MKL_INT *incy, MKL_Complex16 *a, const MKL_INT *lda);
+void ssyr2(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+           const MKL_INT *incx, const float *y, const MKL_INT *incy, float *a,
+           const MKL_INT *lda);
+void dsyr2(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+           const MKL_INT *incx, const double *y, const MKL_INT *incy, double *a,
+           const MKL_INT *lda);
+
+void chpmv(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *ap,
+           const MKL_Complex8 *x, const MKL_INT *incx, const MKL_Complex8 *beta,
+           MKL_Complex8 *y, const MKL_INT *incy);
+void zhpmv(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *ap, const MKL_Complex16 *x, const MKL_INT *incx,
+           const MKL_Complex16 *beta, MKL_Complex16 *y, const MKL_INT *incy);
+void sspmv(const char *uplo, const MKL_INT *n, const float *alpha, const float *ap,
+           const float *x, const MKL_INT *incx, const float *beta, float *y,
+           const MKL_INT *incy);
+void dspmv(const char *uplo, const MKL_INT *n, const double *alpha, const double *ap,
+           const double *x, const MKL_INT *incx, const double *beta, double *y,
+           const MKL_INT *incy);
+
+void chpr(const char *uplo, const MKL_INT *n, const float *alpha, const MKL_Complex8 *x,
+          const MKL_INT *incx, MKL_Complex8 *ap);
+void zhpr(const char *uplo, const MKL_INT *n, const double *alpha, const MKL_Complex16 *x,
+          const MKL_INT *incx, MKL_Complex16 *ap);
+void sspr(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+          const MKL_INT *incx, float *ap);
+void dspr(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+          const MKL_INT *incx, double *ap);
+
+void chpr2(const char *uplo, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *x,
+           const MKL_INT *incx, const MKL_Complex8 *y, const MKL_INT *incy, MKL_Complex8 *ap);
+void zhpr2(const char *uplo, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *x, const MKL_INT *incx, const MKL_Complex16 *y,
+           const MKL_INT *incy, MKL_Complex16 *ap);
+void sspr2(const char *uplo, const MKL_INT *n, const float *alpha, const float *x,
+           const MKL_INT *incx, const float *y, const MKL_INT *incy, float *ap);
+void dspr2(const char *uplo, const MKL_INT *n, const double *alpha, const double *x,
+           const MKL_INT *incx, const double *y, const MKL_INT *incy, double *ap);
+
+void stbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx);
+void dtbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const double *a, const MKL_INT *lda, double *x,
+           const MKL_INT *incx);
+void ctbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x,
+           const MKL_INT *incx);
+void ztbmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x,
+           const MKL_INT *incx);
+
+void stbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx);
+void dtbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const double *a, const MKL_INT *lda, double *x,
+           const MKL_INT *incx);
+void ctbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x,
+           const MKL_INT *incx);
+void ztbsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x,
+           const MKL_INT *incx);
+
+void stpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const float *ap, float *x, const MKL_INT *incx);
+void dtpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *ap, double *x, const MKL_INT *incx);
+void ctpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *ap, MKL_Complex8 *x, const MKL_INT *incx);
+void ztpmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *ap, MKL_Complex16 *x, const MKL_INT *incx);
+
+void stpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const float *ap, float *x, const MKL_INT *incx);
+void dtpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *ap, double *x, const MKL_INT *incx);
+void ctpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *ap, MKL_Complex8 *x, const MKL_INT *incx);
+void ztpsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *ap, MKL_Complex16 *x, const MKL_INT *incx);
+
+void strmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx);
+void dtrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *a, const MKL_INT *lda, double *x, const MKL_INT *incx);
+void ctrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x, const MKL_INT *incx);
+void ztrmv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x, const MKL_INT *incx);
+
+void strsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const float *a, const MKL_INT *lda, float *x, const MKL_INT *incx);
+void dtrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const double *a, const MKL_INT *lda, double *x, const MKL_INT *incx);
+void ctrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex8 *a, const MKL_INT *lda, MKL_Complex8 *x, const MKL_INT *incx);
+void ztrsv(const char *uplo, const char *trans, const char *diag, const MKL_INT *n,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *x, const MKL_INT *incx);
+
+// Level 3
+
+void sgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const float *alpha, const float *a, const MKL_INT *lda,
+           const float *b, const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc);
+void dgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const double *alpha, const double *a, const MKL_INT *lda,
+           const double *b, const MKL_INT *ldb, const double *beta, double *c,
+           const MKL_INT *ldc);
+void cgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, const MKL_Complex8 *b, const MKL_INT *ldb,
+           const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc);
+void zgemm(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+           const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+           const MKL_INT *lda, const MKL_Complex16 *b, const MKL_INT *ldb,
+           const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc);
+
+void cgemm3m(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+             const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+             const MKL_INT *lda, const MKL_Complex8 *b, const MKL_INT *ldb,
+             const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc);
+void zgemm3m(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+             const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+             const MKL_INT *lda, const MKL_Complex16 *b, const MKL_INT *ldb,
+             const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc);
+
+void sgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const float *alpha, const float *a, const MKL_INT *lda,
+            const float *b, const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc);
+void dgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const double *alpha, const double *a, const MKL_INT *lda,
+            const double *b, const MKL_INT *ldb, const double *beta, double *c,
+            const MKL_INT *ldc);
+void cgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+            const MKL_INT *lda, const MKL_Complex8 *b, const MKL_INT *ldb,
+            const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc);
+void zgemmt(const char *uplo, const char *transa, const char *transb, const MKL_INT *n,
+            const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 *a,
+            const MKL_INT *lda, const MKL_Complex16 *b, const MKL_INT *ldb,
+            const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc);
+
+void chemm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+           const MKL_INT *ldc);
+void zhemm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta,
+           MKL_Complex16 *c, const MKL_INT *ldc);
+void ssymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const float *alpha, const float *a, const MKL_INT *lda, const float *b,
+           const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc);
+void dsymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const double *alpha, const double *a, const MKL_INT *lda, const double *b,
+           const MKL_INT *ldb, const double *beta, double *c, const MKL_INT *ldc);
+void csymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta, MKL_Complex8 *c,
+           const MKL_INT *ldc);
+void zsymm(const char *side, const char *uplo, const MKL_INT *m, const MKL_INT *n,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta,
+           MKL_Complex16 *c, const MKL_INT *ldc);
+
+void cherk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const float *alpha, const MKL_Complex8 *a, const MKL_INT *lda, const float *beta,
+           MKL_Complex8 *c, const MKL_INT *ldc);
+void zherk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const double *alpha, const MKL_Complex16 *a, const MKL_INT *lda, const double *beta,
+           MKL_Complex16 *c, const MKL_INT *ldc);
+void ssyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const float *alpha, const float *a, const MKL_INT *lda, const float *beta, float *c,
+           const MKL_INT *ldc);
+void dsyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const double *alpha, const double *a, const MKL_INT *lda, const double *beta,
+           double *c, const MKL_INT *ldc);
+void csyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+           const MKL_Complex8 *beta, MKL_Complex8 *c, const MKL_INT *ldc);
+void zsyrk(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+           const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+           const MKL_Complex16 *beta, MKL_Complex16 *c, const MKL_INT *ldc);
+
+void cher2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+            const MKL_Complex8 *b, const MKL_INT *ldb, const float *beta, MKL_Complex8 *c,
+            const MKL_INT *ldc);
+void zher2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+            const MKL_Complex16 *b, const MKL_INT *ldb, const double *beta, MKL_Complex16 *c,
+            const MKL_INT *ldc);
+void ssyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const float *alpha, const float *a, const MKL_INT *lda, const float *b,
+            const MKL_INT *ldb, const float *beta, float *c, const MKL_INT *ldc);
+void dsyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const double *alpha, const double *a, const MKL_INT *lda, const double *b,
+            const MKL_INT *ldb, const double *beta, double *c, const MKL_INT *ldc);
+void csyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex8 *alpha, const MKL_Complex8 *a, const MKL_INT *lda,
+            const MKL_Complex8 *b, const MKL_INT *ldb, const MKL_Complex8 *beta,
+            MKL_Complex8 *c, const MKL_INT *ldc);
+void zsyr2k(const char *uplo, const char *trans, const MKL_INT *n, const MKL_INT *k,
+            const MKL_Complex16 *alpha, const MKL_Complex16 *a, const MKL_INT *lda,
+            const MKL_Complex16 *b, const MKL_INT *ldb, const MKL_Complex16 *beta,
+            MKL_Complex16 *c, const MKL_INT *ldc);
+
+void strmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, float *b, const MKL_INT *ldb);
+void dtrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, double *b, const MKL_INT *ldb);
+void ctrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, MKL_Complex8 *b, const MKL_INT *ldb);
+void ztrmm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *b, const MKL_INT *ldb);
+
+void strsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const float *alpha, const float *a,
+           const MKL_INT *lda, float *b, const MKL_INT *ldb);
+void dtrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const double *alpha, const double *a,
+           const MKL_INT *lda, double *b, const MKL_INT *ldb);
+void ctrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha, const MKL_Complex8 *a,
+           const MKL_INT *lda, MKL_Complex8 *b, const MKL_INT *ldb);
+void ztrsm(const char *side, const char *uplo, const char *transa, const char *diag,
+           const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+           const MKL_Complex16 *a, const MKL_INT *lda, MKL_Complex16 *b, const MKL_INT *ldb);
+
+// Batches, in groups of problems sharing their parameters
+
+void sgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const float *alpha, const float **a, const MKL_INT *lda,
+                 const float **b, const MKL_INT *ldb, const float *beta, float **c,
+                 const MKL_INT *ldc, const MKL_INT *group_count, const MKL_INT *group_size);
+void dgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const double *alpha, const double **a, const MKL_INT *lda,
+                 const double **b, const MKL_INT *ldb, const double *beta, double **c,
+                 const MKL_INT *ldc, const MKL_INT *group_count, const MKL_INT *group_size);
+void cgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 **a,
+                 const MKL_INT *lda, const MKL_Complex8 **b, const MKL_INT *ldb,
+                 const MKL_Complex8 *beta, MKL_Complex8 **c, const MKL_INT *ldc,
+                 const MKL_INT *group_count, const MKL_INT *group_size);
+void zgemm_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                 const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 **a,
+                 const MKL_INT *lda, const MKL_Complex16 **b, const MKL_INT *ldb,
+                 const MKL_Complex16 *beta, MKL_Complex16 **c, const MKL_INT *ldc,
+                 const MKL_INT *group_count, const MKL_INT *group_size);
+
+void cgemm3m_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                   const MKL_INT *k, const MKL_Complex8 *alpha, const MKL_Complex8 **a,
+                   const MKL_INT *lda, const MKL_Complex8 **b, const MKL_INT *ldb,
+                   const MKL_Complex8 *beta, MKL_Complex8 **c, const MKL_INT *ldc,
+                   const MKL_INT *group_count, const MKL_INT *group_size);
+void zgemm3m_batch(const char *transa, const char *transb, const MKL_INT *m, const MKL_INT *n,
+                   const MKL_INT *k, const MKL_Complex16 *alpha, const MKL_Complex16 **a,
+                   const MKL_INT *lda, const MKL_Complex16 **b, const MKL_INT *ldb,
+                   const MKL_Complex16 *beta, MKL_Complex16 **c, const MKL_INT *ldc,
+                   const MKL_INT *group_count, const MKL_INT *group_size);
+
+void strsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const float *alpha, const float **a,
+                 const MKL_INT *lda, float **b, const MKL_INT *ldb, const MKL_INT *group_count,
+                 const MKL_INT *group_size);
+void dtrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const double *alpha, const double **a,
+                 const MKL_INT *lda, double **b, const MKL_INT *ldb, const MKL_INT *group_count,
+                 const MKL_INT *group_size);
+void ctrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const MKL_Complex8 *alpha,
+                 const MKL_Complex8 **a, const MKL_INT *lda, MKL_Complex8 **b,
+                 const MKL_INT *ldb, const MKL_INT *group_count, const MKL_INT *group_size);
+void ztrsm_batch(const char *side, const char *uplo, const char *transa, const char *diag,
+                 const MKL_INT *m, const MKL_INT *n, const MKL_Complex16 *alpha,
+                 const MKL_Complex16 **a, const MKL_INT *lda, MKL_Complex16 **b,
+                 const MKL_INT *ldb, const MKL_INT *group_count, const MKL_INT *group_size);
+
+// Integer gemm, C = alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co
+
+void gemm_s8u8s32(const char *transa, const char *transb, const char *offsetc, const MKL_INT *m,
+                  const MKL_INT *n, const MKL_INT *k, const float *alpha, const MKL_INT8 *a,
+                  const MKL_INT *lda, const MKL_INT8 *ao, const MKL_UINT8 *b, const MKL_INT *ldb,
+                  const MKL_INT8 *bo, const float *beta, MKL_INT32 *c, const MKL_INT *ldc,
+                  const MKL_INT32 *co);
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+using namespace oneapi::mkl::cblas::compat;
+
+#endif //_ONEMKL_CBLAS_MKL_BLAS_H_
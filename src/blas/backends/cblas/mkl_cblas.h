@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Stands in for the MKL header of the same name in the cblas backend. The
+//  mklcpu sources only take the index routines from it; the i?amin ones are
+//  an extension that not every CBLAS provides, so cblas_extensions.cpp
+//  defines them.
+
+#ifndef _ONEMKL_CBLAS_MKL_CBLAS_H_
+#define _ONEMKL_CBLAS_MKL_CBLAS_H_
+
+#include <cblas.h>
+
+#include "mkl_blas.h"
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+CBLAS_INDEX cblas_isamin(const MKL_INT n, const float *x, const MKL_INT incx);
+CBLAS_INDEX cblas_idamin(const MKL_INT n, const double *x, const MKL_INT incx);
+CBLAS_INDEX cblas_icamin(const MKL_INT n, const void *x, const MKL_INT incx);
+CBLAS_INDEX cblas_izamin(const MKL_INT n, const void *x, const MKL_INT incx);
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+using namespace oneapi::mkl::cblas::compat;
+
+#endif //_ONEMKL_CBLAS_MKL_CBLAS_H_
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Stands in for the MKL header of the same name in the cblas backend. A
+//  CBLAS has no portable way to set its threading per thread, so these only
+//  report the hardware threads and record the per-thread requests of the
+//  split-K and chunked paths; the requests are not passed on to the CBLAS,
+//  whose own threads add to those of the workers.
+
+#ifndef _ONEMKL_CBLAS_MKL_SERVICE_H_
+#define _ONEMKL_CBLAS_MKL_SERVICE_H_
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+int mkl_get_max_threads();
+int mkl_set_num_threads_local(int nt);
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+using namespace oneapi::mkl::cblas::compat;
+
+#endif //_ONEMKL_CBLAS_MKL_SERVICE_H_
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+// Stands in for the MKL header of the same name in the cblas backend, with
+//  the out-of-place and in-place matrix copies and additions that CBLAS has no
+//  counterpart for. cblas_extensions.cpp defines them as blocked loops.
+
+#ifndef _ONEMKL_CBLAS_MKL_TRANS_H_
+#define _ONEMKL_CBLAS_MKL_TRANS_H_
+
+#include "mkl_blas.h"
+
+namespace oneapi {
+namespace mkl {
+namespace cblas {
+namespace compat {
+
+void mkl_somatcopy(char ordering, char trans, size_t rows, size_t cols, float alpha, const float *a,
+                   size_t lda, float *b, size_t ldb);
+void mkl_domatcopy(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                   const double *a, size_t lda, double *b, size_t ldb);
+void mkl_comatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex8 alpha,
+                   const MKL_Complex8 *a, size_t lda, MKL_Complex8 *b, size_t ldb);
+void mkl_zomatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex16 alpha,
+                   const MKL_Complex16 *a, size_t lda, MKL_Complex16 *b, size_t ldb);
+
+void mkl_simatcopy(char ordering, char trans, size_t rows, size_t cols, float alpha, float *ab,
+                   size_t lda, size_t ldb);
+void mkl_dimatcopy(char ordering, char trans, size_t rows, size_t cols, double alpha, double *ab,
+                   size_t lda, size_t ldb);
+void mkl_cimatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex8 alpha,
+                   MKL_Complex8 *ab, size_t lda, size_t ldb);
+void mkl_zimatcopy(char ordering, char trans, size_t rows, size_t cols, MKL_Complex16 alpha,
+                   MKL_Complex16 *ab, size_t lda, size_t ldb);
+
+void mkl_somatadd(char ordering, char transa, char transb, size_t rows, size_t cols, float alpha,
+                  const float *a, size_t lda, float beta, const float *b, size_t ldb, float *c,
+                  size_t ldc);
+void mkl_domatadd(char ordering, char transa, char transb, size_t rows, size_t cols, double alpha,
+                  const double *a, size_t lda, double beta, const double *b, size_t ldb, double *c,
+                  size_t ldc);
+void mkl_comatadd(char ordering, char transa, char transb, size_t rows, size_t cols,
+                  MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda, MKL_Complex8 beta,
+                  const MKL_Complex8 *b, size_t ldb, MKL_Complex8 *c, size_t ldc);
+void mkl_zomatadd(char ordering, char transa, char transb, size_t rows, size_t cols,
+                  MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda, MKL_Complex16 beta,
+                  const MKL_Complex16 *b, size_t ldb, MKL_Complex16 *c, size_t ldc);
+
+void mkl_somatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, float alpha,
+                                 const float *a, size_t lda, size_t stride_a, float *b, size_t ldb,
+                                 size_t stride_b, size_t batch_size);
+void mkl_domatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                                 const double *a, size_t lda, size_t stride_a, double *b,
+                                 size_t ldb, size_t stride_b, size_t batch_size);
+void mkl_comatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda,
+                                 size_t stride_a, MKL_Complex8 *b, size_t ldb, size_t stride_b,
+                                 size_t batch_size);
+void mkl_zomatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda,
+                                 size_t stride_a, MKL_Complex16 *b, size_t ldb, size_t stride_b,
+                                 size_t batch_size);
+
+void mkl_simatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, float alpha,
+                                 float *ab, size_t lda, size_t ldb, size_t stride,
+                                 size_t batch_size);
+void mkl_dimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols, double alpha,
+                                 double *ab, size_t lda, size_t ldb, size_t stride,
+                                 size_t batch_size);
+void mkl_cimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex8 alpha, MKL_Complex8 *ab, size_t lda, size_t ldb,
+                                 size_t stride, size_t batch_size);
+void mkl_zimatcopy_batch_strided(char ordering, char trans, size_t rows, size_t cols,
+                                 MKL_Complex16 alpha, MKL_Complex16 *ab, size_t lda, size_t ldb,
+                                 size_t stride, size_t batch_size);
+
+void mkl_somatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                float alpha, const float *a, size_t lda, size_t stride_a,
+                                float beta, const float *b, size_t ldb, size_t stride_b, float *c,
+                                size_t ldc, size_t stride_c, size_t batch_size);
+void mkl_domatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                double alpha, const double *a, size_t lda, size_t stride_a,
+                                double beta, const double *b, size_t ldb, size_t stride_b,
+                                double *c, size_t ldc, size_t stride_c, size_t batch_size);
+void mkl_comatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                MKL_Complex8 alpha, const MKL_Complex8 *a, size_t lda,
+                                size_t stride_a, MKL_Complex8 beta, const MKL_Complex8 *b,
+                                size_t ldb, size_t stride_b, MKL_Complex8 *c, size_t ldc,
+                                size_t stride_c, size_t batch_size);
+void mkl_zomatadd_batch_strided(char ordering, char transa, char transb, size_t rows, size_t cols,
+                                MKL_Complex16 alpha, const MKL_Complex16 *a, size_t lda,
+                                size_t stride_a, MKL_Complex16 beta, const MKL_Complex16 *b,
+                                size_t ldb, size_t stride_b, MKL_Complex16 *c, size_t ldc,
+                                size_t stride_c, size_t batch_size);
+
+} // namespace compat
+} // namespace cblas
+} // namespace mkl
+} // namespace oneapi
+
+using namespace oneapi::mkl::cblas::compat;
+
+#endif //_ONEMKL_CBLAS_MKL_TRANS_H_
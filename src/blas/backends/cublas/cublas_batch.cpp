@@ -72,6 +72,110 @@ GEMM_STRIDED_BATCH_LAUNCHER(std::complex<double>, cublasZgemmStridedBatched)
 
 #undef GEMM_STRIDED_BATCH_LAUNCHER
 
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  int64_t ldb, int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                  int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                  std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                  int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                   float beta, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                   double beta, cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
@@ -206,6 +310,141 @@ GEMM_BATCH_LAUNCHER_USM(std::complex<double>, cublasZgemmBatched)
 
 #undef GEMM_BATCH_LAUNCHER_USM
 
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             int64_t *m, int64_t *n, int64_t *k, std::complex<float> *alpha,
+                             const std::complex<float> **a, int64_t *lda,
+                             const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
+                             std::complex<float> **c, int64_t *ldc, int64_t group_count,
+                             int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             int64_t *m, int64_t *n, int64_t *k, std::complex<double> *alpha,
+                             const std::complex<double> **a, int64_t *lda,
+                             const std::complex<double> **b, int64_t *ldb,
+                             std::complex<double> *beta, std::complex<double> **c, int64_t *ldc,
+                             int64_t group_count, int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *a, int64_t lda, int64_t stride_a,
+                             const std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                             std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                             int64_t stride_c, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *a, int64_t lda, int64_t stride_a,
+                             const std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                             std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                             int64_t stride_c, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               float alpha, const float *a, int64_t lda, int64_t stride_a, float *b,
+                               int64_t ldb, int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               double alpha, const double *a, int64_t lda, int64_t stride_a,
+                               double *b, int64_t ldb, int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                               int64_t stride_a, std::complex<float> *b, int64_t ldb,
+                               int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<double> alpha, const std::complex<double> *a,
+                               int64_t lda, int64_t stride_a, std::complex<double> *b, int64_t ldb,
+                               int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               float alpha, float *ab, int64_t lda, int64_t ldb, int64_t stride,
+                               int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               double alpha, double *ab, int64_t lda, int64_t ldb, int64_t stride,
+                               int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<float> alpha, std::complex<float> *ab, int64_t lda,
+                               int64_t ldb, int64_t stride, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<double> alpha, std::complex<double> *ab, int64_t lda,
+                               int64_t ldb, int64_t stride, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, float alpha, const float *a, int64_t lda, int64_t stride_a,
+                              float beta, const float *b, int64_t ldb, int64_t stride_b, float *c,
+                              int64_t ldc, int64_t stride_c, int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, double alpha, const double *a, int64_t lda,
+                              int64_t stride_a, double beta, const double *b, int64_t ldb,
+                              int64_t stride_b, double *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                              int64_t lda, int64_t stride_a, std::complex<float> beta,
+                              const std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                              std::complex<float> *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                              int64_t lda, int64_t stride_a, std::complex<double> beta,
+                              const std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                              std::complex<double> *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, const float **x,
                            int64_t *incx, float **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
@@ -61,6 +61,99 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
     throw backend_unsupported_exception();
 }
 
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+              std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+              std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+             float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+             double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+             std::int64_t lda, std::complex<float> beta,
+             cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+             std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
               cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
@@ -83,19 +176,18 @@ inline void gemm_ext(Func func, DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType_A *>(ih, a_acc);
-            auto b_ = sc.get_mem<cuDataType_B *>(ih, b_acc);
-            auto c_ = sc.get_mem<cuDataType_C *>(ih, c_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(transa),
-                              get_cublas_operation(transb), m, n, k, (cuDataType_C *)&alpha, a_,
-                              DT_A, lda, b_, DT_B, ldb, (cuDataType_C *)&beta, c_, DT_C, ldc, DT_C,
-                              CUBLAS_GEMM_DEFAULT);
-        });
+        interop_task_output(
+            cgh, c, beta, m, n, ldc, [=](cl::sycl::interop_handler ih, cuDataType_C *c_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType_A *>(ih, a_acc);
+                auto b_ = sc.get_mem<cuDataType_B *>(ih, b_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(transa),
+                                  get_cublas_operation(transb), m, n, k, (cuDataType_C *)&alpha, a_,
+                                  DT_A, lda, b_, DT_B, ldb, (cuDataType_C *)&beta, c_, DT_C, ldc,
+                                  DT_C, CUBLAS_GEMM_DEFAULT);
+            });
     });
 }
 
@@ -154,6 +246,107 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
     throw backend_unsupported_exception();
 }
 
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                       std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, std::int64_t lda,
+                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                       std::complex<double> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         float alpha, const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         double alpha, const double *a, std::int64_t lda, double *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         std::complex<float> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         float alpha, float *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         double alpha, double *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, float alpha, const float *a, std::int64_t lda, float beta,
+                        const float *b, std::int64_t ldb, float *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, double alpha, const double *a, std::int64_t lda,
+                        double beta, const double *b, std::int64_t ldb, double *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                        std::int64_t lda, std::complex<float> beta, const std::complex<float> *b,
+                        std::int64_t ldb, std::complex<float> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                        std::int64_t lda, std::complex<double> beta, const std::complex<double> *b,
+                        std::int64_t ldb, std::complex<double> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 } // namespace cublas
 } // namespace mkl
 } // namespace oneapi
@@ -23,9 +23,11 @@
  */
 #ifndef _MKL_BLAS_CUBLAS_HELPER_HPP_
 #define _MKL_BLAS_CUBLAS_HELPER_HPP_
+#include <CL/sycl.hpp>
 #include <cublas_v2.h>
 #include <cuda.h>
 #include <complex>
+#include "include/output_access_helper.hpp"
 #include "oneapi/mkl/types.hpp"
 
 namespace oneapi {
@@ -219,6 +221,27 @@ struct CudaEquivalentType<std::complex<double>> {
     using Type = cuDoubleComplex;
 };
 
+/* Submits the interop_task of a routine writing the output operand c, passing
+ * it the device pointer to c. The previous contents of c are discarded rather
+ * than copied in when the routine does not read them. */
+template <typename T, typename S, typename F>
+inline void interop_task_output(cl::sycl::handler &cgh, cl::sycl::buffer<T, 1> &c, S beta,
+                                std::int64_t rows, std::int64_t cols, std::int64_t ld, F f) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    if (is_write_only(c, beta, rows, cols, ld)) {
+        auto c_acc = c.template get_access<cl::sycl::access::mode::discard_write>(cgh);
+        cgh.interop_task([=](cl::sycl::interop_handler ih) {
+            f(ih, reinterpret_cast<cuDataType *>(ih.get_mem<cl::sycl::backend::cuda>(c_acc)));
+        });
+    }
+    else {
+        auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        cgh.interop_task([=](cl::sycl::interop_handler ih) {
+            f(ih, reinterpret_cast<cuDataType *>(ih.get_mem<cl::sycl::backend::cuda>(c_acc)));
+        });
+    }
+}
+
 } // namespace cublas
 } // namespace mkl
 } // namespace oneapi
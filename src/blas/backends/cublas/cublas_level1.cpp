@@ -101,6 +101,36 @@ SCAL_LAUNCHER(float, std::complex<float>, cublasCsscal)
 SCAL_LAUNCHER(double, std::complex<double>, cublasZdscal)
 #undef SCAL_LAUNCHER
 
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline void axpy(Func func, cl::sycl::queue &queue, int64_t n, T alpha, cl::sycl::buffer<T, 1> &x,
                  int64_t incx, cl::sycl::buffer<T, 1> &y, int64_t incy) {
@@ -132,6 +162,54 @@ AXPY_LAUNCHER(std::complex<float>, cublasCaxpy)
 AXPY_LAUNCHER(std::complex<double>, cublasZaxpy)
 #undef AXPY_LAUNCHER
 
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          int64_t offset_x, int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          int64_t offset_x, int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t offset_x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t offset_y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t offset_x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t offset_y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T1, typename T2>
 inline void rotg(Func func, cl::sycl::queue &queue, cl::sycl::buffer<T1, 1> &a,
                  cl::sycl::buffer<T1, 1> &b, cl::sycl::buffer<T2, 1> &c,
@@ -651,6 +729,39 @@ SCAL_LAUNCHER_USM(float, std::complex<float>, cublasCsscal)
 SCAL_LAUNCHER_USM(double, std::complex<double>, cublasZdscal)
 #undef SCAL_LAUNCHER_USM
 
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha, double *x,
+                     int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, std::complex<float> *x,
+                     int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline cl::sycl::event axpy(Func func, cl::sycl::queue &queue, int64_t n, T alpha, const T *x,
                             int64_t incx, T *y, int64_t incy,
@@ -687,6 +798,30 @@ AXPY_LAUNCHER_USM(std::complex<float>, cublasCaxpy)
 AXPY_LAUNCHER_USM(std::complex<double>, cublasZaxpy)
 #undef AXPY_LAUNCHER_USM
 
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const float *alpha, const float *x,
+                     int64_t incx, float *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const double *alpha, const double *x,
+                     int64_t incx, double *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, int64_t incx, std::complex<float> *y,
+                     int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, int64_t incx, std::complex<double> *y,
+                     int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T1, typename T2>
 inline cl::sycl::event rotg(Func func, cl::sycl::queue &queue, T1 *a, T1 *b, T2 *c, T1 *s,
                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
@@ -1101,6 +1236,24 @@ NRM2_LAUNCHER_USM(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER_USM(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER_USM
 
+// Reproducible reductions are not implemented on this backend.
+
+void set_reproducibility(cl::sycl::queue &queue, reproducibility mode) {
+    if (mode != reproducibility::off)
+        throw backend_unsupported_exception();
+}
+
+// Performance counters are not implemented on this backend.
+
+void set_perf_counters(cl::sycl::queue &queue, bool enable) {
+    if (enable)
+        throw backend_unsupported_exception();
+}
+
+std::vector<oneapi::mkl::blas::perf_counter_record> get_perf_counters(cl::sycl::queue &queue) {
+    return {};
+}
+
 } // namespace cublas
 } // namespace mkl
 } // namespace oneapi
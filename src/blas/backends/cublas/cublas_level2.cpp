@@ -37,18 +37,18 @@ inline void gemv(Func func, cl::sycl::queue &queue, transpose trans, int64_t m,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(trans), m, n,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(trans), m, n,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -65,6 +65,68 @@ GEMV_LAUNCHER(std::complex<float>, cublasCgemv)
 GEMV_LAUNCHER(std::complex<double>, cublasZgemv)
 #undef GEMV_LAUNCHER
 
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
+          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
+          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &beta,
+          cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<float, 1> &x, int64_t offset_x, int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, int64_t offset_y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<double, 1> &x, int64_t offset_x, int64_t incx, double beta,
+          cl::sycl::buffer<double, 1> &y, int64_t offset_y, int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t offset_x, int64_t incx,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t offset_x, int64_t incx,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline void gbmv(Func func, cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
                  int64_t kl, int64_t ku, T alpha, cl::sycl::buffer<T, 1> &a, int64_t lda,
@@ -75,18 +137,18 @@ inline void gbmv(Func func, cl::sycl::queue &queue, transpose trans, int64_t m,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(trans), m, n, kl, ku,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(trans), m, n, kl, ku,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -151,18 +213,17 @@ inline void hbmv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n, k,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n, k,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -186,18 +247,17 @@ inline void hemv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -291,17 +351,17 @@ inline void hpmv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
-                              (cuDataType *)&alpha, a_, x_, incx, (cuDataType *)&beta, y_, incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
+                                  (cuDataType *)&alpha, a_, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -393,18 +453,17 @@ inline void sbmv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n, k,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n, k,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -429,18 +488,17 @@ inline void symv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
-                              (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
-                              incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
+                                  (cuDataType *)&alpha, a_, lda, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -537,17 +595,17 @@ inline void spmv(Func func, cl::sycl::queue &queue, uplo upper_lower, int64_t n,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto x_acc = x.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
-            auto y_ = sc.get_mem<cuDataType *>(ih, y_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
-                              (cuDataType *)&alpha, a_, x_, incx, (cuDataType *)&beta, y_, incy);
-        });
+        interop_task_output(
+            cgh, y, beta, 1, n, incy, [=](cl::sycl::interop_handler ih, cuDataType *y_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto x_ = sc.get_mem<cuDataType *>(ih, x_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_fill_mode(upper_lower), n,
+                                  (cuDataType *)&alpha, a_, x_, incx, (cuDataType *)&beta, y_,
+                                  incy);
+            });
     });
 }
 
@@ -889,6 +947,36 @@ GEMV_LAUNCHER_USM(std::complex<float>, cublasCgemv)
 GEMV_LAUNCHER_USM(std::complex<double>, cublasZgemv)
 #undef GEMV_LAUNCHER_USM
 
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const float *alpha, const float *a, int64_t lda, const float *x, int64_t incx,
+                     const float *beta, float *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const double *alpha, const double *a, int64_t lda, const double *x,
+                     int64_t incx, const double *beta, double *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                     const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                     std::complex<float> *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                     const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                     std::complex<double> *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline cl::sycl::event gbmv(Func func, cl::sycl::queue &queue, transpose trans, int64_t m,
                             int64_t n, int64_t kl, int64_t ku, T alpha, const T *a, int64_t lda,
@@ -38,18 +38,17 @@ inline void gemm(Func func, cl::sycl::queue &queue, transpose transa, transpose
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
-            auto c_ = sc.get_mem<cuDataType *>(ih, c_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(transa),
-                              get_cublas_operation(transb), m, n, k, (cuDataType *)&alpha, a_, lda,
-                              b_, ldb, (cuDataType *)&beta, c_, ldc);
-        });
+        interop_task_output(
+            cgh, c, beta, m, n, ldc, [=](cl::sycl::interop_handler ih, cuDataType *c_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_operation(transa),
+                                  get_cublas_operation(transb), m, n, k, (cuDataType *)&alpha, a_,
+                                  lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
+            });
     });
 }
 
@@ -68,6 +67,38 @@ GEMM_LAUNCHER(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER
 
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
+          cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+          int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+          cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
           std::int64_t n, std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
           std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
@@ -75,6 +106,36 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64
     throw std::runtime_error("Not implemented for cublas");
 }
 
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<float, 1> &b, int64_t offset_b, int64_t ldb, float beta,
+          cl::sycl::buffer<float, 1> &c, int64_t offset_c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<double, 1> &b, int64_t offset_b, int64_t ldb, double beta,
+          cl::sycl::buffer<double, 1> &c, int64_t offset_c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+          int64_t offset_b, int64_t ldb, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, int64_t offset_c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+          int64_t offset_b, int64_t ldb, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, int64_t offset_c, int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
 template <typename Func, typename T>
 inline void symm(Func func, cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
                  int64_t n, T alpha, cl::sycl::buffer<T, 1> &a, int64_t lda,
@@ -85,18 +146,17 @@ inline void symm(Func func, cl::sycl::queue &queue, side left_right, uplo upper_
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
-            auto c_ = sc.get_mem<cuDataType *>(ih, c_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_side_mode(left_right),
-                              get_cublas_fill_mode(upper_lower), m, n, (cuDataType *)&alpha, a_,
-                              lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
-        });
+        interop_task_output(
+            cgh, c, beta, m, n, ldc, [=](cl::sycl::interop_handler ih, cuDataType *c_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_side_mode(left_right),
+                                  get_cublas_fill_mode(upper_lower), m, n, (cuDataType *)&alpha, a_,
+                                  lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
+            });
     });
 }
 
@@ -125,18 +185,17 @@ inline void hemm(Func func, cl::sycl::queue &queue, side left_right, uplo upper_
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.template get_access<cl::sycl::access::mode::read>(cgh);
-        auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        cgh.interop_task([=](cl::sycl::interop_handler ih) {
-            auto sc = CublasScopedContextHandler(queue);
-            auto handle = sc.get_handle(queue);
-            auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
-            auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
-            auto c_ = sc.get_mem<cuDataType *>(ih, c_acc);
-            cublasStatus_t err;
-            CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_side_mode(left_right),
-                              get_cublas_fill_mode(upper_lower), m, n, (cuDataType *)&alpha, a_,
-                              lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
-        });
+        interop_task_output(
+            cgh, c, beta, m, n, ldc, [=](cl::sycl::interop_handler ih, cuDataType *c_) {
+                auto sc = CublasScopedContextHandler(queue);
+                auto handle = sc.get_handle(queue);
+                auto a_ = sc.get_mem<cuDataType *>(ih, a_acc);
+                auto b_ = sc.get_mem<cuDataType *>(ih, b_acc);
+                cublasStatus_t err;
+                CUBLAS_ERROR_FUNC(func, err, handle, get_cublas_side_mode(left_right),
+                                  get_cublas_fill_mode(upper_lower), m, n, (cuDataType *)&alpha, a_,
+                                  lda, b_, ldb, (cuDataType *)&beta, c_, ldc);
+            });
     });
 }
 
@@ -381,6 +440,34 @@ TRSM_LAUNCHER(std::complex<double>, cublasZtrsm)
 
 #undef TRSM_LAUNCHER
 
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t offset_b,
+          int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t offset_b,
+          int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, int64_t offset_b, int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, int64_t offset_b, int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
 // USM APIs
 
 template <typename Func, typename T>
@@ -426,6 +513,36 @@ GEMM_LAUNCHER_USM(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER_USM
 
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const float *alpha, const float *a, int64_t lda,
+                     const float *b, int64_t ldb, const float *beta, float *c, int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const double *alpha, const double *a, int64_t lda,
+                     const double *b, int64_t ldb, const double *beta, double *c, int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const std::complex<float> *alpha,
+                     const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                     int64_t ldb, const std::complex<float> *beta, std::complex<float> *c,
+                     int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const std::complex<double> *alpha,
+                     const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                     int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+                     int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
                      std::int64_t n, std::int64_t k, half alpha, const half *a, std::int64_t lda,
                      const half *b, std::int64_t ldb, half beta, half *c, std::int64_t ldc,
@@ -773,6 +890,10 @@ TRSM_LAUNCHER_USM(std::complex<double>, cublasZtrsm)
 
 #undef TRSM_LAUNCHER_USM
 
+// The Strassen-Winograd hint is not implemented on this backend; gemm ignores it.
+
+void set_gemm_algorithm(cl::sycl::queue &queue, gemm_algorithm algorithm, std::int64_t cutoff) {}
+
 } // namespace cublas
 } // namespace mkl
 } // namespace oneapi
@@ -31,6 +31,14 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::copy,
     oneapi::mkl::cublas::copy,
     oneapi::mkl::cublas::copy,
@@ -72,6 +80,12 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::sdsdot,
     oneapi::mkl::cublas::swap,
     oneapi::mkl::cublas::swap,
@@ -85,6 +99,14 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::ger,
     oneapi::mkl::cublas::ger,
     oneapi::mkl::cublas::gerc,
@@ -148,6 +170,14 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::hemm,
     oneapi::mkl::cublas::hemm,
     oneapi::mkl::cublas::herk,
@@ -174,6 +204,10 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::trsm,
     oneapi::mkl::cublas::trsm,
     oneapi::mkl::cublas::trsm,
+    oneapi::mkl::cublas::trsm,
+    oneapi::mkl::cublas::trsm,
+    oneapi::mkl::cublas::trsm,
+    oneapi::mkl::cublas::trsm,
     oneapi::mkl::cublas::gemm_batch,
     oneapi::mkl::cublas::gemm_batch,
     oneapi::mkl::cublas::gemm_batch,
@@ -186,6 +220,34 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemmt,
     oneapi::mkl::cublas::gemmt,
     oneapi::mkl::cublas::gemmt,
+    oneapi::mkl::cublas::gemm3m,
+    oneapi::mkl::cublas::gemm3m,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
     oneapi::mkl::cublas::gemm_ext,
     oneapi::mkl::cublas::gemm_ext,
     oneapi::mkl::cublas::gemm_ext,
@@ -201,6 +263,10 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
+    oneapi::mkl::cublas::axpy,
     oneapi::mkl::cublas::axpy_batch,
     oneapi::mkl::cublas::axpy_batch,
     oneapi::mkl::cublas::axpy_batch,
@@ -246,6 +312,12 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
+    oneapi::mkl::cublas::scal,
     oneapi::mkl::cublas::sdsdot,
     oneapi::mkl::cublas::swap,
     oneapi::mkl::cublas::swap,
@@ -259,6 +331,10 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
+    oneapi::mkl::cublas::gemv,
     oneapi::mkl::cublas::ger,
     oneapi::mkl::cublas::ger,
     oneapi::mkl::cublas::gerc,
@@ -321,6 +397,10 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
+    oneapi::mkl::cublas::gemm,
     oneapi::mkl::cublas::hemm,
     oneapi::mkl::cublas::hemm,
     oneapi::mkl::cublas::herk,
@@ -359,4 +439,40 @@ extern "C" function_table_t mkl_blas_table = {
     oneapi::mkl::cublas::gemmt,
     oneapi::mkl::cublas::gemmt,
     oneapi::mkl::cublas::gemmt,
+    oneapi::mkl::cublas::gemm3m,
+    oneapi::mkl::cublas::gemm3m,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::gemm3m_batch,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::omatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::imatcopy,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatadd,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::omatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::imatcopy_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::omatadd_batch,
+    oneapi::mkl::cublas::replay,
+    oneapi::mkl::cublas::replay,
+    oneapi::mkl::cublas::set_gemm_algorithm,
+    oneapi::mkl::cublas::set_reproducibility,
+    oneapi::mkl::cublas::set_perf_counters,
+    oneapi::mkl::cublas::get_perf_counters,
 };
@@ -33,6 +33,7 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
                 float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
+    const perf_call call(queue, "sgemm_batch_stride", m, n, k, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -66,11 +67,10 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 }
             }
 
-            ::sgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const float **)a_array,
-                          (const MKL_INT *)&lda, (const float **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::sgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const float **)a_array, mkl_int(lda), (const float **)b_array,
+                          mkl_int(ldb), &beta, c_array, mkl_int(ldc), (const MKL_INT *)&one,
+                          mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -84,6 +84,7 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
                 double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
+    const perf_call call(queue, "dgemm_batch_stride", m, n, k, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -117,11 +118,10 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 }
             }
 
-            ::dgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const double **)a_array,
-                          (const MKL_INT *)&lda, (const double **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::dgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const double **)a_array, mkl_int(lda), (const double **)b_array,
+                          mkl_int(ldb), &beta, c_array, mkl_int(ldc), (const MKL_INT *)&one,
+                          mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -136,6 +136,7 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t ldb, int64_t stride_b, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
+    const perf_call call(queue, "cgemm_batch_stride", m, n, k, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -169,11 +170,10 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 }
             }
 
-            ::cgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const MKL_Complex8 **)a_array,
-                          (const MKL_INT *)&lda, (const MKL_Complex8 **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+            ::cgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const MKL_Complex8 **)a_array, mkl_int(lda),
+                          (const MKL_Complex8 **)b_array, mkl_int(ldb), &beta, c_array,
+                          mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -188,6 +188,7 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
+    const perf_call call(queue, "zgemm_batch_stride", m, n, k, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -224,11 +225,10 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 }
             }
 
-            ::zgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const MKL_Complex16 **)a_array,
-                          (const MKL_INT *)&lda, (const MKL_Complex16 **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+            ::zgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const MKL_Complex16 **)a_array, mkl_int(lda),
+                          (const MKL_Complex16 **)b_array, mkl_int(ldb), &beta, c_array,
+                          mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -237,10 +237,344 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
     });
 }
 
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                  int64_t ldb, int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                  int64_t batch_size) {
+    const perf_call call(queue, "cgemm3m_batch_stride", m, n, k, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        char transa_ = *fortran_char(transa);
+        char transb_ = *fortran_char(transb);
+        MKL_INT one = 1;
+
+        host_task<class mkl_kernel_init_cgemm3m_batch_stride>(cgh, [=]() {
+            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
+            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
+                std::cout << "Error cannot allocate input arrays\n";
+                ::free(a_array);
+                ::free(b_array);
+                ::free(c_array);
+                return;
+            }
+
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = a_acc.get_pointer();
+                    b_array[0] = b_acc.get_pointer();
+                    c_array[0] = c_acc.get_pointer();
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+
+            ::cgemm3m_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                            (const MKL_Complex8 **)a_array, mkl_int(lda),
+                            (const MKL_Complex8 **)b_array, mkl_int(ldb), &beta, c_array,
+                            mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, std::complex<double> alpha,
+                  cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                  std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                  int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    const perf_call call(queue, "zgemm3m_batch_stride", m, n, k, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto b_acc = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto c_acc = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        char transa_ = *fortran_char(transa);
+        char transb_ = *fortran_char(transb);
+        MKL_INT one = 1;
+
+        host_task<class mkl_kernel_init_zgemm3m_batch_stride>(cgh, [=]() {
+            MKL_Complex16 **a_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+            MKL_Complex16 **b_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+            MKL_Complex16 **c_array =
+                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
+            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
+                std::cout << "Error cannot allocate input arrays\n";
+                ::free(a_array);
+                ::free(b_array);
+                ::free(c_array);
+                return;
+            }
+
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = a_acc.get_pointer();
+                    b_array[0] = b_acc.get_pointer();
+                    c_array[0] = c_acc.get_pointer();
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+
+            ::zgemm3m_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                            (const MKL_Complex16 **)a_array, mkl_int(lda),
+                            (const MKL_Complex16 **)b_array, mkl_int(ldb), &beta, c_array,
+                            mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    const perf_call call(queue, "somatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_somatcopy_batch_strided>(cgh, [=]() {
+            ::mkl_somatcopy_batch_strided('C', trans_, m, n, alpha, accessor_a.get_pointer(), lda,
+                                          stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                                          batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                    cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size) {
+    const perf_call call(queue, "domatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_domatcopy_batch_strided>(cgh, [=]() {
+            ::mkl_domatcopy_batch_strided('C', trans_, m, n, alpha, accessor_a.get_pointer(), lda,
+                                          stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                                          batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    const perf_call call(queue, "comatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_comatcopy_batch_strided>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_comatcopy_batch_strided('C', trans_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                                          stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                                          batch_size);
+        });
+    });
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    int64_t lda, int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    const perf_call call(queue, "zomatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_zomatcopy_batch_strided>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zomatcopy_batch_strided('C', trans_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                                          stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                                          batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    const perf_call call(queue, "simatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_simatcopy_batch_strided>(cgh, [=]() {
+            ::mkl_simatcopy_batch_strided('C', trans_, m, n, alpha, accessor_ab.get_pointer(), lda,
+                                          ldb, stride, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb, int64_t stride,
+                    int64_t batch_size) {
+    const perf_call call(queue, "dimatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dimatcopy_batch_strided>(cgh, [=]() {
+            ::mkl_dimatcopy_batch_strided('C', trans_, m, n, alpha, accessor_ab.get_pointer(), lda,
+                                          ldb, stride, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    const perf_call call(queue, "cimatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cimatcopy_batch_strided>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_cimatcopy_batch_strided('C', trans_, m, n, alpha_, accessor_ab.get_pointer(), lda,
+                                          ldb, stride, batch_size);
+        });
+    });
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+                    int64_t lda, int64_t ldb, int64_t stride, int64_t batch_size) {
+    const perf_call call(queue, "zimatcopy_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zimatcopy_batch_strided>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zimatcopy_batch_strided('C', trans_, m, n, alpha_, accessor_ab.get_pointer(), lda,
+                                          ldb, stride, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
+                   float beta, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    const perf_call call(queue, "somatadd_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_somatadd_batch_strided>(cgh, [=]() {
+            ::mkl_somatadd_batch_strided('C', transa_, transb_, m, n, alpha,
+                                         accessor_a.get_pointer(), lda, stride_a, beta,
+                                         accessor_b.get_pointer(), ldb, stride_b,
+                                         accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
+                   double beta, cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    const perf_call call(queue, "domatadd_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_domatadd_batch_strided>(cgh, [=]() {
+            ::mkl_domatadd_batch_strided('C', transa_, transb_, m, n, alpha,
+                                         accessor_a.get_pointer(), lda, stride_a, beta,
+                                         accessor_b.get_pointer(), ldb, stride_b,
+                                         accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    const perf_call call(queue, "comatadd_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_comatadd_batch_strided>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::mkl_comatadd_batch_strided('C', transa_, transb_, m, n, alpha_,
+                                         accessor_a.get_pointer(), lda, stride_a, beta_,
+                                         accessor_b.get_pointer(), ldb, stride_b,
+                                         accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
+void omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   int64_t lda, int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
+                   cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
+                   int64_t batch_size) {
+    const perf_call call(queue, "zomatadd_batch_strided", m, n, 0, batch_size);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_zomatadd_batch_strided>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::mkl_zomatadd_batch_strided('C', transa_, transb_, m, n, alpha_,
+                                         accessor_a.get_pointer(), lda, stride_a, beta_,
+                                         accessor_b.get_pointer(), ldb, stride_b,
+                                         accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
+}
+
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                 int64_t lda, int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
+    const perf_call call(queue, "strsm_batch_stride", m, n, 0, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -271,10 +605,9 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 }
             }
 
-            ::strsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const float **)a_array, (const MKL_INT *)&lda, (float **)b_array,
-                          (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::strsm_batch(&side_, &uplo_, &trans_, &diag_, mkl_int(m), mkl_int(n), &alpha,
+                          (const float **)a_array, mkl_int(lda), (float **)b_array, mkl_int(ldb),
+                          (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -286,6 +619,7 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                 int64_t lda, int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
+    const perf_call call(queue, "dtrsm_batch_stride", m, n, 0, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -316,10 +650,9 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 }
             }
 
-            ::dtrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const double **)a_array, (const MKL_INT *)&lda,
-                          (double **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::dtrsm_batch(&side_, &uplo_, &trans_, &diag_, mkl_int(m), mkl_int(n), &alpha,
+                          (const double **)a_array, mkl_int(lda), (double **)b_array, mkl_int(ldb),
+                          (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -332,6 +665,7 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
+    const perf_call call(queue, "ctrsm_batch_stride", m, n, 0, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -362,10 +696,9 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 }
             }
 
-            ::ctrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const MKL_Complex8 **)a_array, (const MKL_INT *)&lda,
-                          (MKL_Complex8 **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::ctrsm_batch(&side_, &uplo_, &trans_, &diag_, mkl_int(m), mkl_int(n), &alpha,
+                          (const MKL_Complex8 **)a_array, mkl_int(lda), (MKL_Complex8 **)b_array,
+                          mkl_int(ldb), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -378,6 +711,7 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
+    const perf_call call(queue, "ztrsm_batch_stride", m, n, 0, batch_size);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto a_acc = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto b_acc = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -409,10 +743,9 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 }
             }
 
-            ::ztrsm_batch(&side_, &uplo_, &trans_, &diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          &alpha, (const MKL_Complex16 **)a_array, (const MKL_INT *)&lda,
-                          (MKL_Complex16 **)b_array, (const MKL_INT *)&ldb, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::ztrsm_batch(&side_, &uplo_, &trans_, &diag_, mkl_int(m), mkl_int(n), &alpha,
+                          (const MKL_Complex16 **)a_array, mkl_int(lda), (MKL_Complex16 **)b_array,
+                          mkl_int(ldb), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
@@ -427,11 +760,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemm_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_usm_sgemm>(cgh, [=]() {
             char *transa_ = (char *)::malloc(sizeof(char) * group_count);
             char *transb_ = (char *)::malloc(sizeof(char) * group_count);
@@ -445,15 +776,16 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::sgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const float **)a, (const MKL_INT *)lda,
-                          (const float **)b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+            ::sgemm_batch(transa_, transb_, mkl_int_array(m, group_count),
+                          mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                          (const float **)a, mkl_int_array(lda, group_count), (const float **)b,
+                          mkl_int_array(ldb, group_count), beta, c, mkl_int_array(ldc, group_count),
+                          mkl_int(group_count), mkl_int_array(group_size, group_count));
             ::free(transa_);
             ::free(transb_);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -461,11 +793,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemm_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dgemm_batch_usm>(cgh, [=]() {
             char *transa_ = (char *)::malloc(sizeof(char) * group_count);
             char *transb_ = (char *)::malloc(sizeof(char) * group_count);
@@ -479,15 +809,16 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::dgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const double **)a, (const MKL_INT *)lda,
-                          (const double **)b, (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+            ::dgemm_batch(transa_, transb_, mkl_int_array(m, group_count),
+                          mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                          (const double **)a, mkl_int_array(lda, group_count), (const double **)b,
+                          mkl_int_array(ldb, group_count), beta, c, mkl_int_array(ldc, group_count),
+                          mkl_int(group_count), mkl_int_array(group_size, group_count));
             ::free(transa_);
             ::free(transb_);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -497,11 +828,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_cgemm_batch_usm>(cgh, [=]() {
             char *transa_ = (char *)::malloc(sizeof(char) * group_count);
             char *transb_ = (char *)::malloc(sizeof(char) * group_count);
@@ -515,16 +844,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::cgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const std::complex<float> **)a,
-                          (const MKL_INT *)lda, (const std::complex<float> **)b,
-                          (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+            ::cgemm_batch(transa_, transb_, mkl_int_array(m, group_count),
+                          mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                          (const std::complex<float> **)a, mkl_int_array(lda, group_count),
+                          (const std::complex<float> **)b, mkl_int_array(ldb, group_count), beta, c,
+                          mkl_int_array(ldc, group_count), mkl_int(group_count),
+                          mkl_int_array(group_size, group_count));
             ::free(transa_);
             ::free(transb_);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -534,11 +864,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zgemm_batch_usm>(cgh, [=]() {
             char *transa_ = (char *)::malloc(sizeof(char) * group_count);
             char *transb_ = (char *)::malloc(sizeof(char) * group_count);
@@ -552,16 +880,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 transa_[i] = *fortran_char(transa[i]);
                 transb_[i] = *fortran_char(transb[i]);
             }
-            ::zgemm_batch(transa_, transb_, (const MKL_INT *)m, (const MKL_INT *)n,
-                          (const MKL_INT *)k, alpha, (const std::complex<double> **)a,
-                          (const MKL_INT *)lda, (const std::complex<double> **)b,
-                          (const MKL_INT *)ldb, beta, c, (const MKL_INT *)ldc,
-                          (const MKL_INT *)&group_count, (const MKL_INT *)group_size);
+            ::zgemm_batch(transa_, transb_, mkl_int_array(m, group_count),
+                          mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                          (const std::complex<double> **)a, mkl_int_array(lda, group_count),
+                          (const std::complex<double> **)b, mkl_int_array(ldb, group_count), beta,
+                          c, mkl_int_array(ldc, group_count), mkl_int(group_count),
+                          mkl_int_array(group_size, group_count));
             ::free(transa_);
             ::free(transb_);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -569,11 +898,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemm_batch_stride_usm", m, n, k, batch_size);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         MKL_INT one = 1;
@@ -600,18 +927,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                     c_array[i] = c_array[i - 1] + stride_c;
                 }
             }
-            ::sgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const float **)a_array,
-                          (const MKL_INT *)&lda, (const float **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::sgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const float **)a_array, mkl_int(lda), (const float **)b_array,
+                          mkl_int(ldb), &beta, c_array, mkl_int(ldc), (const MKL_INT *)&one,
+                          mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
             ::free(c_array);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -620,11 +946,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemm_batch_stride_usm", m, n, k, batch_size);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         MKL_INT one = 1;
@@ -651,18 +975,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                     c_array[i] = c_array[i - 1] + stride_c;
                 }
             }
-            ::dgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const double **)a_array,
-                          (const MKL_INT *)&lda, (const double **)b_array, (const MKL_INT *)&ldb,
-                          &beta, c_array, (const MKL_INT *)&ldc, (const MKL_INT *)&one,
-                          (const MKL_INT *)&batch_size);
+            ::dgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const double **)a_array, mkl_int(lda), (const double **)b_array,
+                          mkl_int(ldb), &beta, c_array, mkl_int(ldc), (const MKL_INT *)&one,
+                          mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
             ::free(c_array);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -672,11 +995,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm_batch_stride_usm", m, n, k, batch_size);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         MKL_INT one = 1;
@@ -706,18 +1027,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                     c_array[i] = c_array[i - 1] + stride_c;
                 }
             }
-            ::cgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const std::complex<float> **)a_array,
-                          (const MKL_INT *)&lda, (const std::complex<float> **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+            ::cgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const std::complex<float> **)a_array, mkl_int(lda),
+                          (const std::complex<float> **)b_array, mkl_int(ldb), &beta, c_array,
+                          mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
             ::free(c_array);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -727,11 +1047,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm_batch_stride_usm", m, n, k, batch_size);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         MKL_INT one = 1;
@@ -761,116 +1079,502 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                     c_array[i] = c_array[i - 1] + stride_c;
                 }
             }
-            ::zgemm_batch(&transa_, &transb_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                          (const MKL_INT *)&k, &alpha, (const std::complex<double> **)a_array,
-                          (const MKL_INT *)&lda, (const std::complex<double> **)b_array,
-                          (const MKL_INT *)&ldb, &beta, c_array, (const MKL_INT *)&ldc,
-                          (const MKL_INT *)&one, (const MKL_INT *)&batch_size);
+            ::zgemm_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                          (const std::complex<double> **)a_array, mkl_int(lda),
+                          (const std::complex<double> **)b_array, mkl_int(ldb), &beta, c_array,
+                          mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
 
             ::free(a_array);
             ::free(b_array);
             ::free(c_array);
         });
     });
-    return done;
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             int64_t *m, int64_t *n, int64_t *k, std::complex<float> *alpha,
+                             const std::complex<float> **a, int64_t *lda,
+                             const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
+                             std::complex<float> **c, int64_t *ldc, int64_t group_count,
+                             int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm3m_batch_group_usm", 0, 0, 0, group_count);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_cgemm3m_batch_group_usm>(cgh, [=]() {
+            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
+            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
+            if ((transa_ == NULL) || (transb_ == NULL)) {
+                std::cout << "Error cannot allocate trans arrays\n";
+                ::free(transa_);
+                ::free(transb_);
+                return;
+            }
+            for (int64_t i = 0; i < group_count; i++) {
+                transa_[i] = *fortran_char(transa[i]);
+                transb_[i] = *fortran_char(transb[i]);
+            }
+            ::cgemm3m_batch(transa_, transb_, mkl_int_array(m, group_count),
+                            mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                            (const std::complex<float> **)a, mkl_int_array(lda, group_count),
+                            (const std::complex<float> **)b, mkl_int_array(ldb, group_count), beta,
+                            c, mkl_int_array(ldc, group_count), mkl_int(group_count),
+                            mkl_int_array(group_size, group_count));
+            ::free(transa_);
+            ::free(transb_);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb,
+                             int64_t *m, int64_t *n, int64_t *k, std::complex<double> *alpha,
+                             const std::complex<double> **a, int64_t *lda,
+                             const std::complex<double> **b, int64_t *ldb,
+                             std::complex<double> *beta, std::complex<double> **c, int64_t *ldc,
+                             int64_t group_count, int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm3m_batch_group_usm", 0, 0, 0, group_count);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_zgemm3m_batch_group_usm>(cgh, [=]() {
+            char *transa_ = (char *)::malloc(sizeof(char) * group_count);
+            char *transb_ = (char *)::malloc(sizeof(char) * group_count);
+            if ((transa_ == NULL) || (transb_ == NULL)) {
+                std::cout << "Error cannot allocate trans arrays\n";
+                ::free(transa_);
+                ::free(transb_);
+                return;
+            }
+            for (int64_t i = 0; i < group_count; i++) {
+                transa_[i] = *fortran_char(transa[i]);
+                transb_[i] = *fortran_char(transb[i]);
+            }
+            ::zgemm3m_batch(transa_, transb_, mkl_int_array(m, group_count),
+                            mkl_int_array(n, group_count), mkl_int_array(k, group_count), alpha,
+                            (const std::complex<double> **)a, mkl_int_array(lda, group_count),
+                            (const std::complex<double> **)b, mkl_int_array(ldb, group_count), beta,
+                            c, mkl_int_array(ldc, group_count), mkl_int(group_count),
+                            mkl_int_array(group_size, group_count));
+            ::free(transa_);
+            ::free(transb_);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *a, int64_t lda, int64_t stride_a,
+                             const std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                             std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                             int64_t stride_c, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm3m_batch_stride_usm", m, n, k, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        MKL_INT one = 1;
+        host_task<class mkl_kernel_cgemm3m_batch_stride_usm>(cgh, [=]() {
+            std::complex<float> **a_array =
+                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
+            std::complex<float> **b_array =
+                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
+            std::complex<float> **c_array =
+                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
+            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
+                std::cout << "Error cannot allocate input arrays\n";
+                ::free(a_array);
+                ::free(b_array);
+                ::free(c_array);
+                return;
+            }
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = (std::complex<float> *)a;
+                    b_array[0] = (std::complex<float> *)b;
+                    c_array[0] = (std::complex<float> *)c;
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+            ::cgemm3m_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                            (const std::complex<float> **)a_array, mkl_int(lda),
+                            (const std::complex<float> **)b_array, mkl_int(ldb), &beta, c_array,
+                            mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *a, int64_t lda, int64_t stride_a,
+                             const std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                             std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                             int64_t stride_c, int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm3m_batch_stride_usm", m, n, k, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        MKL_INT one = 1;
+        host_task<class mkl_kernel_zgemm3m_batch_stride_usm>(cgh, [=]() {
+            std::complex<double> **a_array =
+                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
+            std::complex<double> **b_array =
+                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
+            std::complex<double> **c_array =
+                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
+            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
+                std::cout << "Error cannot allocate input arrays\n";
+                ::free(a_array);
+                ::free(b_array);
+                ::free(c_array);
+                return;
+            }
+            for (int64_t i = 0; i < batch_size; i++) {
+                if (i == 0) {
+                    a_array[0] = (std::complex<double> *)a;
+                    b_array[0] = (std::complex<double> *)b;
+                    c_array[0] = (std::complex<double> *)c;
+                }
+                else {
+                    a_array[i] = a_array[i - 1] + stride_a;
+                    b_array[i] = b_array[i - 1] + stride_b;
+                    c_array[i] = c_array[i - 1] + stride_c;
+                }
+            }
+            ::zgemm3m_batch(&transa_, &transb_, mkl_int(m), mkl_int(n), mkl_int(k), &alpha,
+                            (const std::complex<double> **)a_array, mkl_int(lda),
+                            (const std::complex<double> **)b_array, mkl_int(ldb), &beta, c_array,
+                            mkl_int(ldc), (const MKL_INT *)&one, mkl_int(batch_size));
+
+            ::free(a_array);
+            ::free(b_array);
+            ::free(c_array);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               float alpha, const float *a, int64_t lda, int64_t stride_a, float *b,
+                               int64_t ldb, int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "somatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_somatcopy_batch_strided_usm>(cgh, [=]() {
+            ::mkl_somatcopy_batch_strided('C', trans_, m, n, alpha, a, lda, stride_a, b, ldb,
+                                          stride_b, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               double alpha, const double *a, int64_t lda, int64_t stride_a,
+                               double *b, int64_t ldb, int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "domatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_domatcopy_batch_strided_usm>(cgh, [=]() {
+            ::mkl_domatcopy_batch_strided('C', trans_, m, n, alpha, a, lda, stride_a, b, ldb,
+                                          stride_b, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                               int64_t stride_a, std::complex<float> *b, int64_t ldb,
+                               int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "comatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_comatcopy_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_comatcopy_batch_strided('C', trans_, m, n, alpha_, a, lda, stride_a, b, ldb,
+                                          stride_b, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<double> alpha, const std::complex<double> *a,
+                               int64_t lda, int64_t stride_a, std::complex<double> *b, int64_t ldb,
+                               int64_t stride_b, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zomatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_zomatcopy_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zomatcopy_batch_strided('C', trans_, m, n, alpha_, a, lda, stride_a, b, ldb,
+                                          stride_b, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               float alpha, float *ab, int64_t lda, int64_t ldb, int64_t stride,
+                               int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "simatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_simatcopy_batch_strided_usm>(cgh, [=]() {
+            ::mkl_simatcopy_batch_strided('C', trans_, m, n, alpha, ab, lda, ldb, stride,
+                                          batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               double alpha, double *ab, int64_t lda, int64_t ldb, int64_t stride,
+                               int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dimatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_dimatcopy_batch_strided_usm>(cgh, [=]() {
+            ::mkl_dimatcopy_batch_strided('C', trans_, m, n, alpha, ab, lda, ldb, stride,
+                                          batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<float> alpha, std::complex<float> *ab, int64_t lda,
+                               int64_t ldb, int64_t stride, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cimatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_cimatcopy_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_cimatcopy_batch_strided('C', trans_, m, n, alpha_, ab, lda, ldb, stride,
+                                          batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                               std::complex<double> alpha, std::complex<double> *ab, int64_t lda,
+                               int64_t ldb, int64_t stride, int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zimatcopy_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_zimatcopy_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zimatcopy_batch_strided('C', trans_, m, n, alpha_, ab, lda, ldb, stride,
+                                          batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, float alpha, const float *a, int64_t lda, int64_t stride_a,
+                              float beta, const float *b, int64_t ldb, int64_t stride_b, float *c,
+                              int64_t ldc, int64_t stride_c, int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "somatadd_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_somatadd_batch_strided_usm>(cgh, [=]() {
+            ::mkl_somatadd_batch_strided('C', transa_, transb_, m, n, alpha, a, lda, stride_a, beta,
+                                         b, ldb, stride_b, c, ldc, stride_c, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, double alpha, const double *a, int64_t lda,
+                              int64_t stride_a, double beta, const double *b, int64_t ldb,
+                              int64_t stride_b, double *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "domatadd_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_domatadd_batch_strided_usm>(cgh, [=]() {
+            ::mkl_domatadd_batch_strided('C', transa_, transb_, m, n, alpha, a, lda, stride_a, beta,
+                                         b, ldb, stride_b, c, ldc, stride_c, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                              int64_t lda, int64_t stride_a, std::complex<float> beta,
+                              const std::complex<float> *b, int64_t ldb, int64_t stride_b,
+                              std::complex<float> *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "comatadd_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_comatadd_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::mkl_comatadd_batch_strided('C', transa_, transb_, m, n, alpha_, a, lda, stride_a,
+                                         beta_, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                              int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                              int64_t lda, int64_t stride_a, std::complex<double> beta,
+                              const std::complex<double> *b, int64_t ldb, int64_t stride_b,
+                              std::complex<double> *c, int64_t ldc, int64_t stride_c,
+                              int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zomatadd_batch_strided_usm", m, n, 0, batch_size);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_zomatadd_batch_strided_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::mkl_zomatadd_batch_strided('C', transa_, transb_, m, n, alpha_, a, lda, stride_a,
+                                         beta_, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+        });
+    });
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, const float **x,
                            int64_t *incx, float **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "saxpy_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_saxpy_batch_usm>(cgh, [=]() {
             int64_t offset = 0;
             for (int64_t i = 0; i < group_count; i++) {
                 for (int64_t j = 0; j < group_size[i]; j++) {
-                    ::saxpy((const MKL_INT *)(n + i), (const float *)(alpha + i), x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
+                    ::saxpy(mkl_int(n[i]), (const float *)(alpha + i), x[offset + j],
+                            mkl_int(incx[i]), y[offset + j], mkl_int(incy[i]));
                 }
                 offset += group_size[i];
             }
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, const double **x,
                            int64_t *incx, double **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "daxpy_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_daxpy_batch_usm>(cgh, [=]() {
             int64_t offset = 0;
             for (int64_t i = 0; i < group_count; i++) {
                 for (int64_t j = 0; j < group_size[i]; j++) {
-                    ::daxpy((const MKL_INT *)(n + i), (const double *)(alpha + i), x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
+                    ::daxpy(mkl_int(n[i]), (const double *)(alpha + i), x[offset + j],
+                            mkl_int(incx[i]), y[offset + j], mkl_int(incy[i]));
                 }
                 offset += group_size[i];
             }
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<float> *alpha,
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "caxpy_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_caxpy_batch_usm>(cgh, [=]() {
             int64_t offset = 0;
             for (int64_t i = 0; i < group_count; i++) {
                 for (int64_t j = 0; j < group_size[i]; j++) {
                     MKL_Complex8 alpha_ = { alpha[i].real(), alpha[i].imag() };
-                    ::caxpy((const MKL_INT *)(n + i), (const MKL_Complex8 *)&alpha_, x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
+                    ::caxpy(mkl_int(n[i]), (const MKL_Complex8 *)&alpha_, x[offset + j],
+                            mkl_int(incx[i]), y[offset + j], mkl_int(incy[i]));
                 }
                 offset += group_size[i];
             }
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<double> *alpha,
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zaxpy_batch_usm", 0, 0, 0, group_count);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zaxpy_batch_usm>(cgh, [=]() {
             int64_t offset = 0;
             for (int64_t i = 0; i < group_count; i++) {
                 for (int64_t j = 0; j < group_size[i]; j++) {
                     MKL_Complex16 alpha_ = { alpha[i].real(), alpha[i].imag() };
-                    ::zaxpy((const MKL_INT *)(n + i), (const MKL_Complex16 *)&alpha_, x[offset + j],
-                            (const MKL_INT *)(incx + i), y[offset + j],
-                            (const MKL_INT *)(incy + i));
+                    ::zaxpy(mkl_int(n[i]), (const MKL_Complex16 *)&alpha_, x[offset + j],
+                            mkl_int(incx[i]), y[offset + j], mkl_int(incy[i]));
                 }
                 offset += group_size[i];
             }
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 } // namespace mklcpu
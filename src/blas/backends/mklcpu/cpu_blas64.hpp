@@ -0,0 +1,348 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_BLAS64_HPP_
+#define _MKL_BLAS_CPU_BLAS64_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_split_k.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Calls to the MKL routine f with 64-bit sizes. With the ILP64 interface
+//  every call goes to f unchanged. With LP64, a problem with a size beyond
+//  MKL_INT is split into pieces that fit: level 1 vectors into chunks run on
+//  MKL threads in parallel, combining the partial results of reductions in
+//  chunk order, and gemv, ger and gemm matrices into blocks. Leading
+//  dimensions cannot be split and must still fit.
+namespace blas64 {
+
+// Keeps a parameter out of template argument deduction, so that accessor
+//  pointers convert to the pointer types f takes.
+template <typename T>
+struct identity {
+    using type = T;
+};
+
+template <typename T>
+using same = typename identity<T>::type;
+
+#ifdef MKL_ILP64
+constexpr int64_t max_size = std::numeric_limits<int64_t>::max();
+#else
+constexpr int64_t max_size = std::numeric_limits<MKL_INT>::max();
+#endif
+
+inline int64_t num_blocks(int64_t n) {
+    return (n <= max_size) ? 1 : (n + max_size - 1) / max_size;
+}
+
+// Offset of elements begin, ..., begin + count - 1 of an n-element vector.
+//  Negative increments store the vector backwards from its last element.
+inline int64_t offset(int64_t begin, int64_t count, int64_t n, int64_t inc) {
+    return (inc >= 0) ? begin * inc : (n - begin - count) * -inc;
+}
+
+// An n-element vector is one chunk when n fits, otherwise at least as many
+//  chunks as MKL threads.
+inline int64_t num_chunks(int64_t n) {
+    return (n <= max_size) ? 1 : std::max<int64_t>(num_blocks(n), mkl_get_max_threads());
+}
+
+// Runs f(chunk, begin, count) over the chunks of an n-element vector.
+template <typename F>
+void for_each_chunk(int64_t n, F f) {
+    const int64_t chunks = num_chunks(n);
+    if (chunks == 1) {
+        f(0, 0, n);
+        return;
+    }
+    split_k_parallel(chunks, std::min<int64_t>(chunks, mkl_get_max_threads()), [&](int64_t i) {
+        const int64_t begin = n * i / chunks;
+        f(i, begin, n * (i + 1) / chunks - begin);
+    });
+}
+
+// Level 1
+
+template <typename T, typename S>
+void axpy(void (*f)(const MKL_INT *, const S *, const T *, const MKL_INT *, T *, const MKL_INT *),
+          int64_t n, same<const S *> alpha, same<const T *> x, int64_t incx, same<T *> y,
+          int64_t incy) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), alpha, x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+}
+
+template <typename T, typename S>
+void scal(void (*f)(const MKL_INT *, const S *, T *, const MKL_INT *), int64_t n,
+          same<const S *> alpha, same<T *> x, int64_t incx) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), alpha, x + offset(begin, count, n, incx), mkl_int(incx));
+    });
+}
+
+template <typename T>
+void copy(void (*f)(const MKL_INT *, const T *, const MKL_INT *, T *, const MKL_INT *), int64_t n,
+          same<const T *> x, int64_t incx, same<T *> y, int64_t incy) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+}
+
+template <typename T>
+void swap(void (*f)(const MKL_INT *, T *, const MKL_INT *, T *, const MKL_INT *), int64_t n,
+          same<T *> x, int64_t incx, same<T *> y, int64_t incy) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+}
+
+template <typename T, typename S>
+void rot(void (*f)(const MKL_INT *, T *, const MKL_INT *, T *, const MKL_INT *, const S *,
+                   const S *),
+         int64_t n, same<T *> x, int64_t incx, same<T *> y, int64_t incy, same<const S *> c,
+         same<const S *> s) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy), c, s);
+    });
+}
+
+template <typename T>
+void rotm(void (*f)(const MKL_INT *, T *, const MKL_INT *, T *, const MKL_INT *, const T *),
+          int64_t n, same<T *> x, int64_t incx, same<T *> y, int64_t incy, same<const T *> param) {
+    for_each_chunk(n, [&](int64_t, int64_t begin, int64_t count) {
+        f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy), param);
+    });
+}
+
+template <typename R>
+R sum_partials(const std::vector<R> &partials) {
+    R sum = R(0);
+    for (auto &partial : partials)
+        sum += partial;
+    return sum;
+}
+
+template <typename R, typename T>
+R dot(R (*f)(const MKL_INT *, const T *, const MKL_INT *, const T *, const MKL_INT *), int64_t n,
+      same<const T *> x, int64_t incx, same<const T *> y, int64_t incy) {
+    std::vector<R> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        partials[i] = f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+                        y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+    return sum_partials(partials);
+}
+
+// The partials of sdsdot are accumulated in double, as within each chunk.
+inline float sdsdot(float (*f)(const MKL_INT *, const float *, const float *, const MKL_INT *,
+                               const float *, const MKL_INT *),
+                    int64_t n, const float *sb, const float *x, int64_t incx, const float *y,
+                    int64_t incy) {
+    if (n <= max_size)
+        return f(mkl_int(n), sb, x, mkl_int(incx), y, mkl_int(incy));
+    const float zero = 0.0f;
+    std::vector<double> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        partials[i] = f(mkl_int(count), &zero, x + offset(begin, count, n, incx), mkl_int(incx),
+                        y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+    return float(double(*sb) + sum_partials(partials));
+}
+
+template <typename T>
+void dot(void (*f)(T *, const MKL_INT *, const T *, const MKL_INT *, const T *, const MKL_INT *),
+         same<T *> result, int64_t n, same<const T *> x, int64_t incx, same<const T *> y,
+         int64_t incy) {
+    std::vector<T> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        f(&partials[i], mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx),
+          y + offset(begin, count, n, incy), mkl_int(incy));
+    });
+    *result = sum_partials(partials);
+}
+
+template <typename R, typename T>
+R asum(R (*f)(const MKL_INT *, const T *, const MKL_INT *), int64_t n, same<const T *> x,
+       int64_t incx) {
+    std::vector<R> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        partials[i] = f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx));
+    });
+    return sum_partials(partials);
+}
+
+// The norms of the chunks are combined relative to the largest of them, which
+//  avoids overflow and underflow as nrm2 itself does.
+template <typename R, typename T>
+R nrm2(R (*f)(const MKL_INT *, const T *, const MKL_INT *), int64_t n, same<const T *> x,
+       int64_t incx) {
+    std::vector<R> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        partials[i] = f(mkl_int(count), x + offset(begin, count, n, incx), mkl_int(incx));
+    });
+    if (partials.size() == 1)
+        return partials[0];
+    const R scale = *std::max_element(partials.begin(), partials.end());
+    if (scale == R(0))
+        return scale;
+    R sum = R(0);
+    for (auto &partial : partials)
+        sum += (partial / scale) * (partial / scale);
+    return scale * std::sqrt(sum);
+}
+
+template <typename T>
+T abs1(T x) {
+    return std::abs(x);
+}
+
+template <typename T>
+T abs1(std::complex<T> x) {
+    return std::abs(x.real()) + std::abs(x.imag());
+}
+
+// The chunks return the position of their first extreme element; the first
+//  chunk holding the overall extreme gives the result, as in a single call.
+template <typename T, typename X>
+int64_t iamax(CBLAS_INDEX (*f)(const MKL_INT, const X *, const MKL_INT), int64_t n, const T *x,
+              int64_t incx, bool largest) {
+    if (n <= max_size)
+        return f(*mkl_int(n), x, *mkl_int(incx));
+    if (incx <= 0)
+        return 0;
+    std::vector<int64_t> partials(num_chunks(n));
+    for_each_chunk(n, [&](int64_t i, int64_t begin, int64_t count) {
+        partials[i] = begin + f(MKL_INT(count), x + begin * incx, MKL_INT(incx));
+    });
+    int64_t best = partials[0];
+    for (auto &partial : partials) {
+        const auto value = abs1(x[partial * incx]), best_value = abs1(x[best * incx]);
+        if (largest ? value > best_value : value < best_value)
+            best = partial;
+    }
+    return best;
+}
+
+// Level 2
+
+// y is split into chunks computed in parallel, and x into blocks whose
+//  products accumulate into y in order, the first one scaled by beta.
+template <typename T>
+void gemv(void (*f)(const char *, const MKL_INT *, const MKL_INT *, const T *, const T *,
+                    const MKL_INT *, const T *, const MKL_INT *, const T *, T *, const MKL_INT *),
+          const char *trans, int64_t m, int64_t n, same<const T *> alpha, same<const T *> a,
+          int64_t lda, same<const T *> x, int64_t incx, same<const T *> beta, same<T *> y,
+          int64_t incy) {
+    const bool nontrans = (*trans == 'N' || *trans == 'n');
+    const int64_t len_y = nontrans ? m : n, len_x = nontrans ? n : m;
+    const int64_t x_blocks = num_blocks(len_x);
+    const T one = T(1);
+    for_each_chunk(len_y, [&](int64_t, int64_t y_begin, int64_t y_count) {
+        for (int64_t j = 0; j < x_blocks; j++) {
+            const int64_t x_begin = len_x * j / x_blocks;
+            const int64_t x_count = len_x * (j + 1) / x_blocks - x_begin;
+            const int64_t rows = nontrans ? y_count : x_count;
+            const int64_t cols = nontrans ? x_count : y_count;
+            const T *a_block = nontrans ? a + y_begin + x_begin * lda : a + x_begin + y_begin * lda;
+            f(trans, mkl_int(rows), mkl_int(cols), alpha, a_block, mkl_int(lda),
+              x + offset(x_begin, x_count, len_x, incx), mkl_int(incx), (j == 0) ? beta : &one,
+              y + offset(y_begin, y_count, len_y, incy), mkl_int(incy));
+        }
+    });
+}
+
+// Every block of A is an independent rank-1 update.
+template <typename T>
+void ger(void (*f)(const MKL_INT *, const MKL_INT *, const T *, const T *, const MKL_INT *,
+                   const T *, const MKL_INT *, T *, const MKL_INT *),
+         int64_t m, int64_t n, same<const T *> alpha, same<const T *> x, int64_t incx,
+         same<const T *> y, int64_t incy, same<T *> a, int64_t lda) {
+    const int64_t row_blocks = num_blocks(m);
+    for_each_chunk(n, [&](int64_t, int64_t col_begin, int64_t col_count) {
+        for (int64_t i = 0; i < row_blocks; i++) {
+            const int64_t row_begin = m * i / row_blocks;
+            const int64_t row_count = m * (i + 1) / row_blocks - row_begin;
+            f(mkl_int(row_count), mkl_int(col_count), alpha,
+              x + offset(row_begin, row_count, m, incx), mkl_int(incx),
+              y + offset(col_begin, col_count, n, incy), mkl_int(incy),
+              a + row_begin + col_begin * lda, mkl_int(lda));
+        }
+    });
+}
+
+// Level 3
+
+// The blocks of C run one after the other, each on all MKL threads, with the
+//  blocks of K accumulating in order, the first one scaled by beta.
+template <typename T>
+void gemm(void (*f)(const char *, const char *, const MKL_INT *, const MKL_INT *, const MKL_INT *,
+                    const T *, const T *, const MKL_INT *, const T *, const MKL_INT *, const T *,
+                    T *, const MKL_INT *),
+          const char *transa, const char *transb, int64_t m, int64_t n, int64_t k,
+          same<const T *> alpha, same<const T *> a, int64_t lda, same<const T *> b, int64_t ldb,
+          same<const T *> beta, same<T *> c, int64_t ldc) {
+    const int64_t m_blocks = num_blocks(m), n_blocks = num_blocks(n);
+    const int64_t k_blocks = std::max<int64_t>(1, num_blocks(k));
+    if (m_blocks * n_blocks * k_blocks == 1) {
+        f(transa, transb, mkl_int(m), mkl_int(n), mkl_int(k), alpha, a, mkl_int(lda), b,
+          mkl_int(ldb), beta, c, mkl_int(ldc));
+        return;
+    }
+    const bool nontrans_a = (*transa == 'N' || *transa == 'n');
+    const bool nontrans_b = (*transb == 'N' || *transb == 'n');
+    const T one = T(1);
+    for (int64_t jb = 0; jb < n_blocks; jb++) {
+        const int64_t j = n * jb / n_blocks, cols = n * (jb + 1) / n_blocks - j;
+        for (int64_t ib = 0; ib < m_blocks; ib++) {
+            const int64_t i = m * ib / m_blocks, rows = m * (ib + 1) / m_blocks - i;
+            for (int64_t lb = 0; lb < k_blocks; lb++) {
+                const int64_t l = k * lb / k_blocks, depth = k * (lb + 1) / k_blocks - l;
+                const T *a_block = nontrans_a ? a + i + l * lda : a + l + i * lda;
+                const T *b_block = nontrans_b ? b + l + j * ldb : b + j + l * ldb;
+                f(transa, transb, mkl_int(rows), mkl_int(cols), mkl_int(depth), alpha, a_block,
+                  mkl_int(lda), b_block, mkl_int(ldb), (lb == 0) ? beta : &one, c + i + j * ldc,
+                  mkl_int(ldc));
+            }
+        }
+    }
+}
+
+} // namespace blas64
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_BLAS64_HPP_
@@ -25,10 +25,23 @@
 
 #include <CL/sycl.hpp>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "mkl_blas.h"
 #include "mkl_cblas.h"
+#include "mkl_trans.h"
 
+#include "cpu_perf_counters.hpp"
+#include "cpu_queue_settings.hpp"
+#include "include/output_access_helper.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 #include "oneapi/mkl/types.hpp"
 
@@ -48,11 +61,185 @@ static inline void host_task_internal(H &cgh, F f, long) {
     cgh.template single_task<K>(f);
 }
 
+// Tasks submitted under a perf_call whose queue has counters on run counted,
+//  under a kernel name of their own.
+template <typename K>
+class mkl_kernel_counted;
+
 template <typename K, typename H, typename F>
 static inline void host_task(H &cgh, F f) {
+    if (const perf_call_info *call = perf_call::current()) {
+        const perf_call_info info = *call;
+        (void)host_task_internal<mkl_kernel_counted<K>>(
+            cgh, [=]() mutable { run_counted(info, f); }, 0);
+        return;
+    }
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// host_task_output submits the host_task of a routine writing the output
+//  operand c, passing it a pointer to c. The previous contents of c are
+//  discarded rather than copied in when the routine does not read them.
+template <typename K, cl::sycl::access::mode mode>
+class mkl_kernel_output;
+
+template <typename K, typename H, typename T, typename S, typename F>
+static inline void host_task_output(H &cgh, cl::sycl::buffer<T, 1> &c, S beta, int64_t rows,
+                                    int64_t cols, int64_t ld, F f) {
+    if (is_write_only(c, beta, rows, cols, ld)) {
+        auto accessor_c = c.template get_access<cl::sycl::access::mode::discard_write>(cgh);
+        host_task<mkl_kernel_output<K, cl::sycl::access::mode::discard_write>>(
+            cgh, [=]() { f(accessor_c.get_pointer()); });
+    }
+    else {
+        auto accessor_c = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<mkl_kernel_output<K, cl::sycl::access::mode::read_write>>(
+            cgh, [=]() { f(accessor_c.get_pointer()); });
+    }
+}
+
+// The element-offset overloads address an operand inside a larger buffer.
+//  check_offset throws unless the offset is non-negative and the span of
+//  elements the routine touches from there lies within the buffer. Spans
+//  are those of an n-element vector with increment inc, or of a column-major
+//  rows-by-cols matrix with leading dimension ld.
+static inline int64_t vector_span(int64_t n, int64_t inc) {
+    return n > 0 ? 1 + (n - 1) * (inc < 0 ? -inc : inc) : 0;
+}
+
+static inline int64_t matrix_span(int64_t rows, int64_t cols, int64_t ld) {
+    return (rows > 0 && cols > 0) ? ld * (cols - 1) + rows : 0;
+}
+
+template <typename T>
+static inline void check_offset(cl::sycl::buffer<T, 1> &buffer, int64_t offset, int64_t span,
+                                const char *name) {
+    const int64_t count = static_cast<int64_t>(buffer.get_count());
+    if (offset < 0 || span > count || offset > count - span)
+        throw oneapi::mkl::InvalidArgumentsException(
+            std::string("mklcpu: offset_") + name + " = " + std::to_string(offset) + " with " +
+            std::to_string(span) + " elements accessed does not fit buffer " + name + " of " +
+            std::to_string(count) + " elements");
+}
+
+// In-order queues run every submission after the previous one, so depending
+//  on the event of an earlier submission to the same queue is redundant. The
+//  last submission made on each thread is remembered, which lets the usual
+//  chain of calls, each passing on the event of the one before, skip the
+//  registration of that dependency. Only the hash of the queue is kept, so
+//  that the queue is not held alive, and the entry is dropped as soon as a
+//  submission is checked against another queue.
+struct submission {
+    std::size_t queue_id;
+    cl::sycl::event event;
+};
+
+inline std::unique_ptr<submission> &last_submission() {
+    thread_local std::unique_ptr<submission> last;
+    return last;
+}
+
+static inline std::size_t queue_id(const cl::sycl::queue &queue) {
+    return std::hash<cl::sycl::queue>()(queue);
+}
+
+static inline bool follows_last_submission(const cl::sycl::queue &queue,
+                                           const cl::sycl::event &event) {
+    auto &last = last_submission();
+    if (!last)
+        return false;
+    if (last->queue_id != queue_id(queue)) {
+        last.reset();
+        return false;
+    }
+    return last->event == event && queue.has_property<cl::sycl::property::queue::in_order>();
+}
+
+template <typename H>
+static inline void depends_on_events(H &cgh, const cl::sycl::queue &queue,
+                                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    for (auto &event : dependencies) {
+        if (!follows_last_submission(queue, event))
+            cgh.depends_on(event);
+    }
+}
+
+static inline cl::sycl::event record_submission(const cl::sycl::queue &queue,
+                                                const cl::sycl::event &done) {
+    auto &last = last_submission();
+    if (last) {
+        last->queue_id = queue_id(queue);
+        last->event = done;
+    }
+    else {
+        last.reset(new submission{ queue_id(queue), done });
+    }
+    return done;
+}
+
+// mkl_int passes a 64-bit size or increment to MKL by pointer. With the
+//  ILP64 interface it points at the value itself. With LP64 it points at a
+//  32-bit copy that lives until the end of the MKL call, and values that do
+//  not fit throw; the routines in cpu_blas64.hpp split their problems so that
+//  sizes always fit. mkl_int_array does the same for per-group arrays.
+#ifdef MKL_ILP64
+template <typename T>
+static inline const MKL_INT *mkl_int(const T &value) {
+    static_assert(std::is_same<T, int64_t>::value, "mkl_int expects a 64-bit integer");
+    return (const MKL_INT *)&value;
+}
+
+template <typename T>
+static inline const MKL_INT *mkl_int_array(const T *values, int64_t) {
+    static_assert(std::is_same<T, int64_t>::value, "mkl_int_array expects 64-bit integers");
+    return (const MKL_INT *)values;
+}
+#else
+static inline MKL_INT narrow_mkl_int(int64_t value) {
+    if (value > std::numeric_limits<MKL_INT>::max() || value < std::numeric_limits<MKL_INT>::min())
+        throw oneapi::mkl::InvalidArgumentsException(
+            "mklcpu: " + std::to_string(value) + " does not fit the LP64 MKL interface");
+    return MKL_INT(value);
+}
+
+class mkl_int_value {
+public:
+    explicit mkl_int_value(int64_t value) : value_(narrow_mkl_int(value)) {}
+    operator const MKL_INT *() const {
+        return &value_;
+    }
+
+private:
+    MKL_INT value_;
+};
+
+class mkl_int_vector {
+public:
+    mkl_int_vector(const int64_t *values, int64_t count) : values_(count) {
+        for (int64_t i = 0; i < count; i++)
+            values_[i] = narrow_mkl_int(values[i]);
+    }
+    operator const MKL_INT *() const {
+        return values_.data();
+    }
+
+private:
+    std::vector<MKL_INT> values_;
+};
+
+template <typename T>
+static inline mkl_int_value mkl_int(const T &value) {
+    static_assert(std::is_same<T, int64_t>::value, "mkl_int expects a 64-bit integer");
+    return mkl_int_value(value);
+}
+
+template <typename T>
+static inline mkl_int_vector mkl_int_array(const T *values, int64_t count) {
+    static_assert(std::is_same<T, int64_t>::value, "mkl_int_array expects 64-bit integers");
+    return mkl_int_vector(values, count);
+}
+#endif
+
 // Conversion functions to traditional Fortran characters.
 inline const char *fortran_char(transpose t) {
     if (t == transpose::nontrans)
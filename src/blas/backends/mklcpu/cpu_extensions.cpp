@@ -86,6 +86,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, int64_t lda,
           cl::sycl::buffer<half, 1> &b, int64_t ldb, half beta, cl::sycl::buffer<half, 1> &c,
           int64_t ldc) {
+    const perf_call call(queue, "hgemm", m, n, k);
     auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
     auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
     auto c_fp16 = c.reinterpret<fp16, 1>(c.get_range());
@@ -110,10 +111,9 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
             copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
             copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
             copy_mat(accessor_c, transpose::N, m, n, ldc, 0.0f, f32_c);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&f32_alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&f32_beta,
-                    f32_c, (const MKL_INT *)&ldc);
+            ::sgemm((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                    mkl_int(k), (const float *)&f32_alpha, f32_a, mkl_int(lda), f32_b, mkl_int(ldb),
+                    (const float *)&f32_beta, f32_c, mkl_int(ldc));
             // copy C back to half
             fp16 co = 0.0f;
             copy_mat(f32_c, m, n, ldc, offset::F, &co, accessor_c);
@@ -164,6 +164,7 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_
               int64_t k, float alpha, cl::sycl::buffer<half, 1> &a, int64_t lda,
               cl::sycl::buffer<half, 1> &b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
               int64_t ldc) {
+    const perf_call call(queue, "gemm_f16f16f32", m, n, k);
     auto a_fp16 = a.reinterpret<fp16, 1>(a.get_range());
     auto b_fp16 = b.reinterpret<fp16, 1>(b.get_range());
     queue.submit([&](cl::sycl::handler &cgh) {
@@ -171,23 +172,22 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, int64_
         const char transb_ = *fortran_char(transb);
         auto accessor_a = a_fp16.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b_fp16.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_gemm_f16f16f32>(cgh, [=]() {
-            int64_t sizea, sizeb;
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            // copy A and B to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, f32_a,
-                    (const MKL_INT *)&lda, f32_b, (const MKL_INT *)&ldb, (const float *)&beta,
-                    accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-            ::free(f32_a);
-            ::free(f32_b);
-        });
+        host_task_output<class mkl_kernel_gemm_f16f16f32>(
+            cgh, c, beta, m, n, ldc, [=](float *c_ptr) {
+                int64_t sizea, sizeb;
+                sizea = (transa == transpose::N) ? lda * k : lda * m;
+                sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
+                // copy A and B to float
+                float *f32_a = (float *)::malloc(sizeof(float) * sizea);
+                float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
+                copy_mat(accessor_a, transa, m, k, lda, 0.0f, f32_a);
+                copy_mat(accessor_b, transb, k, n, ldb, 0.0f, f32_b);
+                ::sgemm((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                        mkl_int(k), (const float *)&alpha, f32_a, mkl_int(lda), f32_b, mkl_int(ldb),
+                        (const float *)&beta, c_ptr, mkl_int(ldc));
+                ::free(f32_a);
+                ::free(f32_b);
+            });
     });
 }
 
@@ -195,28 +195,28 @@ void gemm_ext(cl::sycl::queue &queue, transpose transa, transpose transb, offset
               int64_t n, int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a, int64_t lda,
               int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo, float beta,
               cl::sycl::buffer<int32_t, 1> &c, int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    const perf_call call(queue, "gemm_s8u8s32", m, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         const char offsetc_ = *fortran_char(offsetc);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_co = co.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_gemm_s8u8s32>(cgh, [=]() {
-            MKL_INT8 *a_mat =
-                static_cast<MKL_INT8 *>(static_cast<void *>(accessor_a.get_pointer()));
-            MKL_UINT8 *b_mat =
-                static_cast<MKL_UINT8 *>(static_cast<void *>(accessor_b.get_pointer()));
-            MKL_INT8 bo_internal = -bo;
-            MKL_INT8 ao_internal = -ao;
-            ::gemm_s8u8s32((const char *)&transa_, (const char *)&transb_, (const char *)&offsetc_,
-                           (const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                           (const float *)&alpha, a_mat, (const MKL_INT *)&lda, &ao_internal, b_mat,
-                           (const MKL_INT *)&ldb, &bo_internal, (const float *)&beta,
-                           (MKL_INT32 *)accessor_c.get_pointer(), (const MKL_INT *)&ldc,
-                           (const MKL_INT32 *)accessor_co.get_pointer());
-        });
+        host_task_output<class mkl_kernel_gemm_s8u8s32>(
+            cgh, c, beta, m, n, ldc, [=](int32_t *c_ptr) {
+                MKL_INT8 *a_mat =
+                    static_cast<MKL_INT8 *>(static_cast<void *>(accessor_a.get_pointer()));
+                MKL_UINT8 *b_mat =
+                    static_cast<MKL_UINT8 *>(static_cast<void *>(accessor_b.get_pointer()));
+                MKL_INT8 bo_internal = -bo;
+                MKL_INT8 ao_internal = -ao;
+                ::gemm_s8u8s32((const char *)&transa_, (const char *)&transb_,
+                               (const char *)&offsetc_, mkl_int(m), mkl_int(n), mkl_int(k),
+                               (const float *)&alpha, a_mat, mkl_int(lda), &ao_internal, b_mat,
+                               mkl_int(ldb), &bo_internal, (const float *)&beta, (MKL_INT32 *)c_ptr,
+                               mkl_int(ldc), (const MKL_INT32 *)accessor_co.get_pointer());
+            });
     });
 }
 
@@ -224,6 +224,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
            int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
            cl::sycl::buffer<float, 1> &b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
            int64_t ldc) {
+    const perf_call call(queue, "sgemmt", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -233,10 +234,9 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sgemmt>(cgh, [=]() {
             ::sgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha,
-                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                     (const MKL_INT *)&ldb, (const float *)&beta, accessor_c.get_pointer(),
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const float *)&alpha, accessor_a.get_pointer(),
+                     mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb), (const float *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -245,6 +245,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
            int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
            cl::sycl::buffer<double, 1> &b, int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
            int64_t ldc) {
+    const perf_call call(queue, "dgemmt", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -254,10 +255,9 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dgemmt>(cgh, [=]() {
             ::dgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha,
-                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                     (const MKL_INT *)&ldb, (const double *)&beta, accessor_c.get_pointer(),
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const double *)&alpha, accessor_a.get_pointer(),
+                     mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb), (const double *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -266,6 +266,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
            int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
            int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
            std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cgemmt", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -279,10 +280,9 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_,
-                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                     (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(),
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const MKL_Complex8 *)&alpha_,
+                     accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                     (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -291,6 +291,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
            int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
            int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zgemmt", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -304,10 +305,255 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::zgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_,
-                     accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                     (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(),
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const MKL_Complex16 *)&alpha_,
+                     accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                     (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(), mkl_int(ldc));
+        });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+            std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cgemm3m", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_cgemm3m>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<float> *c_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::cgemm3m((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                          mkl_int(k), (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
+                          mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                          (const MKL_Complex8 *)&beta_, c_ptr, mkl_int(ldc));
+            });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zgemm3m", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_zgemm3m>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<double> *c_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zgemm3m((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                          mkl_int(k), (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
+                          mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                          (const MKL_Complex16 *)&beta_, c_ptr, mkl_int(ldc));
+            });
+    });
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
+              int64_t ldb) {
+    const perf_call call(queue, "somatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_somatcopy>(cgh, [=]() {
+            ::mkl_somatcopy('C', trans_, m, n, alpha, accessor_a.get_pointer(), lda,
+                            accessor_b.get_pointer(), ldb);
+        });
+    });
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
+              int64_t ldb) {
+    const perf_call call(queue, "domatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_domatcopy>(cgh, [=]() {
+            ::mkl_domatcopy('C', trans_, m, n, alpha, accessor_a.get_pointer(), lda,
+                            accessor_b.get_pointer(), ldb);
+        });
+    });
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "comatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_comatcopy>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_comatcopy('C', trans_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                            accessor_b.get_pointer(), ldb);
+        });
+    });
+}
+
+void omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "zomatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_zomatcopy>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zomatcopy('C', trans_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                            accessor_b.get_pointer(), ldb);
+        });
+    });
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb) {
+    const perf_call call(queue, "simatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_simatcopy>(cgh, [=]() {
+            ::mkl_simatcopy('C', trans_, m, n, alpha, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb) {
+    const perf_call call(queue, "dimatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dimatcopy>(cgh, [=]() {
+            ::mkl_dimatcopy('C', trans_, m, n, alpha, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab, int64_t lda,
+              int64_t ldb) {
+    const perf_call call(queue, "cimatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cimatcopy>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_cimatcopy('C', trans_, m, n, alpha_, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
+}
+
+void imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              int64_t lda, int64_t ldb) {
+    const perf_call call(queue, "zimatcopy", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_ab = ab.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zimatcopy>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zimatcopy('C', trans_, m, n, alpha_, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, float beta,
+             cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &c,
+             int64_t ldc) {
+    const perf_call call(queue, "somatadd", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_somatadd>(cgh, [=]() {
+            ::mkl_somatadd('C', transa_, transb_, m, n, alpha, accessor_a.get_pointer(), lda, beta,
+                           accessor_b.get_pointer(), ldb, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, double beta,
+             cl::sycl::buffer<double, 1> &b, int64_t ldb, cl::sycl::buffer<double, 1> &c,
+             int64_t ldc) {
+    const perf_call call(queue, "domatadd", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_domatadd>(cgh, [=]() {
+            ::mkl_domatadd('C', transa_, transb_, m, n, alpha, accessor_a.get_pointer(), lda, beta,
+                           accessor_b.get_pointer(), ldb, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "comatadd", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_comatadd>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::mkl_comatadd('C', transa_, transb_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                           beta_, accessor_b.get_pointer(), ldb, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+             std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+             cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zomatadd", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_zomatadd>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::mkl_zomatadd('C', transa_, transb_, m, n, alpha_, accessor_a.get_pointer(), lda,
+                           beta_, accessor_b.get_pointer(), ldb, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -318,44 +564,38 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemmt_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         host_task<class mkl_kernel_sgemmt_usm>(cgh, [=]() {
             ::sgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, a,
-                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const float *)&beta, c,
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const float *)&alpha, a, mkl_int(lda), b,
+                     mkl_int(ldb), (const float *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
                       int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                       const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemmt_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         host_task<class mkl_kernel_dgemmt_usm>(cgh, [=]() {
             ::dgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha, a,
-                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const double *)&beta, c,
-                     (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const double *)&alpha, a, mkl_int(lda), b,
+                     mkl_int(ldb), (const double *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
@@ -363,11 +603,9 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
                       int64_t lda, const std::complex<float> *b, int64_t ldb,
                       std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemmt_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
@@ -377,12 +615,11 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a,
-                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_,
-                     c, (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b,
+                     mkl_int(ldb), (const MKL_Complex8 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
@@ -390,11 +627,9 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                       int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemmt_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
@@ -404,12 +639,253 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::zgemmt((const char *)&upper_lower_, (const char *)&transa_, (const char *)&transb_,
-                     (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a,
-                     (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_,
-                     c, (const MKL_INT *)&ldc);
+                     mkl_int(n), mkl_int(k), (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b,
+                     mkl_int(ldb), (const MKL_Complex16 *)&beta_, c, mkl_int(ldc));
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm3m_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_cgemm3m_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::cgemm3m((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                      mkl_int(k), (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                      (const MKL_Complex8 *)&beta_, c, mkl_int(ldc));
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm3m_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_zgemm3m_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::zgemm3m((const char *)&transa_, (const char *)&transb_, mkl_int(m), mkl_int(n),
+                      mkl_int(k), (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                      (const MKL_Complex16 *)&beta_, c, mkl_int(ldc));
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                         const float *a, int64_t lda, float *b, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "somatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_somatcopy_usm>(cgh, [=]() {
+            ::mkl_somatcopy('C', trans_, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         double alpha, const double *a, int64_t lda, double *b, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "domatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_domatcopy_usm>(cgh, [=]() {
+            ::mkl_domatcopy('C', trans_, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                         std::complex<float> *b, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "comatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_comatcopy_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_comatcopy('C', trans_, m, n, alpha_, a, lda, b, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                         std::complex<double> *b, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zomatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_zomatcopy_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zomatcopy('C', trans_, m, n, alpha_, a, lda, b, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+                         float *ab, int64_t lda, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "simatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_simatcopy_usm>(cgh, [=]() {
+            ::mkl_simatcopy('C', trans_, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         double alpha, double *ab, int64_t lda, int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dimatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_dimatcopy_usm>(cgh, [=]() {
+            ::mkl_dimatcopy('C', trans_, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         std::complex<float> alpha, std::complex<float> *ab, int64_t lda,
+                         int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cimatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_cimatcopy_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_cimatcopy('C', trans_, m, n, alpha_, ab, lda, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                         std::complex<double> alpha, std::complex<double> *ab, int64_t lda,
+                         int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zimatcopy_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        host_task<class mkl_kernel_zimatcopy_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::mkl_zimatcopy('C', trans_, m, n, alpha_, ab, lda, ldb);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                        int64_t n, float alpha, const float *a, int64_t lda, float beta,
+                        const float *b, int64_t ldb, float *c, int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "somatadd_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_somatadd_usm>(cgh, [=]() {
+            ::mkl_somatadd('C', transa_, transb_, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                        int64_t n, double alpha, const double *a, int64_t lda, double beta,
+                        const double *b, int64_t ldb, double *c, int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "domatadd_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_domatadd_usm>(cgh, [=]() {
+            ::mkl_domatadd('C', transa_, transb_, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                        int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                        int64_t lda, std::complex<float> beta, const std::complex<float> *b,
+                        int64_t ldb, std::complex<float> *c, int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "comatadd_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_comatadd_usm>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::mkl_comatadd('C', transa_, transb_, m, n, alpha_, a, lda, beta_, b, ldb, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                        int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                        int64_t lda, std::complex<double> beta, const std::complex<double> *b,
+                        int64_t ldb, std::complex<double> *c, int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zomatadd_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_zomatadd_usm>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::mkl_zomatadd('C', transa_, transb_, m, n, alpha_, a, lda, beta_, b, ldb, c, ldc);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 } // namespace mklcpu
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <vector>
+
+#include "cpu_blas64.hpp"
+#include "cpu_common.hpp"
+#include "cpu_reproducible.hpp"
+#include "cpu_split_k.hpp"
+#include "cpu_strassen.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+using oneapi::mkl::blas::graph;
+using oneapi::mkl::blas::graph_routine;
+
+// Precision-specific routines used while replaying a graph. They go through
+//  the same helpers as the corresponding entry points.
+
+static inline void graph_axpy(int64_t n, const float *alpha, const float *x, int64_t incx,
+                              float *y, int64_t incy) {
+    blas64::axpy(::saxpy, n, alpha, x, incx, y, incy);
+}
+
+static inline void graph_axpy(int64_t n, const double *alpha, const double *x, int64_t incx,
+                              double *y, int64_t incy) {
+    blas64::axpy(::daxpy, n, alpha, x, incx, y, incy);
+}
+
+static inline void graph_scal(int64_t n, const float *alpha, float *x, int64_t incx) {
+    blas64::scal(::sscal, n, alpha, x, incx);
+}
+
+static inline void graph_scal(int64_t n, const double *alpha, double *x, int64_t incx) {
+    blas64::scal(::dscal, n, alpha, x, incx);
+}
+
+static inline void graph_copy(int64_t n, const float *x, int64_t incx, float *y, int64_t incy) {
+    blas64::copy(::scopy, n, x, incx, y, incy);
+}
+
+static inline void graph_copy(int64_t n, const double *x, int64_t incx, double *y,
+                              int64_t incy) {
+    blas64::copy(::dcopy, n, x, incx, y, incy);
+}
+
+static inline float graph_dot(reproducibility mode, int64_t n, const float *x, int64_t incx,
+                              const float *y, int64_t incy) {
+    return cnr::dot(mode, ::sdot, n, x, incx, y, incy);
+}
+
+static inline double graph_dot(reproducibility mode, int64_t n, const double *x, int64_t incx,
+                               const double *y, int64_t incy) {
+    return cnr::dot(mode, ::ddot, n, x, incx, y, incy);
+}
+
+static inline void graph_gemv(char trans, int64_t m, int64_t n, const float *alpha,
+                              const float *a, int64_t lda, const float *x, int64_t incx,
+                              const float *beta, float *y, int64_t incy) {
+    blas64::gemv(::sgemv, &trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void graph_gemv(char trans, int64_t m, int64_t n, const double *alpha,
+                              const double *a, int64_t lda, const double *x, int64_t incx,
+                              const double *beta, double *y, int64_t incy) {
+    blas64::gemv(::dgemv, &trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void graph_gemm(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                              const float *alpha, const float *a, int64_t lda, const float *b,
+                              int64_t ldb, const float *beta, float *c, int64_t ldc) {
+    blas64::gemm(::sgemm, &transa, &transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void graph_gemm(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                              const double *alpha, const double *a, int64_t lda, const double *b,
+                              int64_t ldb, const double *beta, double *c, int64_t ldc) {
+    blas64::gemm(::dgemm, &transa, &transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline const char *graph_routine_name(float, graph_routine routine) {
+    static const char *const names[] = { "saxpy", "sscal", "scopy", "sdot", "sgemv", "sgemm" };
+    return names[static_cast<int>(routine)];
+}
+
+static inline const char *graph_routine_name(double, graph_routine routine) {
+    static const char *const names[] = { "daxpy", "dscal", "dcopy", "ddot", "dgemv", "dgemm" };
+    return names[static_cast<int>(routine)];
+}
+
+// gemm nodes take the path of gemm: the Strassen-Winograd hint of the queue,
+//  then split-K, then MKL on the tuned number of threads.
+template <typename T>
+static void graph_gemm_node(const queue_settings &settings, char transa, char transb, int64_t m,
+                            int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                            int64_t ldb, T beta, T *c, int64_t ldc) {
+    const int64_t cutoff = strassen_cutoff(settings, m, n, k);
+    if (cutoff >= 0) {
+        run_strassen(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, cutoff);
+        return;
+    }
+    if (split_k_gemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc))
+        return;
+    const local_threads threads(tuned_gemm_threads(m, n, k));
+    graph_gemm(transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+template <typename T>
+static void run_node(const typename graph<T>::node &node, const queue_settings &settings, T *a,
+                     T *b, T *c, T alpha, T beta) {
+    const char transa_ = *fortran_char(node.transa);
+    const char transb_ = *fortran_char(node.transb);
+
+    switch (node.routine) {
+        case graph_routine::axpy:
+            graph_axpy(node.n, &alpha, a, node.lda, b, node.ldb);
+            break;
+        case graph_routine::scal:
+            graph_scal(node.n, &alpha, a, node.lda);
+            break;
+        case graph_routine::copy:
+            graph_copy(node.n, a, node.lda, b, node.ldb);
+            break;
+        case graph_routine::dot:
+            c[0] = graph_dot(settings.reproducibility_mode, node.n, a, node.lda, b, node.ldb);
+            break;
+        case graph_routine::gemv:
+            graph_gemv(transa_, node.m, node.n, &alpha, a, node.lda, b, node.ldb, &beta, c,
+                       node.ldc);
+            break;
+        case graph_routine::gemm:
+            graph_gemm_node(settings, transa_, transb_, node.m, node.n, node.k, alpha, a, node.lda,
+                            b, node.ldb, beta, c, node.ldc);
+            break;
+    }
+}
+
+// Runs the recorded calls back-to-back. Buffer operands are looked up in
+//  buffer_ptrs, which holds the host pointers of the graph's buffers. When
+//  call is set, each node is counted as a call of its own routine.
+template <typename T>
+static void run_nodes(const std::vector<typename graph<T>::node> &nodes,
+                      const std::vector<T> &scalars, T *const *buffer_ptrs,
+                      const queue_settings &settings, const perf_call_info *call) {
+    for (auto &node : nodes) {
+        T *a = (node.buffer_a >= 0) ? buffer_ptrs[node.buffer_a] : node.a;
+        T *b = (node.buffer_b >= 0) ? buffer_ptrs[node.buffer_b] : node.b;
+        T *c = (node.buffer_c >= 0) ? buffer_ptrs[node.buffer_c] : node.c;
+        const T alpha = (node.alpha >= 0) ? scalars[node.alpha] : T(0);
+        const T beta = (node.beta >= 0) ? scalars[node.beta] : T(0);
+        auto run = [&]() { run_node<T>(node, settings, a, b, c, alpha, beta); };
+        if (!call) {
+            run();
+            continue;
+        }
+        perf_call_info node_call = *call;
+        node_call.routine = graph_routine_name(T(), node.routine);
+        node_call.shape = { node.m, node.n, node.k, 0 };
+        run_counted(node_call, run);
+    }
+}
+
+template <typename T>
+class mkl_kernel_graph_replay;
+
+// The whole graph is submitted as a single host_task, so the calls pay for one
+//  submission and one round of dependency tracking instead of one per call.
+//  Scalar values and the settings of the queue are captured when replay is
+//  called. The task is submitted with host_task_internal, as its nodes are
+//  counted one by one rather than as a whole.
+template <typename T>
+static cl::sycl::event replay_graph(cl::sycl::queue &queue, const graph<T> &g,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    using accessor_t = cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                                          cl::sycl::access::target::global_buffer>;
+    const queue_settings settings = get_queue_settings(queue);
+    const perf_call_info *current = perf_call::current();
+    const bool counted = (current != nullptr);
+    const perf_call_info call = counted ? *current : perf_call_info();
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        std::vector<accessor_t> accessors;
+        for (auto &buf : g.buffers())
+            accessors.push_back(buf->template get_access<cl::sycl::access::mode::read_write>(cgh));
+        auto nodes = g.nodes();
+        auto scalars = g.scalars();
+        (void)host_task_internal<mkl_kernel_graph_replay<T>>(
+            cgh,
+            [=]() {
+                std::vector<T *> buffer_ptrs;
+                for (auto &accessor : accessors)
+                    buffer_ptrs.push_back(accessor.get_pointer());
+                run_nodes<T>(nodes, scalars, buffer_ptrs.data(), settings,
+                             counted ? &call : nullptr);
+            },
+            0);
+    });
+    return record_submission(queue, done);
+}
+
+// Graph APIs
+
+cl::sycl::event replay(cl::sycl::queue &queue, const graph<float> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgraph_replay", 0, 0, 0);
+    return replay_graph(queue, g, dependencies);
+}
+
+cl::sycl::event replay(cl::sycl::queue &queue, const graph<double> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgraph_replay", 0, 0, 0);
+    return replay_graph(queue, g, dependencies);
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
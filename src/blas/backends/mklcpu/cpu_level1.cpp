@@ -19,7 +19,9 @@
 
 #include <CL/sycl.hpp>
 
+#include "cpu_blas64.hpp"
 #include "cpu_common.hpp"
+#include "cpu_reproducible.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace oneapi {
@@ -30,72 +32,78 @@ namespace mklcpu {
 
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "sasum", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_sasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::sasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::asum(mode, ::sasum, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "dasum", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_dasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::dasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::asum(mode, ::dasum, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "scasum", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_scasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::scasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::asum(mode, ::scasum, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "dzasum", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_dzasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::dzasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::asum(mode, ::dzasum, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "saxpy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_saxpy>(cgh, [=]() {
-            ::saxpy((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::axpy(::saxpy, n, (const float *)&alpha, accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
         });
     });
 }
 
 void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
           int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "daxpy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_daxpy>(cgh, [=]() {
-            ::daxpy((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::axpy(::daxpy, n, (const double *)&alpha, accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -103,14 +111,15 @@ void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
 void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "caxpy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_caxpy>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::caxpy((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::axpy(::caxpy, n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -118,104 +127,242 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
 void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zaxpy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zaxpy>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zaxpy((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::axpy(::zaxpy, n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &y,
+          int64_t incy) {
+    const perf_call call(queue, "saxpy_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_saxpy_device_scalar>(cgh, [=]() {
+            blas64::axpy(::saxpy, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &y,
+          int64_t incy) {
+    const perf_call call(queue, "daxpy_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_daxpy_device_scalar>(cgh, [=]() {
+            blas64::axpy(::daxpy, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "caxpy_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_caxpy_device_scalar>(cgh, [=]() {
+            blas64::axpy(::caxpy, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zaxpy_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zaxpy_device_scalar>(cgh, [=]() {
+            blas64::axpy(::zaxpy, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx,
+                         accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          int64_t offset_x, int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    check_offset(x, offset_x, vector_span(n, incx), "x");
+    check_offset(y, offset_y, vector_span(n, incy), "y");
+    const perf_call call(queue, "saxpy_offset", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_saxpy_offset>(cgh, [=]() {
+            blas64::axpy(::saxpy, n, (const float *)&alpha, accessor_x.get_pointer() + offset_x,
+                         incx, accessor_y.get_pointer() + offset_y, incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          int64_t offset_x, int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    check_offset(x, offset_x, vector_span(n, incx), "x");
+    check_offset(y, offset_y, vector_span(n, incy), "y");
+    const perf_call call(queue, "daxpy_offset", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_daxpy_offset>(cgh, [=]() {
+            blas64::axpy(::daxpy, n, (const double *)&alpha, accessor_x.get_pointer() + offset_x,
+                         incx, accessor_y.get_pointer() + offset_y, incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t offset_x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t offset_y, int64_t incy) {
+    check_offset(x, offset_x, vector_span(n, incx), "x");
+    check_offset(y, offset_y, vector_span(n, incy), "y");
+    const perf_call call(queue, "caxpy_offset", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_caxpy_offset>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            blas64::axpy(::caxpy, n, (const MKL_Complex8 *)&alpha_,
+                         accessor_x.get_pointer() + offset_x, incx,
+                         accessor_y.get_pointer() + offset_y, incy);
+        });
+    });
+}
+
+void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t offset_x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t offset_y, int64_t incy) {
+    check_offset(x, offset_x, vector_span(n, incx), "x");
+    check_offset(y, offset_y, vector_span(n, incy), "y");
+    const perf_call call(queue, "zaxpy_offset", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zaxpy_offset>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            blas64::axpy(::zaxpy, n, (const MKL_Complex16 *)&alpha_,
+                         accessor_x.get_pointer() + offset_x, incx,
+                         accessor_y.get_pointer() + offset_y, incy);
         });
     });
 }
 
 void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "scopy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_scopy>(cgh, [=]() {
-            ::scopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::copy(::scopy, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dcopy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dcopy>(cgh, [=]() {
-            ::dcopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::copy(::dcopy, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "ccopy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ccopy>(cgh, [=]() {
-            ::ccopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::copy(::ccopy, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zcopy", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zcopy>(cgh, [=]() {
-            ::zcopy((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::copy(::zcopy, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
          cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "sdot", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_sdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::sdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                       accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            accessor_result[0] = cnr::dot(mode, ::sdot, n, accessor_x.get_pointer(), incx,
+                                          accessor_y.get_pointer(), incy);
         });
     });
 }
 
 void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
          cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "ddot", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_ddot>(cgh, [=]() {
-            accessor_result[0] =
-                ::ddot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                       accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            accessor_result[0] = cnr::dot(mode, ::ddot, n, accessor_x.get_pointer(), incx,
+                                          accessor_y.get_pointer(), incy);
         });
     });
 }
 
 void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
          cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "dsdot", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_dsdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::dsdot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                        accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            accessor_result[0] = cnr::dot(mode, ::dsdot, n, accessor_x.get_pointer(), incx,
+                                          accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -223,13 +370,14 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
 void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
+    const perf_call call(queue, "cdotc", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cdotc>(cgh, [=]() {
-            ::cdotc(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::dot(::cdotc, accessor_result.get_pointer(), n, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -237,13 +385,14 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
 void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
+    const perf_call call(queue, "zdotc", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zdotc>(cgh, [=]() {
-            ::zdotc(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::dot(::zdotc, accessor_result.get_pointer(), n, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -251,13 +400,14 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
 void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
+    const perf_call call(queue, "cdotu", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cdotu>(cgh, [=]() {
-            ::cdotu(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::dot(::cdotu, accessor_result.get_pointer(), n, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy);
         });
     });
 }
@@ -265,181 +415,196 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
 void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
+    const perf_call call(queue, "zdotu", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zdotu>(cgh, [=]() {
-            ::zdotu(accessor_result.get_pointer(), (const MKL_INT *)&n, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::dot(::zdotu, accessor_result.get_pointer(), n, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy);
         });
     });
 }
 
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "isamin", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_isamin>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_isamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_isamin, n, accessor_x.get_pointer().get(),
+                                               incx, false);
         });
     });
 }
 
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "idamin", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_idamin>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_idamin((const MKL_INT)n, accessor_x.get_pointer(), (const MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_idamin, n, accessor_x.get_pointer().get(),
+                                               incx, false);
         });
     });
 }
 
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "icamin", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_icamin>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_icamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_icamin, n, accessor_x.get_pointer().get(),
+                                               incx, false);
         });
     });
 }
 
 void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "izamin", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_izamin>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_izamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_izamin, n, accessor_x.get_pointer().get(),
+                                               incx, false);
         });
     });
 }
 
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "isamax", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_isamax>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_isamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_isamax, n, accessor_x.get_pointer().get(),
+                                               incx, true);
         });
     });
 }
 
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
            cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "idamax", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_idamax>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_idamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_idamax, n, accessor_x.get_pointer().get(),
+                                               incx, true);
         });
     });
 }
 
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "icamax", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_icamax>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_icamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_icamax, n, accessor_x.get_pointer().get(),
+                                               incx, true);
         });
     });
 }
 
 void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
            int64_t incx, cl::sycl::buffer<int64_t, 1> &result) {
+    const perf_call call(queue, "izamax", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_izamax>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_izamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
+            accessor_result[0] = blas64::iamax(::cblas_izamax, n, accessor_x.get_pointer().get(),
+                                               incx, true);
         });
     });
 }
 
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "snrm2", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_snrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::snrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::nrm2(mode, ::snrm2, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "dnrm2", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_dnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::dnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::nrm2(mode, ::dnrm2, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "scnrm2", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_scnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::scnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::nrm2(mode, ::scnrm2, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<double, 1> &result) {
+    const perf_call call(queue, "dznrm2", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_dznrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::dznrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+            accessor_result[0] = cnr::nrm2(mode, ::dznrm2, n, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
          cl::sycl::buffer<float, 1> &y, int64_t incy, float c, float s) {
+    const perf_call call(queue, "srot", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_srot>(cgh, [=]() {
-            ::srot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                   accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
+            blas64::rot(::srot, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                        &c, &s);
         });
     });
 }
 
 void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
          cl::sycl::buffer<double, 1> &y, int64_t incy, double c, double s) {
+    const perf_call call(queue, "drot", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_drot>(cgh, [=]() {
-            ::drot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                   accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
+            blas64::rot(::drot, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                        &c, &s);
         });
     });
 }
@@ -447,12 +612,13 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
 void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
          int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, float c,
          float s) {
+    const perf_call call(queue, "csrot", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_csrot>(cgh, [=]() {
-            ::csrot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
+            blas64::rot(::csrot, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                        &c, &s);
         });
     });
 }
@@ -460,18 +626,20 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>
 void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
          int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, double c,
          double s) {
+    const perf_call call(queue, "zdrot", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zdrot>(cgh, [=]() {
-            ::zdrot((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy, &c, &s);
+            blas64::rot(::zdrot, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                        &c, &s);
         });
     });
 }
 
 void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &b,
           cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<float, 1> &s) {
+    const perf_call call(queue, "srotg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -486,6 +654,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a, cl::sycl::buffe
 
 void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &b,
           cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<double, 1> &s) {
+    const perf_call call(queue, "drotg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -501,6 +670,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a, cl::sycl::buff
 void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<float, 1> &c,
           cl::sycl::buffer<std::complex<float>, 1> &s) {
+    const perf_call call(queue, "crotg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -516,6 +686,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<float>, 1> &a,
 void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<std::complex<double>, 1> &s) {
+    const perf_call call(queue, "zrotg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
@@ -530,32 +701,35 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
 
 void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &param) {
+    const perf_call call(queue, "srotm", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
         host_task<class mkl_kernel_srotm>(cgh, [=]() {
-            ::srotm((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy, accessor_param.get_pointer());
+            blas64::rotm(::srotm, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                         accessor_param.get_pointer());
         });
     });
 }
 
 void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &param) {
+    const perf_call call(queue, "drotm", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
         host_task<class mkl_kernel_drotm>(cgh, [=]() {
-            ::drotm((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy, accessor_param.get_pointer());
+            blas64::rotm(::drotm, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                         accessor_param.get_pointer());
         });
     });
 }
 
 void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1, cl::sycl::buffer<float, 1> &d2,
            cl::sycl::buffer<float, 1> &x1, float y1, cl::sycl::buffer<float, 1> &param) {
+    const perf_call call(queue, "srotmg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_d1 = d1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_d2 = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -570,6 +744,7 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1, cl::sycl::buf
 
 void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1, cl::sycl::buffer<double, 1> &d2,
            cl::sycl::buffer<double, 1> &x1, double y1, cl::sycl::buffer<double, 1> &param) {
+    const perf_call call(queue, "drotmg", 0, 0, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_d1 = d1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_d2 = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
@@ -584,70 +759,143 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1, cl::sycl::bu
 
 void scal(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "sscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sscal>(cgh, [=]() {
-            ::sscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+            blas64::scal(::sscal, n, (const float *)&alpha, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void scal(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "dscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dscal>(cgh, [=]() {
-            ::dscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+            blas64::scal(::dscal, n, (const double *)&alpha, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "cscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cscal>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+            blas64::scal(::cscal, n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void scal(cl::sycl::queue &queue, int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "csscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_csscal>(cgh, [=]() {
-            ::csscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
-                     (const MKL_INT *)&incx);
+            blas64::scal(::csscal, n, (const float *)&alpha, accessor_x.get_pointer(), incx);
         });
     });
 }
 
 void scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "zscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zscal>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+            blas64::scal(::zscal, n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
+                         incx);
         });
     });
 }
 
 void scal(cl::sycl::queue &queue, int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "zdscal", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zdscal>(cgh, [=]() {
-            ::zdscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
-                     (const MKL_INT *)&incx);
+            blas64::scal(::zdscal, n, (const double *)&alpha, accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, int64_t incx) {
+    const perf_call call(queue, "sscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::sscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, int64_t incx) {
+    const perf_call call(queue, "dscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::dscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "cscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::cscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "csscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_csscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::csscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "zscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::zscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
+        });
+    });
+}
+
+void scal(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "zdscal_device_scalar", 0, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zdscal_device_scalar>(cgh, [=]() {
+            blas64::scal(::zdscal, n, accessor_alpha.get_pointer(), accessor_x.get_pointer(), incx);
         });
     });
 }
@@ -655,62 +903,68 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha,
 void sdsdot(cl::sycl::queue &queue, int64_t n, float sb, cl::sycl::buffer<float, 1> &x,
             int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy,
             cl::sycl::buffer<float, 1> &result) {
+    const perf_call call(queue, "sdsdot", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class mkl_kernel_sdsdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::sdsdot((const MKL_INT *)&n, (const float *)&sb, accessor_x.get_pointer(),
-                         (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            accessor_result[0] = cnr::sdsdot(mode, ::sdsdot, n, (const float *)&sb,
+                                             accessor_x.get_pointer(), incx,
+                                             accessor_y.get_pointer(), incy);
         });
     });
 }
 
 void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
           cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "sswap", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sswap>(cgh, [=]() {
-            ::sswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::swap(::sswap, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
           cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dswap", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dswap>(cgh, [=]() {
-            ::dswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::swap(::dswap, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "cswap", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cswap>(cgh, [=]() {
-            ::cswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::swap(::cswap, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
 
 void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zswap", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zswap>(cgh, [=]() {
-            ::zswap((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::swap(::zswap, n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(),
+                         incy);
         });
     });
 }
@@ -719,792 +973,812 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sasum_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sasum_usm>(
-            cgh, [=]() { result[0] = ::sasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::asum(mode, ::sasum, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dasum_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dasum_usm>(
-            cgh, [=]() { result[0] = ::dasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::asum(mode, ::dasum, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "scasum_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_scasum_usm>(
-            cgh, [=]() { result[0] = ::scasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::asum(mode, ::scasum, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dzasum_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dzasum_usm>(
-            cgh, [=]() { result[0] = ::dzasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::asum(mode, ::dzasum, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "saxpy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_saxpy_usm>(cgh, [=]() {
-            ::saxpy((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::axpy(::saxpy, n, (const float *)&alpha, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "daxpy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_daxpy_usm>(cgh, [=]() {
-            ::daxpy((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::axpy(::daxpy, n, (const double *)&alpha, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, std::complex<float> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "caxpy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_caxpy_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::caxpy((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx,
-                    y, (const MKL_INT *)&incy);
+            blas64::axpy(::caxpy, n, (const MKL_Complex8 *)&alpha_, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, std::complex<double> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zaxpy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zaxpy_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zaxpy((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx,
-                    y, (const MKL_INT *)&incy);
+            blas64::axpy(::zaxpy, n, (const MKL_Complex16 *)&alpha_, x, incx, y, incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const float *alpha, const float *x,
+                     int64_t incx, float *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "saxpy_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_saxpy_device_scalar_usm>(cgh, [=]() {
+            blas64::axpy(::saxpy, n, alpha, x, incx, y, incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const double *alpha, const double *x,
+                     int64_t incx, double *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "daxpy_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_daxpy_device_scalar_usm>(cgh, [=]() {
+            blas64::axpy(::daxpy, n, alpha, x, incx, y, incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, int64_t incx, std::complex<float> *y,
+                     int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "caxpy_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_caxpy_device_scalar_usm>(cgh, [=]() {
+            blas64::axpy(::caxpy, n, alpha, x, incx, y, incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, int64_t incx, std::complex<double> *y,
+                     int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zaxpy_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_zaxpy_device_scalar_usm>(cgh, [=]() {
+            blas64::axpy(::zaxpy, n, alpha, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "scopy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_scopy_usm>(cgh, [=]() {
-            ::scopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::copy(::scopy, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dcopy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dcopy_usm>(cgh, [=]() {
-            ::dcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::copy(::dcopy, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ccopy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_ccopy_usm>(cgh, [=]() {
-            ::ccopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::copy(::ccopy, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zcopy_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zcopy_usm>(cgh, [=]() {
-            ::zcopy((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::copy(::zcopy, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, float *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sdot_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sdot_usm>(cgh, [=]() {
-            result[0] =
-                ::sdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            result[0] = cnr::dot(mode, ::sdot, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                     const double *y, int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ddot_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_ddot_usm>(cgh, [=]() {
-            result[0] =
-                ::ddot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            result[0] = cnr::dot(mode, ::ddot, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsdot_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dsdot_usm>(cgh, [=]() {
-            result[0] =
-                ::dsdot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            result[0] = cnr::dot(mode, ::dsdot, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cdotc_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_cdotc_usm>(cgh, [=]() {
-            ::cdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::dot(::cdotc, result, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zdotc_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zdotc_usm>(cgh, [=]() {
-            ::zdotc(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::dot(::zdotc, result, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cdotu_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_cdotu_usm>(cgh, [=]() {
-            ::cdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::dot(::cdotu, result, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zdotu_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zdotu_usm>(cgh, [=]() {
-            ::zdotu(result, (const MKL_INT *)&n, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy);
+            blas64::dot(::zdotu, result, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "isamin_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_isamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamin((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_isamin, n, x, incx, false); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "idamin_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_idamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamin((const MKL_INT)n, x, (const MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_idamin, n, x, incx, false); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "icamin_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_icamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamin((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_icamin, n, x, incx, false); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "izamin_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_izamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamin((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_izamin, n, x, incx, false); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "isamax_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_isamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamax((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_isamax, n, x, incx, true); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "idamax_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_idamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamax((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_idamax, n, x, incx, true); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "icamax_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_icamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamax((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_icamax, n, x, incx, true); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "izamax_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_izamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamax((MKL_INT)n, x, (MKL_INT)incx); });
+            cgh, [=]() { result[0] = blas64::iamax(::cblas_izamax, n, x, incx, true); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "snrm2_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_snrm2_usm>(
-            cgh, [=]() { result[0] = ::snrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::nrm2(mode, ::snrm2, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dnrm2_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dnrm2_usm>(
-            cgh, [=]() { result[0] = ::dnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::nrm2(mode, ::dnrm2, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "scnrm2_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_scnrm2_usm>(
-            cgh, [=]() { result[0] = ::scnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::nrm2(mode, ::scnrm2, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dznrm2_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dznrm2_usm>(
-            cgh, [=]() { result[0] = ::dznrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+            cgh, [=]() { result[0] = cnr::nrm2(mode, ::dznrm2, n, x, incx); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                     int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "srot_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_srot_usm>(cgh, [=]() {
-            ::srot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                   &s);
+            blas64::rot(::srot, n, x, incx, y, incy, &c, &s);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                     int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "drot_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_drot_usm>(cgh, [=]() {
-            ::drot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                   &s);
+            blas64::rot(::drot, n, x, incx, y, incy, &c, &s);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                     std::complex<float> *y, int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csrot_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_csrot_usm>(cgh, [=]() {
-            ::csrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                    &s);
+            blas64::rot(::csrot, n, x, incx, y, incy, &c, &s);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                     std::complex<double> *y, int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zdrot_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zdrot_usm>(cgh, [=]() {
-            ::zdrot((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, &c,
-                    &s);
+            blas64::rot(::zdrot, n, x, incx, y, incy, &c, &s);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "srotg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_srotg_usm>(cgh, [=]() { ::srotg(a, b, c, s); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "drotg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_drotg_usm>(cgh, [=]() { ::drotg(a, b, c, s); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b,
                      float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "crotg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_crotg_usm>(cgh, [=]() { ::crotg(a, b, c, s); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
                      double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zrotg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zrotg_usm>(cgh, [=]() { ::zrotg(a, b, c, s); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "srotm_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_srotm_usm>(cgh, [=]() {
-            ::srotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy,
-                    param);
+            blas64::rotm(::srotm, n, x, incx, y, incy, param);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "drotm_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_drotm_usm>(cgh, [=]() {
-            ::drotm((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy,
-                    param);
+            blas64::rotm(::drotm, n, x, incx, y, incy, param);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
                       float *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "srotmg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_srotmg_usm>(
             cgh, [=]() { ::srotmg(d1, d2, x1, (float *)&y1, param); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
                       double *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "drotmg_usm", 0, 0, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_drotmg_usm>(
             cgh, [=]() { ::drotmg(d1, d2, x1, (double *)&y1, param); });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sscal_usm>(cgh, [=]() {
-            ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
+            blas64::scal(::sscal, n, (const float *)&alpha, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dscal_usm>(cgh, [=]() {
-            ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
+            blas64::scal(::dscal, n, (const double *)&alpha, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_cscal_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx);
+            blas64::scal(::cscal, n, (const MKL_Complex8 *)&alpha_, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_csscal_usm>(cgh, [=]() {
-            ::csscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
+            blas64::scal(::csscal, n, (const float *)&alpha, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zscal_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx);
+            blas64::scal(::zscal, n, (const MKL_Complex16 *)&alpha_, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zdscal_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zdscal_usm>(cgh, [=]() {
-            ::zdscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
+            blas64::scal(::zdscal, n, (const double *)&alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_sscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::sscal, n, alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha, double *x,
+                     int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_dscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::dscal, n, alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_cscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::cscal, n, alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, std::complex<float> *x,
+                     int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_csscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::csscal, n, alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_zscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::zscal, n, alpha, x, incx);
         });
     });
-    return done;
+    return record_submission(queue, done);
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zdscal_device_scalar_usm", 0, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        host_task<class mkl_kernel_zdscal_device_scalar_usm>(cgh, [=]() {
+            blas64::scal(::zdscal, n, alpha, x, incx);
+        });
+    });
+    return record_submission(queue, done);
 }
 
 cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sdsdot_usm", 0, n, 0);
+    const reproducibility mode = get_reproducibility(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sdsdot_usm>(cgh, [=]() {
-            result[0] = ::sdsdot((const MKL_INT *)&n, (const float *)&sb, x, (const MKL_INT *)&incx,
-                                 y, (const MKL_INT *)&incy);
+            result[0] = cnr::sdsdot(mode, ::sdsdot, n, (const float *)&sb, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sswap_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sswap_usm>(cgh, [=]() {
-            ::sswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::swap(::sswap, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dswap_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dswap_usm>(cgh, [=]() {
-            ::dswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::swap(::dswap, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cswap_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_cswap_usm>(cgh, [=]() {
-            ::cswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::swap(::cswap, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zswap_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_zswap_usm>(cgh, [=]() {
-            ::zswap((const MKL_INT *)&n, x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy);
+            blas64::swap(::zswap, n, x, incx, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
+}
+
+// Reproducibility
+
+void set_reproducibility(cl::sycl::queue &queue, reproducibility mode) {
+    queue_settings_registry::instance().update(
+        queue, [&](queue_settings &settings) { settings.reproducibility_mode = mode; });
 }
 
 } // namespace mklcpu
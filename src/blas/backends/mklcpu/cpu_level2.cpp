@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "cpu_blas64.hpp"
 #include "cpu_common.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
@@ -31,36 +32,36 @@ namespace mklcpu {
 void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x,
           int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "sgbmv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgbmv>(cgh, [=]() {
-            ::sgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const float *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const float *)&beta, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_sgbmv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy, [=](float *y_ptr) {
+                ::sgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                        (const float *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const float *)&beta, y_ptr,
+                        mkl_int(incy));
+            });
     });
 }
 
 void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x,
           int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dgbmv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgbmv>(cgh, [=]() {
-            ::dgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const double *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const double *)&beta, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_dgbmv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy, [=](double *y_ptr) {
+                ::dgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                        (const double *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const double *)&beta, y_ptr,
+                        mkl_int(incy));
+            });
     });
 }
 
@@ -68,22 +69,23 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "cgbmv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgbmv>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex8 *)&alpha_,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_cgbmv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](std::complex<float> *y_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::cgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                        (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const MKL_Complex8 *)&beta_,
+                        y_ptr, mkl_int(incy));
+            });
     });
 }
 
@@ -91,56 +93,57 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zgbmv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgbmv>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex16 *)&alpha_,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_zgbmv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](std::complex<double> *y_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                        (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const MKL_Complex16 *)&beta_,
+                        y_ptr, mkl_int(incy));
+            });
     });
 }
 
 void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x, int64_t incx,
           float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "sgemv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemv>(cgh, [=]() {
-            ::sgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const float *)&beta,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_sgemv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy, [=](float *y_ptr) {
+                blas64::gemv(::sgemv, (const char *)&trans_, m, n, (const float *)&alpha,
+                             accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                             (const float *)&beta, y_ptr, incy);
+            });
     });
 }
 
 void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x, int64_t incx,
           double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dgemv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemv>(cgh, [=]() {
-            ::dgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const double *)&beta,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_dgemv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy, [=](double *y_ptr) {
+                blas64::gemv(::dgemv, (const char *)&trans_, m, n, (const double *)&alpha,
+                             accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                             (const double *)&beta, y_ptr, incy);
+            });
     });
 }
 
@@ -148,28 +151,216 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "cgemv", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_cgemv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](std::complex<float> *y_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                blas64::gemv(::cgemv, (const char *)&trans_, m, n, (const MKL_Complex8 *)&alpha_,
+                             accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                             (const MKL_Complex8 *)&beta_, y_ptr, incy);
+            });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zgemv", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_zgemv>(
+            cgh, y, beta, 1, trans == transpose::nontrans ? m : n, incy,
+            [=](std::complex<double> *y_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                blas64::gemv(::zgemv, (const char *)&trans_, m, n, (const MKL_Complex16 *)&alpha_,
+                             accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                             (const MKL_Complex16 *)&beta_, y_ptr, incy);
+            });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
+          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "sgemv_device_scalar", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemv_device_scalar>(cgh, [=]() {
+            blas64::gemv(::sgemv, (const char *)&trans_, m, n, accessor_alpha.get_pointer(),
+                         accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                         accessor_beta.get_pointer(), accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
+          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &beta,
+          cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dgemv_device_scalar", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemv_device_scalar>(cgh, [=]() {
+            blas64::gemv(::dgemv, (const char *)&trans_, m, n, accessor_alpha.get_pointer(),
+                         accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                         accessor_beta.get_pointer(), accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "cgemv_device_scalar", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemv_device_scalar>(cgh, [=]() {
+            blas64::gemv(::cgemv, (const char *)&trans_, m, n, accessor_alpha.get_pointer(),
+                         accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                         accessor_beta.get_pointer(), accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zgemv_device_scalar", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgemv_device_scalar>(cgh, [=]() {
+            blas64::gemv(::zgemv, (const char *)&trans_, m, n, accessor_alpha.get_pointer(),
+                         accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx,
+                         accessor_beta.get_pointer(), accessor_y.get_pointer(), incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<float, 1> &x, int64_t offset_x, int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, int64_t offset_y, int64_t incy) {
+    const bool nontrans = trans == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(m, n, lda), "a");
+    check_offset(x, offset_x, vector_span(nontrans ? n : m, incx), "x");
+    check_offset(y, offset_y, vector_span(nontrans ? m : n, incy), "y");
+    const perf_call call(queue, "sgemv_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemv_offset>(cgh, [=]() {
+            blas64::gemv(::sgemv, (const char *)&trans_, m, n, (const float *)&alpha,
+                         accessor_a.get_pointer() + offset_a, lda,
+                         accessor_x.get_pointer() + offset_x, incx, (const float *)&beta,
+                         accessor_y.get_pointer() + offset_y, incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<double, 1> &x, int64_t offset_x, int64_t incx, double beta,
+          cl::sycl::buffer<double, 1> &y, int64_t offset_y, int64_t incy) {
+    const bool nontrans = trans == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(m, n, lda), "a");
+    check_offset(x, offset_x, vector_span(nontrans ? n : m, incx), "x");
+    check_offset(y, offset_y, vector_span(nontrans ? m : n, incy), "y");
+    const perf_call call(queue, "dgemv_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemv_offset>(cgh, [=]() {
+            blas64::gemv(::dgemv, (const char *)&trans_, m, n, (const double *)&alpha,
+                         accessor_a.get_pointer() + offset_a, lda,
+                         accessor_x.get_pointer() + offset_x, incx, (const double *)&beta,
+                         accessor_y.get_pointer() + offset_y, incy);
+        });
+    });
+}
+
+void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t offset_x, int64_t incx,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    const bool nontrans = trans == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(m, n, lda), "a");
+    check_offset(x, offset_x, vector_span(nontrans ? n : m, incx), "x");
+    check_offset(y, offset_y, vector_span(nontrans ? m : n, incy), "y");
+    const perf_call call(queue, "cgemv_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char trans_ = *fortran_char(trans);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgemv_offset>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::gemv(::cgemv, (const char *)&trans_, m, n, (const MKL_Complex8 *)&alpha_,
+                         accessor_a.get_pointer() + offset_a, lda,
+                         accessor_x.get_pointer() + offset_x, incx, (const MKL_Complex8 *)&beta_,
+                         accessor_y.get_pointer() + offset_y, incy);
         });
     });
 }
 
 void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
-          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
-          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
-          cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t offset_x, int64_t incx,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y, int64_t offset_y,
+          int64_t incy) {
+    const bool nontrans = trans == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(m, n, lda), "a");
+    check_offset(x, offset_x, vector_span(nontrans ? n : m, incx), "x");
+    check_offset(y, offset_y, vector_span(nontrans ? m : n, incy), "y");
+    const perf_call call(queue, "zgemv_offset", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -177,13 +368,13 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemv_offset>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+            blas64::gemv(::zgemv, (const char *)&trans_, m, n, (const MKL_Complex16 *)&alpha_,
+                         accessor_a.get_pointer() + offset_a, lda,
+                         accessor_x.get_pointer() + offset_x, incx, (const MKL_Complex16 *)&beta_,
+                         accessor_y.get_pointer() + offset_y, incy);
         });
     });
 }
@@ -191,14 +382,14 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
 void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
          int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy, cl::sycl::buffer<float, 1> &a,
          int64_t lda) {
+    const perf_call call(queue, "sger", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sger>(cgh, [=]() {
-            ::sger((const MKL_INT *)&m, (const MKL_INT *)&n, (const float *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                   (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::sger, m, n, (const float *)&alpha, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -206,14 +397,14 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::bu
 void ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
          int64_t incx, cl::sycl::buffer<double, 1> &y, int64_t incy, cl::sycl::buffer<double, 1> &a,
          int64_t lda) {
+    const perf_call call(queue, "dger", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dger>(cgh, [=]() {
-            ::dger((const MKL_INT *)&m, (const MKL_INT *)&n, (const double *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                   (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::dger, m, n, (const double *)&alpha, accessor_x.get_pointer(), incx,
+                        accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -222,6 +413,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "cgerc", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
@@ -229,9 +421,8 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cgerc>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::cgerc, m, n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
+                        incx, accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -240,6 +431,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "zgerc", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
@@ -247,9 +439,8 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zgerc>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::zgerc, m, n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
+                        incx, accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -258,6 +449,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "cgeru", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
@@ -265,9 +457,8 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cgeru>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::cgeru, m, n, (const MKL_Complex8 *)&alpha_, accessor_x.get_pointer(),
+                        incx, accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -276,6 +467,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "zgeru", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
@@ -283,9 +475,8 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zgeru>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            blas64::ger(::zgeru, m, n, (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
+                        incx, accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
     });
 }
@@ -294,21 +485,22 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::c
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "chbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chbmv>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_chbmv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<float> *y_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::chbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k),
+                        (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const MKL_Complex8 *)&beta_,
+                        y_ptr, mkl_int(incy));
+            });
     });
 }
 
@@ -316,21 +508,22 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zhbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhbmv>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_zhbmv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<double> *y_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zhbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k),
+                        (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                        accessor_x.get_pointer(), mkl_int(incx), (const MKL_Complex16 *)&beta_,
+                        y_ptr, mkl_int(incy));
+            });
     });
 }
 
@@ -338,21 +531,21 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "chemv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemv>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_chemv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<float> *y_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::chemv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_,
+                        accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                        mkl_int(incx), (const MKL_Complex8 *)&beta_, y_ptr, mkl_int(incy));
+            });
     });
 }
 
@@ -360,35 +553,35 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zhemv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemv>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhemv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_zhemv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<double> *y_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zhemv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_,
+                        accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                        mkl_int(incx), (const MKL_Complex16 *)&beta_, y_ptr, mkl_int(incy));
+            });
     });
 }
 
 void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "cher", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cher>(cgh, [=]() {
-            ::cher((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
-                   (const MKL_INT *)&lda);
+            ::cher((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -396,14 +589,14 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "zher", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zher>(cgh, [=]() {
-            ::zher((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
-                   (const MKL_INT *)&lda);
+            ::zher((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -412,6 +605,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "cher2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -420,9 +614,9 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cher2>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            ::cher2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -431,6 +625,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
+    const perf_call call(queue, "zher2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -439,10 +634,9 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zher2>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zher2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            ::zher2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -451,20 +645,21 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
           cl::sycl::buffer<std::complex<float>, 1> &ap, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           int64_t incy) {
+    const perf_call call(queue, "chpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpmv>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chpmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_ap.get_pointer(), accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    (const MKL_Complex8 *)&beta_, accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_chpmv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<float> *y_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::chpmv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_,
+                        accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx),
+                        (const MKL_Complex8 *)&beta_, y_ptr, mkl_int(incy));
+            });
     });
 }
 
@@ -472,34 +667,35 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
           cl::sycl::buffer<std::complex<double>, 1> &ap,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
+    const perf_call call(queue, "zhpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpmv>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhpmv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_ap.get_pointer(),
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
-        });
+        host_task_output<class mkl_kernel_zhpmv>(
+            cgh, y, beta, 1, n, incy, [=](std::complex<double> *y_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zhpmv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_,
+                        accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx),
+                        (const MKL_Complex16 *)&beta_, y_ptr, mkl_int(incy));
+            });
     });
 }
 
 void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    const perf_call call(queue, "chpr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_chpr>(cgh, [=]() {
-            ::chpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
+            ::chpr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_ap.get_pointer());
         });
     });
 }
@@ -507,13 +703,14 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    const perf_call call(queue, "zhpr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zhpr>(cgh, [=]() {
-            ::zhpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
+            ::zhpr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_ap.get_pointer());
         });
     });
 }
@@ -522,6 +719,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &ap) {
+    const perf_call call(queue, "chpr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -530,9 +728,9 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_chpr2>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::chpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_ap.get_pointer());
+            ::chpr2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -541,6 +739,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &ap) {
+    const perf_call call(queue, "zhpr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -549,10 +748,9 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zhpr2>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zhpr2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, accessor_y.get_pointer(), (const MKL_INT *)&incy,
-                    accessor_ap.get_pointer());
+            ::zhpr2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -560,16 +758,15 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
 void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float alpha,
           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x, int64_t incx,
           float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "ssbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssbmv>(cgh, [=]() {
-            ::ssbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const float *)&beta,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_ssbmv>(cgh, y, beta, 1, n, incy, [=](float *y_ptr) {
+            ::ssbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k), (const float *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(), mkl_int(incx),
+                    (const float *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
@@ -577,16 +774,15 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float
 void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double alpha,
           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x, int64_t incx,
           double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dsbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsbmv>(cgh, [=]() {
-            ::dsbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, (const double *)&beta,
-                    accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_dsbmv>(cgh, y, beta, 1, n, incy, [=](double *y_ptr) {
+            ::dsbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k), (const double *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(), mkl_int(incx),
+                    (const double *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
@@ -594,15 +790,15 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double
 void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &x, int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "sspmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspmv>(cgh, [=]() {
-            ::sspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                    accessor_ap.get_pointer(), accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    (const float *)&beta, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_sspmv>(cgh, y, beta, 1, n, incy, [=](float *y_ptr) {
+            ::sspmv((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                    accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx),
+                    (const float *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
@@ -610,41 +806,43 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &x, int64_t incx,
           double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dspmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspmv>(cgh, [=]() {
-            ::dspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                    accessor_ap.get_pointer(), accessor_x.get_pointer(), (const MKL_INT *)&incx,
-                    (const double *)&beta, accessor_y.get_pointer(), (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_dspmv>(cgh, y, beta, 1, n, incy, [=](double *y_ptr) {
+            ::dspmv((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                    accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx),
+                    (const double *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
 
 void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &ap) {
+    const perf_call call(queue, "sspr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sspr>(cgh, [=]() {
-            ::sspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
+            ::sspr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_ap.get_pointer());
         });
     });
 }
 
 void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &ap) {
+    const perf_call call(queue, "dspr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dspr>(cgh, [=]() {
-            ::dspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_ap.get_pointer());
+            ::dspr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_ap.get_pointer());
         });
     });
 }
@@ -652,15 +850,16 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
 void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy,
           cl::sycl::buffer<float, 1> &ap) {
+    const perf_call call(queue, "sspr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_sspr2>(cgh, [=]() {
-            ::sspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_ap.get_pointer());
+            ::sspr2((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -668,15 +867,16 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &y,
           int64_t incy, cl::sycl::buffer<double, 1> &ap) {
+    const perf_call call(queue, "dspr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dspr2>(cgh, [=]() {
-            ::dspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_ap.get_pointer());
+            ::dspr2((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -684,16 +884,15 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
 void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x, int64_t incx,
           float beta, cl::sycl::buffer<float, 1> &y, int64_t incy) {
+    const perf_call call(queue, "ssymv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymv>(cgh, [=]() {
-            ::ssymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const float *)&beta, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_ssymv>(cgh, y, beta, 1, n, incy, [=](float *y_ptr) {
+            ::ssymv((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(), mkl_int(incx),
+                    (const float *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
@@ -701,30 +900,29 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x, int64_t incx,
           double beta, cl::sycl::buffer<double, 1> &y, int64_t incy) {
+    const perf_call call(queue, "dsymv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymv>(cgh, [=]() {
-            ::dsymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx, (const double *)&beta, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy);
+        host_task_output<class mkl_kernel_dsymv>(cgh, y, beta, 1, n, incy, [=](double *y_ptr) {
+            ::dsymv((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(), mkl_int(incx),
+                    (const double *)&beta, y_ptr, mkl_int(incy));
         });
     });
 }
 
 void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &a, int64_t lda) {
+    const perf_call call(queue, "ssyr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ssyr>(cgh, [=]() {
-            ::ssyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
-                   (const MKL_INT *)&lda);
+            ::ssyr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -732,14 +930,14 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &a,
          int64_t lda) {
+    const perf_call call(queue, "dsyr", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dsyr>(cgh, [=]() {
-            ::dsyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                   accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_a.get_pointer(),
-                   (const MKL_INT *)&lda);
+            ::dsyr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                   accessor_x.get_pointer(), mkl_int(incx), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -747,15 +945,16 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
 void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, int64_t incx, cl::sycl::buffer<float, 1> &y, int64_t incy,
           cl::sycl::buffer<float, 1> &a, int64_t lda) {
+    const perf_call call(queue, "ssyr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ssyr2>(cgh, [=]() {
-            ::ssyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            ::ssyr2((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -763,15 +962,16 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, int64_t incx, cl::sycl::buffer<double, 1> &y,
           int64_t incy, cl::sycl::buffer<double, 1> &a, int64_t lda) {
+    const perf_call call(queue, "dsyr2", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dsyr2>(cgh, [=]() {
-            ::dsyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx, accessor_y.get_pointer(),
-                    (const MKL_INT *)&incy, accessor_a.get_pointer(), (const MKL_INT *)&lda);
+            ::dsyr2((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha,
+                    accessor_x.get_pointer(), mkl_int(incx), accessor_y.get_pointer(),
+                    mkl_int(incy), accessor_a.get_pointer(), mkl_int(lda));
         });
     });
 }
@@ -779,6 +979,7 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
 void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "stbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -787,8 +988,8 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_stbmv>(cgh, [=]() {
             ::stbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -796,6 +997,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "dtbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -804,8 +1006,8 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtbmv>(cgh, [=]() {
             ::dtbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -813,6 +1015,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ctbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -821,8 +1024,8 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctbmv>(cgh, [=]() {
             ::ctbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -830,6 +1033,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ztbmv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -838,8 +1042,8 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztbmv>(cgh, [=]() {
             ::ztbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -847,6 +1051,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "stbsv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -855,8 +1060,8 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_stbsv>(cgh, [=]() {
             ::stbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -864,6 +1069,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "dtbsv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -872,8 +1078,8 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtbsv>(cgh, [=]() {
             ::dtbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -881,6 +1087,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ctbsv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -889,8 +1096,8 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctbsv>(cgh, [=]() {
             ::ctbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -898,6 +1105,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ztbsv", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -906,14 +1114,15 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztbsv>(cgh, [=]() {
             ::ztbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
 
 void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &x, int64_t incx) {
+    const perf_call call(queue, "stpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -922,14 +1131,14 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_stpmv>(cgh, [=]() {
             ::stpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
 
 void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &x, int64_t incx) {
+    const perf_call call(queue, "dtpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -938,8 +1147,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtpmv>(cgh, [=]() {
             ::dtpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -947,6 +1155,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &ap, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "ctpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -955,8 +1164,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctpmv>(cgh, [=]() {
             ::ctpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -964,6 +1172,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &ap,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ztpmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -972,14 +1181,14 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztpmv>(cgh, [=]() {
             ::ztpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
 
 void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<float, 1> &ap, cl::sycl::buffer<float, 1> &x, int64_t incx) {
+    const perf_call call(queue, "stpsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -988,14 +1197,14 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_stpsv>(cgh, [=]() {
             ::stpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
 
 void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<double, 1> &ap, cl::sycl::buffer<double, 1> &x, int64_t incx) {
+    const perf_call call(queue, "dtpsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1004,8 +1213,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtpsv>(cgh, [=]() {
             ::dtpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -1013,6 +1221,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &ap, cl::sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "ctpsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1021,8 +1230,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctpsv>(cgh, [=]() {
             ::ctpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
@@ -1030,6 +1238,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &ap,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ztpsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1038,14 +1247,14 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztpsv>(cgh, [=]() {
             ::ztpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_ap.get_pointer(), accessor_x.get_pointer(), mkl_int(incx));
         });
     });
 }
 
 void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t incx) {
+    const perf_call call(queue, "strmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1054,8 +1263,8 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_strmv>(cgh, [=]() {
             ::strmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1063,6 +1272,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
 void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
           int64_t incx) {
+    const perf_call call(queue, "dtrmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1071,8 +1281,8 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtrmv>(cgh, [=]() {
             ::dtrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1080,6 +1290,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
 void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t incx) {
+    const perf_call call(queue, "ctrmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1088,8 +1299,8 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctrmv>(cgh, [=]() {
             ::ctrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1097,6 +1308,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
 void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t incx) {
+    const perf_call call(queue, "ztrmv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1105,14 +1317,15 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztrmv>(cgh, [=]() {
             ::ztrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
 
 void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &x, int64_t incx) {
+    const perf_call call(queue, "strsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1121,8 +1334,8 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_strsv>(cgh, [=]() {
             ::strsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1130,6 +1343,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &x,
           int64_t incx) {
+    const perf_call call(queue, "dtrsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1138,8 +1352,8 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtrsv>(cgh, [=]() {
             ::dtrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1147,6 +1361,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ctrsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1155,8 +1370,8 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ctrsv>(cgh, [=]() {
             ::ctrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1164,6 +1379,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
 void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
+    const perf_call call(queue, "ztrsv", 0, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -1172,8 +1388,8 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ztrsv>(cgh, [=]() {
             ::ztrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_x.get_pointer(), (const MKL_INT *)&incx);
+                    mkl_int(n), accessor_a.get_pointer(), mkl_int(lda), accessor_x.get_pointer(),
+                    mkl_int(incx));
         });
     });
 }
@@ -1184,40 +1400,34 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t ku, float alpha, const float *a, int64_t lda, const float *x,
                      int64_t incx, float beta, float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgbmv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_sgbmv_usm>(cgh, [=]() {
-            ::sgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const float *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
-                    (const MKL_INT *)&incy);
+            ::sgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                    (const float *)&alpha, a, mkl_int(lda), x, mkl_int(incx), (const float *)&beta,
+                    y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
                      int64_t ku, double alpha, const double *a, int64_t lda, const double *x,
                      int64_t incx, double beta, double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgbmv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_dgbmv_usm>(cgh, [=]() {
-            ::dgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const double *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
-                    (const MKL_INT *)&incy);
+            ::dgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                    (const double *)&alpha, a, mkl_int(lda), x, mkl_int(incx),
+                    (const double *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
@@ -1225,24 +1435,21 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgbmv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_cgbmv_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex8 *)&alpha_, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_,
-                    y, (const MKL_INT *)&incy);
+            ::cgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), x, mkl_int(incx),
+                    (const MKL_Complex8 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
@@ -1250,62 +1457,53 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<double> *x, int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgbmv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_zgbmv_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgbmv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_INT *)&kl, (const MKL_INT *)&ku, (const MKL_Complex16 *)&alpha_, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_,
-                    y, (const MKL_INT *)&incy);
+            ::zgbmv((const char *)&trans_, mkl_int(m), mkl_int(n), mkl_int(kl), mkl_int(ku),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), x, mkl_int(incx),
+                    (const MKL_Complex16 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_sgemv_usm>(cgh, [=]() {
-            ::sgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const float *)&beta, y, (const MKL_INT *)&incy);
+            blas64::gemv(::sgemv, (const char *)&trans_, m, n, (const float *)&alpha, a, lda, x,
+                         incx, (const float *)&beta, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_dgemv_usm>(cgh, [=]() {
-            ::dgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const double *)&beta, y, (const MKL_INT *)&incy);
+            blas64::gemv(::dgemv, (const char *)&trans_, m, n, (const double *)&alpha, a, lda, x,
+                         incx, (const double *)&beta, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
@@ -1313,24 +1511,20 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_cgemv_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            blas64::gemv(::cgemv, (const char *)&trans_, m, n, (const MKL_Complex8 *)&alpha_, a,
+                         lda, x, incx, (const MKL_Complex8 *)&beta_, y, incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
@@ -1338,132 +1532,176 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemv_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_zgemv_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgemv((const char *)&trans_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            blas64::gemv(::zgemv, (const char *)&trans_, m, n, (const MKL_Complex16 *)&alpha_, a,
+                         lda, x, incx, (const MKL_Complex16 *)&beta_, y, incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const float *alpha, const float *a, int64_t lda, const float *x, int64_t incx,
+                     const float *beta, float *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemv_device_scalar_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_sgemv_device_scalar_usm>(cgh, [=]() {
+            blas64::gemv(::sgemv, (const char *)&trans_, m, n, alpha, a, lda, x, incx, beta, y,
+                         incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const double *alpha, const double *a, int64_t lda, const double *x,
+                     int64_t incx, const double *beta, double *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemv_device_scalar_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_dgemv_device_scalar_usm>(cgh, [=]() {
+            blas64::gemv(::dgemv, (const char *)&trans_, m, n, alpha, a, lda, x, incx, beta, y,
+                         incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const std::complex<float> *alpha, const std::complex<float> *a, int64_t lda,
+                     const std::complex<float> *x, int64_t incx, const std::complex<float> *beta,
+                     std::complex<float> *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemv_device_scalar_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_cgemv_device_scalar_usm>(cgh, [=]() {
+            blas64::gemv(::cgemv, (const char *)&trans_, m, n, alpha, a, lda, x, incx, beta, y,
+                         incy);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n,
+                     const std::complex<double> *alpha, const std::complex<double> *a, int64_t lda,
+                     const std::complex<double> *x, int64_t incx, const std::complex<double> *beta,
+                     std::complex<double> *y, int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemv_device_scalar_usm", m, n, 0);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char trans_ = *fortran_char(trans);
+        host_task<class mkl_kernel_zgemv_device_scalar_usm>(cgh, [=]() {
+            blas64::gemv(::zgemv, (const char *)&trans_, m, n, alpha, a, lda, x, incx, beta, y,
+                         incy);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, const float *x,
                     int64_t incx, const float *y, int64_t incy, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sger_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_sger_usm>(cgh, [=]() {
-            ::sger((const MKL_INT *)&m, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::sger, m, n, (const float *)&alpha, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, const double *x,
                     int64_t incx, const double *y, int64_t incy, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dger_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         host_task<class mkl_kernel_dger_usm>(cgh, [=]() {
-            ::dger((const MKL_INT *)&m, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::dger, m, n, (const double *)&alpha, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgerc_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_cgerc_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::cgerc, m, n, (const MKL_Complex8 *)&alpha_, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgerc_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zgerc_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgerc((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::zgerc, m, n, (const MKL_Complex16 *)&alpha_, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgeru_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_cgeru_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::cgeru, m, n, (const MKL_Complex8 *)&alpha_, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgeru_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zgeru_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zgeru((const MKL_INT *)&m, (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            blas64::ger(::zgeru, m, n, (const MKL_Complex16 *)&alpha_, x, incx, y, incy, a, lda);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
@@ -1471,24 +1709,21 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_chbmv_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            ::chbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), x, mkl_int(incx),
+                    (const MKL_Complex8 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
@@ -1496,47 +1731,41 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_zhbmv_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            ::zhbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), x, mkl_int(incx),
+                    (const MKL_Complex16 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, const std::complex<float> *x,
                      int64_t incx, std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chemv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_chemv_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chemv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const MKL_Complex8 *)&beta_, y, (const MKL_INT *)&incy);
+            ::chemv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_, a,
+                    mkl_int(lda), x, mkl_int(incx), (const MKL_Complex8 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
@@ -1544,122 +1773,107 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhemv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_zhemv_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhemv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx, (const MKL_Complex16 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            ::zhemv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_, a,
+                    mkl_int(lda), x, mkl_int(incx), (const MKL_Complex16 *)&beta_, y,
+                    mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cher_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_cher_usm>(cgh, [=]() {
-            ::cher((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
+            ::cher((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x, mkl_int(incx),
+                   a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *a,
                     int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zher_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_zher_usm>(cgh, [=]() {
-            ::zher((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
+            ::zher((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                   mkl_int(incx), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cher2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_cher2_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cher2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            ::cher2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_, x,
+                    mkl_int(incx), y, mkl_int(incy), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zher2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zher2_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zher2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            ::zher2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_, x,
+                    mkl_int(incx), y, mkl_int(incy), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *ap, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_chpmv_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chpmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    ap, x, (const MKL_INT *)&incx, (const MKL_Complex8 *)&beta_, y,
-                    (const MKL_INT *)&incy);
+            ::chpmv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_, ap, x,
+                    mkl_int(incx), (const MKL_Complex8 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
@@ -1667,812 +1881,712 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
         host_task<class mkl_kernel_zhpmv_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhpmv((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, ap, x, (const MKL_INT *)&incx,
-                    (const MKL_Complex16 *)&beta_, y, (const MKL_INT *)&incy);
+            ::zhpmv((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_, ap, x,
+                    mkl_int(incx), (const MKL_Complex16 *)&beta_, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chpr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_chpr_usm>(cgh, [=]() {
-            ::chpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
+            ::chpr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x, mkl_int(incx),
+                   ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhpr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_zhpr_usm>(cgh, [=]() {
-            ::zhpr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
+            ::zhpr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                   mkl_int(incx), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chpr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_chpr2_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::chpr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_,
-                    x, (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
+            ::chpr2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex8 *)&alpha_, x,
+                    mkl_int(incx), y, mkl_int(incy), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhpr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zhpr2_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zhpr2((const char *)&upper_lower_, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx, y,
-                    (const MKL_INT *)&incy, ap);
+            ::zhpr2((const char *)&upper_lower_, mkl_int(n), (const MKL_Complex16 *)&alpha_, x,
+                    mkl_int(incx), y, mkl_int(incy), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float alpha,
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_ssbmv_usm>(cgh, [=]() {
-            ::ssbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const float *)&beta, y, (const MKL_INT *)&incy);
+            ::ssbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k), (const float *)&alpha, a,
+                    mkl_int(lda), x, mkl_int(incx), (const float *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double alpha,
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dsbmv_usm>(cgh, [=]() {
-            ::dsbmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const MKL_INT *)&k,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx,
-                    (const double *)&beta, y, (const MKL_INT *)&incy);
+            ::dsbmv((const char *)&upper_lower_, mkl_int(n), mkl_int(k), (const double *)&alpha, a,
+                    mkl_int(lda), x, mkl_int(incx), (const double *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *ap, const float *x, int64_t incx, float beta, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sspmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_sspmv_usm>(cgh, [=]() {
-            ::sspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, ap, x,
-                    (const MKL_INT *)&incx, (const float *)&beta, y, (const MKL_INT *)&incy);
+            ::sspmv((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, ap, x,
+                    mkl_int(incx), (const float *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *ap, const double *x, int64_t incx, double beta, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dspmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dspmv_usm>(cgh, [=]() {
-            ::dspmv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, ap, x,
-                    (const MKL_INT *)&incx, (const double *)&beta, y, (const MKL_INT *)&incy);
+            ::dspmv((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, ap, x,
+                    mkl_int(incx), (const double *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sspr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_sspr_usm>(cgh, [=]() {
-            ::sspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
+            ::sspr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x, mkl_int(incx),
+                   ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dspr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dspr_usm>(cgh, [=]() {
-            ::dspr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, ap);
+            ::dspr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                   mkl_int(incx), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sspr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_sspr2_usm>(cgh, [=]() {
-            ::sspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
+            ::sspr2((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x,
+                    mkl_int(incx), y, mkl_int(incy), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dspr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dspr2_usm>(cgh, [=]() {
-            ::dspr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, ap);
+            ::dspr2((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                    mkl_int(incx), y, mkl_int(incy), ap);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssymv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_ssymv_usm>(cgh, [=]() {
-            ::ssymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const float *)&beta, y,
-                    (const MKL_INT *)&incy);
+            ::ssymv((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, a, mkl_int(lda),
+                    x, mkl_int(incx), (const float *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsymv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dsymv_usm>(cgh, [=]() {
-            ::dsymv((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, a,
-                    (const MKL_INT *)&lda, x, (const MKL_INT *)&incx, (const double *)&beta, y,
-                    (const MKL_INT *)&incy);
+            ::dsymv((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, a,
+                    mkl_int(lda), x, mkl_int(incx), (const double *)&beta, y, mkl_int(incy));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssyr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_ssyr_usm>(cgh, [=]() {
-            ::ssyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
+            ::ssyr((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x, mkl_int(incx),
+                   a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsyr_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dsyr_usm>(cgh, [=]() {
-            ::dsyr((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                   (const MKL_INT *)&incx, a, (const MKL_INT *)&lda);
+            ::dsyr((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                   mkl_int(incx), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssyr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_ssyr2_usm>(cgh, [=]() {
-            ::ssyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const float *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            ::ssyr2((const char *)&upper_lower_, mkl_int(n), (const float *)&alpha, x,
+                    mkl_int(incx), y, mkl_int(incy), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsyr2_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dsyr2_usm>(cgh, [=]() {
-            ::dsyr2((const char *)&upper_lower_, (const MKL_INT *)&n, (const double *)&alpha, x,
-                    (const MKL_INT *)&incx, y, (const MKL_INT *)&incy, a, (const MKL_INT *)&lda);
+            ::dsyr2((const char *)&upper_lower_, mkl_int(n), (const double *)&alpha, x,
+                    mkl_int(incx), y, mkl_int(incy), a, mkl_int(lda));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "stbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_stbmv_usm>(cgh, [=]() {
             ::stbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtbmv_usm>(cgh, [=]() {
             ::dtbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctbmv_usm>(cgh, [=]() {
             ::ctbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztbmv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztbmv_usm>(cgh, [=]() {
             ::ztbmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "stbsv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_stbsv_usm>(cgh, [=]() {
             ::stbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtbsv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtbsv_usm>(cgh, [=]() {
             ::dtbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctbsv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctbsv_usm>(cgh, [=]() {
             ::ctbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztbsv_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztbsv_usm>(cgh, [=]() {
             ::ztbsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, a, (const MKL_INT *)&lda, x,
-                    (const MKL_INT *)&incx);
+                    mkl_int(n), mkl_int(k), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "stpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_stpmv_usm>(cgh, [=]() {
             ::stpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtpmv_usm>(cgh, [=]() {
             ::dtpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctpmv_usm>(cgh, [=]() {
             ::ctpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztpmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztpmv_usm>(cgh, [=]() {
             ::ztpmv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "stpsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_stpsv_usm>(cgh, [=]() {
             ::stpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtpsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtpsv_usm>(cgh, [=]() {
             ::dtpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctpsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctpsv_usm>(cgh, [=]() {
             ::ctpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztpsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztpsv_usm>(cgh, [=]() {
             ::ztpsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, ap, x, (const MKL_INT *)&incx);
+                    mkl_int(n), ap, x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "strmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_strmv_usm>(cgh, [=]() {
             ::strmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), b, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtrmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtrmv_usm>(cgh, [=]() {
             ::dtrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), b, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctrmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctrmv_usm>(cgh, [=]() {
             ::ctrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), b, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztrmv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztrmv_usm>(cgh, [=]() {
             ::ztrmv((const char *)&upper_lower_, (const char *)&transa_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), b, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "strsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_strsv_usm>(cgh, [=]() {
             ::strsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtrsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtrsv_usm>(cgh, [=]() {
             ::dtrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctrsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ctrsv_usm>(cgh, [=]() {
             ::ctrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztrsv_usm", 0, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_ztrsv_usm>(cgh, [=]() {
             ::ztrsv((const char *)&upper_lower_, (const char *)&trans_, (const char *)&unit_diag_,
-                    (const MKL_INT *)&n, a, (const MKL_INT *)&lda, x, (const MKL_INT *)&incx);
+                    mkl_int(n), a, mkl_int(lda), x, mkl_int(incx));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 } // namespace mklcpu
@@ -19,7 +19,10 @@
 
 #include <CL/sycl.hpp>
 
+#include "cpu_blas64.hpp"
 #include "cpu_common.hpp"
+#include "cpu_split_k.hpp"
+#include "cpu_strassen.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace oneapi {
@@ -32,18 +35,26 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
           cl::sycl::buffer<float, 1> &b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
           int64_t ldc) {
+    const perf_call call(queue, "sgemm", m, n, k);
+    const int64_t cutoff = strassen_cutoff(queue, m, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemm>(cgh, [=]() {
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                    (const MKL_INT *)&ldb, (const float *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+        host_task_output<class mkl_kernel_sgemm>(cgh, c, beta, m, n, ldc, [=](float *c_ptr) {
+            if (cutoff >= 0) {
+                run_strassen(transa_, transb_, m, n, k, alpha, accessor_a.get_pointer().get(), lda,
+                             accessor_b.get_pointer().get(), ldb, beta, c_ptr, ldc, cutoff);
+                return;
+            }
+            if (split_k_gemm(transa_, transb_, m, n, k, alpha, accessor_a.get_pointer().get(), lda,
+                             accessor_b.get_pointer().get(), ldb, beta, c_ptr, ldc))
+                return;
+            const local_threads threads(tuned_gemm_threads(m, n, k));
+            blas64::gemm(::sgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const float *)&alpha, accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, (const float *)&beta, c_ptr, ldc);
         });
     });
 }
@@ -52,18 +63,26 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
           cl::sycl::buffer<double, 1> &b, int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
           int64_t ldc) {
+    const perf_call call(queue, "dgemm", m, n, k);
+    const int64_t cutoff = strassen_cutoff(queue, m, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemm>(cgh, [=]() {
-            ::dgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                    (const MKL_INT *)&ldb, (const double *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+        host_task_output<class mkl_kernel_dgemm>(cgh, c, beta, m, n, ldc, [=](double *c_ptr) {
+            if (cutoff >= 0) {
+                run_strassen(transa_, transb_, m, n, k, alpha, accessor_a.get_pointer().get(), lda,
+                             accessor_b.get_pointer().get(), ldb, beta, c_ptr, ldc, cutoff);
+                return;
+            }
+            if (split_k_gemm(transa_, transb_, m, n, k, alpha, accessor_a.get_pointer().get(), lda,
+                             accessor_b.get_pointer().get(), ldb, beta, c_ptr, ldc))
+                return;
+            const local_threads threads(tuned_gemm_threads(m, n, k));
+            blas64::gemm(::dgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const double *)&alpha, accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, (const double *)&beta, c_ptr, ldc);
         });
     });
 }
@@ -72,6 +91,203 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cgemm", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_cgemm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<float> *c_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                blas64::gemm(::cgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                             (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), lda,
+                             accessor_b.get_pointer(), ldb, (const MKL_Complex8 *)&beta_, c_ptr,
+                             ldc);
+            });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zgemm", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        host_task_output<class mkl_kernel_zgemm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<double> *c_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                blas64::gemm(::zgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                             (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), lda,
+                             accessor_b.get_pointer(), ldb, (const MKL_Complex16 *)&beta_, c_ptr,
+                             ldc);
+            });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
+          cl::sycl::buffer<float, 1> &b, int64_t ldb, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "sgemm_device_scalar", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemm_device_scalar>(cgh, [=]() {
+            blas64::gemm(::sgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         accessor_alpha.get_pointer(), accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, accessor_beta.get_pointer(),
+                         accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+          int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb,
+          cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "dgemm_device_scalar", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemm_device_scalar>(cgh, [=]() {
+            blas64::gemm(::dgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         accessor_alpha.get_pointer(), accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, accessor_beta.get_pointer(),
+                         accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cgemm_device_scalar", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgemm_device_scalar>(cgh, [=]() {
+            blas64::gemm(::cgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         accessor_alpha.get_pointer(), accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, accessor_beta.get_pointer(),
+                         accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zgemm_device_scalar", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_alpha = alpha.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_beta = beta.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgemm_device_scalar>(cgh, [=]() {
+            blas64::gemm(::zgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         accessor_alpha.get_pointer(), accessor_a.get_pointer(), lda,
+                         accessor_b.get_pointer(), ldb, accessor_beta.get_pointer(),
+                         accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<float, 1> &b, int64_t offset_b, int64_t ldb, float beta,
+          cl::sycl::buffer<float, 1> &c, int64_t offset_c, int64_t ldc) {
+    const bool nontransa = transa == transpose::nontrans;
+    const bool nontransb = transb == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(nontransa ? m : k, nontransa ? k : m, lda), "a");
+    check_offset(b, offset_b, matrix_span(nontransb ? k : n, nontransb ? n : k, ldb), "b");
+    check_offset(c, offset_c, matrix_span(m, n, ldc), "c");
+    const perf_call call(queue, "sgemm_offset", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemm_offset>(cgh, [=]() {
+            blas64::gemm(::sgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const float *)&alpha, accessor_a.get_pointer() + offset_a, lda,
+                         accessor_b.get_pointer() + offset_b, ldb, (const float *)&beta,
+                         accessor_c.get_pointer() + offset_c, ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<double, 1> &b, int64_t offset_b, int64_t ldb, double beta,
+          cl::sycl::buffer<double, 1> &c, int64_t offset_c, int64_t ldc) {
+    const bool nontransa = transa == transpose::nontrans;
+    const bool nontransb = transb == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(nontransa ? m : k, nontransa ? k : m, lda), "a");
+    check_offset(b, offset_b, matrix_span(nontransb ? k : n, nontransb ? n : k, ldb), "b");
+    check_offset(c, offset_c, matrix_span(m, n, ldc), "c");
+    const perf_call call(queue, "dgemm_offset", m, n, k);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemm_offset>(cgh, [=]() {
+            blas64::gemm(::dgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const double *)&alpha, accessor_a.get_pointer() + offset_a, lda,
+                         accessor_b.get_pointer() + offset_b, ldb, (const double *)&beta,
+                         accessor_c.get_pointer() + offset_c, ldc);
+        });
+    });
+}
+
+void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+          int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+          int64_t offset_b, int64_t ldb, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, int64_t offset_c, int64_t ldc) {
+    const bool nontransa = transa == transpose::nontrans;
+    const bool nontransb = transb == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(nontransa ? m : k, nontransa ? k : m, lda), "a");
+    check_offset(b, offset_b, matrix_span(nontransb ? k : n, nontransb ? n : k, ldb), "b");
+    check_offset(c, offset_c, matrix_span(m, n, ldc), "c");
+    const perf_call call(queue, "cgemm_offset", m, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
@@ -80,22 +296,28 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemm_offset>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                    (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            blas64::gemm(::cgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer() + offset_a, lda,
+                         accessor_b.get_pointer() + offset_b, ldb, (const MKL_Complex8 *)&beta_,
+                         accessor_c.get_pointer() + offset_c, ldc);
         });
     });
 }
 
 void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
           int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
-          int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
-          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+          int64_t offset_b, int64_t ldb, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, int64_t offset_c, int64_t ldc) {
+    const bool nontransa = transa == transpose::nontrans;
+    const bool nontransb = transb == transpose::nontrans;
+    check_offset(a, offset_a, matrix_span(nontransa ? m : k, nontransa ? k : m, lda), "a");
+    check_offset(b, offset_b, matrix_span(nontransb ? k : n, nontransb ? n : k, ldb), "b");
+    check_offset(c, offset_c, matrix_span(m, n, ldc), "c");
+    const perf_call call(queue, "zgemm_offset", m, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
@@ -104,14 +326,13 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemm_offset>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_,
-                    accessor_a.get_pointer(), (const MKL_INT *)&lda, accessor_b.get_pointer(),
-                    (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            blas64::gemm(::zgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer() + offset_a, lda,
+                         accessor_b.get_pointer() + offset_b, ldb, (const MKL_Complex16 *)&beta_,
+                         accessor_c.get_pointer() + offset_c, ldc);
         });
     });
 }
@@ -120,6 +341,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "chemm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -127,15 +349,15 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-        });
+        host_task_output<class mkl_kernel_chemm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<float> *c_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::chemm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m),
+                        mkl_int(n), (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
+                        mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                        (const MKL_Complex8 *)&beta_, c_ptr, mkl_int(ldc));
+            });
     });
 }
 
@@ -143,6 +365,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zhemm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -150,31 +373,31 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-        });
+        host_task_output<class mkl_kernel_zhemm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<double> *c_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m),
+                        mkl_int(n), (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
+                        mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                        (const MKL_Complex16 *)&beta_, c_ptr, mkl_int(ldc));
+            });
     });
 }
 
 void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           float alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, float beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cherk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cherk>(cgh, [=]() {
-            ::cherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const float *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::cherk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const float *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    (const float *)&beta, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -182,16 +405,16 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           double alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, double beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zherk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zherk>(cgh, [=]() {
-            ::zherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const double *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::zherk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const double *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    (const double *)&beta, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -200,6 +423,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, float beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "cher2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -209,10 +433,10 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_cher2k>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const float *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+            ::cher2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const float *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -221,6 +445,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
            std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
            cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, double beta,
            cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zher2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -230,10 +455,10 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_zher2k>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const double *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+            ::zher2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const double *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -241,17 +466,17 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
           int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "ssymm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymm>(cgh, [=]() {
-            ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const float *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const float *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+        host_task_output<class mkl_kernel_ssymm>(cgh, c, beta, m, n, ldc, [=](float *c_ptr) {
+            ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const float *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb), (const float *)&beta, c_ptr,
+                    mkl_int(ldc));
         });
     });
 }
@@ -259,17 +484,17 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
 void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
           int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "dsymm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymm>(cgh, [=]() {
-            ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const double *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const double *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+        host_task_output<class mkl_kernel_dsymm>(cgh, c, beta, m, n, ldc, [=](double *c_ptr) {
+            ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const double *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb), (const double *)&beta, c_ptr,
+                    mkl_int(ldc));
         });
     });
 }
@@ -278,6 +503,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "csymm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -285,15 +511,15 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csymm>(cgh, [=]() {
-            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-        });
+        host_task_output<class mkl_kernel_csymm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<float> *c_ptr) {
+                MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex8 beta_ = { beta_real, beta_imag };
+                ::csymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m),
+                        mkl_int(n), (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
+                        mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                        (const MKL_Complex8 *)&beta_, c_ptr, mkl_int(ldc));
+            });
     });
 }
 
@@ -301,6 +527,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zsymm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -308,31 +535,31 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsymm>(cgh, [=]() {
-            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                    (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
-        });
+        host_task_output<class mkl_kernel_zsymm>(
+            cgh, c, beta, m, n, ldc, [=](std::complex<double> *c_ptr) {
+                MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+                MKL_Complex16 beta_ = { beta_real, beta_imag };
+                ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m),
+                        mkl_int(n), (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
+                        mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb),
+                        (const MKL_Complex16 *)&beta_, c_ptr, mkl_int(ldc));
+            });
     });
 }
 
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, float beta,
           cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "ssyrk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ssyrk>(cgh, [=]() {
-            ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const float *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const float *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    (const float *)&beta, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -340,16 +567,16 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, double beta,
           cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "dsyrk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dsyrk>(cgh, [=]() {
-            ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const double *)&beta, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const double *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                    (const double *)&beta, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -357,6 +584,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "csyrk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -367,10 +595,9 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         host_task<class mkl_kernel_csyrk>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::csyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -378,6 +605,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zsyrk", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -388,10 +616,9 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         host_task<class mkl_kernel_zsyrk>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
-                    (const MKL_INT *)&lda, (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(),
-                    (const MKL_INT *)&ldc);
+            ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -399,6 +626,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
            float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
            int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "ssyr2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -406,10 +634,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_ssyr2k>(cgh, [=]() {
-            ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const float *)&alpha, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const float *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+            ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const float *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const float *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -418,6 +646,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
            double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
            cl::sycl::buffer<double, 1> &b, int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
            int64_t ldc) {
+    const perf_call call(queue, "dsyr2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -425,10 +654,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dsyr2k>(cgh, [=]() {
-            ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const double *)&alpha, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const double *)&beta, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+            ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const double *)&alpha, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const double *)&beta,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -437,6 +666,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
            std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "csyr2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -448,10 +678,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         host_task<class mkl_kernel_csyr2k>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const MKL_Complex8 *)&beta_, accessor_c.get_pointer(), (const MKL_INT *)&ldc);
+            ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const MKL_Complex8 *)&beta_,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -460,6 +690,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
            std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
            cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
            cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const perf_call call(queue, "zsyr2k", 0, n, k);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
@@ -471,11 +702,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         host_task<class mkl_kernel_zsyr2k>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(),
-                     (const MKL_INT *)&lda, accessor_b.get_pointer(), (const MKL_INT *)&ldb,
-                     (const MKL_Complex16 *)&beta_, accessor_c.get_pointer(),
-                     (const MKL_INT *)&ldc);
+            ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                     accessor_b.get_pointer(), mkl_int(ldb), (const MKL_Complex16 *)&beta_,
+                     accessor_c.get_pointer(), mkl_int(ldc));
         });
     });
 }
@@ -483,6 +713,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "strmm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -492,9 +723,8 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_strmm>(cgh, [=]() {
             ::strmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const float *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -502,6 +732,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "dtrmm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -511,9 +742,8 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtrmm>(cgh, [=]() {
             ::dtrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const double *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -522,6 +752,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "ctrmm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -533,9 +764,9 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         host_task<class mkl_kernel_ctrmm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -544,6 +775,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "ztrmm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -555,9 +787,9 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         host_task<class mkl_kernel_ztrmm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -565,6 +797,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "strsm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -574,9 +807,8 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_strsm>(cgh, [=]() {
             ::strsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const float *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -584,6 +816,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "dtrsm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -593,9 +826,8 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class mkl_kernel_dtrsm>(cgh, [=]() {
             ::dtrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const double *)&alpha,
+                    accessor_a.get_pointer(), mkl_int(lda), accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -604,6 +836,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "ctrsm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -615,9 +848,9 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         host_task<class mkl_kernel_ctrsm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb));
         });
     });
 }
@@ -626,6 +859,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    const perf_call call(queue, "ztrsm", m, n, 0);
     queue.submit([&](cl::sycl::handler &cgh) {
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
@@ -637,9 +871,109 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         host_task<class mkl_kernel_ztrsm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), (const MKL_INT *)&lda,
-                    accessor_b.get_pointer(), (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer(), mkl_int(lda),
+                    accessor_b.get_pointer(), mkl_int(ldb));
+        });
+    });
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t offset_b,
+          int64_t ldb) {
+    const int64_t order_a = (left_right == side::left) ? m : n;
+    check_offset(a, offset_a, matrix_span(order_a, order_a, lda), "a");
+    check_offset(b, offset_b, matrix_span(m, n, ldb), "b");
+    const perf_call call(queue, "strsm_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char left_right_ = *fortran_char(left_right);
+        const char upper_lower_ = *fortran_char(upper_lower);
+        const char transa_ = *fortran_char(transa);
+        const char unit_diag_ = *fortran_char(unit_diag);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_strsm_offset>(cgh, [=]() {
+            ::strsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const float *)&alpha,
+                    accessor_a.get_pointer() + offset_a, mkl_int(lda),
+                    accessor_b.get_pointer() + offset_b, mkl_int(ldb));
+        });
+    });
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+          int64_t offset_a, int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t offset_b,
+          int64_t ldb) {
+    const int64_t order_a = (left_right == side::left) ? m : n;
+    check_offset(a, offset_a, matrix_span(order_a, order_a, lda), "a");
+    check_offset(b, offset_b, matrix_span(m, n, ldb), "b");
+    const perf_call call(queue, "dtrsm_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char left_right_ = *fortran_char(left_right);
+        const char upper_lower_ = *fortran_char(upper_lower);
+        const char transa_ = *fortran_char(transa);
+        const char unit_diag_ = *fortran_char(unit_diag);
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dtrsm_offset>(cgh, [=]() {
+            ::dtrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const double *)&alpha,
+                    accessor_a.get_pointer() + offset_a, mkl_int(lda),
+                    accessor_b.get_pointer() + offset_b, mkl_int(ldb));
+        });
+    });
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, int64_t offset_b, int64_t ldb) {
+    const int64_t order_a = (left_right == side::left) ? m : n;
+    check_offset(a, offset_a, matrix_span(order_a, order_a, lda), "a");
+    check_offset(b, offset_b, matrix_span(m, n, ldb), "b");
+    const perf_call call(queue, "ctrsm_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char left_right_ = *fortran_char(left_right);
+        const char upper_lower_ = *fortran_char(upper_lower);
+        const char transa_ = *fortran_char(transa);
+        const char unit_diag_ = *fortran_char(unit_diag);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ctrsm_offset>(cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            ::ctrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, accessor_a.get_pointer() + offset_a,
+                    mkl_int(lda), accessor_b.get_pointer() + offset_b, mkl_int(ldb));
+        });
+    });
+}
+
+void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
+          diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, int64_t offset_a, int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, int64_t offset_b, int64_t ldb) {
+    const int64_t order_a = (left_right == side::left) ? m : n;
+    check_offset(a, offset_a, matrix_span(order_a, order_a, lda), "a");
+    check_offset(b, offset_b, matrix_span(m, n, ldb), "b");
+    const perf_call call(queue, "ztrsm_offset", m, n, 0);
+    queue.submit([&](cl::sycl::handler &cgh) {
+        const char left_right_ = *fortran_char(left_right);
+        const char upper_lower_ = *fortran_char(upper_lower);
+        const char transa_ = *fortran_char(transa);
+        const char unit_diag_ = *fortran_char(unit_diag);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_ztrsm_offset>(cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            ::ztrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, accessor_a.get_pointer() + offset_a,
+                    mkl_int(lda), accessor_b.get_pointer() + offset_b, mkl_int(ldb));
         });
     });
 }
@@ -650,42 +984,52 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemm_usm", m, n, k);
+    const int64_t cutoff = strassen_cutoff(queue, m, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         host_task<class mkl_kernel_sgemm_usm>(cgh, [=]() {
-            ::sgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const float *)&alpha, a,
-                    (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const float *)&beta, c,
-                    (const MKL_INT *)&ldc);
+            if (cutoff >= 0) {
+                run_strassen(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             cutoff);
+                return;
+            }
+            if (split_k_gemm(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc))
+                return;
+            const local_threads threads(tuned_gemm_threads(m, n, k));
+            blas64::gemm(::sgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const float *)&alpha, a, lda, b, ldb, (const float *)&beta, c, ldc);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
                      int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                      const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemm_usm", m, n, k);
+    const int64_t cutoff = strassen_cutoff(queue, m, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         host_task<class mkl_kernel_dgemm_usm>(cgh, [=]() {
-            ::dgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const double *)&alpha, a,
-                    (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const double *)&beta, c,
-                    (const MKL_INT *)&ldc);
+            if (cutoff >= 0) {
+                run_strassen(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             cutoff);
+                return;
+            }
+            if (split_k_gemm(transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc))
+                return;
+            const local_threads threads(tuned_gemm_threads(m, n, k));
+            blas64::gemm(::dgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const double *)&alpha, a, lda, b, ldb, (const double *)&beta, c, ldc);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -693,11 +1037,9 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm_usm", m, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -705,13 +1047,12 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         host_task<class mkl_kernel_cgemm_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::cgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a,
-                    (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_,
-                    c, (const MKL_INT *)&ldc);
+            blas64::gemm(::cgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const MKL_Complex8 *)&alpha_, a, lda, b, ldb,
+                         (const MKL_Complex8 *)&beta_, c, ldc);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -719,11 +1060,9 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                      int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm_usm", m, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char transa_ = *fortran_char(transa);
         const char transb_ = *fortran_char(transb);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -731,13 +1070,82 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         host_task<class mkl_kernel_zgemm_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zgemm((const char *)&transa_, (const char *)&transb_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a,
-                    (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_,
-                    c, (const MKL_INT *)&ldc);
+            blas64::gemm(::zgemm, (const char *)&transa_, (const char *)&transb_, m, n, k,
+                         (const MKL_Complex16 *)&alpha_, a, lda, b, ldb,
+                         (const MKL_Complex16 *)&beta_, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const float *alpha, const float *a, int64_t lda,
+                     const float *b, int64_t ldb, const float *beta, float *c, int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "sgemm_device_scalar_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_sgemm_device_scalar_usm>(cgh, [=]() {
+            blas64::gemm(::sgemm, (const char *)&transa_, (const char *)&transb_, m, n, k, alpha, a,
+                         lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const double *alpha, const double *a, int64_t lda,
+                     const double *b, int64_t ldb, const double *beta, double *c, int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dgemm_device_scalar_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_dgemm_device_scalar_usm>(cgh, [=]() {
+            blas64::gemm(::dgemm, (const char *)&transa_, (const char *)&transb_, m, n, k, alpha, a,
+                         lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const std::complex<float> *alpha,
+                     const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                     int64_t ldb, const std::complex<float> *beta, std::complex<float> *c,
+                     int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cgemm_device_scalar_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_cgemm_device_scalar_usm>(cgh, [=]() {
+            blas64::gemm(::cgemm, (const char *)&transa_, (const char *)&transb_, m, n, k, alpha, a,
+                         lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return record_submission(queue, done);
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, const std::complex<double> *alpha,
+                     const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                     int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+                     int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zgemm_device_scalar_usm", m, n, k);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        depends_on_events(cgh, queue, dependencies);
+        const char transa_ = *fortran_char(transa);
+        const char transb_ = *fortran_char(transb);
+        host_task<class mkl_kernel_zgemm_device_scalar_usm>(cgh, [=]() {
+            blas64::gemm(::zgemm, (const char *)&transa_, (const char *)&transb_, m, n, k, alpha, a,
+                         lda, b, ldb, beta, c, ldc);
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
@@ -745,11 +1153,9 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "chemm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -757,12 +1163,12 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_chemm_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::chemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_, c, (const MKL_INT *)&ldc);
+            ::chemm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                    (const MKL_Complex8 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
@@ -770,11 +1176,9 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zhemm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -782,53 +1186,47 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_zhemm_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
-                    b, (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_, c,
-                    (const MKL_INT *)&ldc);
+            ::zhemm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                    (const MKL_Complex16 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, float alpha, const std::complex<float> *a, int64_t lda, float beta,
                      std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cherk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_cherk_usm>(cgh, [=]() {
-            ::cherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda,
-                    (const float *)&beta, c, (const MKL_INT *)&ldc);
+            ::cherk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const float *)&alpha, a, mkl_int(lda), (const float *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, double alpha, const std::complex<double> *a, int64_t lda,
                      double beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zherk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_zherk_usm>(cgh, [=]() {
-            ::zherk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda,
-                    (const double *)&beta, c, (const MKL_INT *)&ldc);
+            ::zherk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const double *)&alpha, a, mkl_int(lda), (const double *)&beta, c,
+                    mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -836,22 +1234,20 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<float> *b, int64_t ldb, float beta,
                       std::complex<float> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "cher2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_cher2k_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
-            ::cher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda,
-                     b, (const MKL_INT *)&ldb, (const float *)&beta, c, (const MKL_INT *)&ldc);
+            ::cher2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                     (const float *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -859,62 +1255,56 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<double> *b, int64_t ldb, double beta,
                       std::complex<double> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zher2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         host_task<class mkl_kernel_zher2k_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
-            ::zher2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
-                     b, (const MKL_INT *)&ldb, (const double *)&beta, c, (const MKL_INT *)&ldc);
+            ::zher2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                     (const double *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
                      int64_t n, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssymm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_ssymm_usm>(cgh, [=]() {
-            ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const float *)&alpha, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb, (const float *)&beta, c, (const MKL_INT *)&ldc);
+            ::ssymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const float *)&alpha, a, mkl_int(lda), b, mkl_int(ldb), (const float *)&beta,
+                    c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
                      int64_t n, double alpha, const double *a, int64_t lda, const double *b,
                      int64_t ldb, double beta, double *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsymm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         host_task<class mkl_kernel_dsymm_usm>(cgh, [=]() {
-            ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const double *)&alpha, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb, (const double *)&beta, c, (const MKL_INT *)&ldc);
+            ::dsymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const double *)&alpha, a, mkl_int(lda), b, mkl_int(ldb), (const double *)&beta,
+                    c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
@@ -922,11 +1312,9 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csymm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -934,12 +1322,12 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_csymm_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_, c, (const MKL_INT *)&ldc);
+            ::csymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                    (const MKL_Complex8 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
@@ -947,11 +1335,9 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zsymm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -959,62 +1345,54 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_zsymm_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, (const MKL_INT *)&m,
-                    (const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
-                    b, (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_, c,
-                    (const MKL_INT *)&ldc);
+            ::zsymm((const char *)&left_right_, (const char *)&upper_lower_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                    (const MKL_Complex16 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
                      int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssyrk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_ssyrk_usm>(cgh, [=]() {
-            ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda,
-                    (const float *)&beta, c, (const MKL_INT *)&ldc);
+            ::ssyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const float *)&alpha, a, mkl_int(lda), (const float *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
                      int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsyrk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_dsyrk_usm>(cgh, [=]() {
-            ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda,
-                    (const double *)&beta, c, (const MKL_INT *)&ldc);
+            ::dsyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const double *)&alpha, a, mkl_int(lda), (const double *)&beta, c,
+                    mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
                      int64_t lda, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csyrk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -1022,23 +1400,21 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         host_task<class mkl_kernel_csyrk_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda,
-                    (const MKL_Complex8 *)&beta_, c, (const MKL_INT *)&ldc);
+            ::csyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), (const MKL_Complex8 *)&beta_, c,
+                    mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
                      int64_t lda, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zsyrk_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -1046,52 +1422,48 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         host_task<class mkl_kernel_zsyrk_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                    (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
-                    (const MKL_Complex16 *)&beta_, c, (const MKL_INT *)&ldc);
+            ::zsyrk((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), (const MKL_Complex16 *)&beta_,
+                    c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                       int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                       int64_t ldb, float beta, float *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ssyr2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_ssyr2k_usm>(cgh, [=]() {
-            ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const float *)&alpha, a, (const MKL_INT *)&lda, b,
-                     (const MKL_INT *)&ldb, (const float *)&beta, c, (const MKL_INT *)&ldc);
+            ::ssyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const float *)&alpha, a, mkl_int(lda), b, mkl_int(ldb), (const float *)&beta,
+                     c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                       int64_t k, double alpha, const double *a, int64_t lda, const double *b,
                       int64_t ldb, double beta, double *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dsyr2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         host_task<class mkl_kernel_dsyr2k_usm>(cgh, [=]() {
-            ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const double *)&alpha, a, (const MKL_INT *)&lda, b,
-                     (const MKL_INT *)&ldb, (const double *)&beta, c, (const MKL_INT *)&ldc);
+            ::dsyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const double *)&alpha, a, mkl_int(lda), b, mkl_int(ldb),
+                     (const double *)&beta, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1099,11 +1471,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<float> *b, int64_t ldb,
                       std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "csyr2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -1111,13 +1481,12 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         host_task<class mkl_kernel_csyr2k_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
-            ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda,
-                     b, (const MKL_INT *)&ldb, (const MKL_Complex8 *)&beta_, c,
-                     (const MKL_INT *)&ldc);
+            ::csyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                     (const MKL_Complex8 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1125,11 +1494,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<double> *b, int64_t ldb,
                       std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "zsyr2k_usm", 0, n, k);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char trans_ = *fortran_char(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
@@ -1137,68 +1504,61 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         host_task<class mkl_kernel_zsyr2k_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
-            ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, (const MKL_INT *)&n,
-                     (const MKL_INT *)&k, (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda,
-                     b, (const MKL_INT *)&ldb, (const MKL_Complex16 *)&beta_, c,
-                     (const MKL_INT *)&ldc);
+            ::zsyr2k((const char *)&upper_lower_, (const char *)&trans_, mkl_int(n), mkl_int(k),
+                     (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb),
+                     (const MKL_Complex16 *)&beta_, c, mkl_int(ldc));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "strmm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_strmm_usm>(cgh, [=]() {
             ::strmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const float *)&alpha, a,
+                    mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtrmm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtrmm_usm>(cgh, [=]() {
             ::dtrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const double *)&alpha, a,
+                    mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctrmm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1207,23 +1567,20 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_ctrmm_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztrmm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1232,67 +1589,60 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_ztrmm_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrmm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "strsm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_strsm_usm>(cgh, [=]() {
             ::strsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const float *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const float *)&alpha, a,
+                    mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "dtrsm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
         const char unit_diag_ = *fortran_char(unit_diag);
         host_task<class mkl_kernel_dtrsm_usm>(cgh, [=]() {
             ::dtrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const double *)&alpha, a, (const MKL_INT *)&lda, b, (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n), (const double *)&alpha, a,
+                    mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ctrsm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1301,23 +1651,20 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_ctrsm_usm>(cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::ctrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex8 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex8 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const perf_call call(queue, "ztrsm_usm", m, n, 0);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
+        depends_on_events(cgh, queue, dependencies);
         const char left_right_ = *fortran_char(left_right);
         const char upper_lower_ = *fortran_char(upper_lower);
         const char transa_ = *fortran_char(transa);
@@ -1326,12 +1673,11 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         host_task<class mkl_kernel_ztrsm_usm>(cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::ztrsm((const char *)&left_right_, (const char *)&upper_lower_, (const char *)&transa_,
-                    (const char *)&unit_diag_, (const MKL_INT *)&m, (const MKL_INT *)&n,
-                    (const MKL_Complex16 *)&alpha_, a, (const MKL_INT *)&lda, b,
-                    (const MKL_INT *)&ldb);
+                    (const char *)&unit_diag_, mkl_int(m), mkl_int(n),
+                    (const MKL_Complex16 *)&alpha_, a, mkl_int(lda), b, mkl_int(ldb));
         });
     });
-    return done;
+    return record_submission(queue, done);
 }
 
 } // namespace mklcpu
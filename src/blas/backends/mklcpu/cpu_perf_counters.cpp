@@ -0,0 +1,240 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <CL/sycl.hpp>
+
+#include "cpu_perf_counters.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+namespace {
+
+const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point from,
+                    std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+}
+
+#ifdef __linux__
+// Cycles, instructions and cache misses, which the kernel maps to the
+//  last-level cache, counted in user mode so that perf_event_paranoid 2, the
+//  usual default, allows them on the threads of the process.
+const uint64_t event_configs[3] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                    PERF_COUNT_HW_CACHE_MISSES };
+
+// Set once perf_event_open has failed for every event, as it then fails on
+//  every thread, so that no thread tries again.
+std::atomic<bool> events_unavailable{ false };
+
+// The event group of the calling thread. The first event that opens leads
+//  the group, and the others join it, so that one read of the leader
+//  returns all counts, taken over the same time.
+class thread_events {
+public:
+    thread_events() {
+        for (int e = 0; e < 3; e++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = event_configs[e];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+            const int fd = int(
+                ::syscall(SYS_perf_event_open, &attr, 0, -1, leader_, PERF_FLAG_FD_CLOEXEC));
+            if (fd < 0)
+                continue;
+            if (leader_ < 0)
+                leader_ = fd;
+            else
+                members_[num_members_] = fd;
+            slots_[e] = num_members_++;
+        }
+        if (leader_ < 0)
+            events_unavailable = true;
+    }
+
+    ~thread_events() {
+        for (int i = 1; i < num_members_; i++)
+            ::close(members_[i]);
+        if (leader_ >= 0)
+            ::close(leader_);
+    }
+
+    // Reads the group into counts, scaled up for the time it was
+    //  multiplexed out, leaving -1 for the events that did not open.
+    void read(int64_t counts[3]) const {
+        uint64_t values[3 + 3];
+        const ssize_t size = ssize_t(sizeof(uint64_t) * (3 + num_members_));
+        if (leader_ < 0 || ::read(leader_, values, size) != size)
+            return;
+        const uint64_t enabled = values[1], running = values[2];
+        for (int e = 0; e < 3; e++) {
+            if (slots_[e] < 0)
+                continue;
+            const uint64_t count = values[3 + slots_[e]];
+            counts[e] = (running == 0 || running >= enabled)
+                            ? int64_t(count)
+                            : int64_t(double(count) * double(enabled) / double(running));
+        }
+    }
+
+private:
+    int leader_ = -1;
+    int members_[3] = { -1, -1, -1 };
+    int num_members_ = 0;
+    int slots_[3] = { -1, -1, -1 };
+};
+#endif
+
+// The file named by ONEMKL_CPU_PERF_COUNTERS, written a line per record as
+//  tasks complete. It is never destroyed, so that tasks completing during
+//  static destruction can still write to it.
+class perf_csv {
+public:
+    perf_csv() {
+        const char *path = std::getenv("ONEMKL_CPU_PERF_COUNTERS");
+        if (path && *path) {
+            out_.open(path);
+            blas::write_perf_counters_csv_header(out_);
+            out_.flush();
+        }
+    }
+
+    bool enabled() const {
+        return out_.is_open();
+    }
+
+    void write(const blas::perf_counter_record &record) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blas::write_perf_counters_csv_line(out_, record);
+        out_.flush();
+    }
+
+    static perf_csv &instance() {
+        static perf_csv *csv = new perf_csv;
+        return *csv;
+    }
+
+private:
+    std::mutex mutex_;
+    std::ofstream out_;
+};
+
+} // namespace
+
+bool perf_counters_csv_enabled() {
+    static const bool enabled = perf_csv::instance().enabled();
+    return enabled;
+}
+
+perf_reading read_perf_counters() {
+    perf_reading reading = { std::chrono::steady_clock::now(), -1, -1, -1 };
+#ifdef __linux__
+    if (!events_unavailable.load()) {
+        thread_local thread_events events;
+        int64_t counts[3] = { -1, -1, -1 };
+        events.read(counts);
+        reading.cycles = counts[0];
+        reading.instructions = counts[1];
+        reading.llc_misses = counts[2];
+    }
+#endif
+    return reading;
+}
+
+void append_perf_record(const perf_call_info &call, const perf_reading &before) {
+    const perf_reading after = read_perf_counters();
+    auto delta = [](int64_t from, int64_t to) { return (from < 0 || to < 0) ? -1 : to - from; };
+    blas::perf_counter_record record;
+    record.routine = call.routine;
+    record.m = call.shape.m;
+    record.n = call.shape.n;
+    record.k = call.shape.k;
+    record.batch = call.shape.batch;
+    record.start_ns = elapsed_ns(start_time, before.time);
+    record.duration_ns = elapsed_ns(before.time, after.time);
+    record.cycles = delta(before.cycles, after.cycles);
+    record.instructions = delta(before.instructions, after.instructions);
+    record.llc_misses = delta(before.llc_misses, after.llc_misses);
+    record.memory_bytes = (record.llc_misses < 0) ? -1 : record.llc_misses * 64;
+
+    if (perf_counters_csv_enabled())
+        perf_csv::instance().write(record);
+    if (call.sink) {
+        std::lock_guard<std::mutex> lock(call.sink->mutex);
+        if (call.sink->records.size() == perf_sink::max_records)
+            call.sink->records.pop_front();
+        call.sink->records.push_back(record);
+    }
+}
+
+// Performance counters
+
+void set_perf_counters(cl::sycl::queue &queue, bool enable) {
+    queue_settings_registry::instance().update(queue, [&](queue_settings &settings) {
+        settings.perf_counters = enable;
+        if (enable && !settings.perf_records) {
+            settings.perf_records = std::make_shared<perf_sink>();
+        }
+        else if (!enable && settings.perf_records) {
+            std::lock_guard<std::mutex> lock(settings.perf_records->mutex);
+            if (settings.perf_records->records.empty())
+                settings.perf_records.reset();
+        }
+    });
+}
+
+std::vector<blas::perf_counter_record> get_perf_counters(cl::sycl::queue &queue) {
+    std::vector<blas::perf_counter_record> records;
+    queue_settings_registry::instance().update(queue, [&](queue_settings &settings) {
+        if (!settings.perf_records)
+            return;
+        {
+            perf_sink &sink = *settings.perf_records;
+            std::lock_guard<std::mutex> lock(sink.mutex);
+            records.assign(sink.records.begin(), sink.records.end());
+            sink.records.clear();
+        }
+        if (!settings.perf_counters)
+            settings.perf_records.reset();
+    });
+    return records;
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
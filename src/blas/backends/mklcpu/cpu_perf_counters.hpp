@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_PERF_COUNTERS_HPP_
+#define _MKL_BLAS_CPU_PERF_COUNTERS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "cpu_queue_settings.hpp"
+#include "mkl_service.h"
+#include "oneapi/mkl/blas/perf_counters.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Hardware counters around host tasks, turned on per queue by
+//  set_perf_counters, or for every queue by ONEMKL_CPU_PERF_COUNTERS, which
+//  names a CSV file the records are appended to as tasks complete.
+//
+//  Each entry point opens a perf_call with its queue, name and shape.
+//  host_task then wraps the tasks submitted under it, when their queue has
+//  counters on, in two readings of the counters and appends a record to the
+//  queue's sink. Counters are one Linux perf event group per thread running
+//  tasks, opened on its first counted task and read in a single system
+//  call. As they only cover that thread, counted tasks run on it alone:
+//  MKL is limited to one thread for them, and split_k_parallel runs its
+//  items in turn. Without perf events, as under the default seccomp profile
+//  of most container runtimes, records still carry the routine, shape and
+//  time, with -1 counters.
+struct perf_shape {
+    int64_t m, n, k, batch;
+};
+
+// The records of one queue not yet taken by get_perf_counters, oldest first.
+//  Only the last max_records are kept. Pending tasks hold their sink, so it
+//  outlives set_perf_counters(queue, false).
+struct perf_sink {
+    static constexpr std::size_t max_records = 65536;
+
+    std::mutex mutex;
+    std::deque<blas::perf_counter_record> records;
+};
+
+struct perf_reading {
+    std::chrono::steady_clock::time_point time;
+    int64_t cycles, instructions, llc_misses;
+};
+
+struct perf_call_info {
+    std::shared_ptr<perf_sink> sink;
+    const char *routine;
+    perf_shape shape;
+};
+
+// Whether ONEMKL_CPU_PERF_COUNTERS names a CSV file for every record.
+bool perf_counters_csv_enabled();
+
+// The counters of the calling thread.
+perf_reading read_perf_counters();
+
+// Appends the record of a task of call that started at before to the sink
+//  of call and to the CSV file.
+void append_perf_record(const perf_call_info &call, const perf_reading &before);
+
+// Marks the calling thread as submitting a call of routine, a string literal
+//  such as "sgemm_usm", on queue with the given shape, for the tasks
+//  host_task submits until it goes out of scope.
+class perf_call {
+public:
+    perf_call(const cl::sycl::queue &queue, const char *routine, int64_t m, int64_t n, int64_t k,
+              int64_t batch = 0)
+            : previous_(current()) {
+        const queue_settings settings = get_queue_settings(queue);
+        info_ = { settings.perf_counters ? settings.perf_records : nullptr, routine,
+                  { m, n, k, batch } };
+        const bool counted = info_.sink || perf_counters_csv_enabled();
+        current() = counted ? &info_ : nullptr;
+    }
+    perf_call(const perf_call &) = delete;
+    perf_call &operator=(const perf_call &) = delete;
+    ~perf_call() {
+        current() = previous_;
+    }
+
+    static const perf_call_info *&current() {
+        thread_local const perf_call_info *call = nullptr;
+        return call;
+    }
+
+private:
+    const perf_call_info *previous_;
+    perf_call_info info_;
+};
+
+// Whether the calling thread is running a counted task.
+inline bool &counting_thread() {
+    thread_local bool counting = false;
+    return counting;
+}
+
+template <typename F>
+void run_counted(const perf_call_info &call, F &f) {
+    const int previous_threads = mkl_set_num_threads_local(1);
+    const bool previous_counting = counting_thread();
+    counting_thread() = true;
+    const perf_reading before = read_perf_counters();
+    try {
+        f();
+    }
+    catch (...) {
+        counting_thread() = previous_counting;
+        mkl_set_num_threads_local(previous_threads);
+        throw;
+    }
+    append_perf_record(call, before);
+    counting_thread() = previous_counting;
+    mkl_set_num_threads_local(previous_threads);
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_PERF_COUNTERS_HPP_
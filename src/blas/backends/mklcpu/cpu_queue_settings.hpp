@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_QUEUE_SETTINGS_HPP_
+#define _MKL_BLAS_CPU_QUEUE_SETTINGS_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+struct perf_sink;
+
+// Settings the backend keeps for each queue. The perf_sink of a queue is kept
+//  after its counters are turned off, until its records are taken.
+struct queue_settings {
+    gemm_algorithm algorithm = gemm_algorithm::standard;
+    int64_t strassen_cutoff = 0;
+    reproducibility reproducibility_mode = reproducibility::off;
+    bool perf_counters = false;
+    std::shared_ptr<perf_sink> perf_records;
+
+    bool is_default() const {
+        return algorithm == gemm_algorithm::standard &&
+               reproducibility_mode == reproducibility::off && !perf_counters && !perf_records;
+    }
+};
+
+// Only queues with settings other than the defaults are kept, so that calls
+//  on any other queue only pay for an atomic load. Entries are dropped once
+//  an update brings them back to the defaults.
+class queue_settings_registry {
+public:
+    queue_settings get(const cl::sycl::queue &queue) {
+        if (num_entries_.load() == 0)
+            return queue_settings();
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = find(queue);
+        return (it != entries_.end()) ? it->settings : queue_settings();
+    }
+
+    // Applies f to the settings of queue under the registry lock.
+    template <typename F>
+    void update(const cl::sycl::queue &queue, F f) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = find(queue);
+        if (it == entries_.end())
+            it = entries_.insert(entries_.end(), entry{ queue, queue_settings() });
+        f(it->settings);
+        if (it->settings.is_default())
+            entries_.erase(it);
+        num_entries_ = entries_.size();
+    }
+
+    // The registry is never destroyed, so that no queue is released during
+    //  static destruction.
+    static queue_settings_registry &instance() {
+        static queue_settings_registry *registry = new queue_settings_registry;
+        return *registry;
+    }
+
+private:
+    struct entry {
+        cl::sycl::queue queue;
+        queue_settings settings;
+    };
+
+    std::vector<entry>::iterator find(const cl::sycl::queue &queue) {
+        return std::find_if(entries_.begin(), entries_.end(),
+                            [&queue](const entry &e) { return e.queue == queue; });
+    }
+
+    std::mutex mutex_;
+    std::vector<entry> entries_;
+    std::atomic<std::size_t> num_entries_{ 0 };
+};
+
+inline queue_settings get_queue_settings(const cl::sycl::queue &queue) {
+    return queue_settings_registry::instance().get(queue);
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_QUEUE_SETTINGS_HPP_
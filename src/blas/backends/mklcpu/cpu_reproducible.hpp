@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_REPRODUCIBLE_HPP_
+#define _MKL_BLAS_CPU_REPRODUCIBLE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "cpu_blas64.hpp"
+#include "cpu_common.hpp"
+#include "cpu_split_k.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+inline reproducibility get_reproducibility(const cl::sycl::queue &queue) {
+    return get_queue_settings(queue).reproducibility_mode;
+}
+
+// Reductions whose result does not depend on the number of threads. The
+//  vector is cut into blocks of block_size elements, fixed by n alone, that
+//  are reduced in parallel, each on one thread, and the block results are
+//  then combined pairwise along a fixed binary tree.
+//
+//  With reproducibility::on the blocks go to single-threaded MKL, whose
+//  kernels return the same result for the same data at the same alignment on
+//  the same machine, as MKL_CBWR_AUTO does. With reproducibility::strict they
+//  are plain loops into eight interleaved accumulators, added up in a fixed
+//  order, so that alignment and instruction set no longer matter either, as
+//  with MKL_CBWR_STRICT. Mode off, and the cases BLAS defines as trivial, go
+//  to blas64 unchanged.
+namespace cnr {
+
+constexpr int64_t block_size = 8192;
+constexpr int lanes = 8;
+
+template <typename R, typename B, typename C>
+R reduce(int64_t n, B block, C combine) {
+    const int64_t num_blocks = (n + block_size - 1) / block_size;
+    std::vector<R> partials(num_blocks);
+    split_k_parallel(num_blocks, std::min<int64_t>(num_blocks, mkl_get_max_threads()),
+                     [&](int64_t i) {
+                         const int64_t begin = i * block_size;
+                         partials[i] = block(begin, std::min(block_size, n - begin));
+                     });
+    for (int64_t step = 1; step < num_blocks; step *= 2) {
+        for (int64_t i = 0; i + step < num_blocks; i += 2 * step)
+            partials[i] = combine(partials[i], partials[i + step]);
+    }
+    return partials[0];
+}
+
+// Element j of a count-element block starting at x, stored as blas64 stores
+//  chunks.
+template <typename T>
+const T &element(const T *x, int64_t j, int64_t count, int64_t inc) {
+    return x[(inc >= 0) ? j * inc : (count - 1 - j) * -inc];
+}
+
+// Sums term(0), ..., term(count - 1), term(j) going to accumulator j % lanes.
+template <typename R, typename F>
+R lane_sum(int64_t count, F term) {
+    R acc[lanes];
+    std::fill(acc, acc + lanes, R(0));
+    int64_t j = 0;
+    for (; j + lanes <= count; j += lanes) {
+        for (int l = 0; l < lanes; l++)
+            acc[l] += term(j + l);
+    }
+    for (int l = 0; j < count; j++, l++)
+        acc[l] += term(j);
+    for (int width = lanes / 2; width > 0; width /= 2) {
+        for (int l = 0; l < width; l++)
+            acc[l] += acc[l + width];
+    }
+    return acc[0];
+}
+
+template <typename R, typename T>
+R dot(reproducibility mode,
+      R (*f)(const MKL_INT *, const T *, const MKL_INT *, const T *, const MKL_INT *), int64_t n,
+      blas64::same<const T *> x, int64_t incx, blas64::same<const T *> y, int64_t incy) {
+    if (mode == reproducibility::off || n <= 0)
+        return blas64::dot(f, n, x, incx, y, incy);
+    return reduce<R>(
+        n,
+        [&](int64_t begin, int64_t count) {
+            const T *x_block = x + blas64::offset(begin, count, n, incx);
+            const T *y_block = y + blas64::offset(begin, count, n, incy);
+            if (mode == reproducibility::on)
+                return f(mkl_int(count), x_block, mkl_int(incx), y_block, mkl_int(incy));
+            return lane_sum<R>(count, [&](int64_t j) {
+                return R(element(x_block, j, count, incx)) * R(element(y_block, j, count, incy));
+            });
+        },
+        std::plus<R>());
+}
+
+// sdsdot accumulates in double throughout: its blocks are dsdot products.
+inline float sdsdot(reproducibility mode,
+                    float (*f)(const MKL_INT *, const float *, const float *, const MKL_INT *,
+                               const float *, const MKL_INT *),
+                    int64_t n, const float *sb, const float *x, int64_t incx, const float *y,
+                    int64_t incy) {
+    if (mode == reproducibility::off || n <= 0)
+        return blas64::sdsdot(f, n, sb, x, incx, y, incy);
+    return float(double(*sb) + dot(mode, ::dsdot, n, x, incx, y, incy));
+}
+
+template <typename R, typename T>
+R asum(reproducibility mode, R (*f)(const MKL_INT *, const T *, const MKL_INT *), int64_t n,
+       blas64::same<const T *> x, int64_t incx) {
+    if (mode == reproducibility::off || n <= 0 || incx <= 0)
+        return blas64::asum(f, n, x, incx);
+    return reduce<R>(
+        n,
+        [&](int64_t begin, int64_t count) {
+            const T *x_block = x + blas64::offset(begin, count, n, incx);
+            if (mode == reproducibility::on)
+                return f(mkl_int(count), x_block, mkl_int(incx));
+            return lane_sum<R>(count, [&](int64_t j) {
+                return R(blas64::abs1(element(x_block, j, count, incx)));
+            });
+        },
+        std::plus<R>());
+}
+
+// The norm of a block as scale * sqrt(ssq), with ssq at least one unless
+//  the block is zero, as in the LAPACK routine lassq.
+template <typename R>
+struct scaled_ssq {
+    R scale;
+    R ssq;
+};
+
+template <typename R>
+scaled_ssq<R> combine_ssq(const scaled_ssq<R> &p, const scaled_ssq<R> &q) {
+    if (p.scale < q.scale)
+        return combine_ssq(q, p);
+    if (p.scale == R(0))
+        return p;
+    const R ratio = q.scale / p.scale;
+    return { p.scale, p.ssq + q.ssq * ratio * ratio };
+}
+
+template <typename R>
+void add_square(scaled_ssq<R> &s, R value) {
+    const R a = std::abs(value);
+    if (a == R(0))
+        return;
+    if (s.scale < a) {
+        const R ratio = s.scale / a;
+        s.ssq = R(1) + s.ssq * ratio * ratio;
+        s.scale = a;
+    }
+    else {
+        const R ratio = a / s.scale;
+        s.ssq += ratio * ratio;
+    }
+}
+
+template <typename R>
+void add_squares(scaled_ssq<R> &s, R value) {
+    add_square(s, value);
+}
+
+template <typename R>
+void add_squares(scaled_ssq<R> &s, std::complex<R> value) {
+    add_square(s, value.real());
+    add_square(s, value.imag());
+}
+
+template <typename R, typename T>
+R nrm2(reproducibility mode, R (*f)(const MKL_INT *, const T *, const MKL_INT *), int64_t n,
+       blas64::same<const T *> x, int64_t incx) {
+    if (mode == reproducibility::off || n <= 0 || incx <= 0)
+        return blas64::nrm2(f, n, x, incx);
+    const scaled_ssq<R> norm = reduce<scaled_ssq<R>>(
+        n,
+        [&](int64_t begin, int64_t count) {
+            const T *x_block = x + blas64::offset(begin, count, n, incx);
+            scaled_ssq<R> s = { R(0), R(1) };
+            if (mode == reproducibility::on) {
+                s.scale = f(mkl_int(count), x_block, mkl_int(incx));
+            }
+            else {
+                for (int64_t j = 0; j < count; j++)
+                    add_squares(s, element(x_block, j, count, incx));
+            }
+            return s;
+        },
+        combine_ssq<R>);
+    return norm.scale * std::sqrt(norm.ssq);
+}
+
+} // namespace cnr
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_REPRODUCIBLE_HPP_
@@ -0,0 +1,258 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_SPLIT_K_HPP_
+#define _MKL_BLAS_CPU_SPLIT_K_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mkl_blas.h"
+#include "mkl_service.h"
+
+#include "cpu_perf_counters.hpp"
+#include "cpu_tuning.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Split-K gemm for K-dominant shapes such as m = n = 64, k = 10^7, where MKL
+//  can only spread the small output over a few threads. K is cut into chunks
+//  whose products go to private m-by-n partial results, one thread per group
+//  of chunks, and the partials are then summed into C column by column.
+//
+//  ONEMKL_CPU_GEMM_SPLIT_K_RATIO is the smallest k / max(m, n) that triggers
+//  the split; 0 disables it. Its default, and the shortest K range worth a
+//  chunk, come from the tuning file (256 and 2048 without one).
+//  ONEMKL_CPU_GEMM_SPLIT_K_CHUNKS fixes the number of chunks. By default it
+//  follows the MKL thread count, so results can change with it; with a fixed
+//  count the partials and their summation order no longer depend on the
+//  number of threads, and results are reproducible.
+struct split_k_settings {
+    int64_t ratio;
+    int64_t chunks;
+    int64_t min_chunk;
+};
+
+inline int64_t split_k_env(const char *name, int64_t default_value) {
+    const char *value = std::getenv(name);
+    return value ? std::strtoll(value, nullptr, 10) : default_value;
+}
+
+inline const split_k_settings &get_split_k_settings() {
+    const cpu_tuning &tuning = get_cpu_tuning();
+    static const split_k_settings settings = {
+        split_k_env("ONEMKL_CPU_GEMM_SPLIT_K_RATIO", tuning.split_k_ratio),
+        split_k_env("ONEMKL_CPU_GEMM_SPLIT_K_CHUNKS", 0), tuning.split_k_min_chunk
+    };
+    return settings;
+}
+
+// The most partial elements to allocate.
+constexpr int64_t split_k_max_workspace = int64_t(1) << 24;
+
+inline void split_k_gemm_call(const char *transa, const char *transb, const MKL_INT *m,
+                              const MKL_INT *n, const MKL_INT *k, const float *alpha,
+                              const float *a, const MKL_INT *lda, const float *b,
+                              const MKL_INT *ldb, const float *beta, float *c,
+                              const MKL_INT *ldc) {
+    ::sgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void split_k_gemm_call(const char *transa, const char *transb, const MKL_INT *m,
+                              const MKL_INT *n, const MKL_INT *k, const double *alpha,
+                              const double *a, const MKL_INT *lda, const double *b,
+                              const MKL_INT *ldb, const double *beta, double *c,
+                              const MKL_INT *ldc) {
+    ::dgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+// Threads kept for the life of the process for split_k_parallel, so that
+//  calls do not pay for creating threads. Each worker runs with a
+//  single-threaded MKL. The pool is never destroyed, as its threads may
+//  still be waiting for work at exit.
+class split_k_pool {
+public:
+    // Runs f(0), ..., f(count - 1) on the calling thread and up to helpers
+    //  workers. Items are claimed one at a time, so the caller completes the
+    //  job by itself when every worker is busy with other jobs.
+    template <typename F>
+    void run(int64_t count, int64_t helpers, F &f) {
+        auto current = std::make_shared<job>();
+        current->f = [&f](int64_t i) { f(i); };
+        current->count = count;
+        if (helpers > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (int64_t(workers_) < helpers) {
+                std::thread(&split_k_pool::work, this).detach();
+                workers_++;
+            }
+            for (int64_t t = 0; t < helpers; t++)
+                tickets_.push_back(current);
+        }
+        if (helpers > 0)
+            ready_.notify_all();
+        current->run();
+        std::unique_lock<std::mutex> lock(current->mutex);
+        current->finished.wait(lock, [&] { return current->completed == count; });
+        if (current->error)
+            std::rethrow_exception(current->error);
+    }
+
+    static split_k_pool &instance() {
+        static split_k_pool *pool = new split_k_pool;
+        return *pool;
+    }
+
+private:
+    struct job {
+        std::function<void(int64_t)> f;
+        int64_t count;
+        std::atomic<int64_t> next{ 0 };
+        std::mutex mutex;
+        std::condition_variable finished;
+        int64_t completed = 0;
+        std::exception_ptr error;
+
+        void run() {
+            for (int64_t i = next++; i < count; i = next++) {
+                std::exception_ptr e;
+                try {
+                    f(i);
+                }
+                catch (...) {
+                    e = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (e && !error)
+                    error = e;
+                if (++completed == count)
+                    finished.notify_all();
+            }
+        }
+    };
+
+    void work() {
+        mkl_set_num_threads_local(1);
+        for (;;) {
+            std::shared_ptr<job> current;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return !tickets_.empty(); });
+                current = std::move(tickets_.front());
+                tickets_.pop_front();
+            }
+            current->run();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::shared_ptr<job>> tickets_;
+    std::size_t workers_ = 0;
+};
+
+// Runs f(0), ..., f(count - 1) over up to num_threads threads of the pool,
+//  the calling thread included, each with a single-threaded MKL. Counted
+//  tasks run every item on the calling thread, which their counters follow.
+template <typename F>
+void split_k_parallel(int64_t count, int64_t num_threads, F f) {
+    if (counting_thread())
+        num_threads = 1;
+    const int previous = mkl_set_num_threads_local(1);
+    try {
+        split_k_pool::instance().run(count, std::min(count, num_threads) - 1, f);
+    }
+    catch (...) {
+        mkl_set_num_threads_local(previous);
+        throw;
+    }
+    mkl_set_num_threads_local(previous);
+}
+
+// Computes C = alpha*op(A)*op(B) + beta*C by splitting K when the shape
+//  calls for it under the given settings. Returns false, without touching C,
+//  when the caller should use plain gemm.
+template <typename T>
+bool split_k_gemm(const split_k_settings &settings, char transa, char transb, int64_t m,
+                  int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb,
+                  T beta, T *c, int64_t ldc) {
+    // k / ratio < max(m, n) is k < ratio * max(m, n) without the overflow.
+    if (settings.ratio <= 0 || m == 0 || n == 0 || k / settings.ratio < std::max(m, n))
+        return false;
+    // With the LP64 interface, sizes that do not fit go to blocked gemm.
+    if (std::max({ m, n, k, lda, ldb }) > std::numeric_limits<MKL_INT>::max())
+        return false;
+
+    const int64_t num_threads = mkl_get_max_threads();
+    int64_t chunks = (settings.chunks > 0) ? settings.chunks : num_threads;
+    chunks = std::min(chunks, k / std::max<int64_t>(settings.min_chunk, 1));
+    chunks = std::min(chunks, split_k_max_workspace / (m * n));
+    if (chunks < 2 || (settings.chunks <= 0 && num_threads < 2))
+        return false;
+
+    std::vector<T> partials(chunks * m * n);
+    const T zero = T(0);
+    split_k_parallel(chunks, std::min(chunks, num_threads), [&](int64_t i) {
+        const int64_t k_begin = k * i / chunks;
+        const MKL_INT k_chunk = k * (i + 1) / chunks - k_begin;
+        const T *a_chunk = (transa == 'N') ? a + k_begin * lda : a + k_begin;
+        const T *b_chunk = (transb == 'N') ? b + k_begin : b + k_begin * ldb;
+        const MKL_INT m_ = m, n_ = n, lda_ = lda, ldb_ = ldb;
+        split_k_gemm_call(&transa, &transb, &m_, &n_, &k_chunk, &alpha, a_chunk, &lda_, b_chunk,
+                          &ldb_, &zero, partials.data() + i * m * n, &m_);
+    });
+
+    // Each column sums the partials in chunk order, whichever thread owns it.
+    split_k_parallel(n, std::min(n, num_threads), [&](int64_t j) {
+        T *c_col = c + j * ldc;
+        for (int64_t row = 0; row < m; row++) {
+            T sum = (beta == T(0)) ? T(0) : beta * c_col[row];
+            for (int64_t i = 0; i < chunks; i++)
+                sum += partials[(i * n + j) * m + row];
+            c_col[row] = sum;
+        }
+    });
+    return true;
+}
+
+template <typename T>
+bool split_k_gemm(char transa, char transb, int64_t m, int64_t n, int64_t k, T alpha, const T *a,
+                  int64_t lda, const T *b, int64_t ldb, T beta, T *c, int64_t ldc) {
+    return split_k_gemm(get_split_k_settings(), transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                        beta, c, ldc);
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_SPLIT_K_HPP_
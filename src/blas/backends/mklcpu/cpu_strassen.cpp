@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <vector>
+
+#include "cpu_common.hpp"
+#include "cpu_strassen.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Precision-specific MKL entry points used by the Strassen-Winograd scheme.
+
+static inline void strassen_gemm(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                 float alpha, const float *a, int64_t lda, const float *b,
+                                 int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::sgemm((const char *)&transa, (const char *)&transb, mkl_int(m), mkl_int(n), mkl_int(k),
+            &alpha, a, mkl_int(lda), b, mkl_int(ldb), &beta, c, mkl_int(ldc));
+}
+
+static inline void strassen_gemm(char transa, char transb, int64_t m, int64_t n, int64_t k,
+                                 double alpha, const double *a, int64_t lda, const double *b,
+                                 int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::dgemm((const char *)&transa, (const char *)&transb, mkl_int(m), mkl_int(n), mkl_int(k),
+            &alpha, a, mkl_int(lda), b, mkl_int(ldb), &beta, c, mkl_int(ldc));
+}
+
+static inline void strassen_omatadd(char transa, char transb, int64_t rows, int64_t cols,
+                                    float alpha, const float *a, int64_t lda, float beta,
+                                    const float *b, int64_t ldb, float *c, int64_t ldc) {
+    ::mkl_somatadd('C', transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void strassen_omatadd(char transa, char transb, int64_t rows, int64_t cols,
+                                    double alpha, const double *a, int64_t lda, double beta,
+                                    const double *b, int64_t ldb, double *c, int64_t ldc) {
+    ::mkl_domatadd('C', transa, transb, rows, cols, alpha, a, lda, beta, b, ldb, c, ldc);
+}
+
+static inline void strassen_axpby(int64_t n, float a, const float *x, int64_t incx, float b,
+                                  float *y) {
+    const int64_t one = 1;
+    ::saxpby(mkl_int(n), &a, x, mkl_int(incx), &b, y, (const MKL_INT *)&one);
+}
+
+static inline void strassen_axpby(int64_t n, double a, const double *x, int64_t incx, double b,
+                                  double *y) {
+    const int64_t one = 1;
+    ::daxpby(mkl_int(n), &a, x, mkl_int(incx), &b, y, (const MKL_INT *)&one);
+}
+
+// op(X) for a column-major matrix X, where trans is a Fortran character.
+template <typename T>
+struct op_view {
+    const T *data;
+    int64_t ld;
+    char trans;
+
+    // Top-left corner of the block of op(X) starting at row r and column c.
+    op_view block(int64_t r, int64_t c) const {
+        return { (trans == 'N') ? data + r + c * ld : data + c + r * ld, ld, trans };
+    }
+};
+
+template <typename T>
+static op_view<T> plain_view(const T *data, int64_t ld) {
+    return { data, ld, 'N' };
+}
+
+// y = a*op(X) + b*y for a rows-by-cols block; y may be an operand of earlier steps.
+template <typename T>
+static void update(int64_t rows, int64_t cols, T a, op_view<T> x, T b, T *y, int64_t ldy) {
+    for (int64_t j = 0; j < cols; j++) {
+        if (x.trans == 'N')
+            strassen_axpby(rows, a, x.data + j * x.ld, 1, b, y + j * ldy);
+        else
+            strassen_axpby(rows, a, x.data + j, x.ld, b, y + j * ldy);
+    }
+}
+
+// z = a*op(X) + b*op(Y) for a rows-by-cols block; z must not overlap X or Y.
+template <typename T>
+static void combine(int64_t rows, int64_t cols, T a, op_view<T> x, T b, op_view<T> y, T *z,
+                    int64_t ldz) {
+    strassen_omatadd(x.trans, y.trans, rows, cols, a, x.data, x.ld, b, y.data, y.ld, z, ldz);
+}
+
+// C = alpha*op(A)*op(B) by Strassen-Winograd recursion down to cutoff, using
+//  the schedule of Boyer, Dumas, Pernet and Zhou that keeps the seven products
+//  in the quadrants of C and two temporaries. Odd dimensions are handled by
+//  peeling the last row, column or rank-one update off to gemm.
+template <typename T>
+static void strassen_winograd(int64_t m, int64_t n, int64_t k, T alpha, op_view<T> a,
+                              op_view<T> b, T *c, int64_t ldc, int64_t cutoff) {
+    if (m <= cutoff || n <= cutoff || k <= cutoff) {
+        strassen_gemm(a.trans, b.trans, m, n, k, alpha, a.data, a.ld, b.data, b.ld, T(0), c, ldc);
+        return;
+    }
+
+    const int64_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+    auto a11 = a, a12 = a.block(0, k2), a21 = a.block(m2, 0), a22 = a.block(m2, k2);
+    auto b11 = b, b12 = b.block(0, n2), b21 = b.block(k2, 0), b22 = b.block(k2, n2);
+    T *c11 = c, *c12 = c + n2 * ldc, *c21 = c + m2, *c22 = c + m2 + n2 * ldc;
+
+    std::vector<T> x_ws(m2 * std::max(k2, n2)), y_ws(k2 * n2);
+    T *x = x_ws.data(), *y = y_ws.data();
+    auto x_v = plain_view<T>(x, m2), y_v = plain_view<T>(y, k2);
+
+    combine(m2, k2, T(1), a11, T(-1), a21, x, m2);                     // S3 = A11 - A21
+    combine(k2, n2, T(1), b22, T(-1), b12, y, k2);                     // T3 = B22 - B12
+    strassen_winograd(m2, n2, k2, alpha, x_v, y_v, c21, ldc, cutoff);  // P7 = S3*T3
+    combine(m2, k2, T(1), a21, T(1), a22, x, m2);                      // S1 = A21 + A22
+    combine(k2, n2, T(1), b12, T(-1), b11, y, k2);                     // T1 = B12 - B11
+    strassen_winograd(m2, n2, k2, alpha, x_v, y_v, c22, ldc, cutoff);  // P5 = S1*T1
+    update(m2, k2, T(-1), a11, T(1), x, m2);                           // S2 = S1 - A11
+    update(k2, n2, T(1), b22, T(-1), y, k2);                           // T2 = B22 - T1
+    strassen_winograd(m2, n2, k2, alpha, x_v, y_v, c12, ldc, cutoff);  // P6 = S2*T2
+    update(m2, k2, T(1), a12, T(-1), x, m2);                           // S4 = A12 - S2
+    strassen_winograd(m2, n2, k2, alpha, x_v, b22, c11, ldc, cutoff);  // P3 = S4*B22
+    strassen_winograd(m2, n2, k2, alpha, a11, b11, x, m2, cutoff);     // P1 = A11*B11
+    update(m2, n2, T(1), x_v, T(1), c12, ldc);                         // U2 = P1 + P6
+    update(m2, n2, T(1), plain_view<T>(c12, ldc), T(1), c21, ldc);     // U3 = U2 + P7
+    update(m2, n2, T(1), plain_view<T>(c22, ldc), T(1), c12, ldc);     // U4 = U2 + P5
+    update(m2, n2, T(1), plain_view<T>(c21, ldc), T(1), c22, ldc);     // U7 = U3 + P5
+    update(m2, n2, T(1), plain_view<T>(c11, ldc), T(1), c12, ldc);     // U5 = U4 + P3
+    update(k2, n2, T(-1), b21, T(1), y, k2);                           // T4 = T2 - B21
+    strassen_winograd(m2, n2, k2, alpha, a22, y_v, c11, ldc, cutoff);  // P4 = A22*T4
+    update(m2, n2, T(-1), plain_view<T>(c11, ldc), T(1), c21, ldc);    // U6 = U3 - P4
+    strassen_winograd(m2, n2, k2, alpha, a12, b21, c11, ldc, cutoff);  // P2 = A12*B21
+    update(m2, n2, T(1), x_v, T(1), c11, ldc);                         // U1 = P1 + P2
+
+    if (k % 2) {
+        strassen_gemm(a.trans, b.trans, 2 * m2, 2 * n2, 1, alpha, a.block(0, k - 1).data, a.ld,
+                      b.block(k - 1, 0).data, b.ld, T(1), c, ldc);
+    }
+    if (n % 2) {
+        strassen_gemm(a.trans, b.trans, m, 1, k, alpha, a.data, a.ld, b.block(0, n - 1).data,
+                      b.ld, T(0), c + (n - 1) * ldc, ldc);
+    }
+    if (m % 2) {
+        strassen_gemm(a.trans, b.trans, 1, 2 * n2, k, alpha, a.block(m - 1, 0).data, a.ld, b.data,
+                      b.ld, T(0), c + m - 1, ldc);
+    }
+}
+
+// C = alpha*op(A)*op(B) + beta*C. A nonzero beta needs an m-by-n workspace
+//  for the product.
+template <typename T>
+static void strassen_product(char transa, char transb, int64_t m, int64_t n, int64_t k, T alpha,
+                             const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+                             int64_t ldc, int64_t cutoff) {
+    if (alpha == T(0) || k == 0) {
+        strassen_gemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+    const op_view<T> a_v = { a, lda, transa }, b_v = { b, ldb, transb };
+    if (beta == T(0)) {
+        strassen_winograd(m, n, k, alpha, a_v, b_v, c, ldc, cutoff);
+        return;
+    }
+    std::vector<T> product(m * n);
+    strassen_winograd(m, n, k, alpha, a_v, b_v, product.data(), m, cutoff);
+    update(m, n, T(1), plain_view<T>(product.data(), m), beta, c, ldc);
+}
+
+void run_strassen(char transa, char transb, int64_t m, int64_t n, int64_t k, float alpha,
+                  const float *a, int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                  int64_t ldc, int64_t cutoff) {
+    strassen_product(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, cutoff);
+}
+
+void run_strassen(char transa, char transb, int64_t m, int64_t n, int64_t k, double alpha,
+                  const double *a, int64_t lda, const double *b, int64_t ldb, double beta,
+                  double *c, int64_t ldc, int64_t cutoff) {
+    strassen_product(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, cutoff);
+}
+
+int64_t strassen_cutoff(const queue_settings &settings, int64_t m, int64_t n, int64_t k) {
+    if (settings.algorithm != gemm_algorithm::strassen ||
+        std::min(m, std::min(n, k)) <= settings.strassen_cutoff)
+        return -1;
+    return settings.strassen_cutoff;
+}
+
+// A cutoff below 1 would recurse down to 1-by-1 products, allocating at every
+//  level, so it is rejected rather than clamped.
+void set_gemm_algorithm(cl::sycl::queue &queue, gemm_algorithm algorithm, int64_t cutoff) {
+    if (algorithm == gemm_algorithm::strassen && cutoff < 1)
+        throw oneapi::mkl::InvalidArgumentsException(
+            "mklcpu: set_gemm_algorithm: Strassen cutoff " + std::to_string(cutoff) +
+            " is not positive");
+    queue_settings_registry::instance().update(queue, [&](queue_settings &settings) {
+        settings.algorithm = algorithm;
+        settings.strassen_cutoff = cutoff;
+    });
+}
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_STRASSEN_HPP_
+#define _MKL_BLAS_CPU_STRASSEN_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+#include "cpu_queue_settings.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Returns the cutoff down to which an m-by-n-by-k real gemm on a queue with
+//  settings recurses with Strassen-Winograd, or -1 when set_gemm_algorithm
+//  leaves it to gemm.
+int64_t strassen_cutoff(const queue_settings &settings, int64_t m, int64_t n, int64_t k);
+
+inline int64_t strassen_cutoff(const cl::sycl::queue &queue, int64_t m, int64_t n, int64_t k) {
+    return strassen_cutoff(get_queue_settings(queue), m, n, k);
+}
+
+// C = alpha*op(A)*op(B) + beta*C by Strassen-Winograd recursion down to
+//  cutoff, where transa and transb are Fortran characters.
+void run_strassen(char transa, char transb, int64_t m, int64_t n, int64_t k, float alpha,
+                  const float *a, int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                  int64_t ldc, int64_t cutoff);
+void run_strassen(char transa, char transb, int64_t m, int64_t n, int64_t k, double alpha,
+                  const double *a, int64_t lda, const double *b, int64_t ldb, double beta,
+                  double *c, int64_t ldc, int64_t cutoff);
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_STRASSEN_HPP_
@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_BLAS_CPU_TUNING_HPP_
+#define _MKL_BLAS_CPU_TUNING_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "mkl_service.h"
+
+namespace oneapi {
+namespace mkl {
+namespace mklcpu {
+
+// Machine-dependent parameters of the backend, read once from the tuning
+//  file that onemkl_cpu_autotune writes. The file is ONEMKL_CPU_TUNING_FILE,
+//  or else $HOME/.cache/onemkl/cpu_tuning, and holds one section per machine,
+//  keyed by logical CPU count and CPU model name:
+//
+//   onemkl_cpu_tuning 1
+//   machine 64 Intel(R) Xeon(R) Platinum 8358 CPU @ 2.60GHz
+//   split_k_ratio 128
+//   split_k_min_chunk 4096
+//   gemm_threads 1 1 1 2 4 8 16 0 0 0 0 0
+//
+//  A missing file, one of another version, or one without a section for
+//  this machine leaves the built-in defaults in place.
+constexpr int cpu_tuning_version = 1;
+constexpr int gemm_size_classes = 12;
+
+struct cpu_tuning {
+    int64_t split_k_ratio = 256;
+    int64_t split_k_min_chunk = 2048;
+    // MKL threads for real gemm by gemm_size_class; 0 keeps the MKL default.
+    int gemm_threads[gemm_size_classes] = {};
+};
+
+// The class of an m-by-n-by-k gemm, floor(log2(m*n*k) / 3): class c holds
+//  the cubes with sides from 2^c to 2^(c+1), and the last class all larger
+//  ones.
+inline int gemm_size_class(int64_t m, int64_t n, int64_t k) {
+    const double volume = std::max(double(m) * double(n) * double(k), 1.0);
+    return std::min(std::ilogb(volume) / 3, gemm_size_classes - 1);
+}
+
+inline std::string cpu_model_name() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") != 0)
+            continue;
+        const auto begin = line.find_first_not_of(" \t", line.find(':') + 1);
+        return (begin != std::string::npos) ? line.substr(begin) : std::string();
+    }
+    return "unknown";
+}
+
+inline int64_t cpu_count() {
+    return std::thread::hardware_concurrency();
+}
+
+// Reads the section for the machine with the given CPU count and model from
+//  the tuning file at path into tuning. Returns false, leaving tuning as it
+//  was, when the file cannot be used or has no such section.
+inline bool read_cpu_tuning(const std::string &path, int64_t cpus, const std::string &model,
+                            cpu_tuning &tuning) {
+    std::ifstream file(path);
+    std::string magic;
+    int version = 0;
+    if (!(file >> magic >> version) || magic != "onemkl_cpu_tuning" ||
+        version != cpu_tuning_version)
+        return false;
+
+    cpu_tuning section;
+    bool found = false;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        if (!(fields >> key))
+            continue;
+        if (key == "machine") {
+            if (found)
+                break;
+            int64_t section_cpus = 0;
+            std::string section_model;
+            fields >> section_cpus >> std::ws;
+            std::getline(fields, section_model);
+            found = (section_cpus == cpus && section_model == model);
+            continue;
+        }
+        if (!found)
+            continue;
+        bool parsed = true;
+        if (key == "split_k_ratio")
+            parsed = bool(fields >> section.split_k_ratio);
+        else if (key == "split_k_min_chunk")
+            parsed = bool(fields >> section.split_k_min_chunk) && section.split_k_min_chunk > 0;
+        else if (key == "gemm_threads") {
+            for (int &threads : section.gemm_threads)
+                parsed = parsed && bool(fields >> threads) && threads >= 0;
+        }
+        if (!parsed)
+            return false;
+    }
+    if (found)
+        tuning = section;
+    return found;
+}
+
+inline std::string cpu_tuning_path() {
+    if (const char *path = std::getenv("ONEMKL_CPU_TUNING_FILE"))
+        return path;
+    if (const char *home = std::getenv("HOME"))
+        return std::string(home) + "/.cache/onemkl/cpu_tuning";
+    return std::string();
+}
+
+inline const cpu_tuning &get_cpu_tuning() {
+    static const cpu_tuning tuning = [] {
+        cpu_tuning defaults;
+        const std::string path = cpu_tuning_path();
+        if (!path.empty())
+            read_cpu_tuning(path, cpu_count(), cpu_model_name(), defaults);
+        return defaults;
+    }();
+    return tuning;
+}
+
+inline int tuned_gemm_threads(int64_t m, int64_t n, int64_t k) {
+    return get_cpu_tuning().gemm_threads[gemm_size_class(m, n, k)];
+}
+
+// Sets the MKL thread count of the calling thread for the lifetime of the
+//  object; a count of 0 leaves it unchanged.
+class local_threads {
+public:
+    explicit local_threads(int count)
+            : previous_((count > 0) ? mkl_set_num_threads_local(count) : -1) {}
+    local_threads(const local_threads &) = delete;
+    local_threads &operator=(const local_threads &) = delete;
+    ~local_threads() {
+        if (previous_ >= 0)
+            mkl_set_num_threads_local(previous_);
+    }
+
+private:
+    int previous_;
+};
+
+} // namespace mklcpu
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKL_BLAS_CPU_TUNING_HPP_
@@ -32,6 +32,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::copy,
     oneapi::mkl::mklcpu::copy,
     oneapi::mkl::mklcpu::copy,
@@ -73,6 +81,12 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::sdsdot,
     oneapi::mkl::mklcpu::swap,
     oneapi::mkl::mklcpu::swap,
@@ -86,6 +100,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::ger,
     oneapi::mkl::mklcpu::ger,
     oneapi::mkl::mklcpu::gerc,
@@ -149,6 +171,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::hemm,
     oneapi::mkl::mklcpu::hemm,
     oneapi::mkl::mklcpu::herk,
@@ -175,6 +205,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::trsm,
     oneapi::mkl::mklcpu::trsm,
     oneapi::mkl::mklcpu::trsm,
+    oneapi::mkl::mklcpu::trsm,
+    oneapi::mkl::mklcpu::trsm,
+    oneapi::mkl::mklcpu::trsm,
+    oneapi::mkl::mklcpu::trsm,
     oneapi::mkl::mklcpu::gemm_batch,
     oneapi::mkl::mklcpu::gemm_batch,
     oneapi::mkl::mklcpu::gemm_batch,
@@ -187,6 +221,34 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemmt,
     oneapi::mkl::mklcpu::gemmt,
     oneapi::mkl::mklcpu::gemmt,
+    oneapi::mkl::mklcpu::gemm3m,
+    oneapi::mkl::mklcpu::gemm3m,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
     oneapi::mkl::mklcpu::gemm_ext,
     oneapi::mkl::mklcpu::gemm_ext,
     oneapi::mkl::mklcpu::gemm_ext,
@@ -202,6 +264,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
+    oneapi::mkl::mklcpu::axpy,
     oneapi::mkl::mklcpu::axpy_batch,
     oneapi::mkl::mklcpu::axpy_batch,
     oneapi::mkl::mklcpu::axpy_batch,
@@ -247,6 +313,12 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
+    oneapi::mkl::mklcpu::scal,
     oneapi::mkl::mklcpu::sdsdot,
     oneapi::mkl::mklcpu::swap,
     oneapi::mkl::mklcpu::swap,
@@ -260,6 +332,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
+    oneapi::mkl::mklcpu::gemv,
     oneapi::mkl::mklcpu::ger,
     oneapi::mkl::mklcpu::ger,
     oneapi::mkl::mklcpu::gerc,
@@ -322,6 +398,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
+    oneapi::mkl::mklcpu::gemm,
     oneapi::mkl::mklcpu::hemm,
     oneapi::mkl::mklcpu::hemm,
     oneapi::mkl::mklcpu::herk,
@@ -360,4 +440,40 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklcpu::gemmt,
     oneapi::mkl::mklcpu::gemmt,
     oneapi::mkl::mklcpu::gemmt,
+    oneapi::mkl::mklcpu::gemm3m,
+    oneapi::mkl::mklcpu::gemm3m,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::gemm3m_batch,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::omatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::imatcopy,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatadd,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::omatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::imatcopy_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::omatadd_batch,
+    oneapi::mkl::mklcpu::replay,
+    oneapi::mkl::mklcpu::replay,
+    oneapi::mkl::mklcpu::set_gemm_algorithm,
+    oneapi::mkl::mklcpu::set_reproducibility,
+    oneapi::mkl::mklcpu::set_perf_counters,
+    oneapi::mkl::mklcpu::get_perf_counters,
 };
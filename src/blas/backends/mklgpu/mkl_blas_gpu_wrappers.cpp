@@ -32,6 +32,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::copy,
     oneapi::mkl::mklgpu::copy,
     oneapi::mkl::mklgpu::copy,
@@ -73,6 +81,12 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::sdsdot,
     oneapi::mkl::mklgpu::swap,
     oneapi::mkl::mklgpu::swap,
@@ -86,6 +100,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::ger,
     oneapi::mkl::mklgpu::ger,
     oneapi::mkl::mklgpu::gerc,
@@ -149,6 +171,14 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::hemm,
     oneapi::mkl::mklgpu::hemm,
     oneapi::mkl::mklgpu::herk,
@@ -175,6 +205,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::trsm,
     oneapi::mkl::mklgpu::trsm,
     oneapi::mkl::mklgpu::trsm,
+    oneapi::mkl::mklgpu::trsm,
+    oneapi::mkl::mklgpu::trsm,
+    oneapi::mkl::mklgpu::trsm,
+    oneapi::mkl::mklgpu::trsm,
     oneapi::mkl::mklgpu::gemm_batch,
     oneapi::mkl::mklgpu::gemm_batch,
     oneapi::mkl::mklgpu::gemm_batch,
@@ -187,6 +221,34 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemmt,
     oneapi::mkl::mklgpu::gemmt,
     oneapi::mkl::mklgpu::gemmt,
+    oneapi::mkl::mklgpu::gemm3m,
+    oneapi::mkl::mklgpu::gemm3m,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
     oneapi::mkl::mklgpu::gemm_ext,
     oneapi::mkl::mklgpu::gemm_ext,
     oneapi::mkl::mklgpu::gemm_ext,
@@ -202,6 +264,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
+    oneapi::mkl::mklgpu::axpy,
     oneapi::mkl::mklgpu::axpy_batch,
     oneapi::mkl::mklgpu::axpy_batch,
     oneapi::mkl::mklgpu::axpy_batch,
@@ -247,6 +313,12 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
+    oneapi::mkl::mklgpu::scal,
     oneapi::mkl::mklgpu::sdsdot,
     oneapi::mkl::mklgpu::swap,
     oneapi::mkl::mklgpu::swap,
@@ -260,6 +332,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
+    oneapi::mkl::mklgpu::gemv,
     oneapi::mkl::mklgpu::ger,
     oneapi::mkl::mklgpu::ger,
     oneapi::mkl::mklgpu::gerc,
@@ -322,6 +398,10 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
+    oneapi::mkl::mklgpu::gemm,
     oneapi::mkl::mklgpu::hemm,
     oneapi::mkl::mklgpu::hemm,
     oneapi::mkl::mklgpu::herk,
@@ -360,4 +440,40 @@ extern "C" ONEMKL_EXPORT function_table_t mkl_blas_table = {
     oneapi::mkl::mklgpu::gemmt,
     oneapi::mkl::mklgpu::gemmt,
     oneapi::mkl::mklgpu::gemmt,
+    oneapi::mkl::mklgpu::gemm3m,
+    oneapi::mkl::mklgpu::gemm3m,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::gemm3m_batch,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::omatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::imatcopy,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatadd,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::omatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::imatcopy_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::omatadd_batch,
+    oneapi::mkl::mklgpu::replay,
+    oneapi::mkl::mklgpu::replay,
+    oneapi::mkl::mklgpu::set_gemm_algorithm,
+    oneapi::mkl::mklgpu::set_reproducibility,
+    oneapi::mkl::mklgpu::set_perf_counters,
+    oneapi::mkl::mklgpu::get_perf_counters,
 };
@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "include/exceptions_helper.hpp"
 #include "mkl_internal_blas_gpu_wrappers.hpp"
 #include "oneapi/mkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 #include "oneapi/mkl/types.hpp"
@@ -69,6 +70,80 @@ void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::tr
                                         c, ldc);
 }
 
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+          std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+          std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb, float beta,
+          cl::sycl::buffer<float, 1> &c, std::int64_t offset_c, std::int64_t ldc) {
+    oneapi::mkl::mklgpu::internal::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                                        offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb, double beta,
+          cl::sycl::buffer<double, 1> &c, std::int64_t offset_c, std::int64_t ldc) {
+    oneapi::mkl::mklgpu::internal::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                                        offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc) {
+    oneapi::mkl::mklgpu::internal::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                                        offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc) {
+    oneapi::mkl::mklgpu::internal::gemm(queue, transa, transb, m, n, k, alpha, a, offset_a, lda, b,
+                                        offset_b, ldb, beta, c, offset_c, ldc);
+}
+
 void symm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
@@ -284,6 +359,38 @@ void trsm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::upl
                                         alpha, a, lda, b, ldb);
 }
 
+void trsm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
+          oneapi::mkl::transpose transa, oneapi::mkl::diag unit_diag, std::int64_t m,
+          std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+          std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t offset_b,
+          std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
+          oneapi::mkl::transpose transa, oneapi::mkl::diag unit_diag, std::int64_t m,
+          std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+          std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t offset_b,
+          std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
+          oneapi::mkl::transpose transa, oneapi::mkl::diag unit_diag, std::int64_t m,
+          std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void trsm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
+          oneapi::mkl::transpose transa, oneapi::mkl::diag unit_diag, std::int64_t m,
+          std::int64_t n, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
 void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
@@ -313,6 +420,68 @@ void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
     oneapi::mkl::mklgpu::internal::gemv(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &beta,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx, float beta,
+          cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx, double beta,
+          cl::sycl::buffer<double, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
 void gbmv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
           std::int64_t kl, std::int64_t ku, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
@@ -843,6 +1012,54 @@ void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
     oneapi::mkl::mklgpu::internal::axpy(queue, n, alpha, x, incx, y, incy);
 }
 
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+          std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+          std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
+void axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    throw backend_unsupported_exception();
+}
+
 void copy(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     oneapi::mkl::mklgpu::internal::copy(queue, n, x, incx, y, incy);
@@ -998,6 +1215,36 @@ void scal(cl::sycl::queue &queue, std::int64_t n, double alpha,
     oneapi::mkl::mklgpu::internal::scal(queue, n, alpha, x, incx);
 }
 
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
+void scal(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    throw backend_unsupported_exception();
+}
+
 void swap(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     oneapi::mkl::mklgpu::internal::swap(queue, n, x, incx, y, incy);
@@ -1143,6 +1390,215 @@ void gemmt(cl::sycl::queue &queue, oneapi::mkl::uplo upper_lower, oneapi::mkl::t
                                          ldb, beta, c, ldc);
 }
 
+void gemm3m(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm3m(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                  oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                  std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                  oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                  std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                    std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                   std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
+void omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                   std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                   std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    throw backend_unsupported_exception();
+}
+
 void gemm_ext(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
               cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
@@ -1204,6 +1660,28 @@ void gemm_ext(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl
                                         c, ldc);
 }
 
+// The Strassen-Winograd hint is not implemented on this backend; gemm ignores it.
+
+void set_gemm_algorithm(cl::sycl::queue &queue, gemm_algorithm algorithm, std::int64_t cutoff) {}
+
+// Reproducible reductions are not implemented on this backend.
+
+void set_reproducibility(cl::sycl::queue &queue, reproducibility mode) {
+    if (mode != reproducibility::off)
+        throw backend_unsupported_exception();
+}
+
+// Performance counters are not implemented on this backend.
+
+void set_perf_counters(cl::sycl::queue &queue, bool enable) {
+    if (enable)
+        throw backend_unsupported_exception();
+}
+
+std::vector<oneapi::mkl::blas::perf_counter_record> get_perf_counters(cl::sycl::queue &queue) {
+    return {};
+}
+
 } // namespace mklgpu
 } // namespace mkl
 } // namespace oneapi
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <CL/sycl.hpp>
+
+#include "include/graph_replay_helper.hpp"
+#include "oneapi/mkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace mklgpu {
+
+namespace {
+
+struct graph_routines {
+    GRAPH_REPLAY_ROUTINES(mklgpu)
+};
+
+} // namespace
+
+cl::sycl::event replay(cl::sycl::queue &queue, const oneapi::mkl::blas::graph<float> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return replay_eager<graph_routines>(queue, g, dependencies);
+}
+
+cl::sycl::event replay(cl::sycl::queue &queue, const oneapi::mkl::blas::graph<double> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return replay_eager<graph_routines>(queue, g, dependencies);
+}
+
+} // namespace mklgpu
+} // namespace mkl
+} // namespace oneapi
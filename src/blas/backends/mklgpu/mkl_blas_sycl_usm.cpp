@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "include/exceptions_helper.hpp"
 #include "mkl_internal_blas_gpu_wrappers.hpp"
 #include "oneapi/mkl/blas/detail/mklgpu/onemkl_blas_mklgpu.hpp"
 #include "oneapi/mkl/types.hpp"
@@ -65,6 +66,40 @@ cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
                                                ldb, beta, c, ldc, dependencies);
 }
 
+cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const float *alpha, const float *a, std::int64_t lda, const float *b,
+                     std::int64_t ldb, const float *beta, float *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const double *alpha, const double *a, std::int64_t lda, const double *b,
+                     std::int64_t ldb, const double *beta, double *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const std::complex<float> *alpha, const std::complex<float> *a,
+                     std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                     const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const std::complex<double> *alpha, const std::complex<double> *a,
+                     std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                     const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event symm(cl::sycl::queue &queue, oneapi::mkl::side left_right,
                      oneapi::mkl::uplo upper_lower, std::int64_t m, std::int64_t n, float alpha,
                      const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
@@ -343,6 +378,39 @@ cl::sycl::event gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::
                                                incy, dependencies);
 }
 
+cl::sycl::event gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                     std::int64_t n, const float *alpha, const float *a, std::int64_t lda,
+                     const float *x, std::int64_t incx, const float *beta, float *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                     std::int64_t n, const double *alpha, const double *a, std::int64_t lda,
+                     const double *x, std::int64_t incx, const double *beta, double *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                     std::int64_t n, const std::complex<float> *alpha, const std::complex<float> *a,
+                     std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+                     const std::complex<float> *beta, std::complex<float> *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                     std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *a, std::int64_t lda, const std::complex<double> *x,
+                     std::int64_t incx, const std::complex<double> *beta, std::complex<double> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event gbmv(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
                      std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, const float *a,
                      std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
@@ -986,6 +1054,32 @@ cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double
     return oneapi::mkl::mklgpu::internal::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+                     std::int64_t incx, float *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+                     std::int64_t incx, double *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x,
                            std::int64_t *incx, float **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
@@ -1195,6 +1289,42 @@ cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, double alpha, std::
     return oneapi::mkl::mklgpu::internal::scal(queue, n, alpha, x, incx, dependencies);
 }
 
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                     std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x,
+                     std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 cl::sycl::event swap(cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
@@ -1355,6 +1485,263 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, oneapi::mkl::uplo upper_lower,
                                                 lda, b, ldb, beta, c, ldc, dependencies);
 }
 
+cl::sycl::event gemm3m(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                       oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                       std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                       std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                       oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                       std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                       std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose *transa,
+                             oneapi::mkl::transpose *transb, std::int64_t *m, std::int64_t *n,
+                             std::int64_t *k, std::complex<float> *alpha,
+                             const std::complex<float> **a, std::int64_t *lda,
+                             const std::complex<float> **b, std::int64_t *ldb,
+                             std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+                             std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose *transa,
+                             oneapi::mkl::transpose *transb, std::int64_t *m, std::int64_t *n,
+                             std::int64_t *k, std::complex<double> *alpha,
+                             const std::complex<double> **a, std::int64_t *lda,
+                             const std::complex<double> **b, std::int64_t *ldb,
+                             std::complex<double> *beta, std::complex<double> **c,
+                             std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                             oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<float> alpha,
+                             const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                             const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+                             std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                             std::int64_t stride_c, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event gemm3m_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                             oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<double> alpha,
+                             const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+                             const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+                             std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                             std::int64_t stride_c, std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+                         std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, float alpha, float *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, double alpha, double *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::complex<float> alpha, std::complex<float> *ab,
+                         std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::complex<double> alpha, std::complex<double> *ab,
+                         std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                        const float *a, std::int64_t lda, float beta, const float *b,
+                        std::int64_t ldb, float *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                        const double *a, std::int64_t lda, double beta, const double *b,
+                        std::int64_t ldb, double *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                        std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                        std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+                        std::complex<float> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                        oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                        std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+                        std::complex<double> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, const float *a, std::int64_t lda,
+                               std::int64_t stride_a, float *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, const double *a, std::int64_t lda,
+                               std::int64_t stride_a, double *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha,
+                               const std::complex<float> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha,
+                               const std::complex<double> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, float alpha, float *ab, std::int64_t lda,
+                               std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, double alpha, double *ab, std::int64_t lda,
+                               std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<float> alpha, std::complex<float> *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event imatcopy_batch(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::complex<double> alpha, std::complex<double> *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              float alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+                              float beta, const float *b, std::int64_t ldb, std::int64_t stride_b,
+                              float *c, std::int64_t ldc, std::int64_t stride_c,
+                              std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              double alpha, const double *a, std::int64_t lda,
+                              std::int64_t stride_a, double beta, const double *b, std::int64_t ldb,
+                              std::int64_t stride_b, double *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::complex<float> alpha, const std::complex<float> *a,
+                              std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+                              const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+                              std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                              std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
+cl::sycl::event omatadd_batch(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::complex<double> alpha, const std::complex<double> *a,
+                              std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+                              const std::complex<double> *b, std::int64_t ldb,
+                              std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    throw backend_unsupported_exception();
+}
+
 } // namespace mklgpu
 } // namespace mkl
 } // namespace oneapi
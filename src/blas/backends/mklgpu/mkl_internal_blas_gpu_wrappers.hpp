@@ -54,6 +54,32 @@ void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::tr
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb, float beta,
+          cl::sycl::buffer<float, 1> &c, std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb, double beta,
+          cl::sycl::buffer<double, 1> &c, std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
+void gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc);
+
 void symm(cl::sycl::queue &queue, oneapi::mkl::side left_right, oneapi::mkl::uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
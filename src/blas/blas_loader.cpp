@@ -20,7 +20,9 @@
 #include "oneapi/mkl/blas/detail/blas_loader.hpp"
 
 #include "function_table_initializer.hpp"
+#include "blas/call_recorder.hpp"
 #include "blas/function_table.hpp"
+#include "blas/gemm_coalescer.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -29,93 +31,218 @@ namespace detail {
 
 static oneapi::mkl::detail::table_initializer<domain::blas, function_table_t> function_tables;
 
+static gemm_coalescing_settings gemm_coalescing;
+static gemm_coalescer<float> sgemm_coalescer(gemm_coalescing);
+static gemm_coalescer<double> dgemm_coalescer(gemm_coalescing);
+static gemm_coalescer<std::complex<float>> cgemm_coalescer(gemm_coalescing);
+static gemm_coalescer<std::complex<double>> zgemm_coalescer(gemm_coalescing);
+
+static call_recorder &recorder = call_recorder::instance();
+
+void set_gemm_coalescing(std::int64_t max_batch, std::int64_t window_us, std::int64_t max_size) {
+    gemm_coalescing.max_size = max_size;
+    gemm_coalescing.window_us = window_us;
+    gemm_coalescing.max_batch = max_batch;
+    if (max_batch < 2) {
+        sgemm_coalescer.stop();
+        dgemm_coalescer.stop();
+        cgemm_coalescer.stop();
+        zgemm_coalescer.stop();
+    }
+}
+
+void flush_gemm_coalescing() {
+    sgemm_coalescer.flush();
+    dgemm_coalescer.flush();
+    cgemm_coalescer.flush();
+    zgemm_coalescer.flush();
+}
+
+void set_gemm_algorithm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                        gemm_algorithm algorithm, std::int64_t cutoff) {
+    function_tables[libkey].set_gemm_algorithm_sycl(queue, algorithm, cutoff);
+}
+
+void set_reproducibility(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+                         reproducibility mode) {
+    function_tables[libkey].set_reproducibility_sycl(queue, mode);
+}
+
+void set_perf_counters(oneapi::mkl::device libkey, cl::sycl::queue &queue, bool enable) {
+    function_tables[libkey].set_perf_counters_sycl(queue, enable);
+}
+
+std::vector<perf_counter_record> get_perf_counters(oneapi::mkl::device libkey,
+                                                   cl::sycl::queue &queue) {
+    return function_tables[libkey].get_perf_counters_sycl(queue);
+}
+
 // Buffer APIs
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
+    recorder.record("scasum", libkey, queue, n, x, incx, result);
     function_tables[libkey].scasum_sycl(queue, n, x, incx, result);
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
+    recorder.record("dzasum", libkey, queue, n, x, incx, result);
     function_tables[libkey].dzasum_sycl(queue, n, x, incx, result);
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
+    recorder.record("sasum", libkey, queue, n, x, incx, result);
     function_tables[libkey].sasum_sycl(queue, n, x, incx, result);
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
+    recorder.record("dasum", libkey, queue, n, x, incx, result);
     function_tables[libkey].dasum_sycl(queue, n, x, incx, result);
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
+    recorder.record("saxpy", libkey, queue, n, alpha, x, incx, y, incy);
     function_tables[libkey].saxpy_sycl(queue, n, alpha, x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
+    recorder.record("daxpy", libkey, queue, n, alpha, x, incx, y, incy);
     function_tables[libkey].daxpy_sycl(queue, n, alpha, x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("caxpy", libkey, queue, n, alpha, x, incx, y, incy);
     function_tables[libkey].caxpy_sycl(queue, n, alpha, x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    recorder.record("zaxpy", libkey, queue, n, alpha, x, incx, y, incy);
     function_tables[libkey].zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
 }
 
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("saxpy_device_scalar", libkey, queue, n, alpha, x, incx, y, incy);
+    function_tables[libkey].saxpy_device_scalar_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("daxpy_device_scalar", libkey, queue, n, alpha, x, incx, y, incy);
+    function_tables[libkey].daxpy_device_scalar_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("caxpy_device_scalar", libkey, queue, n, alpha, x, incx, y, incy);
+    function_tables[libkey].caxpy_device_scalar_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    recorder.record("zaxpy_device_scalar", libkey, queue, n, alpha, x, incx, y, incy);
+    function_tables[libkey].zaxpy_device_scalar_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("saxpy_offset", libkey, queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    function_tables[libkey].saxpy_offset_sycl(queue, n, alpha, x, offset_x, incx, y, offset_y,
+                                              incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("daxpy_offset", libkey, queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    function_tables[libkey].daxpy_offset_sycl(queue, n, alpha, x, offset_x, incx, y, offset_y,
+                                              incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+          std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("caxpy_offset", libkey, queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    function_tables[libkey].caxpy_offset_sycl(queue, n, alpha, x, offset_x, incx, y, offset_y,
+                                              incy);
+}
+
+void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+          std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("zaxpy_offset", libkey, queue, n, alpha, x, offset_x, incx, y, offset_y, incy);
+    function_tables[libkey].zaxpy_offset_sycl(queue, n, alpha, x, offset_x, incx, y, offset_y,
+                                              incy);
+}
+
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
+    recorder.record("scopy", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].scopy_sycl(queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
+    recorder.record("dcopy", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].dcopy_sycl(queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("ccopy", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].ccopy_sycl(queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    recorder.record("zcopy", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].zcopy_sycl(queue, n, x, incx, y, incy);
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
+    recorder.record("sdot", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].sdot_sycl(queue, n, x, incx, y, incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
+    recorder.record("ddot", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].ddot_sycl(queue, n, x, incx, y, incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
+    recorder.record("dsdot", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].dsdot_sycl(queue, n, x, incx, y, incy, result);
 }
 
@@ -123,6 +250,7 @@ void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
+    recorder.record("cdotc", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].cdotc_sycl(queue, n, x, incx, y, incy, result);
 }
 
@@ -130,6 +258,7 @@ void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
+    recorder.record("zdotc", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].zdotc_sycl(queue, n, x, incx, y, incy, result);
 }
 
@@ -137,6 +266,7 @@ void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
+    recorder.record("cdotu", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].cdotu_sycl(queue, n, x, incx, y, incy, result);
 }
 
@@ -144,118 +274,138 @@ void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
+    recorder.record("zdotu", libkey, queue, n, x, incx, y, incy, result);
     function_tables[libkey].zdotu_sycl(queue, n, x, incx, y, incy, result);
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("isamin", libkey, queue, n, x, incx, result);
     function_tables[libkey].isamin_sycl(queue, n, x, incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("idamin", libkey, queue, n, x, incx, result);
     function_tables[libkey].idamin_sycl(queue, n, x, incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("icamin", libkey, queue, n, x, incx, result);
     function_tables[libkey].icamin_sycl(queue, n, x, incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("izamin", libkey, queue, n, x, incx, result);
     function_tables[libkey].izamin_sycl(queue, n, x, incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("isamax", libkey, queue, n, x, incx, result);
     function_tables[libkey].isamax_sycl(queue, n, x, incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("idamax", libkey, queue, n, x, incx, result);
     function_tables[libkey].idamax_sycl(queue, n, x, incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("icamax", libkey, queue, n, x, incx, result);
     function_tables[libkey].icamax_sycl(queue, n, x, incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
+    recorder.record("izamax", libkey, queue, n, x, incx, result);
     function_tables[libkey].izamax_sycl(queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
+    recorder.record("snrm2", libkey, queue, n, x, incx, result);
     function_tables[libkey].snrm2_sycl(queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
+    recorder.record("dnrm2", libkey, queue, n, x, incx, result);
     function_tables[libkey].dnrm2_sycl(queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
+    recorder.record("scnrm2", libkey, queue, n, x, incx, result);
     function_tables[libkey].scnrm2_sycl(queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
+    recorder.record("dznrm2", libkey, queue, n, x, incx, result);
     function_tables[libkey].dznrm2_sycl(queue, n, x, incx, result);
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
+    recorder.record("srot", libkey, queue, n, x, incx, y, incy, c, s);
     function_tables[libkey].srot_sycl(queue, n, x, incx, y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
+    recorder.record("drot", libkey, queue, n, x, incx, y, incy, c, s);
     function_tables[libkey].drot_sycl(queue, n, x, incx, y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, float c, float s) {
+    recorder.record("csrot", libkey, queue, n, x, incx, y, incy, c, s);
     function_tables[libkey].csrot_sycl(queue, n, x, incx, y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, double c, double s) {
+    recorder.record("zdrot", libkey, queue, n, x, incx, y, incy, c, s);
     function_tables[libkey].zdrot_sycl(queue, n, x, incx, y, incy, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<float, 1> &c,
           cl::sycl::buffer<float, 1> &s) {
+    recorder.record("srotg", libkey, queue, a, b, c, s);
     function_tables[libkey].srotg_sycl(queue, a, b, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<double, 1> &s) {
+    recorder.record("drotg", libkey, queue, a, b, c, s);
     function_tables[libkey].drotg_sycl(queue, a, b, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::complex<float>, 1> &b,
           cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::complex<float>, 1> &s) {
+    recorder.record("crotg", libkey, queue, a, b, c, s);
     function_tables[libkey].crotg_sycl(queue, a, b, c, s);
 }
 
@@ -263,92 +413,148 @@ void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<std::complex<double>, 1> &s) {
+    recorder.record("zrotg", libkey, queue, a, b, c, s);
     function_tables[libkey].zrotg_sycl(queue, a, b, c, s);
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy, cl::sycl::buffer<float, 1> &param) {
+    recorder.record("srotm", libkey, queue, n, x, incx, y, incy, param);
     function_tables[libkey].srotm_sycl(queue, n, x, incx, y, incy, param);
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy, cl::sycl::buffer<double, 1> &param) {
+    recorder.record("drotm", libkey, queue, n, x, incx, y, incy, param);
     function_tables[libkey].drotm_sycl(queue, n, x, incx, y, incy, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
            cl::sycl::buffer<float, 1> &d2, cl::sycl::buffer<float, 1> &x1, float y1,
            cl::sycl::buffer<float, 1> &param) {
+    recorder.record("srotmg", libkey, queue, d1, d2, x1, y1, param);
     function_tables[libkey].srotmg_sycl(queue, d1, d2, x1, y1, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1,
            cl::sycl::buffer<double, 1> &d2, cl::sycl::buffer<double, 1> &x1, double y1,
            cl::sycl::buffer<double, 1> &param) {
+    recorder.record("drotmg", libkey, queue, d1, d2, x1, y1, param);
     function_tables[libkey].drotmg_sycl(queue, d1, d2, x1, y1, param);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("sscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].sscal_sycl(queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].dscal_sycl(queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
           std::int64_t incx) {
+    recorder.record("cscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].cscal_sycl(queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx) {
+    recorder.record("csscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].csscal_sycl(queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("zscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].zscal_sycl(queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("zdscal", libkey, queue, n, alpha, x, incx);
     function_tables[libkey].zdscal_sycl(queue, n, alpha, x, incx);
 }
 
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("sscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].sscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].dscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("cscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].cscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t incx) {
+    recorder.record("csscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].csscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("zscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].zscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
+void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+          cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t incx) {
+    recorder.record("zdscal_device_scalar", libkey, queue, n, alpha, x, incx);
+    function_tables[libkey].zdscal_device_scalar_sycl(queue, n, alpha, x, incx);
+}
+
 void sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
             cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
             std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
+    recorder.record("sdsdot", libkey, queue, n, sb, x, incx, y, incy, result);
     function_tables[libkey].sdsdot_sycl(queue, n, sb, x, incx, y, incy, result);
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
+    recorder.record("sswap", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].sswap_sycl(queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
+    recorder.record("dswap", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].dswap_sycl(queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("cswap", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].cswap_sycl(queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    recorder.record("zswap", libkey, queue, n, x, incx, y, incy);
     function_tables[libkey].zswap_sycl(queue, n, x, incx, y, incy);
 }
 
@@ -356,6 +562,8 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("sgbmv", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -364,6 +572,8 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dgbmv", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -373,6 +583,8 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("cgbmv", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -383,6 +595,8 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
+    recorder.record("zgbmv", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -391,6 +605,7 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("sgemv", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].sgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -398,6 +613,7 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dgemv", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].dgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -406,6 +622,7 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
+    recorder.record("cgemv", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].cgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
@@ -414,13 +631,102 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
+    recorder.record("zgemv", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].zgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, cl::sycl::buffer<float, 1> &alpha, cl::sycl::buffer<float, 1> &a,
+          std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("sgemv_device_scalar", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                    y, incy);
+    function_tables[libkey].sgemv_device_scalar_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                     beta, y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, cl::sycl::buffer<double, 1> &alpha, cl::sycl::buffer<double, 1> &a,
+          std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dgemv_device_scalar", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                    y, incy);
+    function_tables[libkey].dgemv_device_scalar_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                     beta, y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("cgemv_device_scalar", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                    y, incy);
+    function_tables[libkey].cgemv_device_scalar_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                     beta, y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    recorder.record("zgemv_device_scalar", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta,
+                    y, incy);
+    function_tables[libkey].zgemv_device_scalar_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                     beta, y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+          std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t offset_x, std::int64_t incx,
+          float beta, cl::sycl::buffer<float, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("sgemv_offset", libkey, queue, trans, m, n, alpha, a, offset_a, lda, x,
+                    offset_x, incx, beta, y, offset_y, incy);
+    function_tables[libkey].sgemv_offset_sycl(queue, trans, m, n, alpha, a, offset_a, lda, x,
+                                              offset_x, incx, beta, y, offset_y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+          std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+          std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t offset_y,
+          std::int64_t incy) {
+    recorder.record("dgemv_offset", libkey, queue, trans, m, n, alpha, a, offset_a, lda, x,
+                    offset_x, incx, beta, y, offset_y, incy);
+    function_tables[libkey].dgemv_offset_sycl(queue, trans, m, n, alpha, a, offset_a, lda, x,
+                                              offset_x, incx, beta, y, offset_y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<float> beta,
+          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("cgemv_offset", libkey, queue, trans, m, n, alpha, a, offset_a, lda, x,
+                    offset_x, incx, beta, y, offset_y, incy);
+    function_tables[libkey].cgemv_offset_sycl(queue, trans, m, n, alpha, a, offset_a, lda, x,
+                                              offset_x, incx, beta, y, offset_y, incy);
+}
+
+void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+          std::int64_t n, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+          std::int64_t offset_x, std::int64_t incx, std::complex<double> beta,
+          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y, std::int64_t incy) {
+    recorder.record("zgemv_offset", libkey, queue, trans, m, n, alpha, a, offset_a, lda, x,
+                    offset_x, incx, beta, y, offset_y, incy);
+    function_tables[libkey].zgemv_offset_sycl(queue, trans, m, n, alpha, a, offset_a, lda, x,
+                                              offset_x, incx, beta, y, offset_y, incy);
+}
+
 void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
          std::int64_t lda) {
+    recorder.record("sger", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].sger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -428,6 +734,7 @@ void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
          std::int64_t lda) {
+    recorder.record("dger", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].dger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -435,6 +742,7 @@ void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, st
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    recorder.record("cgerc", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -442,6 +750,7 @@ void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, st
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    recorder.record("zgerc", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -449,6 +758,7 @@ void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, st
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    recorder.record("cgeru", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -456,6 +766,7 @@ void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, st
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    recorder.record("zgeru", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -464,6 +775,8 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
+    recorder.record("chbmv", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -473,6 +786,8 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
+    recorder.record("zhbmv", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -481,6 +796,7 @@ void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("chemv", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].chemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -490,6 +806,7 @@ void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
+    recorder.record("zhemv", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -497,12 +814,14 @@ void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    recorder.record("cher", libkey, queue, upper_lower, n, alpha, x, incx, a, lda);
     function_tables[libkey].cher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    recorder.record("zher", libkey, queue, upper_lower, n, alpha, x, incx, a, lda);
     function_tables[libkey].zher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -510,6 +829,7 @@ void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+    recorder.record("cher2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].cher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -517,6 +837,7 @@ void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+    recorder.record("zher2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].zher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -524,6 +845,7 @@ void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    recorder.record("chpmv", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     function_tables[libkey].chpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
@@ -532,18 +854,21 @@ void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
+    recorder.record("zhpmv", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     function_tables[libkey].zhpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a) {
+    recorder.record("chpr", libkey, queue, upper_lower, n, alpha, x, incx, a);
     function_tables[libkey].chpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a) {
+    recorder.record("zhpr", libkey, queue, upper_lower, n, alpha, x, incx, a);
     function_tables[libkey].zhpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
 }
 
@@ -551,6 +876,7 @@ void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a) {
+    recorder.record("chpr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a);
     function_tables[libkey].chpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
@@ -558,6 +884,7 @@ void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a) {
+    recorder.record("zhpr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a);
     function_tables[libkey].zhpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
@@ -565,6 +892,8 @@ void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("ssbmv", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -573,6 +902,8 @@ void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dsbmv", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy);
     function_tables[libkey].dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -580,36 +911,42 @@ void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("sspmv", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     function_tables[libkey].sspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dspmv", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
     function_tables[libkey].dspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a) {
+    recorder.record("sspr", libkey, queue, upper_lower, n, alpha, x, incx, a);
     function_tables[libkey].sspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a) {
+    recorder.record("dspr", libkey, queue, upper_lower, n, alpha, x, incx, a);
     function_tables[libkey].dspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a) {
+    recorder.record("sspr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a);
     function_tables[libkey].sspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a) {
+    recorder.record("dspr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a);
     function_tables[libkey].dspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
@@ -617,6 +954,7 @@ void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+    recorder.record("ssymv", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -625,6 +963,7 @@ void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+    recorder.record("dsymv", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
     function_tables[libkey].dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
                                        incy);
 }
@@ -632,12 +971,14 @@ void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+    recorder.record("ssyr", libkey, queue, upper_lower, n, alpha, x, incx, a, lda);
     function_tables[libkey].ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+    recorder.record("dsyr", libkey, queue, upper_lower, n, alpha, x, incx, a, lda);
     function_tables[libkey].dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
 }
 
@@ -645,6 +986,7 @@ void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda) {
+    recorder.record("ssyr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].ssyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
@@ -652,18 +994,21 @@ void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda) {
+    recorder.record("dsyr2", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
     function_tables[libkey].dsyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("stbmv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].stbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtbmv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].dtbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -671,6 +1016,7 @@ void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctbmv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].ctbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -678,18 +1024,21 @@ void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztbmv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].ztbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("stbsv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].stbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtbsv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].dtbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -697,6 +1046,7 @@ void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctbsv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].ctbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
@@ -704,102 +1054,119 @@ void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztbsv", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
     function_tables[libkey].ztbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("stpmv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].stpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtpmv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].dtpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctpmv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].ctpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztpmv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].ztpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("stpsv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].stpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtpsv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].dtpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctpsv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].ctpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztpsv", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx);
     function_tables[libkey].ztpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("strmv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].strmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtrmv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].dtrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctrmv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].ctrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztrmv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].ztrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+    recorder.record("strsv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].strsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+    recorder.record("dtrsv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].dtrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+    recorder.record("ctrsv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].ctrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+    recorder.record("ztrsv", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
     function_tables[libkey].ztrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
@@ -807,6 +1174,8 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("sgemm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                    ldc);
     function_tables[libkey].sgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                                        c, ldc);
 }
@@ -815,6 +1184,8 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dgemm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                    ldc);
     function_tables[libkey].dgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                                        c, ldc);
 }
@@ -824,6 +1195,8 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("cgemm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                    ldc);
     function_tables[libkey].cgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                                        c, ldc);
 }
@@ -833,6 +1206,8 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zgemm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                    ldc);
     function_tables[libkey].zgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                                        c, ldc);
 }
@@ -841,15 +1216,113 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           std::int64_t m, std::int64_t n, std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a,
           std::int64_t lda, cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
           cl::sycl::buffer<half, 1> &c, std::int64_t ldc) {
+    recorder.record("hgemm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                    ldc);
     function_tables[libkey].hgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                                        c, ldc);
 }
 
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<float, 1> &beta, cl::sycl::buffer<float, 1> &c,
+          std::int64_t ldc) {
+    recorder.record("sgemm_device_scalar", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
+    function_tables[libkey].sgemm_device_scalar_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+          std::int64_t ldb, cl::sycl::buffer<double, 1> &beta, cl::sycl::buffer<double, 1> &c,
+          std::int64_t ldc) {
+    recorder.record("dgemm_device_scalar", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
+    function_tables[libkey].dgemm_device_scalar_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k,
+          cl::sycl::buffer<std::complex<float>, 1> &alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<float>, 1> &beta,
+          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("cgemm_device_scalar", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
+    function_tables[libkey].cgemm_device_scalar_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k,
+          cl::sycl::buffer<std::complex<double>, 1> &alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+          cl::sycl::buffer<std::complex<double>, 1> &beta,
+          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zgemm_device_scalar", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
+    function_tables[libkey].zgemm_device_scalar_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb, float beta,
+          cl::sycl::buffer<float, 1> &c, std::int64_t offset_c, std::int64_t ldc) {
+    recorder.record("sgemm_offset", libkey, queue, transa, transb, m, n, k, alpha, a, offset_a, lda,
+                    b, offset_b, ldb, beta, c, offset_c, ldc);
+    function_tables[libkey].sgemm_offset_sycl(queue, transa, transb, m, n, k, alpha, a, offset_a,
+                                              lda, b, offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb, double beta,
+          cl::sycl::buffer<double, 1> &c, std::int64_t offset_c, std::int64_t ldc) {
+    recorder.record("dgemm_offset", libkey, queue, transa, transb, m, n, k, alpha, a, offset_a, lda,
+                    b, offset_b, ldb, beta, c, offset_c, ldc);
+    function_tables[libkey].dgemm_offset_sycl(queue, transa, transb, m, n, k, alpha, a, offset_a,
+                                              lda, b, offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc) {
+    recorder.record("cgemm_offset", libkey, queue, transa, transb, m, n, k, alpha, a, offset_a, lda,
+                    b, offset_b, ldb, beta, c, offset_c, ldc);
+    function_tables[libkey].cgemm_offset_sycl(queue, transa, transb, m, n, k, alpha, a, offset_a,
+                                              lda, b, offset_b, ldb, beta, c, offset_c, ldc);
+}
+
+void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t offset_b, std::int64_t ldb,
+          std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+          std::int64_t offset_c, std::int64_t ldc) {
+    recorder.record("zgemm_offset", libkey, queue, transa, transb, m, n, k, alpha, a, offset_a, lda,
+                    b, offset_b, ldb, beta, c, offset_c, ldc);
+    function_tables[libkey].zgemm_offset_sycl(queue, transa, transb, m, n, k, alpha, a, offset_a,
+                                              lda, b, offset_b, ldb, beta, c, offset_c, ldc);
+}
+
 void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("chemm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].chemm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -859,6 +1332,8 @@ void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zhemm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].zhemm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -867,6 +1342,7 @@ void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
           std::int64_t ldc) {
+    recorder.record("cherk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].cherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -875,6 +1351,7 @@ void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zherk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].zherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -884,6 +1361,8 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("cher2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].cher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -893,6 +1372,8 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zher2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].zher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -901,6 +1382,8 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("ssymm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].ssymm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -909,6 +1392,8 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dsymm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].dsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -918,6 +1403,8 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("csymm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].csymm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -927,6 +1414,8 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zsymm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].zsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb,
                                        beta, c, ldc);
 }
@@ -934,6 +1423,7 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("ssyrk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].ssyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -941,6 +1431,7 @@ void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dsyrk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].dsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -949,6 +1440,7 @@ void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("csyrk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].csyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -957,6 +1449,7 @@ void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zsyrk", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
     function_tables[libkey].zsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
                                        ldc);
 }
@@ -965,6 +1458,8 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
            std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("ssyr2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -973,6 +1468,8 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
            std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dsyr2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -982,6 +1479,8 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("csyr2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].csyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -992,6 +1491,8 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
+    recorder.record("zsyr2k", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
     function_tables[libkey].zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
                                         beta, c, ldc);
 }
@@ -1000,6 +1501,8 @@ void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
+    recorder.record("strmm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].strmm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1008,6 +1511,8 @@ void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
+    recorder.record("dtrmm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].dtrmm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1016,6 +1521,8 @@ void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    recorder.record("ctrmm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].ctrmm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1024,6 +1531,8 @@ void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    recorder.record("ztrmm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].ztrmm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1032,6 +1541,8 @@ void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
+    recorder.record("strsm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].strsm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1040,6 +1551,8 @@ void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
+    recorder.record("dtrsm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].dtrsm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1048,6 +1561,8 @@ void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    recorder.record("ctrsm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].ctrsm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
@@ -1056,16 +1571,62 @@ void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    recorder.record("ztrsm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                    a, lda, b, ldb);
     function_tables[libkey].ztrsm_sycl(queue, left_right, upper_lower, trans, unit_diag, m, n,
                                        alpha, a, lda, b, ldb);
 }
 
+void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+          transpose transa, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
+          cl::sycl::buffer<float, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<float, 1> &b, std::int64_t offset_b, std::int64_t ldb) {
+    recorder.record("strsm_offset", libkey, queue, left_right, upper_lower, transa, unit_diag, m, n,
+                    alpha, a, offset_a, lda, b, offset_b, ldb);
+    function_tables[libkey].strsm_offset_sycl(queue, left_right, upper_lower, transa, unit_diag, m,
+                                              n, alpha, a, offset_a, lda, b, offset_b, ldb);
+}
+
+void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+          transpose transa, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
+          cl::sycl::buffer<double, 1> &a, std::int64_t offset_a, std::int64_t lda,
+          cl::sycl::buffer<double, 1> &b, std::int64_t offset_b, std::int64_t ldb) {
+    recorder.record("dtrsm_offset", libkey, queue, left_right, upper_lower, transa, unit_diag, m, n,
+                    alpha, a, offset_a, lda, b, offset_b, ldb);
+    function_tables[libkey].dtrsm_offset_sycl(queue, left_right, upper_lower, transa, unit_diag, m,
+                                              n, alpha, a, offset_a, lda, b, offset_b, ldb);
+}
+
+void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+          transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb) {
+    recorder.record("ctrsm_offset", libkey, queue, left_right, upper_lower, transa, unit_diag, m, n,
+                    alpha, a, offset_a, lda, b, offset_b, ldb);
+    function_tables[libkey].ctrsm_offset_sycl(queue, left_right, upper_lower, transa, unit_diag, m,
+                                              n, alpha, a, offset_a, lda, b, offset_b, ldb);
+}
+
+void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
+          transpose transa, diag unit_diag, std::int64_t m, std::int64_t n,
+          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t offset_a, std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+          std::int64_t offset_b, std::int64_t ldb) {
+    recorder.record("ztrsm_offset", libkey, queue, left_right, upper_lower, transa, unit_diag, m, n,
+                    alpha, a, offset_a, lda, b, offset_b, ldb);
+    function_tables[libkey].ztrsm_offset_sycl(queue, left_right, upper_lower, transa, unit_diag, m,
+                                              n, alpha, a, offset_a, lda, b, offset_b, ldb);
+}
+
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
                 transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
                 cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    recorder.record("sgemm_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
     function_tables[libkey].sgemm_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
                                                      stride_a, b, ldb, stride_b, beta, c, ldc,
                                                      stride_c, batch_size);
@@ -1077,6 +1638,8 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("dgemm_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
     function_tables[libkey].dgemm_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
                                                      stride_a, b, ldb, stride_b, beta, c, ldc,
                                                      stride_c, batch_size);
@@ -1090,6 +1653,8 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("cgemm_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
     function_tables[libkey].cgemm_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
                                                      stride_a, b, ldb, stride_b, beta, c, ldc,
                                                      stride_c, batch_size);
@@ -1103,6 +1668,8 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("zgemm_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
     function_tables[libkey].zgemm_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
                                                      stride_a, b, ldb, stride_b, beta, c, ldc,
                                                      stride_c, batch_size);
@@ -1113,6 +1680,8 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
+    recorder.record("strsm_batch_strided", libkey, queue, left_right, upper_lower, trans, unit_diag,
+                    m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
     function_tables[libkey].strsm_batch_strided_sycl(queue, left_right, upper_lower, trans,
                                                      unit_diag, m, n, alpha, a, lda, stride_a, b,
                                                      ldb, stride_b, batch_size);
@@ -1123,6 +1692,8 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("dtrsm_batch_strided", libkey, queue, left_right, upper_lower, trans, unit_diag,
+                    m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
     function_tables[libkey].dtrsm_batch_strided_sycl(queue, left_right, upper_lower, trans,
                                                      unit_diag, m, n, alpha, a, lda, stride_a, b,
                                                      ldb, stride_b, batch_size);
@@ -1134,6 +1705,8 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("ctrsm_batch_strided", libkey, queue, left_right, upper_lower, trans, unit_diag,
+                    m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
     function_tables[libkey].ctrsm_batch_strided_sycl(queue, left_right, upper_lower, trans,
                                                      unit_diag, m, n, alpha, a, lda, stride_a, b,
                                                      ldb, stride_b, batch_size);
@@ -1145,6 +1718,8 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("ztrsm_batch_strided", libkey, queue, left_right, upper_lower, trans, unit_diag,
+                    m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
     function_tables[libkey].ztrsm_batch_strided_sycl(queue, left_right, upper_lower, trans,
                                                      unit_diag, m, n, alpha, a, lda, stride_a, b,
                                                      ldb, stride_b, batch_size);
@@ -1154,6 +1729,8 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            transpose transb, std::int64_t n, std::int64_t k, float alpha,
            cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
            std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("sgemmt", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
     function_tables[libkey].sgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
                                         ldb, beta, c, ldc);
 }
@@ -1162,6 +1739,8 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
            std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dgemmt", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
     function_tables[libkey].dgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
                                         ldb, beta, c, ldc);
 }
@@ -1171,6 +1750,8 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("cgemmt", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
     function_tables[libkey].cgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
                                         ldb, beta, c, ldc);
 }
@@ -1181,14 +1762,307 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
+    recorder.record("zgemmt", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
     function_tables[libkey].zgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha, a, lda, b,
                                         ldb, beta, c, ldc);
 }
 
+void gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("cgemm3m", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
+    function_tables[libkey].cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                         beta, c, ldc);
+}
+
+void gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    recorder.record("zgemm3m", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                    c, ldc);
+    function_tables[libkey].zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                         beta, c, ldc);
+}
+
+void gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                  std::int64_t stride_b, std::complex<float> beta,
+                  cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("cgemm3m_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    function_tables[libkey].cgemm3m_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, stride_a, b, ldb, stride_b, beta, c,
+                                                       ldc, stride_c, batch_size);
+}
+
+void gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                  std::int64_t lda, std::int64_t stride_a,
+                  cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                  std::int64_t stride_b, std::complex<double> beta,
+                  cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                  std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("zgemm3m_batch_strided", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+    function_tables[libkey].zgemm3m_batch_strided_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, stride_a, b, ldb, stride_b, beta, c,
+                                                       ldc, stride_c, batch_size);
+}
+
+void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    recorder.record("somatcopy", libkey, queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables[libkey].somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    recorder.record("domatcopy", libkey, queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables[libkey].domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    recorder.record("comatcopy", libkey, queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables[libkey].comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    recorder.record("zomatcopy", libkey, queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables[libkey].zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    recorder.record("simatcopy", libkey, queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables[libkey].simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    recorder.record("dimatcopy", libkey, queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables[libkey].dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    recorder.record("cimatcopy", libkey, queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables[libkey].cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda, std::int64_t ldb) {
+    recorder.record("zimatcopy", libkey, queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables[libkey].zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("somatadd", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
+                    ldc);
+    function_tables[libkey].somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                          c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+             cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("domatadd", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
+                    ldc);
+    function_tables[libkey].domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                          c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+             std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    recorder.record("comatadd", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
+                    ldc);
+    function_tables[libkey].comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                          c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+             std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &b,
+             std::int64_t ldb, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    recorder.record("zomatadd", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
+                    ldc);
+    function_tables[libkey].zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb,
+                                          c, ldc);
+}
+
+void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("somatcopy_batch_strided", libkey, queue, trans, m, n, alpha, a, lda, stride_a,
+                    b, ldb, stride_b, batch_size);
+    function_tables[libkey].somatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                         stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("domatcopy_batch_strided", libkey, queue, trans, m, n, alpha, a, lda, stride_a,
+                    b, ldb, stride_b, batch_size);
+    function_tables[libkey].domatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                         stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("comatcopy_batch_strided", libkey, queue, trans, m, n, alpha, a, lda, stride_a,
+                    b, ldb, stride_b, batch_size);
+    function_tables[libkey].comatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                         stride_a, b, ldb, stride_b, batch_size);
+}
+
+void omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    recorder.record("zomatcopy_batch_strided", libkey, queue, trans, m, n, alpha, a, lda, stride_a,
+                    b, ldb, stride_b, batch_size);
+    function_tables[libkey].zomatcopy_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
+                                                         stride_a, b, ldb, stride_b, batch_size);
+}
+
+void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    recorder.record("simatcopy_batch_strided", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size);
+    function_tables[libkey].simatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                         stride, batch_size);
+}
+
+void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                    std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                    std::int64_t batch_size) {
+    recorder.record("dimatcopy_batch_strided", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size);
+    function_tables[libkey].dimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                         stride, batch_size);
+}
+
+void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    recorder.record("cimatcopy_batch_strided", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size);
+    function_tables[libkey].cimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                         stride, batch_size);
+}
+
+void imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                    std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
+    recorder.record("zimatcopy_batch_strided", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size);
+    function_tables[libkey].zimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                         stride, batch_size);
+}
+
+void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                   cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   float beta, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("somatadd_batch_strided", libkey, queue, transa, transb, m, n, alpha, a, lda,
+                    stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    function_tables[libkey].somatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                        stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                        stride_c, batch_size);
+}
+
+void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                   cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                   double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("domatadd_batch_strided", libkey, queue, transa, transb, m, n, alpha, a, lda,
+                    stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    function_tables[libkey].domatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                        stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                        stride_c, batch_size);
+}
+
+void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                   cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<float> beta,
+                   cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<float>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("comatadd_batch_strided", libkey, queue, transa, transb, m, n, alpha, a, lda,
+                    stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    function_tables[libkey].comatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                        stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                        stride_c, batch_size);
+}
+
+void omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                   cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                   std::int64_t stride_a, std::complex<double> beta,
+                   cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                   std::int64_t stride_b, cl::sycl::buffer<std::complex<double>, 1> &c,
+                   std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    recorder.record("zomatadd_batch_strided", libkey, queue, transa, transb, m, n, alpha, a, lda,
+                    stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size);
+    function_tables[libkey].zomatadd_batch_strided_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                        stride_a, beta, b, ldb, stride_b, c, ldc,
+                                                        stride_c, batch_size);
+}
+
 void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
               cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
               std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("gemm_f16f16f32_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b,
+                    ldb, beta, c, ldc);
     function_tables[libkey].gemm_f16f16f32_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
                                                     b, ldb, beta, c, ldc);
 }
@@ -1198,6 +2072,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               float alpha, cl::sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao,
               cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
               cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co) {
+    recorder.record("gemm_s8u8s32_ext", libkey, queue, transa, transb, offsetc, m, n, k, alpha, a,
+                    lda, ao, b, ldb, bo, beta, c, ldc, co);
     function_tables[libkey].gemm_s8u8s32_ext_sycl(queue, transa, transb, offsetc, m, n, k, alpha, a,
                                                   lda, ao, b, ldb, bo, beta, c, ldc, co);
 }
@@ -1206,6 +2082,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
               cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
               std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    recorder.record("sgemm_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].sgemm_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                                            beta, c, ldc);
 }
@@ -1214,6 +2092,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
               cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
               std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    recorder.record("dgemm_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].dgemm_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                                            beta, c, ldc);
 }
@@ -1224,6 +2104,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
               std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
               std::int64_t ldc) {
+    recorder.record("cgemm_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].cgemm_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                                            beta, c, ldc);
 }
@@ -1234,6 +2116,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
               std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
               std::int64_t ldc) {
+    recorder.record("zgemm_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].zgemm_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                                            beta, c, ldc);
 }
@@ -1242,6 +2126,8 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, half alpha,
               cl::sycl::buffer<half, 1> &a, std::int64_t lda, cl::sycl::buffer<half, 1> &b,
               std::int64_t ldb, half beta, cl::sycl::buffer<half, 1> &c, std::int64_t ldc) {
+    recorder.record("hgemm_ext", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc);
     function_tables[libkey].hgemm_ext_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                                            beta, c, ldc);
 }
@@ -1251,36 +2137,42 @@ void gemm_ext(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tran
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("scasum_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].scasum_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dzasum_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].dzasum_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sasum_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].sasum_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dasum_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].dasum_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("saxpy_usm", libkey, queue, n, alpha, x, incx, y, incy, dependencies);
     return function_tables[libkey].saxpy_usm_sycl(queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("daxpy_usm", libkey, queue, n, alpha, x, incx, y, incy, dependencies);
     return function_tables[libkey].daxpy_usm_sycl(queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
@@ -1288,6 +2180,7 @@ cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("caxpy_usm", libkey, queue, n, alpha, x, incx, y, incy, dependencies);
     return function_tables[libkey].caxpy_usm_sycl(queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
@@ -1295,13 +2188,56 @@ cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zaxpy_usm", libkey, queue, n, alpha, x, incx, y, incy, dependencies);
     return function_tables[libkey].zaxpy_usm_sycl(queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
+cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const float *alpha, const float *x, std::int64_t incx, float *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("saxpy_device_scalar_usm", libkey, queue, n, alpha, x, incx, y, incy,
+                    dependencies);
+    return function_tables[libkey].saxpy_device_scalar_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const double *alpha, const double *x, std::int64_t incx, double *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("daxpy_device_scalar_usm", libkey, queue, n, alpha, x, incx, y, incy,
+                    dependencies);
+    return function_tables[libkey].daxpy_device_scalar_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const std::complex<float> *alpha, const std::complex<float> *x,
+                     std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("caxpy_device_scalar_usm", libkey, queue, n, alpha, x, incx, y, incy,
+                    dependencies);
+    return function_tables[libkey].caxpy_device_scalar_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const std::complex<double> *alpha, const std::complex<double> *x,
+                     std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zaxpy_device_scalar_usm", libkey, queue, n, alpha, x, incx, y, incy,
+                    dependencies);
+    return function_tables[libkey].zaxpy_device_scalar_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                dependencies);
+}
+
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
                            float *alpha, const float **x, std::int64_t *incx, float **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("saxpy_batch_group_usm", libkey, queue, n, alpha, x, incx, y, incy, group_count,
+                    group_size, dependencies);
     return function_tables[libkey].saxpy_batch_group_usm_sycl(
         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
@@ -1310,6 +2246,8 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            double *alpha, const double **x, std::int64_t *incx, double **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("daxpy_batch_group_usm", libkey, queue, n, alpha, x, incx, y, incy, group_count,
+                    group_size, dependencies);
     return function_tables[libkey].daxpy_batch_group_usm_sycl(
         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
@@ -1319,6 +2257,8 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("caxpy_batch_group_usm", libkey, queue, n, alpha, x, incx, y, incy, group_count,
+                    group_size, dependencies);
     return function_tables[libkey].caxpy_batch_group_usm_sycl(
         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
@@ -1328,6 +2268,8 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<double> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zaxpy_batch_group_usm", libkey, queue, n, alpha, x, incx, y, incy, group_count,
+                    group_size, dependencies);
     return function_tables[libkey].zaxpy_batch_group_usm_sycl(
         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
@@ -1335,12 +2277,14 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("scopy_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].scopy_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dcopy_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].dcopy_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
@@ -1348,6 +2292,7 @@ cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ccopy_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].ccopy_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
@@ -1355,24 +2300,28 @@ cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zcopy_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].zcopy_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sdot_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].sdot_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const double *x, std::int64_t incx, const double *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ddot_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].ddot_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsdot_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].dsdot_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
@@ -1380,6 +2329,7 @@ cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cdotc_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].cdotc_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
@@ -1387,6 +2337,7 @@ cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zdotc_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].zdotc_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
@@ -1394,6 +2345,7 @@ cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cdotu_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].cdotu_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
@@ -1401,78 +2353,91 @@ cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zdotu_usm", libkey, queue, n, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].zdotu_usm_sycl(queue, n, x, incx, y, incy, result, dependencies);
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("isamin_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].isamin_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("idamin_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].idamin_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("icamin_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].icamin_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("izamin_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].izamin_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("isamax_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].isamax_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("idamax_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].idamax_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("icamax_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].icamax_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("izamax_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].izamax_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("snrm2_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].snrm2_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dnrm2_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].dnrm2_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("scnrm2_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].scnrm2_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dznrm2_usm", libkey, queue, n, x, incx, result, dependencies);
     return function_tables[libkey].dznrm2_usm_sycl(queue, n, x, incx, result, dependencies);
 }
 
@@ -1480,6 +2445,7 @@ cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int
                     std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                     std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("srot_usm", libkey, queue, n, x, incx, y, incy, c, s, dependencies);
     return function_tables[libkey].srot_usm_sycl(queue, n, x, incx, y, incy, c, s, dependencies);
 }
 
@@ -1487,108 +2453,174 @@ cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int
                     std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                     std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("drot_usm", libkey, queue, n, x, incx, y, incy, c, s, dependencies);
     return function_tables[libkey].drot_usm_sycl(queue, n, x, incx, y, incy, c, s, dependencies);
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                     std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csrot_usm", libkey, queue, n, x, incx, y, incy, c, s, dependencies);
     return function_tables[libkey].csrot_usm_sycl(queue, n, x, incx, y, incy, c, s, dependencies);
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                     std::int64_t incx, double *y, std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zdrot_usm", libkey, queue, n, x, incx, y, incy, c, s, dependencies);
     return function_tables[libkey].zdrot_usm_sycl(queue, n, x, incx, y, incy, c, s, dependencies);
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *a, float *b,
                      float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("srotg_usm", libkey, queue, a, b, c, s, dependencies);
     return function_tables[libkey].srotg_usm_sycl(queue, a, b, c, s, dependencies);
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *a, double *b,
                      double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("drotg_usm", libkey, queue, a, b, c, s, dependencies);
     return function_tables[libkey].drotg_usm_sycl(queue, a, b, c, s, dependencies);
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<float> *a,
                      std::complex<float> *b, float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("crotg_usm", libkey, queue, a, b, c, s, dependencies);
     return function_tables[libkey].crotg_usm_sycl(queue, a, b, c, s, dependencies);
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<double> *a,
                      std::complex<double> *b, double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zrotg_usm", libkey, queue, a, b, c, s, dependencies);
     return function_tables[libkey].zrotg_usm_sycl(queue, a, b, c, s, dependencies);
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("srotm_usm", libkey, queue, n, x, incx, y, incy, param, dependencies);
     return function_tables[libkey].srotm_usm_sycl(queue, n, x, incx, y, incy, param, dependencies);
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("drotm_usm", libkey, queue, n, x, incx, y, incy, param, dependencies);
     return function_tables[libkey].drotm_usm_sycl(queue, n, x, incx, y, incy, param, dependencies);
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *d1, float *d2,
                       float *x1, float y1, float *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("srotmg_usm", libkey, queue, d1, d2, x1, y1, param, dependencies);
     return function_tables[libkey].srotmg_usm_sycl(queue, d1, d2, x1, y1, param, dependencies);
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *d1, double *d2,
                       double *x1, double y1, double *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("drotmg_usm", libkey, queue, d1, d2, x1, y1, param, dependencies);
     return function_tables[libkey].drotmg_usm_sycl(queue, d1, d2, x1, y1, param, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].sscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].dscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].cscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].csscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].zscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zdscal_usm", libkey, queue, n, alpha, x, incx, dependencies);
     return function_tables[libkey].zdscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
 }
 
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const float *alpha, float *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].sscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const double *alpha, double *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].dscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const std::complex<float> *alpha, std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].cscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const float *alpha, std::complex<float> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].csscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                 dependencies);
+}
+
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const std::complex<double> *alpha, std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].zscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                dependencies);
+}
+
+cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+                     const double *alpha, std::complex<double> *x, std::int64_t incx,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zdscal_device_scalar_usm", libkey, queue, n, alpha, x, incx, dependencies);
+    return function_tables[libkey].zdscal_device_scalar_usm_sycl(queue, n, alpha, x, incx,
+                                                                 dependencies);
+}
+
 cl::sycl::event sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
                        const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                        float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sdsdot_usm", libkey, queue, n, sb, x, incx, y, incy, result, dependencies);
     return function_tables[libkey].sdsdot_usm_sycl(queue, n, sb, x, incx, y, incy, result,
                                                    dependencies);
 }
@@ -1596,12 +2628,14 @@ cl::sycl::event sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sswap_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].sswap_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dswap_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].dswap_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
@@ -1609,6 +2643,7 @@ cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cswap_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].cswap_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
@@ -1616,6 +2651,7 @@ cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zswap_usm", libkey, queue, n, x, incx, y, incy, dependencies);
     return function_tables[libkey].zswap_usm_sycl(queue, n, x, incx, y, incy, dependencies);
 }
 
@@ -1624,6 +2660,8 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgbmv_usm", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta,
+                    y, incy, dependencies);
     return function_tables[libkey].sgbmv_usm_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
                                                   incx, beta, y, incy, dependencies);
 }
@@ -1633,6 +2671,8 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *x, std::int64_t incx,
                      double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgbmv_usm", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta,
+                    y, incy, dependencies);
     return function_tables[libkey].dgbmv_usm_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
                                                   incx, beta, y, incy, dependencies);
 }
@@ -1643,6 +2683,8 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgbmv_usm", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta,
+                    y, incy, dependencies);
     return function_tables[libkey].cgbmv_usm_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
                                                   incx, beta, y, incy, dependencies);
 }
@@ -1653,6 +2695,8 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgbmv_usm", libkey, queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta,
+                    y, incy, dependencies);
     return function_tables[libkey].zgbmv_usm_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
                                                   incx, beta, y, incy, dependencies);
 }
@@ -1661,6 +2705,8 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemv_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].sgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
                                                   y, incy, dependencies);
 }
@@ -1670,6 +2716,8 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemv_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].dgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
                                                   y, incy, dependencies);
 }
@@ -1680,6 +2728,8 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemv_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].cgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
                                                   y, incy, dependencies);
 }
@@ -1690,14 +2740,67 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemv_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].zgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
                                                   y, incy, dependencies);
 }
 
+cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                     std::int64_t m, std::int64_t n, const float *alpha, const float *a,
+                     std::int64_t lda, const float *x, std::int64_t incx, const float *beta,
+                     float *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemv_device_scalar_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx,
+                    beta, y, incy, dependencies);
+    return function_tables[libkey].sgemv_device_scalar_usm_sycl(queue, trans, m, n, alpha, a, lda,
+                                                                x, incx, beta, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                     std::int64_t m, std::int64_t n, const double *alpha, const double *a,
+                     std::int64_t lda, const double *x, std::int64_t incx, const double *beta,
+                     double *y, std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemv_device_scalar_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx,
+                    beta, y, incy, dependencies);
+    return function_tables[libkey].dgemv_device_scalar_usm_sycl(queue, trans, m, n, alpha, a, lda,
+                                                                x, incx, beta, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                     std::int64_t m, std::int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *a, std::int64_t lda, const std::complex<float> *x,
+                     std::int64_t incx, const std::complex<float> *beta, std::complex<float> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemv_device_scalar_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx,
+                    beta, y, incy, dependencies);
+    return function_tables[libkey].cgemv_device_scalar_usm_sycl(queue, trans, m, n, alpha, a, lda,
+                                                                x, incx, beta, y, incy,
+                                                                dependencies);
+}
+
+cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                     std::int64_t m, std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *a, std::int64_t lda, const std::complex<double> *x,
+                     std::int64_t incx, const std::complex<double> *beta, std::complex<double> *y,
+                     std::int64_t incy,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemv_device_scalar_usm", libkey, queue, trans, m, n, alpha, a, lda, x, incx,
+                    beta, y, incy, dependencies);
+    return function_tables[libkey].zgemv_device_scalar_usm_sycl(queue, trans, m, n, alpha, a, lda,
+                                                                x, incx, beta, y, incy,
+                                                                dependencies);
+}
+
 cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                     std::int64_t incy, float *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sger_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return function_tables[libkey].sger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                  dependencies);
 }
@@ -1706,6 +2809,7 @@ cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int
                     std::int64_t n, double alpha, const double *x, std::int64_t incx,
                     const double *y, std::int64_t incy, double *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dger_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
     return function_tables[libkey].dger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                  dependencies);
 }
@@ -1715,6 +2819,8 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgerc_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].cgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                   dependencies);
 }
@@ -1724,6 +2830,8 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgerc_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].zgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                   dependencies);
 }
@@ -1733,6 +2841,8 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgeru_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].cgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                   dependencies);
 }
@@ -1742,6 +2852,8 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgeru_usm", libkey, queue, m, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].zgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda,
                                                   dependencies);
 }
@@ -1752,6 +2864,8 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chbmv_usm", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].chbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1762,6 +2876,8 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhbmv_usm", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].zhbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1771,6 +2887,8 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chemv_usm", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].chemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1780,6 +2898,8 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhemv_usm", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].zhemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1788,6 +2908,8 @@ cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cher_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, lda,
+                    dependencies);
     return function_tables[libkey].cher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a, lda,
                                                  dependencies);
 }
@@ -1796,6 +2918,8 @@ cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zher_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, lda,
+                    dependencies);
     return function_tables[libkey].zher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a, lda,
                                                  dependencies);
 }
@@ -1805,6 +2929,8 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cher2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].cher2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   lda, dependencies);
 }
@@ -1814,6 +2940,8 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zher2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].zher2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   lda, dependencies);
 }
@@ -1823,6 +2951,8 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chpmv_usm", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].chpmv_usm_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
                                                   incy, dependencies);
 }
@@ -1832,6 +2962,8 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhpmv_usm", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].zhpmv_usm_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
                                                   incy, dependencies);
 }
@@ -1840,6 +2972,7 @@ cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chpr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return function_tables[libkey].chpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
                                                  dependencies);
 }
@@ -1848,6 +2981,7 @@ cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhpr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return function_tables[libkey].zhpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
                                                  dependencies);
 }
@@ -1857,6 +2991,8 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chpr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a,
+                    dependencies);
     return function_tables[libkey].chpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   dependencies);
 }
@@ -1866,6 +3002,8 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhpr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a,
+                    dependencies);
     return function_tables[libkey].zhpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   dependencies);
 }
@@ -1874,6 +3012,8 @@ cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssbmv_usm", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].ssbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1883,6 +3023,8 @@ cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsbmv_usm", libkey, queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].dsbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1891,6 +3033,8 @@ cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, float alpha, const float *a, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sspmv_usm", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].sspmv_usm_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
                                                   incy, dependencies);
 }
@@ -1899,6 +3043,8 @@ cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, double alpha, const double *a, const double *x,
                      std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dspmv_usm", libkey, queue, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                    dependencies);
     return function_tables[libkey].dspmv_usm_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
                                                   incy, dependencies);
 }
@@ -1906,6 +3052,7 @@ cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sspr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return function_tables[libkey].sspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
                                                  dependencies);
 }
@@ -1913,6 +3060,7 @@ cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dspr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, dependencies);
     return function_tables[libkey].dspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
                                                  dependencies);
 }
@@ -1921,6 +3069,8 @@ cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sspr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a,
+                    dependencies);
     return function_tables[libkey].sspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   dependencies);
 }
@@ -1929,6 +3079,8 @@ cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dspr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a,
+                    dependencies);
     return function_tables[libkey].dspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   dependencies);
 }
@@ -1937,6 +3089,8 @@ cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *x,
                      std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssymv_usm", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].ssymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1945,6 +3099,8 @@ cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, double alpha, const double *a, std::int64_t lda,
                      const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsymv_usm", libkey, queue, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                    incy, dependencies);
     return function_tables[libkey].dsymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
                                                   beta, y, incy, dependencies);
 }
@@ -1952,6 +3108,8 @@ cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssyr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, lda,
+                    dependencies);
     return function_tables[libkey].ssyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a, lda,
                                                  dependencies);
 }
@@ -1959,6 +3117,8 @@ cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upp
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsyr_usm", libkey, queue, upper_lower, n, alpha, x, incx, a, lda,
+                    dependencies);
     return function_tables[libkey].dsyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a, lda,
                                                  dependencies);
 }
@@ -1967,6 +3127,8 @@ cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssyr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].ssyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   lda, dependencies);
 }
@@ -1975,6 +3137,8 @@ cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsyr2_usm", libkey, queue, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                    dependencies);
     return function_tables[libkey].dsyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
                                                   lda, dependencies);
 }
@@ -1983,6 +3147,8 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("stbmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].stbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -1991,6 +3157,8 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtbmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].dtbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2000,6 +3168,8 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctbmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].ctbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2009,6 +3179,8 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztbmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].ztbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2017,6 +3189,8 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("stbsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].stbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2025,6 +3199,8 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtbsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].dtbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2034,6 +3210,8 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctbsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].ctbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2043,6 +3221,8 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztbsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                    incx, dependencies);
     return function_tables[libkey].ztbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
                                                   lda, x, incx, dependencies);
 }
@@ -2051,6 +3231,8 @@ cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("stpmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].stpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2059,6 +3241,8 @@ cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtpmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].dtpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2067,6 +3251,8 @@ cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctpmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].ctpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2075,6 +3261,8 @@ cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztpmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].ztpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2083,6 +3271,8 @@ cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("stpsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].stpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2091,6 +3281,8 @@ cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtpsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].dtpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2099,6 +3291,8 @@ cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctpsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].ctpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2107,6 +3301,8 @@ cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztpsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, x, incx,
+                    dependencies);
     return function_tables[libkey].ztpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
                                                   incx, dependencies);
 }
@@ -2115,6 +3311,8 @@ cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("strmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].strmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2123,6 +3321,8 @@ cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtrmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].dtrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2131,6 +3331,8 @@ cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctrmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].ctrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2139,6 +3341,8 @@ cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztrmv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].ztrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2147,6 +3351,8 @@ cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("strsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].strsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2155,6 +3361,8 @@ cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtrsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].dtrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2163,6 +3371,8 @@ cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctrsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].ctrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2171,6 +3381,8 @@ cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztrsv_usm", libkey, queue, upper_lower, trans, unit_diag, n, a, lda, x, incx,
+                    dependencies);
     return function_tables[libkey].ztrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
                                                   x, incx, dependencies);
 }
@@ -2180,6 +3392,12 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                      float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemm_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    if (sgemm_coalescer.accepts(queue, m, n, k))
+        return sgemm_coalescer.submit(function_tables[libkey].sgemm_batch_group_usm_sycl, queue,
+                                      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                      dependencies);
     return function_tables[libkey].sgemm_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
                                                   ldb, beta, c, ldc, dependencies);
 }
@@ -2189,6 +3407,12 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemm_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    if (dgemm_coalescer.accepts(queue, m, n, k))
+        return dgemm_coalescer.submit(function_tables[libkey].dgemm_batch_group_usm_sycl, queue,
+                                      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                      dependencies);
     return function_tables[libkey].dgemm_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
                                                   ldb, beta, c, ldc, dependencies);
 }
@@ -2199,6 +3423,12 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    if (cgemm_coalescer.accepts(queue, m, n, k))
+        return cgemm_coalescer.submit(function_tables[libkey].cgemm_batch_group_usm_sycl, queue,
+                                      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                      dependencies);
     return function_tables[libkey].cgemm_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
                                                   ldb, beta, c, ldc, dependencies);
 }
@@ -2209,16 +3439,74 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    if (zgemm_coalescer.accepts(queue, m, n, k))
+        return zgemm_coalescer.submit(function_tables[libkey].zgemm_batch_group_usm_sycl, queue,
+                                      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                      dependencies);
     return function_tables[libkey].zgemm_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
                                                   ldb, beta, c, ldc, dependencies);
 }
 
+cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                     transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const float *alpha, const float *a, std::int64_t lda, const float *b,
+                     std::int64_t ldb, const float *beta, float *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemm_device_scalar_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables[libkey].sgemm_device_scalar_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                dependencies);
+}
+
+cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                     transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const double *alpha, const double *a, std::int64_t lda, const double *b,
+                     std::int64_t ldb, const double *beta, double *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemm_device_scalar_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables[libkey].dgemm_device_scalar_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                dependencies);
+}
+
+cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                     transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const std::complex<float> *alpha, const std::complex<float> *a,
+                     std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                     const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm_device_scalar_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables[libkey].cgemm_device_scalar_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                dependencies);
+}
+
+cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                     transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                     const std::complex<double> *alpha, const std::complex<double> *a,
+                     std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                     const std::complex<double> *beta, std::complex<double> *c, std::int64_t ldc,
+                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm_device_scalar_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables[libkey].zgemm_device_scalar_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                dependencies);
+}
+
 cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
                      uplo upper_lower, std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("chemm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].chemm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2229,6 +3517,8 @@ cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zhemm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].zhemm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2238,6 +3528,8 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, float beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cherk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].cherk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2247,6 +3539,8 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, double beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zherk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].zherk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2256,6 +3550,8 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                       std::int64_t ldb, float beta, std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cher2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].cher2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2266,6 +3562,8 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, double beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zher2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].zher2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2275,6 +3573,8 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssymm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].ssymm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2284,6 +3584,8 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsymm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].dsymm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2294,6 +3596,8 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csymm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].csymm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2304,6 +3608,8 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zsymm_usm", libkey, queue, left_right, upper_lower, m, n, alpha, a, lda, b,
+                    ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].zsymm_usm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
                                                   lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2312,6 +3618,8 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, std::int64_t n, std::int64_t k, float alpha, const float *a,
                      std::int64_t lda, float beta, float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssyrk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].ssyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2320,6 +3628,8 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      transpose trans, std::int64_t n, std::int64_t k, double alpha, const double *a,
                      std::int64_t lda, double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsyrk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].dsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2329,6 +3639,8 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csyrk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].csyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2338,6 +3650,8 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zsyrk_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                    ldc, dependencies);
     return function_tables[libkey].zsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                   beta, c, ldc, dependencies);
 }
@@ -2347,6 +3661,8 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ssyr2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].ssyr2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2356,6 +3672,8 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                       double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dsyr2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].dsyr2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2366,6 +3684,8 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("csyr2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].csyr2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2376,6 +3696,8 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zsyr2k_usm", libkey, queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
     return function_tables[libkey].zsyr2k_usm_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
                                                    b, ldb, beta, c, ldc, dependencies);
 }
@@ -2385,6 +3707,8 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("strmm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].strmm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2394,6 +3718,8 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtrmm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].dtrmm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2403,6 +3729,8 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctrmm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].ctrmm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2412,6 +3740,8 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztrmm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].ztrmm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2421,6 +3751,8 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("strsm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].strsm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2430,6 +3762,8 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dtrsm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].dtrsm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2439,6 +3773,8 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ctrsm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].ctrsm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2448,6 +3784,8 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("ztrsm_usm", libkey, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                    alpha, a, lda, b, ldb, dependencies);
     return function_tables[libkey].ztrsm_usm_sycl(queue, left_right, upper_lower, trans, unit_diag,
                                                   m, n, alpha, a, lda, b, ldb, dependencies);
 }
@@ -2458,6 +3796,8 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemm_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, group_count, group_size, dependencies);
     return function_tables[libkey].sgemm_batch_group_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
         group_size, dependencies);
@@ -2469,6 +3809,8 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemm_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, group_count, group_size, dependencies);
     return function_tables[libkey].dgemm_batch_group_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
         group_size, dependencies);
@@ -2481,6 +3823,8 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, group_count, group_size, dependencies);
     return function_tables[libkey].cgemm_batch_group_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
         group_size, dependencies);
@@ -2493,6 +3837,8 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, group_count, group_size, dependencies);
     return function_tables[libkey].zgemm_batch_group_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
         group_size, dependencies);
@@ -2505,6 +3851,9 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            float *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemm_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
     return function_tables[libkey].sgemm_batch_strided_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
         stride_c, batch_size, dependencies);
@@ -2517,6 +3866,9 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            double *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemm_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
     return function_tables[libkey].dgemm_batch_strided_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
         stride_c, batch_size, dependencies);
@@ -2530,6 +3882,9 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
     return function_tables[libkey].cgemm_batch_strided_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
         stride_c, batch_size, dependencies);
@@ -2543,6 +3898,9 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
     return function_tables[libkey].zgemm_batch_strided_usm_sycl(
         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
         stride_c, batch_size, dependencies);
@@ -2553,6 +3911,8 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       float alpha, const float *a, std::int64_t lda, const float *b,
                       std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("sgemmt_usm", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].sgemmt_usm_sycl(queue, upper_lower, transa, transb, n, k, alpha,
                                                    a, lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2562,6 +3922,8 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       double alpha, const double *a, std::int64_t lda, const double *b,
                       std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgemmt_usm", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].dgemmt_usm_sycl(queue, upper_lower, transa, transb, n, k, alpha,
                                                    a, lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2572,6 +3934,8 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                       std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemmt_usm", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].cgemmt_usm_sycl(queue, upper_lower, transa, transb, n, k, alpha,
                                                    a, lda, b, ldb, beta, c, ldc, dependencies);
 }
@@ -2582,11 +3946,412 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemmt_usm", libkey, queue, upper_lower, transa, transb, n, k, alpha, a, lda,
+                    b, ldb, beta, c, ldc, dependencies);
     return function_tables[libkey].zgemmt_usm_sycl(queue, upper_lower, transa, transb, n, k, alpha,
                                                    a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
+cl::sycl::event gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                       const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                       std::complex<float> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm3m_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    return function_tables[libkey].cgemm3m_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc, dependencies);
+}
+
+cl::sycl::event gemm3m(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                       transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                       std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                       std::complex<double> *c, std::int64_t ldc,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm3m_usm", libkey, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                    beta, c, ldc, dependencies);
+    return function_tables[libkey].zgemm3m_usm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc, dependencies);
+}
+
+cl::sycl::event gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
+                             transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                             std::complex<float> *alpha, const std::complex<float> **a,
+                             std::int64_t *lda, const std::complex<float> **b, std::int64_t *ldb,
+                             std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+                             std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm3m_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, group_count, group_size, dependencies);
+    return function_tables[libkey].cgemm3m_batch_group_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                group_count, group_size,
+                                                                dependencies);
+}
+
+cl::sycl::event gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
+                             transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                             std::complex<double> *alpha, const std::complex<double> **a,
+                             std::int64_t *lda, const std::complex<double> **b, std::int64_t *ldb,
+                             std::complex<double> *beta, std::complex<double> **c,
+                             std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm3m_batch_group_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, b, ldb, beta, c, ldc, group_count, group_size, dependencies);
+    return function_tables[libkey].zgemm3m_batch_group_usm_sycl(queue, transa, transb, m, n, k,
+                                                                alpha, a, lda, b, ldb, beta, c, ldc,
+                                                                group_count, group_size,
+                                                                dependencies);
+}
+
+cl::sycl::event gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                             transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<float> alpha, const std::complex<float> *a,
+                             std::int64_t lda, std::int64_t stride_a, const std::complex<float> *b,
+                             std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                             std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cgemm3m_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].cgemm3m_batch_strided_usm_sycl(queue, transa, transb, m, n, k,
+                                                                  alpha, a, lda, stride_a, b, ldb,
+                                                                  stride_b, beta, c, ldc, stride_c,
+                                                                  batch_size, dependencies);
+}
+
+cl::sycl::event gemm3m_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                             transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                             std::complex<double> alpha, const std::complex<double> *a,
+                             std::int64_t lda, std::int64_t stride_a, const std::complex<double> *b,
+                             std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                             std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+                             std::int64_t batch_size,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zgemm3m_batch_strided_usm", libkey, queue, transa, transb, m, n, k, alpha, a,
+                    lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].zgemm3m_batch_strided_usm_sycl(queue, transa, transb, m, n, k,
+                                                                  alpha, a, lda, stride_a, b, ldb,
+                                                                  stride_b, beta, c, ldc, stride_c,
+                                                                  batch_size, dependencies);
+}
+
+cl::sycl::event omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, float alpha, const float *a,
+                         std::int64_t lda, float *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("somatcopy_usm", libkey, queue, trans, m, n, alpha, a, lda, b, ldb,
+                    dependencies);
+    return function_tables[libkey].somatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, double alpha, const double *a,
+                         std::int64_t lda, double *b, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("domatcopy_usm", libkey, queue, trans, m, n, alpha, a, lda, b, ldb,
+                    dependencies);
+    return function_tables[libkey].domatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("comatcopy_usm", libkey, queue, trans, m, n, alpha, a, lda, b, ldb,
+                    dependencies);
+    return function_tables[libkey].comatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event omatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zomatcopy_usm", libkey, queue, trans, m, n, alpha, a, lda, b, ldb,
+                    dependencies);
+    return function_tables[libkey].zomatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda, b, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, float alpha, float *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("simatcopy_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return function_tables[libkey].simatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, double alpha, double *ab, std::int64_t lda,
+                         std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dimatcopy_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return function_tables[libkey].dimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cimatcopy_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return function_tables[libkey].cimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event imatcopy(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zimatcopy_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return function_tables[libkey].zimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda, ldb,
+                                                      dependencies);
+}
+
+cl::sycl::event omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                        const float *a, std::int64_t lda, float beta, const float *b,
+                        std::int64_t ldb, float *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("somatadd_usm", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                    ldb, c, ldc, dependencies);
+    return function_tables[libkey].somatadd_usm_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                     beta, b, ldb, c, ldc, dependencies);
+}
+
+cl::sycl::event omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                        const double *a, std::int64_t lda, double beta, const double *b,
+                        std::int64_t ldb, double *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("domatadd_usm", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                    ldb, c, ldc, dependencies);
+    return function_tables[libkey].domatadd_usm_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                     beta, b, ldb, c, ldc, dependencies);
+}
+
+cl::sycl::event omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                        const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
+                        const std::complex<float> *b, std::int64_t ldb, std::complex<float> *c,
+                        std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("comatadd_usm", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                    ldb, c, ldc, dependencies);
+    return function_tables[libkey].comatadd_usm_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                     beta, b, ldb, c, ldc, dependencies);
+}
+
+cl::sycl::event omatadd(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                        transpose transb, std::int64_t m, std::int64_t n,
+                        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                        std::complex<double> beta, const std::complex<double> *b, std::int64_t ldb,
+                        std::complex<double> *c, std::int64_t ldc,
+                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zomatadd_usm", libkey, queue, transa, transb, m, n, alpha, a, lda, beta, b,
+                    ldb, c, ldc, dependencies);
+    return function_tables[libkey].zomatadd_usm_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                     beta, b, ldb, c, ldc, dependencies);
+}
+
+cl::sycl::event omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, float alpha, const float *a,
+                               std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("somatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables[libkey].somatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, a,
+                                                                    lda, stride_a, b, ldb, stride_b,
+                                                                    batch_size, dependencies);
+}
+
+cl::sycl::event omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, double alpha, const double *a,
+                               std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("domatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables[libkey].domatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, a,
+                                                                    lda, stride_a, b, ldb, stride_b,
+                                                                    batch_size, dependencies);
+}
+
+cl::sycl::event omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                               const std::complex<float> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("comatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables[libkey].comatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, a,
+                                                                    lda, stride_a, b, ldb, stride_b,
+                                                                    batch_size, dependencies);
+}
+
+cl::sycl::event omatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                               const std::complex<double> *a, std::int64_t lda,
+                               std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zomatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, a, lda,
+                    stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables[libkey].zomatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, a,
+                                                                    lda, stride_a, b, ldb, stride_b,
+                                                                    batch_size, dependencies);
+}
+
+cl::sycl::event imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, float alpha, float *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("simatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size, dependencies);
+    return function_tables[libkey].simatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, ab,
+                                                                    lda, ldb, stride, batch_size,
+                                                                    dependencies);
+}
+
+cl::sycl::event imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, double alpha, double *ab,
+                               std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                               std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dimatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size, dependencies);
+    return function_tables[libkey].dimatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, ab,
+                                                                    lda, ldb, stride, batch_size,
+                                                                    dependencies);
+}
+
+cl::sycl::event imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                               std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+                               std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("cimatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size, dependencies);
+    return function_tables[libkey].cimatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, ab,
+                                                                    lda, ldb, stride, batch_size,
+                                                                    dependencies);
+}
+
+cl::sycl::event imatcopy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+                               std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                               std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+                               std::int64_t stride, std::int64_t batch_size,
+                               const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zimatcopy_batch_strided_usm", libkey, queue, trans, m, n, alpha, ab, lda, ldb,
+                    stride, batch_size, dependencies);
+    return function_tables[libkey].zimatcopy_batch_strided_usm_sycl(queue, trans, m, n, alpha, ab,
+                                                                    lda, ldb, stride, batch_size,
+                                                                    dependencies);
+}
+
+cl::sycl::event omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                              transpose transb, std::int64_t m, std::int64_t n, float alpha,
+                              const float *a, std::int64_t lda, std::int64_t stride_a, float beta,
+                              const float *b, std::int64_t ldb, std::int64_t stride_b, float *c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("somatadd_batch_strided_usm", libkey, queue, transa, transb, m, n, alpha, a,
+                    lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].somatadd_batch_strided_usm_sycl(queue, transa, transb, m, n,
+                                                                   alpha, a, lda, stride_a, beta, b,
+                                                                   ldb, stride_b, c, ldc, stride_c,
+                                                                   batch_size, dependencies);
+}
+
+cl::sycl::event omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                              transpose transb, std::int64_t m, std::int64_t n, double alpha,
+                              const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
+                              const double *b, std::int64_t ldb, std::int64_t stride_b, double *c,
+                              std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("domatadd_batch_strided_usm", libkey, queue, transa, transb, m, n, alpha, a,
+                    lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].domatadd_batch_strided_usm_sycl(queue, transa, transb, m, n,
+                                                                   alpha, a, lda, stride_a, beta, b,
+                                                                   ldb, stride_b, c, ldc, stride_c,
+                                                                   batch_size, dependencies);
+}
+
+cl::sycl::event omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                              transpose transb, std::int64_t m, std::int64_t n,
+                              std::complex<float> alpha, const std::complex<float> *a,
+                              std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+                              const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+                              std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                              std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("comatadd_batch_strided_usm", libkey, queue, transa, transb, m, n, alpha, a,
+                    lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].comatadd_batch_strided_usm_sycl(queue, transa, transb, m, n,
+                                                                   alpha, a, lda, stride_a, beta, b,
+                                                                   ldb, stride_b, c, ldc, stride_c,
+                                                                   batch_size, dependencies);
+}
+
+cl::sycl::event omatadd_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+                              transpose transb, std::int64_t m, std::int64_t n,
+                              std::complex<double> alpha, const std::complex<double> *a,
+                              std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+                              const std::complex<double> *b, std::int64_t ldb,
+                              std::int64_t stride_b, std::complex<double> *c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("zomatadd_batch_strided_usm", libkey, queue, transa, transb, m, n, alpha, a,
+                    lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+                    dependencies);
+    return function_tables[libkey].zomatadd_batch_strided_usm_sycl(queue, transa, transb, m, n,
+                                                                   alpha, a, lda, stride_a, beta, b,
+                                                                   ldb, stride_b, c, ldc, stride_c,
+                                                                   batch_size, dependencies);
+}
+
+// Graph APIs
+
+cl::sycl::event replay(oneapi::mkl::device libkey, cl::sycl::queue &queue, const graph<float> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("fgraph_replay", libkey, queue, g, dependencies);
+    return function_tables[libkey].fgraph_replay_sycl(queue, g, dependencies);
+}
+
+cl::sycl::event replay(oneapi::mkl::device libkey, cl::sycl::queue &queue, const graph<double> &g,
+                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    recorder.record("dgraph_replay", libkey, queue, g, dependencies);
+    return function_tables[libkey].dgraph_replay_sycl(queue, g, dependencies);
+}
+
 } /*namespace detail */
+
+// Call recording
+
+void start_call_recording(const std::string &path, std::int64_t samples) {
+    detail::recorder.start(path, samples);
+}
+
+void stop_call_recording() {
+    detail::recorder.stop();
+}
+
 } /* namespace blas */
 } /* namespace mkl */
 } /* namespace oneapi */
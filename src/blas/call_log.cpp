@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "oneapi/mkl/blas/call_log.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+namespace {
+
+[[noreturn]] void fail(const std::string &path, const char *what) {
+    throw oneapi::mkl::InvalidArgumentsException("call_log: " + path + ": " + what);
+}
+
+} // namespace
+
+call_log::call_log(const std::string &path) : path_(path) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+        fail(path_, std::strerror(errno));
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        ::close(fd_);
+        fail(path_, std::strerror(errno));
+    }
+    size_ = st.st_size;
+    if (size_ < sizeof(call_log_header)) {
+        ::close(fd_);
+        fail(path_, "not a call log");
+    }
+    void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (data == MAP_FAILED) {
+        ::close(fd_);
+        fail(path_, std::strerror(errno));
+    }
+    data_ = static_cast<const char *>(data);
+    ::madvise(data, size_, MADV_SEQUENTIAL);
+
+    call_log_header header;
+    std::memcpy(&header, data_, sizeof(header));
+    if (std::memcmp(header.magic, "OMKLCALL", 8) != 0 || header.version != call_log_version) {
+        ::munmap(data, size_);
+        ::close(fd_);
+        fail(path_, "not a call log of this version");
+    }
+    rewind();
+}
+
+call_log::~call_log() {
+    ::munmap(const_cast<char *>(data_), size_);
+    ::close(fd_);
+}
+
+void call_log::rewind() {
+    position_ = sizeof(call_log_header);
+}
+
+std::int64_t call_log::samples() const {
+    call_log_header header;
+    std::memcpy(&header, data_, sizeof(header));
+    return header.samples;
+}
+
+bool call_log::next(call_entry &entry) {
+    call_record_header header;
+    if (size_ - position_ < sizeof(header))
+        return false;
+    std::memcpy(&header, data_ + position_, sizeof(header));
+    if (header.size < sizeof(header) + header.name_length || size_ - position_ < header.size)
+        return false;
+
+    const char *p = data_ + position_ + sizeof(header);
+    const char *end = data_ + position_ + header.size;
+    entry.routine.assign(p, header.name_length);
+    entry.device = oneapi::mkl::device(header.device);
+    entry.queue = header.queue;
+    entry.time_ns = header.time_ns;
+    entry.args.resize(header.num_args);
+    p += header.name_length;
+
+    auto read = [&](void *value, std::size_t bytes) {
+        if (std::size_t(end - p) < bytes)
+            fail(path_, "corrupt record");
+        std::memcpy(value, p, bytes);
+        p += bytes;
+    };
+    for (auto &arg : entry.args) {
+        std::uint8_t kind_type[2];
+        read(kind_type, 2);
+        arg.kind = call_arg_kind(kind_type[0]);
+        arg.type = call_value_type(kind_type[1]);
+        arg.data = nullptr;
+        arg.count = arg.num_samples = 0;
+        arg.address = 0;
+        switch (arg.kind) {
+            case call_arg_kind::scalar:
+                arg.data = p;
+                p += call_value_size(arg.type);
+                break;
+            case call_arg_kind::buffer:
+                read(&arg.count, 8);
+                read(&arg.num_samples, 8);
+                arg.data = p;
+                p += arg.num_samples * call_value_size(arg.type);
+                break;
+            case call_arg_kind::pointer:
+            case call_arg_kind::pointer_array: read(&arg.address, 8); break;
+            case call_arg_kind::events: read(&arg.count, 8); break;
+            case call_arg_kind::opaque: break;
+            default: fail(path_, "corrupt record");
+        }
+        if (p > end)
+            fail(path_, "corrupt record");
+    }
+    position_ += header.size;
+    return true;
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
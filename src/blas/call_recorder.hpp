@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CALL_RECORDER_HPP_
+#define _ONEMKL_CALL_RECORDER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/blas/call_log.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+template <typename T>
+struct call_value_type_of {
+    static constexpr call_value_type value = call_value_type::none;
+};
+
+#define CALL_VALUE_TYPE(T, TYPE)                                        \
+    template <>                                                         \
+    struct call_value_type_of<T> {                                      \
+        static constexpr call_value_type value = call_value_type::TYPE; \
+    };
+CALL_VALUE_TYPE(std::int8_t, int8)
+CALL_VALUE_TYPE(std::uint8_t, uint8)
+CALL_VALUE_TYPE(std::int32_t, int32)
+CALL_VALUE_TYPE(std::int64_t, int64)
+CALL_VALUE_TYPE(half, real_half)
+CALL_VALUE_TYPE(float, real_float)
+CALL_VALUE_TYPE(double, real_double)
+CALL_VALUE_TYPE(std::complex<float>, complex_float)
+CALL_VALUE_TYPE(std::complex<double>, complex_double)
+CALL_VALUE_TYPE(transpose, transpose)
+CALL_VALUE_TYPE(uplo, uplo)
+CALL_VALUE_TYPE(diag, diag)
+CALL_VALUE_TYPE(side, side)
+CALL_VALUE_TYPE(offset, offset)
+#undef CALL_VALUE_TYPE
+
+// Records run-time dispatch calls to a file in the call_log.hpp format.
+// Recording is off until start() or the ONEMKL_BLAS_RECORD environment
+// variable turns it on, and calls then only pay for an atomic load. Each
+// record is encoded by the calling thread and appended under a lock. The
+// recorder is built when the library is loaded, so a file named by
+// ONEMKL_BLAS_RECORD that cannot be opened is reported on stderr rather
+// than thrown, and recording stays off.
+class call_recorder {
+public:
+    call_recorder() {
+        const char *path = std::getenv("ONEMKL_BLAS_RECORD");
+        if (path && *path) {
+            const char *samples = std::getenv("ONEMKL_BLAS_RECORD_SAMPLES");
+            try {
+                start(path, samples ? std::strtoll(samples, nullptr, 10) : 0);
+            }
+            catch (const std::exception &e) {
+                std::cerr << "ONEMKL_BLAS_RECORD: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    call_recorder(const call_recorder &) = delete;
+    call_recorder &operator=(const call_recorder &) = delete;
+
+    ~call_recorder() {
+        stop();
+    }
+
+    void start(const std::string &path, std::int64_t samples) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        close();
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_)
+            throw oneapi::mkl::InvalidArgumentsException("call recording: cannot open " + path);
+        samples_ = std::max<std::int64_t>(samples, 0);
+        call_log_header header = { { 'O', 'M', 'K', 'L', 'C', 'A', 'L', 'L' },
+                                   call_log_version,
+                                   std::uint32_t(samples_) };
+        std::fwrite(&header, sizeof(header), 1, file_);
+        queue_ids_.clear();
+        start_time_ = std::chrono::steady_clock::now();
+        active_ = true;
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        close();
+    }
+
+    static call_recorder &instance() {
+        static call_recorder recorder;
+        return recorder;
+    }
+
+    // Records a call of routine, the function table entry without _sycl,
+    //  made with the arguments of the run-time API after the queue.
+    template <typename... Args>
+    void record(const char *routine, oneapi::mkl::device libkey, const cl::sycl::queue &queue,
+                Args &... args) {
+        if (!active_.load())
+            return;
+        const auto now = std::chrono::steady_clock::now();
+        std::string out(sizeof(call_record_header), '\0');
+        out.append(routine);
+        const int expand[] = { 0, (encode(out, args), 0)... };
+        (void)expand;
+
+        call_record_header header;
+        header.size = std::uint32_t(out.size());
+        header.device = std::uint8_t(libkey);
+        header.num_args = std::uint8_t(sizeof...(Args));
+        header.name_length = std::uint16_t(std::strlen(routine));
+
+        // start_time_ is read under the lock, as start() may reset it
+        //  concurrently; a call begun before a restart is stamped at 0.
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_)
+            return;
+        header.time_ns = std::uint64_t(std::max<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_time_).count(), 0));
+        header.queue = queue_index(queue);
+        std::memcpy(&out[0], &header, sizeof(header));
+        std::fwrite(out.data(), 1, out.size(), file_);
+    }
+
+private:
+    void close() {
+        active_ = false;
+        if (file_)
+            std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    // Queues are told apart by their hash, so that recording does not keep
+    //  them alive.
+    std::uint32_t queue_index(const cl::sycl::queue &queue) {
+        const std::size_t id = std::hash<cl::sycl::queue>()(queue);
+        auto it = std::find(queue_ids_.begin(), queue_ids_.end(), id);
+        if (it != queue_ids_.end())
+            return std::uint32_t(it - queue_ids_.begin());
+        queue_ids_.push_back(id);
+        return std::uint32_t(queue_ids_.size() - 1);
+    }
+
+    template <typename T>
+    static void put(std::string &out, const T &value) {
+        out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    static void put_kind(std::string &out, call_arg_kind kind, call_value_type type) {
+        out.push_back(char(kind));
+        out.push_back(char(type));
+    }
+
+    // Scalars of a known type by value; anything else, such as a graph, by
+    //  kind alone.
+    template <typename T>
+    void encode(std::string &out, const T &value) {
+        const call_value_type type = call_value_type_of<T>::value;
+        if (type == call_value_type::none) {
+            put_kind(out, call_arg_kind::opaque, type);
+            return;
+        }
+        put_kind(out, call_arg_kind::scalar, type);
+        put(out, value);
+    }
+
+    // Samples are read through a host accessor, which waits for every kernel
+    //  still writing the buffer. With samples on, buffer calls are therefore
+    //  synchronous: each one waits for the work before it to complete.
+    template <typename T>
+    void encode(std::string &out, cl::sycl::buffer<T, 1> &buffer) {
+        put_kind(out, call_arg_kind::buffer, call_value_type_of<T>::value);
+        const std::int64_t count = buffer.get_count();
+        const std::int64_t num_samples = std::min<std::int64_t>(count, samples_);
+        put(out, count);
+        put(out, num_samples);
+        if (num_samples > 0) {
+            auto host = buffer.template get_access<cl::sycl::access::mode::read>();
+            out.append(reinterpret_cast<const char *>(&host[0]), num_samples * sizeof(T));
+        }
+    }
+
+    template <typename T>
+    void encode(std::string &out, T *const &pointer) {
+        put_kind(out, call_arg_kind::pointer,
+                 call_value_type_of<typename std::remove_const<T>::type>::value);
+        put(out, std::uint64_t(reinterpret_cast<std::uintptr_t>(pointer)));
+    }
+
+    template <typename T>
+    void encode(std::string &out, T **const &pointers) {
+        put_kind(out, call_arg_kind::pointer_array,
+                 call_value_type_of<typename std::remove_const<T>::type>::value);
+        put(out, std::uint64_t(reinterpret_cast<std::uintptr_t>(pointers)));
+    }
+
+    void encode(std::string &out, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+        put_kind(out, call_arg_kind::events, call_value_type::none);
+        put(out, std::int64_t(dependencies.size()));
+    }
+
+    std::mutex mutex_;
+    std::atomic<bool> active_{ false };
+    std::FILE *file_ = nullptr;
+    std::atomic<std::int64_t> samples_{ 0 };
+    std::chrono::steady_clock::time_point start_time_;
+    std::vector<std::size_t> queue_ids_;
+};
+
+} // namespace detail
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CALL_RECORDER_HPP_
@@ -0,0 +1,583 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/blas/blas.hpp"
+#include "oneapi/mkl/blas/contraction.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+namespace {
+
+enum operand { op_a = 0, op_b = 1, op_c = 2 };
+
+// Modes in A, B and C form the batch, modes in A and C the rows and modes in
+// B and C the columns of C, and modes in A and B are summed over.
+enum class mode_class { batch, rows, cols, sum };
+
+// One mode of the contraction, with its stride in each operand holding it.
+struct mode_info {
+    char label;
+    mode_class cls;
+    std::int64_t extent;
+    std::int64_t stride[3];
+    bool held[3];
+};
+
+// A group of modes folded into one dimension.
+struct fold {
+    std::int64_t extent;
+    std::int64_t stride[3];
+};
+
+constexpr int max_permute_rank = 8;
+
+// Copies a tensor between two layouts. The modes run in the order of the
+// destination of a packing copy, whose strides are compact.
+struct permute_args {
+    int rank;
+    std::int64_t size;
+    std::int64_t extents[max_permute_rank];
+    std::int64_t from[max_permute_rank];
+    std::int64_t to[max_permute_rank];
+};
+
+// A contraction as one gemm or strided gemm_batch per index of the outer
+// batch folds. With swap, it computes C^T = op(B)^T*op(A)^T, so that the
+// first gemm operand is B; lda and transa always describe the first one.
+struct contraction_plan {
+    bool packed[3];
+    permute_args pack[3];
+    bool swap;
+    transpose transa, transb;
+    std::int64_t m, n, k, lda, ldb, ldc;
+    std::int64_t batch;
+    std::int64_t batch_stride[3];
+    std::vector<fold> outer;
+};
+
+void check_desc(const tensor_desc &desc, const char *name) {
+    const std::size_t rank = desc.modes.size();
+    if (desc.extents.size() != rank || desc.strides.size() != rank)
+        throw oneapi::mkl::InvalidArgumentsException(
+            std::string("contract: modes, extents and strides of ") + name + " differ in length");
+    for (std::size_t i = 0; i < rank; i++) {
+        if (desc.extents[i] < 0 || desc.strides[i] < 0)
+            throw oneapi::mkl::InvalidArgumentsException(
+                std::string("contract: negative extent or stride in ") + name);
+        if (desc.modes.find(desc.modes[i], i + 1) != std::string::npos)
+            throw oneapi::mkl::InvalidArgumentsException(
+                std::string("contract: repeated mode in ") + name);
+    }
+}
+
+// Classifies every mode, dropping those of extent 1, which do not affect the
+// layout. C's modes come first, in order, then A's and B's.
+std::vector<mode_info> classify(const tensor_desc *descs[3]) {
+    check_desc(*descs[op_a], "A");
+    check_desc(*descs[op_b], "B");
+    check_desc(*descs[op_c], "C");
+
+    const std::string labels = descs[op_c]->modes + descs[op_a]->modes + descs[op_b]->modes;
+    std::vector<mode_info> modes;
+    std::string seen;
+    for (char label : labels) {
+        if (seen.find(label) != std::string::npos)
+            continue;
+        seen.push_back(label);
+
+        mode_info mode = { label, mode_class::batch, -1, { 0, 0, 0 }, { false, false, false } };
+        for (int op = 0; op < 3; op++) {
+            const std::size_t pos = descs[op]->modes.find(label);
+            if (pos == std::string::npos)
+                continue;
+            if (mode.extent >= 0 && descs[op]->extents[pos] != mode.extent)
+                throw oneapi::mkl::InvalidArgumentsException(
+                    std::string("contract: extents of mode ") + label + " differ");
+            mode.extent = descs[op]->extents[pos];
+            mode.stride[op] = descs[op]->strides[pos];
+            mode.held[op] = true;
+        }
+        if (mode.held[op_a] && mode.held[op_b])
+            mode.cls = mode.held[op_c] ? mode_class::batch : mode_class::sum;
+        else if (mode.held[op_c])
+            mode.cls = mode.held[op_a] ? mode_class::rows : mode_class::cols;
+        if (mode.held[op_c] ? !(mode.held[op_a] || mode.held[op_b])
+                            : !(mode.held[op_a] && mode.held[op_b]))
+            throw oneapi::mkl::InvalidArgumentsException(std::string("contract: mode ") + label +
+                                                         " must appear in two operands");
+        if (mode.extent != 1)
+            modes.push_back(mode);
+    }
+    return modes;
+}
+
+std::vector<mode_info> modes_of(const std::vector<mode_info> &modes, mode_class cls) {
+    std::vector<mode_info> result;
+    for (auto &mode : modes) {
+        if (mode.cls == cls)
+            result.push_back(mode);
+    }
+    return result;
+}
+
+void sort_by_stride(std::vector<mode_info> &modes, int op) {
+    std::stable_sort(modes.begin(), modes.end(), [op](const mode_info &x, const mode_info &y) {
+        return x.stride[op] < y.stride[op];
+    });
+}
+
+// Folds modes of one class into one dimension, if they nest the same way in
+// every operand holding them when ordered by their strides in ops[0].
+bool fold_modes(std::vector<mode_info> modes, std::initializer_list<int> ops, fold &f) {
+    f = { 1, { 0, 0, 0 } };
+    for (auto &mode : modes)
+        f.extent *= mode.extent;
+    if (f.extent <= 1)
+        return true;
+
+    sort_by_stride(modes, *ops.begin());
+    for (std::size_t q = 1; q < modes.size(); q++) {
+        for (int op : ops) {
+            if (modes[q].stride[op] != modes[q - 1].stride[op] * modes[q - 1].extent)
+                return false;
+        }
+    }
+    for (int op : ops)
+        f.stride[op] = modes[0].stride[op];
+    return true;
+}
+
+// Splits the batch modes into as few folds as possible, in the order of their
+// strides in C.
+std::vector<fold> fold_batch(std::vector<mode_info> modes) {
+    sort_by_stride(modes, op_c);
+    std::vector<fold> folds;
+    for (std::size_t q = 0; q < modes.size(); q++) {
+        bool nested = (q > 0);
+        for (int op = 0; op < 3 && nested; op++)
+            nested = (modes[q].stride[op] == modes[q - 1].stride[op] * modes[q - 1].extent);
+        if (nested)
+            folds.back().extent *= modes[q].extent;
+        else
+            folds.push_back({ modes[q].extent,
+                              { modes[q].stride[op_a], modes[q].stride[op_b],
+                                modes[q].stride[op_c] } });
+    }
+    return folds;
+}
+
+// Describes the rows-by-cols matrix of operand op to gemm. Fails when neither
+// dimension has unit stride or the leading dimension is too small.
+bool as_matrix(const fold &rows, const fold &cols, int op, transpose &trans, std::int64_t &ld) {
+    const std::int64_t r = std::max<std::int64_t>(1, rows.extent);
+    const std::int64_t c = std::max<std::int64_t>(1, cols.extent);
+    if (rows.extent <= 1 || rows.stride[op] == 1) {
+        trans = transpose::nontrans;
+        ld = (cols.extent <= 1) ? r : cols.stride[op];
+        if (ld >= r)
+            return true;
+    }
+    if (cols.extent <= 1 || cols.stride[op] == 1) {
+        trans = transpose::trans;
+        ld = (rows.extent <= 1) ? c : rows.stride[op];
+        if (ld >= c)
+            return true;
+    }
+    return false;
+}
+
+bool plan_gemm(const std::vector<mode_info> &modes, contraction_plan &plan) {
+    fold rows, cols, sum;
+    if (!fold_modes(modes_of(modes, mode_class::rows), { op_c, op_a }, rows) ||
+        !fold_modes(modes_of(modes, mode_class::cols), { op_c, op_b }, cols) ||
+        !fold_modes(modes_of(modes, mode_class::sum), { op_a, op_b }, sum))
+        return false;
+
+    transpose trans_c;
+    if (!as_matrix(rows, cols, op_c, trans_c, plan.ldc))
+        return false;
+    plan.swap = (trans_c != transpose::nontrans);
+    const fold &first_rows = plan.swap ? cols : rows;
+    const fold &second_cols = plan.swap ? rows : cols;
+    if (!as_matrix(first_rows, sum, plan.swap ? op_b : op_a, plan.transa, plan.lda) ||
+        !as_matrix(sum, second_cols, plan.swap ? op_a : op_b, plan.transb, plan.ldb))
+        return false;
+    plan.m = first_rows.extent;
+    plan.n = second_cols.extent;
+    plan.k = sum.extent;
+
+    // The largest batch fold goes to gemm_batch, the others to the host.
+    plan.outer = fold_batch(modes_of(modes, mode_class::batch));
+    auto largest = std::max_element(
+        plan.outer.begin(), plan.outer.end(),
+        [](const fold &x, const fold &y) { return x.extent < y.extent; });
+    plan.batch = 1;
+    std::fill(plan.batch_stride, plan.batch_stride + 3, 0);
+    if (largest != plan.outer.end()) {
+        plan.batch = largest->extent;
+        std::copy(largest->stride, largest->stride + 3, plan.batch_stride);
+        plan.outer.erase(largest);
+    }
+    return true;
+}
+
+// Gives operand op compact strides, recording the copy into them. Each class
+// of modes is laid out in the order of its strides in an operand that keeps
+// its layout, so that both still fold together.
+void pack_operand(std::vector<mode_info> &modes, int op, const bool packed[3],
+                  permute_args &args) {
+    static const mode_class layouts[3][3] = {
+        { mode_class::rows, mode_class::sum, mode_class::batch },
+        { mode_class::sum, mode_class::cols, mode_class::batch },
+        { mode_class::rows, mode_class::cols, mode_class::batch }
+    };
+    args.rank = 0;
+    args.size = 1;
+    for (mode_class cls : layouts[op]) {
+        std::vector<std::size_t> order;
+        for (std::size_t i = 0; i < modes.size(); i++) {
+            if (modes[i].cls == cls)
+                order.push_back(i);
+        }
+        int reference = -1;
+        for (int other : { op_c, op_a, op_b }) {
+            if (reference < 0 && !packed[other] && !order.empty() && modes[order[0]].held[other])
+                reference = other;
+        }
+        if (reference >= 0) {
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) {
+                return modes[x].stride[reference] < modes[y].stride[reference];
+            });
+        }
+        for (std::size_t i : order) {
+            if (args.rank == max_permute_rank)
+                throw oneapi::mkl::InvalidArgumentsException("contract: too many modes");
+            args.extents[args.rank] = modes[i].extent;
+            args.from[args.rank] = modes[i].stride[op];
+            args.to[args.rank] = args.size;
+            modes[i].stride[op] = args.size;
+            args.size *= modes[i].extent;
+            args.rank++;
+        }
+    }
+}
+
+// Plans the contraction with operands in place if possible. Otherwise the
+// cheapest set of operands to pack that makes it possible is chosen; packing
+// all three always works.
+contraction_plan make_plan(const tensor_desc *descs[3], bool beta_zero) {
+    const std::vector<mode_info> modes = classify(descs);
+
+    std::int64_t elements[3] = { 1, 1, 1 };
+    for (auto &mode : modes) {
+        for (int op = 0; op < 3; op++)
+            elements[op] *= mode.held[op] ? mode.extent : 1;
+    }
+    // C is copied back after the product, and in beforehand unless beta is 0.
+    elements[op_c] *= beta_zero ? 1 : 2;
+
+    std::vector<int> subsets = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    auto cost = [&](int subset) {
+        std::int64_t total = 0;
+        for (int op = 0; op < 3; op++)
+            total += (subset & (1 << op)) ? elements[op] : 0;
+        return total;
+    };
+    std::stable_sort(subsets.begin(), subsets.end(),
+                     [&](int x, int y) { return cost(x) < cost(y); });
+
+    contraction_plan plan;
+    for (int subset : subsets) {
+        std::vector<mode_info> layout = modes;
+        for (int op = 0; op < 3; op++)
+            plan.packed[op] = (subset & (1 << op)) != 0;
+        for (int op = 0; op < 3; op++) {
+            if (plan.packed[op])
+                pack_operand(layout, op, plan.packed, plan.pack[op]);
+        }
+        if (plan_gemm(layout, plan))
+            return plan;
+    }
+    throw oneapi::mkl::InvalidArgumentsException("contract: no plan found");
+}
+
+// Plans are kept per descriptor triple and element type; the cache is simply
+// emptied when it grows too large.
+class plan_cache {
+public:
+    std::shared_ptr<const contraction_plan> get(const tensor_desc *descs[3], std::size_t type_size,
+                                                bool beta_zero) {
+        std::string key(1, static_cast<char>(type_size));
+        key.push_back(beta_zero ? 'z' : 'b');
+        for (int op = 0; op < 3; op++) {
+            key += descs[op]->modes;
+            key.push_back('\0');
+            append(key, descs[op]->extents);
+            append(key, descs[op]->strides);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = plans_.find(key);
+        if (it != plans_.end())
+            return it->second;
+        if (plans_.size() >= max_plans)
+            plans_.clear();
+        auto plan = std::make_shared<const contraction_plan>(make_plan(descs, beta_zero));
+        plans_.emplace(key, plan);
+        return plan;
+    }
+
+private:
+    static constexpr std::size_t max_plans = 1024;
+
+    static void append(std::string &key, const std::vector<std::int64_t> &values) {
+        key.append(reinterpret_cast<const char *>(values.data()),
+                   values.size() * sizeof(std::int64_t));
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const contraction_plan>> plans_;
+};
+
+// Workspace of contractions in flight. It is freed by the next allocation
+//  once its last event completes, or by release, which waits for it. The
+//  list is never destroyed, so no event is waited on during static
+//  destruction; workspace still in flight at exit goes with the process.
+class workspace_list {
+public:
+    static workspace_list &instance() {
+        static workspace_list *list = new workspace_list;
+        return *list;
+    }
+
+    void *allocate(cl::sycl::queue &queue, std::size_t bytes) {
+        reap();
+        void *ptr = cl::sycl::malloc_device(std::max<std::size_t>(bytes, 1), queue.get_device(),
+                                            queue.get_context());
+        if (!ptr)
+            throw oneapi::mkl::MemoryAllocationException("contract: cannot allocate workspace");
+        return ptr;
+    }
+
+    void retire(cl::sycl::queue &queue, void *ptr, const cl::sycl::event &done) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_.push_back({ ptr, queue.get_context(), done });
+    }
+
+    // Waits for the contractions in flight on context and frees their
+    //  workspace. The wait happens outside the lock, so that other threads
+    //  can keep submitting contractions meanwhile.
+    void release(const cl::sycl::context &context) {
+        std::list<entry> released;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = in_flight_.begin(); it != in_flight_.end();) {
+                auto next = std::next(it);
+                if (it->context == context)
+                    released.splice(released.end(), in_flight_, it);
+                it = next;
+            }
+        }
+        for (auto &w : released) {
+            w.done.wait();
+            cl::sycl::free(w.ptr, w.context);
+        }
+    }
+
+private:
+    struct entry {
+        void *ptr;
+        cl::sycl::context context;
+        cl::sycl::event done;
+    };
+
+    void reap() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_.remove_if([](const entry &w) {
+            if (w.done.get_info<cl::sycl::info::event::command_execution_status>() !=
+                cl::sycl::info::event_command_status::complete)
+                return false;
+            cl::sycl::free(w.ptr, w.context);
+            return true;
+        });
+    }
+
+    std::mutex mutex_;
+    std::list<entry> in_flight_;
+};
+
+static plan_cache contraction_plans;
+
+template <typename T>
+class contraction_permute_kernel;
+
+template <typename T>
+class contraction_join_kernel;
+
+template <typename T>
+cl::sycl::event permute(cl::sycl::queue &queue, const T *src, T *dst, const permute_args &args,
+                        bool forward, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    permute_args p = args;
+    if (!forward)
+        std::swap(p.from, p.to);
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        for (auto &e : dependencies)
+            cgh.depends_on(e);
+        cgh.parallel_for<contraction_permute_kernel<T>>(
+            cl::sycl::range<1>(p.size), [=](cl::sycl::id<1> id) {
+                std::int64_t i = id[0], from = 0, to = 0;
+                for (int d = 0; d < p.rank; d++) {
+                    const std::int64_t index = i % p.extents[d];
+                    i /= p.extents[d];
+                    from += index * p.from[d];
+                    to += index * p.to[d];
+                }
+                dst[to] = src[from];
+            });
+    });
+}
+
+template <typename T>
+cl::sycl::event join(cl::sycl::queue &queue,
+                     const cl::sycl::vector_class<cl::sycl::event> &events) {
+    if (events.size() == 1)
+        return events[0];
+    if (events.empty())
+        return cl::sycl::event();
+#ifdef _WIN64
+    cl::sycl::event::wait(events);
+    return cl::sycl::event();
+#else
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        for (auto &e : events)
+            cgh.depends_on(e);
+        cgh.single_task<contraction_join_kernel<T>>([]() {});
+    });
+#endif
+}
+
+template <typename T>
+cl::sycl::event contract_impl(cl::sycl::queue &queue, T alpha, const tensor_desc &a_desc,
+                              const T *a, const tensor_desc &b_desc, const T *b, T beta,
+                              const tensor_desc &c_desc, T *c,
+                              const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    const tensor_desc *descs[3] = { &a_desc, &b_desc, &c_desc };
+    const auto plan = contraction_plans.get(descs, sizeof(T), beta == T(0));
+
+    // Pack the operands that need it.
+    const T *in[3] = { a, b, c };
+    T *workspace[3] = { nullptr, nullptr, nullptr };
+    cl::sycl::vector_class<cl::sycl::event> gemm_dependencies(dependencies);
+    for (int op = 0; op < 3; op++) {
+        if (!plan->packed[op])
+            continue;
+        workspace[op] = static_cast<T *>(
+            workspace_list::instance().allocate(queue, plan->pack[op].size * sizeof(T)));
+        if (plan->pack[op].size > 0 && (op != op_c || beta != T(0)))
+            gemm_dependencies.push_back(
+                permute(queue, in[op], workspace[op], plan->pack[op], true, dependencies));
+        in[op] = workspace[op];
+    }
+    T *out = plan->packed[op_c] ? workspace[op_c] : c;
+
+    const int first = plan->swap ? op_b : op_a;
+    const int second = plan->swap ? op_a : op_b;
+    std::int64_t outer_count = 1;
+    for (auto &f : plan->outer)
+        outer_count *= f.extent;
+
+    cl::sycl::vector_class<cl::sycl::event> products;
+    std::vector<std::int64_t> index(plan->outer.size(), 0);
+    for (std::int64_t i = 0; i < outer_count; i++) {
+        std::int64_t offset[3] = { 0, 0, 0 };
+        for (std::size_t d = 0; d < index.size(); d++) {
+            for (int op = 0; op < 3; op++)
+                offset[op] += index[d] * plan->outer[d].stride[op];
+        }
+        if (plan->batch == 1)
+            products.push_back(oneapi::mkl::blas::gemm(
+                queue, plan->transa, plan->transb, plan->m, plan->n, plan->k, alpha,
+                in[first] + offset[first], plan->lda, in[second] + offset[second], plan->ldb,
+                beta, out + offset[op_c], plan->ldc, gemm_dependencies));
+        else
+            products.push_back(oneapi::mkl::blas::gemm_batch(
+                queue, plan->transa, plan->transb, plan->m, plan->n, plan->k, alpha,
+                in[first] + offset[first], plan->lda, plan->batch_stride[first],
+                in[second] + offset[second], plan->ldb, plan->batch_stride[second], beta,
+                out + offset[op_c], plan->ldc, plan->batch_stride[op_c], plan->batch,
+                gemm_dependencies));
+        for (std::size_t d = 0; d < index.size() && ++index[d] == plan->outer[d].extent; d++)
+            index[d] = 0;
+    }
+    if (products.empty())
+        products = gemm_dependencies;
+
+    cl::sycl::event done;
+    if (plan->packed[op_c] && plan->pack[op_c].size > 0)
+        done = permute(queue, static_cast<const T *>(out), c, plan->pack[op_c], false, products);
+    else
+        done = join<T>(queue, products);
+
+    for (int op = 0; op < 3; op++) {
+        if (workspace[op])
+            workspace_list::instance().retire(queue, workspace[op], done);
+    }
+    return done;
+}
+
+} // namespace
+
+cl::sycl::event contract(cl::sycl::queue &queue, float alpha, const tensor_desc &a_desc,
+                         const float *a, const tensor_desc &b_desc, const float *b, float beta,
+                         const tensor_desc &c_desc, float *c,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return contract_impl(queue, alpha, a_desc, a, b_desc, b, beta, c_desc, c, dependencies);
+}
+
+cl::sycl::event contract(cl::sycl::queue &queue, double alpha, const tensor_desc &a_desc,
+                         const double *a, const tensor_desc &b_desc, const double *b, double beta,
+                         const tensor_desc &c_desc, double *c,
+                         const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return contract_impl(queue, alpha, a_desc, a, b_desc, b, beta, c_desc, c, dependencies);
+}
+
+void release_contraction_workspace(cl::sycl::queue &queue) {
+    workspace_list::instance().release(queue.get_context());
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
@@ -24,6 +24,8 @@
 #include <cstdint>
 #include <CL/sycl.hpp>
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas/graph.hpp"
+#include "oneapi/mkl/blas/perf_counters.hpp"
 
 typedef struct {
     int version;
@@ -52,6 +54,41 @@ typedef struct {
     void (*zaxpy_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
+    void (*saxpy_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*daxpy_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*caxpy_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                     std::int64_t incy);
+    void (*zaxpy_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy);
+    void (*saxpy_offset_sycl)(cl::sycl::queue &queue, std::int64_t n, float alpha,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
+    void (*daxpy_offset_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
+    void (*caxpy_offset_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
+    void (*zaxpy_offset_sycl)(cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
     void (*scopy_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
     void (*dcopy_sycl)(cl::sycl::queue &queue, std::int64_t n, cl::sycl::buffer<double, 1> &x,
@@ -167,6 +204,28 @@ typedef struct {
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
     void (*zdscal_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
+    void (*sscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx);
+    void (*dscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx);
+    void (*cscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x,
+                                     std::int64_t incx);
+    void (*csscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                      cl::sycl::buffer<float, 1> &alpha,
+                                      cl::sycl::buffer<std::complex<float>, 1> &x,
+                                      std::int64_t incx);
+    void (*zscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx);
+    void (*zdscal_device_scalar_sycl)(cl::sycl::queue &queue, std::int64_t n,
+                                      cl::sycl::buffer<double, 1> &alpha,
+                                      cl::sycl::buffer<std::complex<double>, 1> &x,
+                                      std::int64_t incx);
     void (*sdsdot_sycl)(cl::sycl::queue &queue, std::int64_t n, float sb,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -223,6 +282,63 @@ typedef struct {
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                        std::int64_t incy);
+    void (*sgemv_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<float, 1> &beta,
+                                     cl::sycl::buffer<float, 1> &y, std::int64_t incy);
+    void (*dgemv_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<double, 1> &beta,
+                                     cl::sycl::buffer<double, 1> &y, std::int64_t incy);
+    void (*cgemv_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                                     cl::sycl::buffer<std::complex<float>, 1> &beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &y,
+                                     std::int64_t incy);
+    void (*zgemv_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<std::complex<double>, 1> &x,
+                                     std::int64_t incx,
+                                     cl::sycl::buffer<std::complex<double>, 1> &beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &y,
+                                     std::int64_t incy);
+    void (*sgemv_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                              std::int64_t offset_a, std::int64_t lda,
+                              cl::sycl::buffer<float, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
+    void (*dgemv_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                              std::int64_t offset_a, std::int64_t lda,
+                              cl::sycl::buffer<double, 1> &x, std::int64_t offset_x,
+                              std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y,
+                              std::int64_t offset_y, std::int64_t incy);
+    void (*cgemv_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
+                              std::int64_t offset_x, std::int64_t incx, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t offset_y,
+                              std::int64_t incy);
+    void (*zgemv_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
+                              std::int64_t offset_x, std::int64_t incx, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t offset_y,
+                              std::int64_t incy);
     void (*sger_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, float alpha,
                       cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                       cl::sycl::buffer<float, 1> &y, std::int64_t incy,
@@ -494,6 +610,67 @@ typedef struct {
                        std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                        cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                        cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
+    void (*sgemm_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                     std::int64_t k, cl::sycl::buffer<float, 1> &alpha,
+                                     cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<float, 1> &beta,
+                                     cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*dgemm_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                     std::int64_t k, cl::sycl::buffer<double, 1> &alpha,
+                                     cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<double, 1> &beta,
+                                     cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*cgemm_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                     std::int64_t k,
+                                     cl::sycl::buffer<std::complex<float>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<std::complex<float>, 1> &beta,
+                                     cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zgemm_device_scalar_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                     std::int64_t k,
+                                     cl::sycl::buffer<std::complex<double>, 1> &alpha,
+                                     cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                     cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                                     cl::sycl::buffer<std::complex<double>, 1> &beta,
+                                     cl::sycl::buffer<std::complex<double>, 1> &c,
+                                     std::int64_t ldc);
+    void (*sgemm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
+                              std::int64_t offset_a, std::int64_t lda,
+                              cl::sycl::buffer<float, 1> &b, std::int64_t offset_b,
+                              std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
+                              std::int64_t offset_c, std::int64_t ldc);
+    void (*dgemm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
+                              std::int64_t offset_a, std::int64_t lda,
+                              cl::sycl::buffer<double, 1> &b, std::int64_t offset_b,
+                              std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
+                              std::int64_t offset_c, std::int64_t ldc);
+    void (*cgemm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb, std::complex<float> beta,
+                              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t offset_c,
+                              std::int64_t ldc);
+    void (*zgemm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb, std::complex<double> beta,
+                              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t offset_c,
+                              std::int64_t ldc);
     void (*chemm_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
                        oneapi::mkl::uplo upper_lower, std::int64_t m, std::int64_t n,
                        std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
@@ -632,6 +809,32 @@ typedef struct {
                        std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                        std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                        std::int64_t ldb);
+    void (*strsm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
+                              oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
+                              oneapi::mkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb);
+    void (*dtrsm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
+                              oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
+                              oneapi::mkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb);
+    void (*ctrsm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
+                              oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
+                              oneapi::mkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<float> alpha,
+                              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb);
+    void (*ztrsm_offset_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
+                              oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa,
+                              oneapi::mkl::diag unit_diag, std::int64_t m, std::int64_t n,
+                              std::complex<double> alpha,
+                              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t offset_a,
+                              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                              std::int64_t offset_b, std::int64_t ldb);
     void (*sgemm_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
                                      oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
                                      std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
@@ -721,6 +924,177 @@ typedef struct {
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
+    void (*cgemm3m_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                         oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, std::complex<float> alpha,
+                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                         std::int64_t ldc);
+    void (*zgemm3m_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                         oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, std::complex<double> alpha,
+                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                         std::int64_t ldc);
+    void (*cgemm3m_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                       oneapi::mkl::transpose transb, std::int64_t m,
+                                       std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                                       cl::sycl::buffer<std::complex<float>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<float>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       std::complex<float> beta,
+                                       cl::sycl::buffer<std::complex<float>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size);
+    void (*zgemm3m_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                       oneapi::mkl::transpose transb, std::int64_t m,
+                                       std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                                       cl::sycl::buffer<std::complex<double>, 1> &a,
+                                       std::int64_t lda, std::int64_t stride_a,
+                                       cl::sycl::buffer<std::complex<double>, 1> &b,
+                                       std::int64_t ldb, std::int64_t stride_b,
+                                       std::complex<double> beta,
+                                       cl::sycl::buffer<std::complex<double>, 1> &c,
+                                       std::int64_t ldc, std::int64_t stride_c,
+                                       std::int64_t batch_size);
+    void (*somatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
+    void (*domatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
+    void (*comatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
+    void (*zomatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
+    void (*simatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &ab,
+                           std::int64_t lda, std::int64_t ldb);
+    void (*dimatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &ab,
+                           std::int64_t lda, std::int64_t ldb);
+    void (*cimatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<float> alpha,
+                           cl::sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda,
+                           std::int64_t ldb);
+    void (*zimatcopy_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                           std::int64_t n, std::complex<double> alpha,
+                           cl::sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda,
+                           std::int64_t ldb);
+    void (*somatadd_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*domatadd_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                          double beta, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*comatadd_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*zomatadd_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*somatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, float alpha,
+                                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                                         std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*domatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                         std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*comatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<float>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*zomatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &a,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         cl::sycl::buffer<std::complex<double>, 1> &b,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size);
+    void (*simatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, float alpha,
+                                         cl::sycl::buffer<float, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*dimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, double alpha,
+                                         cl::sycl::buffer<double, 1> &ab, std::int64_t lda,
+                                         std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*cimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                                         cl::sycl::buffer<std::complex<float>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*zimatcopy_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                                         cl::sycl::buffer<std::complex<double>, 1> &ab,
+                                         std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+                                         std::int64_t batch_size);
+    void (*somatadd_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                        oneapi::mkl::transpose transb, std::int64_t m,
+                                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a, float beta,
+                                        cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<float, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*domatadd_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                        oneapi::mkl::transpose transb, std::int64_t m,
+                                        std::int64_t n, double alpha,
+                                        cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                                        std::int64_t stride_a, double beta,
+                                        cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                                        std::int64_t stride_b, cl::sycl::buffer<double, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*comatadd_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                        oneapi::mkl::transpose transb, std::int64_t m,
+                                        std::int64_t n, std::complex<float> alpha,
+                                        cl::sycl::buffer<std::complex<float>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        std::complex<float> beta,
+                                        cl::sycl::buffer<std::complex<float>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<float>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
+    void (*zomatadd_batch_strided_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
+                                        oneapi::mkl::transpose transb, std::int64_t m,
+                                        std::int64_t n, std::complex<double> alpha,
+                                        cl::sycl::buffer<std::complex<double>, 1> &a,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        std::complex<double> beta,
+                                        cl::sycl::buffer<std::complex<double>, 1> &b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        cl::sycl::buffer<std::complex<double>, 1> &c,
+                                        std::int64_t ldc, std::int64_t stride_c,
+                                        std::int64_t batch_size);
     void (*gemm_f16f16f32_ext_sycl)(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
                                     oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
                                     std::int64_t k, float alpha, cl::sycl::buffer<half, 1> &a,
@@ -796,6 +1170,22 @@ typedef struct {
                                       std::complex<double> alpha, const std::complex<double> *x,
                                       std::int64_t incx, std::complex<double> *y, std::int64_t incy,
                                       const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*saxpy_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+        std::int64_t incx, float *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*daxpy_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+        std::int64_t incx, double *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*caxpy_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zaxpy_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+        std::int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
 
     cl::sycl::event (*saxpy_batch_group_usm_sycl)(
         cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
@@ -968,6 +1358,26 @@ typedef struct {
     cl::sycl::event (*zdscal_usm_sycl)(cl::sycl::queue &queue, std::int64_t n, double alpha,
                                        std::complex<double> *x, std::int64_t incx,
                                        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*sscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        std::complex<float> *x, std::int64_t incx,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*csscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, std::complex<float> *x,
+        std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        std::complex<double> *x, std::int64_t incx,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zdscal_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, std::complex<double> *x,
+        std::int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
     cl::sycl::event (*sdsdot_usm_sycl)(cl::sycl::queue &queue, std::int64_t n, float sb,
                                        const float *x, std::int64_t incx, const float *y,
                                        std::int64_t incy, float *result,
@@ -1038,6 +1448,28 @@ typedef struct {
                                       std::complex<double> beta, std::complex<double> *y,
                                       std::int64_t incy,
                                       const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*sgemv_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const float *alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx,
+        const float *beta, float *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dgemv_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const double *alpha, const double *a, std::int64_t lda, const double *x, std::int64_t incx,
+        const double *beta, double *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cgemv_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<float> *alpha, const std::complex<float> *a, std::int64_t lda,
+        const std::complex<float> *x, std::int64_t incx, const std::complex<float> *beta,
+        std::complex<float> *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zgemv_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        const std::complex<double> *alpha, const std::complex<double> *a, std::int64_t lda,
+        const std::complex<double> *x, std::int64_t incx, const std::complex<double> *beta,
+        std::complex<double> *y, std::int64_t incy,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
     cl::sycl::event (*sger_usm_sycl)(cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
                                      float alpha, const float *x, std::int64_t incx, const float *y,
                                      std::int64_t incy, float *a, std::int64_t lda,
@@ -1356,6 +1788,28 @@ typedef struct {
                                       std::complex<double> beta, std::complex<double> *c,
                                       std::int64_t ldc,
                                       const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*sgemm_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, const float *beta, float *c,
+        std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dgemm_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, const double *beta, double *c,
+        std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cgemm_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, const std::complex<float> *beta, std::complex<float> *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zgemm_device_scalar_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, const std::complex<double> *beta, std::complex<double> *c,
+        std::int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
     cl::sycl::event (*chemm_usm_sycl)(cl::sycl::queue &queue, oneapi::mkl::side left_right,
                                       oneapi::mkl::uplo upper_lower, std::int64_t m, std::int64_t n,
                                       std::complex<float> alpha, const std::complex<float> *a,
@@ -1595,6 +2049,178 @@ typedef struct {
                                        std::complex<double> beta, std::complex<double> *c,
                                        std::int64_t ldc,
                                        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cgemm3m_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose *transa, oneapi::mkl::transpose *transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<float> *alpha,
+        const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **b,
+        std::int64_t *ldb, std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+        std::int64_t group_count, std::int64_t *group_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zgemm3m_batch_group_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose *transa, oneapi::mkl::transpose *transb,
+        std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> *alpha,
+        const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
+        std::int64_t *ldb, std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
+        std::int64_t group_count, std::int64_t *group_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cgemm3m_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zgemm3m_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+        const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*somatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        float alpha, const float *a, std::int64_t lda, float *b, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*domatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        double alpha, const double *a, std::int64_t lda, double *b, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*comatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+        std::complex<float> *b, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zomatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+        std::complex<double> *b, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*simatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        float alpha, float *ab, std::int64_t lda, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dimatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        double alpha, double *ab, std::int64_t lda, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cimatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zimatcopy_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*somatadd_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda, float beta,
+        const float *b, std::int64_t ldb, float *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*domatadd_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+        double beta, const double *b, std::int64_t ldb, double *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*comatadd_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+        std::int64_t lda, std::complex<float> beta, const std::complex<float> *b, std::int64_t ldb,
+        std::complex<float> *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zomatadd_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+        std::int64_t lda, std::complex<double> beta, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> *c, std::int64_t ldc,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*somatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        float alpha, const float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*domatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        double alpha, const double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*comatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zomatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*simatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        float alpha, float *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dimatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        double alpha, double *ab, std::int64_t lda, std::int64_t ldb, std::int64_t stride,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*cimatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<float> alpha, std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
+        std::int64_t stride, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zimatcopy_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::complex<double> alpha, std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
+        std::int64_t stride, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*somatadd_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
+        std::int64_t stride_a, float beta, const float *b, std::int64_t ldb, std::int64_t stride_b,
+        float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*domatadd_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
+        std::int64_t stride_a, double beta, const double *b, std::int64_t ldb,
+        std::int64_t stride_b, double *c, std::int64_t ldc, std::int64_t stride_c,
+        std::int64_t batch_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*comatadd_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
+        std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+        const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*zomatadd_batch_strided_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
+        std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+        const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*fgraph_replay_sycl)(
+        cl::sycl::queue &queue, const oneapi::mkl::blas::graph<float> &g,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    cl::sycl::event (*dgraph_replay_sycl)(
+        cl::sycl::queue &queue, const oneapi::mkl::blas::graph<double> &g,
+        const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+    void (*set_gemm_algorithm_sycl)(cl::sycl::queue &queue, oneapi::mkl::gemm_algorithm algorithm,
+                                    std::int64_t cutoff);
+    void (*set_reproducibility_sycl)(cl::sycl::queue &queue, oneapi::mkl::reproducibility mode);
+    void (*set_perf_counters_sycl)(cl::sycl::queue &queue, bool enable);
+    std::vector<oneapi::mkl::blas::perf_counter_record> (*get_perf_counters_sycl)(
+        cl::sycl::queue &queue);
 
 } function_table_t;
 
@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_GEMM_COALESCER_HPP_
+#define _ONEMKL_GEMM_COALESCER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+// Settings shared by every gemm_coalescer; max_batch < 2 disables coalescing.
+struct gemm_coalescing_settings {
+    std::atomic<std::int64_t> max_batch{ 0 };
+    std::atomic<std::int64_t> window_us{ 0 };
+    std::atomic<std::int64_t> max_size{ 0 };
+};
+
+// Runs f on the host from command group cgh. cgh.host_task is used where the
+// SYCL implementation provides it, run_on_host_intel otherwise.
+template <typename H, typename F>
+static inline auto coalescer_host_task(H &cgh, F f, int) -> decltype(cgh.host_task(f)) {
+    return cgh.host_task(f);
+}
+
+template <typename H, typename F>
+static inline void coalescer_host_task(H &cgh, F f, long) {
+    cgh.run_on_host_intel(f);
+}
+
+// Collects small USM gemm calls issued on the same out-of-order queue and
+// submits them as group gemm_batch calls, once max_batch calls are pending,
+// window_us microseconds after the first one arrived, or when flush() is
+// called. Calls with identical transposes, sizes, leading dimensions and
+// scalars share a group.
+//
+// Nothing is submitted for a call until its window is flushed, as SYCL has no
+// event that could stand for work not submitted yet: submit() waits, on the
+// host and never on a SYCL event, until the window closes, which is at most
+// window_us microseconds. The batch then depends on the dependencies of all
+// its calls, and each call gets the event of a no-op task of its own that
+// depends on the batch and holds the group arrays passed to gemm_batch until
+// the backend is done with them. Errors raised while submitting a batch are
+// rethrown from the submit() of each of its calls.
+//
+// Windows past their deadline are flushed by a timer thread that is started
+// by the first call and stopped by stop().
+template <typename T>
+class gemm_coalescer {
+public:
+    using batch_fn = cl::sycl::event (*)(
+        cl::sycl::queue &queue, transpose *transa, transpose *transb, std::int64_t *m,
+        std::int64_t *n, std::int64_t *k, T *alpha, const T **a, std::int64_t *lda, const T **b,
+        std::int64_t *ldb, T *beta, T **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const cl::sycl::vector_class<cl::sycl::event> &dependencies);
+
+    explicit gemm_coalescer(const gemm_coalescing_settings &settings) : settings_(settings) {}
+
+    // Calls that were never flushed fail rather than being submitted to a SYCL
+    // runtime that may already be shutting down.
+    ~gemm_coalescer() {
+        stop_timer();
+        for (auto &w : open_) {
+            for (auto &p : w->calls)
+                p->finish(cl::sycl::event(),
+                          std::make_exception_ptr(std::runtime_error(
+                              "gemm coalescing: call pending at exit was not flushed")));
+        }
+    }
+
+    bool accepts(const cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 std::int64_t k) const {
+        const std::int64_t max_size = settings_.max_size.load();
+        // Coalescing reorders calls made from different threads, which an
+        //  in-order queue does not allow.
+        return settings_.max_batch.load() > 1 && m <= max_size && n <= max_size &&
+               k <= max_size && !queue.has_property<cl::sycl::property::queue::in_order>();
+    }
+
+    cl::sycl::event submit(batch_fn batch, cl::sycl::queue &queue, transpose transa,
+                           transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                           T alpha, const T *a, std::int64_t lda, const T *b, std::int64_t ldb,
+                           T beta, T *c, std::int64_t ldc,
+                           const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+        auto p = std::make_shared<pending>(
+            call{ transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc }, dependencies);
+
+        std::shared_ptr<window> full;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::shared_ptr<window> w;
+            for (auto &open : open_) {
+                if (open->queue == queue && open->batch == batch) {
+                    w = open;
+                    break;
+                }
+            }
+            if (!w) {
+                w = std::make_shared<window>(queue, batch);
+                w->deadline = std::chrono::steady_clock::now() +
+                              std::chrono::microseconds(settings_.window_us.load());
+                open_.push_back(w);
+                if (!timer_.joinable() && !stopping_)
+                    timer_ = std::thread([this]() { run_timer(); });
+                timer_wake_.notify_one();
+            }
+            w->calls.push_back(p);
+            if (static_cast<std::int64_t>(w->calls.size()) >= settings_.max_batch.load() ||
+                stopping_) {
+                open_.remove(w);
+                full = w;
+            }
+        }
+        if (full)
+            flush(*full);
+        return p->wait();
+    }
+
+    // Submits every pending call now.
+    void flush() {
+        std::list<std::shared_ptr<window>> due;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            due.swap(open_);
+        }
+        for (auto &w : due)
+            flush(*w);
+    }
+
+    // Joins the timer thread and flushes the pending calls. The next call
+    // starts the timer again.
+    void stop() {
+        stop_timer();
+        flush();
+    }
+
+private:
+    struct call {
+        transpose transa, transb;
+        std::int64_t m, n, k;
+        T alpha;
+        const T *a;
+        std::int64_t lda;
+        const T *b;
+        std::int64_t ldb;
+        T beta;
+        T *c;
+        std::int64_t ldc;
+
+        bool same_group(const call &o) const {
+            return transa == o.transa && transb == o.transb && m == o.m && n == o.n && k == o.k &&
+                   lda == o.lda && ldb == o.ldb && ldc == o.ldc && alpha == o.alpha &&
+                   beta == o.beta;
+        }
+    };
+
+    // Group arrays handed to gemm_batch.
+    struct batch_arrays {
+        std::vector<transpose> transa, transb;
+        std::vector<std::int64_t> m, n, k, lda, ldb, ldc, group_size;
+        std::vector<T> alpha, beta;
+        std::vector<const T *> a, b;
+        std::vector<T *> c;
+    };
+
+    // One coalesced call, whose caller waits in submit() for its event.
+    struct pending {
+        pending(const call &args, const cl::sycl::vector_class<cl::sycl::event> &dependencies)
+                : args(args),
+                  dependencies(dependencies) {}
+
+        void finish(cl::sycl::event call_done, std::exception_ptr batch_error) {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = call_done;
+            error = batch_error;
+            submitted = true;
+            submitted_cv.notify_all();
+        }
+
+        // Waits for the window to be flushed and returns the event of the call.
+        cl::sycl::event wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            submitted_cv.wait(lock, [this] { return submitted; });
+            if (error)
+                std::rethrow_exception(error);
+            return done;
+        }
+
+        const call args;
+        const cl::sycl::vector_class<cl::sycl::event> dependencies;
+
+        std::mutex mutex;
+        std::condition_variable submitted_cv;
+        bool submitted = false;
+        cl::sycl::event done;
+        std::exception_ptr error;
+    };
+
+    struct window {
+        window(cl::sycl::queue &queue, batch_fn batch) : queue(queue), batch(batch) {}
+
+        cl::sycl::queue queue;
+        batch_fn batch;
+        std::chrono::steady_clock::time_point deadline;
+        std::vector<std::shared_ptr<pending>> calls;
+    };
+
+    static std::shared_ptr<batch_arrays> build_groups(
+        const std::vector<std::shared_ptr<pending>> &calls) {
+        auto arrays = std::make_shared<batch_arrays>();
+        std::vector<std::vector<std::size_t>> groups;
+        for (std::size_t i = 0; i < calls.size(); i++) {
+            std::size_t g = 0;
+            while (g < groups.size() && !calls[groups[g][0]]->args.same_group(calls[i]->args))
+                g++;
+            if (g == groups.size())
+                groups.emplace_back();
+            groups[g].push_back(i);
+        }
+        for (auto &members : groups) {
+            const call &p = calls[members[0]]->args;
+            arrays->transa.push_back(p.transa);
+            arrays->transb.push_back(p.transb);
+            arrays->m.push_back(p.m);
+            arrays->n.push_back(p.n);
+            arrays->k.push_back(p.k);
+            arrays->alpha.push_back(p.alpha);
+            arrays->lda.push_back(p.lda);
+            arrays->ldb.push_back(p.ldb);
+            arrays->beta.push_back(p.beta);
+            arrays->ldc.push_back(p.ldc);
+            arrays->group_size.push_back(members.size());
+            for (auto i : members) {
+                arrays->a.push_back(calls[i]->args.a);
+                arrays->b.push_back(calls[i]->args.b);
+                arrays->c.push_back(calls[i]->args.c);
+            }
+        }
+        return arrays;
+    }
+
+    // Submits a closed window as one batch that depends on the dependencies of
+    //  all its calls, then a no-op task per call that depends on the batch.
+    static void flush(window &w) {
+        cl::sycl::vector_class<cl::sycl::event> dependencies;
+        for (auto &p : w.calls)
+            dependencies.insert(dependencies.end(), p->dependencies.begin(),
+                                p->dependencies.end());
+        std::size_t finished = 0;
+        try {
+            const std::shared_ptr<batch_arrays> arrays = build_groups(w.calls);
+            const cl::sycl::event batch_done = w.batch(
+                w.queue, arrays->transa.data(), arrays->transb.data(), arrays->m.data(),
+                arrays->n.data(), arrays->k.data(), arrays->alpha.data(), arrays->a.data(),
+                arrays->lda.data(), arrays->b.data(), arrays->ldb.data(), arrays->beta.data(),
+                arrays->c.data(), arrays->ldc.data(), arrays->group_size.size(),
+                arrays->group_size.data(), dependencies);
+            for (; finished < w.calls.size(); finished++) {
+                auto done = w.queue.submit([&](cl::sycl::handler &cgh) {
+                    cgh.depends_on(batch_done);
+                    coalescer_host_task(cgh, [arrays]() {}, 0);
+                });
+                w.calls[finished]->finish(done, nullptr);
+            }
+        }
+        catch (...) {
+            for (; finished < w.calls.size(); finished++)
+                w.calls[finished]->finish(cl::sycl::event(), std::current_exception());
+        }
+    }
+
+    // Calls that arrive while the timer is being stopped are flushed at once.
+    void stop_timer() {
+        std::thread timer;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            timer.swap(timer_);
+        }
+        timer_wake_.notify_all();
+        if (timer.joinable())
+            timer.join();
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = false;
+    }
+
+    void run_timer() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            const auto now = std::chrono::steady_clock::now();
+            auto next = std::chrono::steady_clock::time_point::max();
+            std::vector<std::shared_ptr<window>> due;
+            for (auto it = open_.begin(); it != open_.end();) {
+                if ((*it)->deadline <= now) {
+                    due.push_back(*it);
+                    it = open_.erase(it);
+                }
+                else {
+                    next = std::min(next, (*it)->deadline);
+                    ++it;
+                }
+            }
+            if (!due.empty()) {
+                lock.unlock();
+                for (auto &w : due)
+                    flush(*w);
+                lock.lock();
+            }
+            else if (next == std::chrono::steady_clock::time_point::max()) {
+                timer_wake_.wait(lock);
+            }
+            else {
+                timer_wake_.wait_until(lock, next);
+            }
+        }
+    }
+
+    const gemm_coalescing_settings &settings_;
+    std::mutex mutex_;
+    std::condition_variable timer_wake_;
+    std::list<std::shared_ptr<window>> open_;
+    std::thread timer_;
+    bool stopping_ = false;
+};
+
+} // namespace detail
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_GEMM_COALESCER_HPP_
@@ -0,0 +1,215 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/blas/blas.hpp"
+#include "oneapi/mkl/blas/multi_queue.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+namespace {
+
+// Tiles kept in flight on each queue, so that a queue never waits for its
+// worker to submit the next one.
+constexpr std::size_t tiles_in_flight = 2;
+
+// Per-queue shares of the tiles. A worker takes tiles from the front of its
+// own share and, once that is empty, from the back of the largest other
+// share, which holds the tiles its owner would reach last.
+class tile_scheduler {
+public:
+    tile_scheduler(std::int64_t num_tiles, std::size_t num_workers) : shares_(num_workers) {
+        for (std::size_t w = 0; w < num_workers; w++) {
+            const std::int64_t begin = num_tiles * std::int64_t(w) / std::int64_t(num_workers);
+            const std::int64_t end = num_tiles * std::int64_t(w + 1) / std::int64_t(num_workers);
+            for (std::int64_t t = begin; t < end; t++)
+                shares_[w].push_back(t);
+        }
+    }
+
+    bool next(std::size_t worker, std::int64_t &tile) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!shares_[worker].empty()) {
+            tile = shares_[worker].front();
+            shares_[worker].pop_front();
+            return true;
+        }
+        auto victim = std::max_element(
+            shares_.begin(), shares_.end(),
+            [](const std::deque<std::int64_t> &x, const std::deque<std::int64_t> &y) {
+                return x.size() < y.size();
+            });
+        if (victim->empty())
+            return false;
+        tile = victim->back();
+        victim->pop_back();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::deque<std::int64_t>> shares_;
+};
+
+template <typename T>
+class multi_queue_done_kernel;
+
+template <typename T>
+cl::sycl::event gemm_multi_queue_impl(cl::sycl::vector_class<cl::sycl::queue> &queues,
+                                      transpose transa, transpose transb, std::int64_t m,
+                                      std::int64_t n, std::int64_t k, T alpha, const T *a,
+                                      std::int64_t lda, const T *b, std::int64_t ldb, T beta,
+                                      T *c, std::int64_t ldc,
+                                      const cl::sycl::vector_class<cl::sycl::event> &dependencies,
+                                      std::int64_t tile) {
+    if (queues.empty())
+        throw oneapi::mkl::InvalidArgumentsException("gemm_multi_queue: no queues given");
+    if (tile <= 0)
+        throw oneapi::mkl::InvalidArgumentsException("gemm_multi_queue: invalid tile size");
+    for (auto &queue : queues) {
+        if (queue.get_context() != queues[0].get_context())
+            throw oneapi::mkl::InvalidArgumentsException(
+                "gemm_multi_queue: queues must share one context");
+    }
+
+    // Tiles go down each block column of C, so that consecutive tiles, which
+    // usually land on the same queue, share their panel of op(B).
+    const std::int64_t tile_rows = (m + tile - 1) / tile;
+    const std::int64_t num_tiles = tile_rows * ((n + tile - 1) / tile);
+    const std::size_t num_workers =
+        std::max<std::size_t>(1, std::min<std::size_t>(queues.size(), num_tiles));
+    tile_scheduler scheduler(num_tiles, num_workers);
+
+    const bool trans_a = (transa != transpose::nontrans);
+    const bool trans_b = (transb != transpose::nontrans);
+    std::vector<cl::sycl::vector_class<cl::sycl::event>> pending(num_workers);
+    std::vector<std::exception_ptr> errors(num_workers);
+
+    auto worker = [&](std::size_t w) {
+        auto &in_flight = pending[w];
+        try {
+            std::int64_t t;
+            while (scheduler.next(w, t)) {
+                const std::int64_t i = (t % tile_rows) * tile, j = (t / tile_rows) * tile;
+                const T *a_tile = trans_a ? a + i * lda : a + i;
+                const T *b_tile = trans_b ? b + j : b + j * ldb;
+                in_flight.push_back(oneapi::mkl::blas::gemm(
+                    queues[w], transa, transb, std::min(tile, m - i), std::min(tile, n - j), k,
+                    alpha, a_tile, lda, b_tile, ldb, beta, c + i + j * ldc, ldc, dependencies));
+                if (in_flight.size() > tiles_in_flight) {
+                    in_flight.front().wait();
+                    in_flight.erase(in_flight.begin());
+                }
+            }
+        }
+        catch (...) {
+            errors[w] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t w = 1; w < num_workers; w++)
+        threads.emplace_back(worker, w);
+    worker(0);
+    for (auto &thread : threads)
+        thread.join();
+
+    cl::sycl::vector_class<cl::sycl::event> last;
+    for (std::size_t w = 0; w < num_workers; w++) {
+        if (errors[w]) {
+            for (auto &p : pending)
+                cl::sycl::event::wait(p);
+            std::rethrow_exception(errors[w]);
+        }
+        last.insert(last.end(), pending[w].begin(), pending[w].end());
+    }
+
+    // With no tiles, as when m or n is 0, the result still follows dependencies.
+    if (last.empty())
+        last = dependencies;
+#ifdef _WIN64
+    cl::sycl::event::wait(last);
+    return cl::sycl::event();
+#else
+    return queues[0].submit([&](cl::sycl::handler &cgh) {
+        for (auto &e : last)
+            cgh.depends_on(e);
+        cgh.single_task<multi_queue_done_kernel<T>>([]() {});
+    });
+#endif
+}
+
+} // namespace
+
+cl::sycl::vector_class<cl::sycl::queue> make_sub_device_queues(const cl::sycl::device &device) {
+    cl::sycl::vector_class<cl::sycl::device> sub_devices;
+    try {
+        sub_devices = device.create_sub_devices<
+            cl::sycl::info::partition_property::partition_by_affinity_domain>(
+            cl::sycl::info::partition_affinity_domain::numa);
+    }
+    catch (const cl::sycl::exception &) {
+    }
+    if (sub_devices.empty())
+        sub_devices.push_back(device);
+
+    cl::sycl::context context(sub_devices);
+    cl::sycl::vector_class<cl::sycl::queue> queues;
+    for (auto &sub_device : sub_devices)
+        queues.emplace_back(context, sub_device);
+    return queues;
+}
+
+cl::sycl::event gemm_multi_queue(cl::sycl::vector_class<cl::sycl::queue> &queues,
+                                 transpose transa, transpose transb, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, float alpha, const float *a,
+                                 std::int64_t lda, const float *b, std::int64_t ldb, float beta,
+                                 float *c, std::int64_t ldc,
+                                 const cl::sycl::vector_class<cl::sycl::event> &dependencies,
+                                 std::int64_t tile) {
+    return gemm_multi_queue_impl(queues, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, dependencies, tile);
+}
+
+cl::sycl::event gemm_multi_queue(cl::sycl::vector_class<cl::sycl::queue> &queues,
+                                 transpose transa, transpose transb, std::int64_t m,
+                                 std::int64_t n, std::int64_t k, double alpha, const double *a,
+                                 std::int64_t lda, const double *b, std::int64_t ldb, double beta,
+                                 double *c, std::int64_t ldc,
+                                 const cl::sycl::vector_class<cl::sycl::event> &dependencies,
+                                 std::int64_t tile) {
+    return gemm_multi_queue_impl(queues, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, dependencies, tile);
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
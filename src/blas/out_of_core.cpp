@@ -0,0 +1,303 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/blas/blas.hpp"
+#include "oneapi/mkl/blas/out_of_core.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+
+namespace {
+
+// A whole file mapped into memory. Writable mappings are shared, so that
+// stores through them reach the file.
+class mapped_file {
+public:
+    mapped_file(const std::string &path, bool writable) : path_(path) {
+        fd_ = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+        if (fd_ < 0)
+            fail("open");
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            ::close(fd_);
+            fail("stat");
+        }
+        size_ = st.st_size;
+        if (size_ > 0) {
+            void *data = ::mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                                MAP_SHARED, fd_, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd_);
+                fail("map");
+            }
+            data_ = static_cast<char *>(data);
+        }
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    ~mapped_file() {
+        if (data_)
+            ::munmap(data_, size_);
+        ::close(fd_);
+    }
+
+    char *data() const {
+        return data_;
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    const std::string &path() const {
+        return path_;
+    }
+
+    // Applies madvise or msync to the pages covering [begin, end).
+    void advise(std::size_t begin, std::size_t end, int advice) const {
+        char *first = page_begin(begin);
+        ::madvise(first, data_ + end - first, advice);
+    }
+    void sync(std::size_t begin, std::size_t end) const {
+        char *first = page_begin(begin);
+        ::msync(first, data_ + end - first, MS_ASYNC);
+    }
+
+private:
+    char *page_begin(std::size_t offset) const {
+        static const std::size_t page = ::sysconf(_SC_PAGESIZE);
+        return data_ + offset / page * page;
+    }
+
+    [[noreturn]] void fail(const char *what) const {
+        throw oneapi::mkl::InvalidArgumentsException("gemm_out_of_core: cannot " +
+                                                     std::string(what) + " " + path_ + ": " +
+                                                     std::strerror(errno));
+    }
+
+    std::string path_;
+    int fd_ = -1;
+    char *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// A rows-by-cols column-major matrix inside a mapped file.
+template <typename T>
+struct file_view {
+    const mapped_file &file;
+    std::int64_t rows, cols, ld, offset;
+
+    std::size_t column(std::int64_t j) const {
+        return offset + j * ld * sizeof(T);
+    }
+
+    void check(const char *name) const {
+        if (ld < std::max<std::int64_t>(1, rows) || offset < 0)
+            throw oneapi::mkl::InvalidArgumentsException(
+                std::string("gemm_out_of_core: invalid leading dimension or offset for ") + name);
+        if (rows > 0 && cols > 0 && column(cols - 1) + rows * sizeof(T) > file.size())
+            throw oneapi::mkl::InvalidArgumentsException("gemm_out_of_core: " + file.path() +
+                                                         " is too small for " + name);
+    }
+
+    // Hints that the block at (row, col) will be read soon.
+    void prefetch(std::int64_t row, std::int64_t col, std::int64_t nrows,
+                  std::int64_t ncols) const {
+        if (nrows > 0 && ncols > 0)
+            file.advise(column(col) + row * sizeof(T),
+                        column(col + ncols - 1) + (row + nrows) * sizeof(T), MADV_WILLNEED);
+    }
+
+    // Copies the block at (row, col) to dst, with leading dimension nrows.
+    void load(std::int64_t row, std::int64_t col, std::int64_t nrows, std::int64_t ncols,
+              T *dst) const {
+        for (std::int64_t j = 0; j < ncols; j++)
+            std::memcpy(dst + j * nrows, file.data() + column(col + j) + row * sizeof(T),
+                        nrows * sizeof(T));
+    }
+
+    // Copies src, with leading dimension nrows, to the block at (row, col)
+    // and starts writing it back to the file.
+    void store(std::int64_t row, std::int64_t col, std::int64_t nrows, std::int64_t ncols,
+               const T *src) const {
+        for (std::int64_t j = 0; j < ncols; j++)
+            std::memcpy(file.data() + column(col + j) + row * sizeof(T), src + j * nrows,
+                        nrows * sizeof(T));
+        if (nrows > 0 && ncols > 0)
+            file.sync(column(col) + row * sizeof(T),
+                      column(col + ncols - 1) + (row + nrows) * sizeof(T));
+    }
+};
+
+template <typename T>
+struct usm_deleter {
+    cl::sycl::context context;
+    void operator()(T *ptr) const {
+        cl::sycl::free(ptr, context);
+    }
+};
+
+template <typename T>
+using usm_ptr = std::unique_ptr<T, usm_deleter<T>>;
+
+template <typename T>
+usm_ptr<T> allocate(cl::sycl::queue &queue, std::int64_t count) {
+    T *ptr = static_cast<T *>(
+        cl::sycl::malloc_shared(count * sizeof(T), queue.get_device(), queue.get_context()));
+    if (!ptr)
+        throw oneapi::mkl::MemoryAllocationException("gemm_out_of_core: cannot allocate tiles");
+    return usm_ptr<T>(ptr, usm_deleter<T>{ queue.get_context() });
+}
+
+// One gemm call of the schedule: the K panel starting at l of the C tile at
+// (i, j).
+struct tile_step {
+    std::int64_t i, j, l;
+    std::int64_t mb, nb, kb;
+};
+
+template <typename T>
+void gemm_out_of_core_impl(cl::sycl::queue &queue, transpose transa, transpose transb,
+                           std::int64_t m, std::int64_t n, std::int64_t k, T alpha,
+                           const file_matrix &a, const file_matrix &b, T beta,
+                           const file_matrix &c, std::int64_t tile) {
+    if (m < 0 || n < 0 || k < 0 || tile <= 0)
+        throw oneapi::mkl::InvalidArgumentsException(
+            "gemm_out_of_core: invalid size or tile size");
+    if (m == 0 || n == 0)
+        return;
+
+    const bool trans_a = (transa != transpose::nontrans);
+    const bool trans_b = (transb != transpose::nontrans);
+    mapped_file a_file(a.path, false), b_file(b.path, false), c_file(c.path, true);
+    const file_view<T> a_view{ a_file, trans_a ? k : m, trans_a ? m : k, a.ld, a.offset };
+    const file_view<T> b_view{ b_file, trans_b ? n : k, trans_b ? k : n, b.ld, b.offset };
+    const file_view<T> c_view{ c_file, m, n, c.ld, c.offset };
+    a_view.check("A");
+    b_view.check("B");
+    c_view.check("C");
+
+    // Tiles of C go down columns, and each runs through K in panels; k == 0
+    // still needs one step per tile to scale C by beta.
+    std::vector<tile_step> steps;
+    for (std::int64_t j = 0; j < n; j += tile)
+        for (std::int64_t i = 0; i < m; i += tile)
+            for (std::int64_t l = 0; l < std::max<std::int64_t>(k, 1); l += tile)
+                steps.push_back({ i, j, l, std::min(tile, m - i), std::min(tile, n - j),
+                                  std::min(tile, k - l) });
+
+    // Two of each buffer: one in use by gemm, one being filled or drained.
+    const std::int64_t tile_size = tile * tile;
+    usm_ptr<T> a_tiles[2] = { allocate<T>(queue, tile_size), allocate<T>(queue, tile_size) };
+    usm_ptr<T> b_tiles[2] = { allocate<T>(queue, tile_size), allocate<T>(queue, tile_size) };
+    usm_ptr<T> c_tiles[2] = { allocate<T>(queue, tile_size), allocate<T>(queue, tile_size) };
+
+    // Step s uses A and B buffers s % 2 and, as part of the t-th C tile, C
+    // buffer t % 2. The first step of a tile also loads its C tile.
+    auto a_block = [&](const tile_step &s, T *dst, bool load) {
+        const std::int64_t row = trans_a ? s.l : s.i, col = trans_a ? s.i : s.l;
+        const std::int64_t rows = trans_a ? s.kb : s.mb, cols = trans_a ? s.mb : s.kb;
+        load ? a_view.load(row, col, rows, cols, dst) : a_view.prefetch(row, col, rows, cols);
+    };
+    auto b_block = [&](const tile_step &s, T *dst, bool load) {
+        const std::int64_t row = trans_b ? s.j : s.l, col = trans_b ? s.l : s.j;
+        const std::int64_t rows = trans_b ? s.nb : s.kb, cols = trans_b ? s.kb : s.nb;
+        load ? b_view.load(row, col, rows, cols, dst) : b_view.prefetch(row, col, rows, cols);
+    };
+    auto read_step = [&](std::size_t s, std::int64_t t) {
+        const tile_step &step = steps[s];
+        if (s + 1 < steps.size()) {
+            a_block(steps[s + 1], nullptr, false);
+            b_block(steps[s + 1], nullptr, false);
+        }
+        a_block(step, a_tiles[s % 2].get(), true);
+        b_block(step, b_tiles[s % 2].get(), true);
+        if (step.l == 0 && beta != T(0))
+            c_view.load(step.i, step.j, step.mb, step.nb, c_tiles[t % 2].get());
+    };
+
+    std::future<void> pending_read = std::async(std::launch::async, read_step, 0, 0);
+    std::future<void> pending_write;
+    std::int64_t t = 0;
+    for (std::size_t s = 0; s < steps.size(); s++) {
+        const tile_step &step = steps[s];
+        pending_read.get();
+        if (s + 1 < steps.size()) {
+            const bool next_tile = (steps[s + 1].l == 0);
+            // The next tile reuses the C buffer of the tile before this one.
+            if (next_tile && pending_write.valid())
+                pending_write.get();
+            pending_read =
+                std::async(std::launch::async, read_step, s + 1, next_tile ? t + 1 : t);
+        }
+
+        const T *a_ptr = a_tiles[s % 2].get();
+        const T *b_ptr = b_tiles[s % 2].get();
+        T *c_ptr = c_tiles[t % 2].get();
+        const std::int64_t lda = std::max<std::int64_t>(1, trans_a ? step.kb : step.mb);
+        const std::int64_t ldb = std::max<std::int64_t>(1, trans_b ? step.nb : step.kb);
+        oneapi::mkl::blas::gemm(queue, transa, transb, step.mb, step.nb, step.kb, alpha, a_ptr,
+                                lda, b_ptr, ldb, (step.l == 0) ? beta : T(1), c_ptr, step.mb,
+                                {})
+            .wait();
+
+        if (s + 1 == steps.size() || steps[s + 1].l == 0) {
+            pending_write = std::async(std::launch::async, [&c_view, step, c_ptr]() {
+                c_view.store(step.i, step.j, step.mb, step.nb, c_ptr);
+            });
+            t++;
+        }
+    }
+    pending_write.get();
+}
+
+} // namespace
+
+void gemm_out_of_core(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                      std::int64_t n, std::int64_t k, float alpha, const file_matrix &a,
+                      const file_matrix &b, float beta, const file_matrix &c, std::int64_t tile) {
+    gemm_out_of_core_impl(queue, transa, transb, m, n, k, alpha, a, b, beta, c, tile);
+}
+
+void gemm_out_of_core(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                      std::int64_t n, std::int64_t k, double alpha, const file_matrix &a,
+                      const file_matrix &b, double beta, const file_matrix &c, std::int64_t tile) {
+    gemm_out_of_core_impl(queue, transa, transb, m, n, k, alpha, a, b, beta, c, tile);
+}
+
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
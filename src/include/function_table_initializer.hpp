@@ -21,7 +21,11 @@
 #define _LOADER_HPP_
 
 #include <cstdint>
+#include <cstdlib>
 #include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 
 #include "oneapi/mkl/detail/backends_table.hpp"
 
@@ -58,7 +62,11 @@ class table_initializer {
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
 public:
+    // Calls may come from several threads at once, e.g. the workers of
+    // gemm_multi_queue, so the first call for a device loads its backend
+    // under a lock. Tables are never removed, so references stay valid.
     function_table_t &operator[](oneapi::mkl::device key) {
+        std::lock_guard<std::mutex> lock(mutex);
         auto lib = tables.find(key);
         if (lib != tables.end())
             return lib->second;
@@ -91,12 +99,21 @@ private:
 
     function_table_t &add_table(oneapi::mkl::device key) {
         dlhandle handle;
+        // ONEMKL_CPU_BACKEND=mklcpu or cblas picks one CPU backend when both are built
+        const char *cpu_backend =
+            (key == oneapi::mkl::device::x86cpu) ? std::getenv("ONEMKL_CPU_BACKEND") : nullptr;
+        const std::string suffix = cpu_backend ? std::string("_") + cpu_backend + "." : "";
         // check all available libraries for the key(device)
         for (const char *libname : libraries[domain_id][key]) {
+            if (cpu_backend && std::string(libname).find(suffix) == std::string::npos)
+                continue;
             handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
             if (handle)
                 break;
         }
+        if (!handle && cpu_backend)
+            throw std::runtime_error{ std::string("Couldn't load the CPU backend ") +
+                                      cpu_backend + " named by ONEMKL_CPU_BACKEND" };
         if (!handle) {
             std::cerr << ERROR_MSG << '\n';
             throw std::runtime_error{ "Couldn't load selected backend" };
@@ -113,9 +130,10 @@ private:
 
         handles[key] = std::move(handle);
         tables[key] = *t;
-        return *t;
+        return tables[key];
     }
 
+    std::mutex mutex;
     std::map<oneapi::mkl::device, function_table_t> tables;
     std::map<oneapi::mkl::device, dlhandle> handles;
 };
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef __GRAPH_REPLAY_HELPER_HPP
+#define __GRAPH_REPLAY_HELPER_HPP
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <utility>
+
+#include "oneapi/mkl/blas/graph.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+// GRAPH_REPLAY_ROUTINE forwards one routine of a backend namespace, so that
+//  a backend can describe its routines to replay_eager as a struct of them.
+#define GRAPH_REPLAY_ROUTINE(BACKEND, ROUTINE)                                                     \
+    template <typename... Args>                                                                    \
+    static auto ROUTINE(Args &&... args)                                                           \
+        -> decltype(oneapi::mkl::BACKEND::ROUTINE(std::forward<Args>(args)...)) {                  \
+        return oneapi::mkl::BACKEND::ROUTINE(std::forward<Args>(args)...);                         \
+    }
+
+#define GRAPH_REPLAY_ROUTINES(BACKEND)                                                             \
+    GRAPH_REPLAY_ROUTINE(BACKEND, axpy)                                                            \
+    GRAPH_REPLAY_ROUTINE(BACKEND, scal)                                                            \
+    GRAPH_REPLAY_ROUTINE(BACKEND, copy)                                                            \
+    GRAPH_REPLAY_ROUTINE(BACKEND, dot)                                                             \
+    GRAPH_REPLAY_ROUTINE(BACKEND, gemv)                                                            \
+    GRAPH_REPLAY_ROUTINE(BACKEND, gemm)
+
+template <typename T>
+class graph_replay_start_kernel;
+
+template <typename T>
+class graph_replay_done_kernel;
+
+// Submits an empty kernel that takes every buffer of a graph for read_write,
+//  so that it is ordered after every earlier access to them and before every
+//  later one.
+template <typename K, typename T>
+cl::sycl::event order_graph_buffers(cl::sycl::queue &queue,
+                                    const oneapi::mkl::blas::graph<T> &g,
+                                    const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        for (auto &e : dependencies)
+            cgh.depends_on(e);
+        for (auto &buffer : g.buffers())
+            buffer->template get_access<cl::sycl::access::mode::read_write>(cgh);
+        cgh.single_task<K>([]() {});
+    });
+}
+
+// replay_eager replays a graph by submitting each recorded call on its own,
+//  for backends that have no cheaper way to run a sequence. USM calls are
+//  chained through their events. Buffer calls take no events and are ordered
+//  by their accessors, so the dependencies are passed to an empty kernel
+//  holding every buffer of the graph ahead of the first call, and a second
+//  one after the last call provides the returned event.
+template <typename Routines, typename T>
+cl::sycl::event replay_eager(cl::sycl::queue &queue, const oneapi::mkl::blas::graph<T> &g,
+                             const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
+    using oneapi::mkl::blas::graph_routine;
+    auto &scalars = g.scalars();
+
+    if (g.uses_buffers()) {
+        if (!dependencies.empty())
+            order_graph_buffers<graph_replay_start_kernel<T>>(queue, g, dependencies);
+        auto &buffers = g.buffers();
+        for (auto &node : g.nodes()) {
+            const T alpha = (node.alpha >= 0) ? scalars[node.alpha] : T(0);
+            const T beta = (node.beta >= 0) ? scalars[node.beta] : T(0);
+            switch (node.routine) {
+                case graph_routine::axpy:
+                    Routines::axpy(queue, node.n, alpha, *buffers[node.buffer_a], node.lda,
+                                   *buffers[node.buffer_b], node.ldb);
+                    break;
+                case graph_routine::scal:
+                    Routines::scal(queue, node.n, alpha, *buffers[node.buffer_a], node.lda);
+                    break;
+                case graph_routine::copy:
+                    Routines::copy(queue, node.n, *buffers[node.buffer_a], node.lda,
+                                   *buffers[node.buffer_b], node.ldb);
+                    break;
+                case graph_routine::dot:
+                    Routines::dot(queue, node.n, *buffers[node.buffer_a], node.lda,
+                                  *buffers[node.buffer_b], node.ldb, *buffers[node.buffer_c]);
+                    break;
+                case graph_routine::gemv:
+                    Routines::gemv(queue, node.transa, node.m, node.n, alpha,
+                                   *buffers[node.buffer_a], node.lda, *buffers[node.buffer_b],
+                                   node.ldb, beta, *buffers[node.buffer_c], node.ldc);
+                    break;
+                case graph_routine::gemm:
+                    Routines::gemm(queue, node.transa, node.transb, node.m, node.n, node.k,
+                                   alpha, *buffers[node.buffer_a], node.lda,
+                                   *buffers[node.buffer_b], node.ldb, beta,
+                                   *buffers[node.buffer_c], node.ldc);
+                    break;
+            }
+        }
+        return order_graph_buffers<graph_replay_done_kernel<T>>(queue, g, {});
+    }
+
+    cl::sycl::event done;
+    cl::sycl::vector_class<cl::sycl::event> deps(dependencies);
+    for (auto &node : g.nodes()) {
+        const T alpha = (node.alpha >= 0) ? scalars[node.alpha] : T(0);
+        const T beta = (node.beta >= 0) ? scalars[node.beta] : T(0);
+        const T *a = node.a;
+        const T *b = node.b;
+        switch (node.routine) {
+            case graph_routine::axpy:
+                done = Routines::axpy(queue, node.n, alpha, a, node.lda, node.b, node.ldb, deps);
+                break;
+            case graph_routine::scal:
+                done = Routines::scal(queue, node.n, alpha, node.a, node.lda, deps);
+                break;
+            case graph_routine::copy:
+                done = Routines::copy(queue, node.n, a, node.lda, node.b, node.ldb, deps);
+                break;
+            case graph_routine::dot:
+                done = Routines::dot(queue, node.n, a, node.lda, b, node.ldb, node.c, deps);
+                break;
+            case graph_routine::gemv:
+                done = Routines::gemv(queue, node.transa, node.m, node.n, alpha, a, node.lda, b,
+                                      node.ldb, beta, node.c, node.ldc, deps);
+                break;
+            case graph_routine::gemm:
+                done = Routines::gemm(queue, node.transa, node.transb, node.m, node.n, node.k,
+                                      alpha, a, node.lda, b, node.ldb, beta, node.c, node.ldc,
+                                      deps);
+                break;
+        }
+        deps = { done };
+    }
+    return done;
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif // __GRAPH_REPLAY_HELPER_HPP
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef __OUTPUT_ACCESS_HELPER_HPP
+#define __OUTPUT_ACCESS_HELPER_HPP
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+namespace oneapi {
+namespace mkl {
+
+// Returns true if a routine computing alpha*op(...) + beta*C overwrites every
+// element of the buffer c without reading it. This is the case when beta is
+// zero and c holds exactly the rows-by-cols result with leading dimension ld.
+// Vectors are described as 1-by-n matrices with leading dimension incy.
+// Backends request discard_write access for such outputs, so the runtime does
+// not copy in contents that are never read.
+template <typename T, typename S>
+static inline bool is_write_only(cl::sycl::buffer<T, 1> &c, S beta, std::int64_t rows,
+                                 std::int64_t cols, std::int64_t ld) {
+    return beta == S(0) && ld == rows && c.get_count() == static_cast<std::size_t>(rows * cols);
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif // __OUTPUT_ACCESS_HELPER_HPP
@@ -105,14 +105,14 @@ int test(const device &dev, int64_t batch_size) {
     int ldb_ref = (int)ldb;
     int ldc_ref = (int)ldc;
     int batch_size_ref = (int)batch_size;
-    for (i = 0; i < batch_size_ref; i++) {
+    blocked_ref::parallel_for(batch_size_ref, [&](int i) {
         ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), (const int *)&m_ref,
                (const int *)&n_ref, (const int *)&k_ref, (const fp_ref *)&alpha,
                (const fp_ref *)(A.data() + stride_a * i), (const int *)&lda_ref,
                (const fp_ref *)(B.data() + stride_b * i), (const int *)&ldb_ref,
                (const fp_ref *)&beta, (fp_ref *)(C_ref.data() + stride_c * i),
                (const int *)&ldc_ref);
-    }
+    });
 
     // Call DPC++ GEMM_BATCH_STRIDE.
 
@@ -199,13 +199,15 @@ int test(const device &dev, int64_t group_count) {
         ldb_ref[i] = (int)ldb[i];
         ldc_ref[i] = (int)ldc[i];
         group_size_ref[i] = (int)group_size[i];
-        for (j = 0; j < group_size_ref[i]; j++) {
+        blocked_ref::parallel_for(group_size_ref[i], [&](int j) {
             ::gemm(transa_ref[i], transb_ref[i], (const int *)&m_ref[i], (const int *)&n_ref[i],
-                   (const int *)&k_ref[i], (const fp_ref *)&alpha[i], (const fp_ref *)a_array[idx],
-                   (const int *)&lda_ref[i], (const fp_ref *)b_array[idx], (const int *)&ldb_ref[i],
-                   (const fp_ref *)&beta[i], (fp_ref *)c_ref_array[idx], (const int *)&ldc_ref[i]);
-            idx++;
-        }
+                   (const int *)&k_ref[i], (const fp_ref *)&alpha[i],
+                   (const fp_ref *)a_array[idx + j], (const int *)&lda_ref[i],
+                   (const fp_ref *)b_array[idx + j], (const int *)&ldb_ref[i],
+                   (const fp_ref *)&beta[i], (fp_ref *)c_ref_array[idx + j],
+                   (const int *)&ldc_ref[i]);
+        });
+        idx += group_size_ref[i];
     }
 
     // Call DPC++ GEMM_BATCH.
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device& dev, int num_calls, int max_batch, int window_us, bool threaded) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    // Prepare data. Odd calls use a second shape and transposes so that a
+    // window holds more than one group.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<vector<fp, decltype(ua)>> A, B, C;
+    vector<vector<fp, allocator_helper<fp, 64>>> C_ref(num_calls);
+    vector<oneapi::mkl::transpose> transa(num_calls), transb(num_calls);
+    vector<int> m(num_calls), n(num_calls), k(num_calls);
+    fp alpha(2.0), beta(3.0);
+
+    for (int i = 0; i < num_calls; i++) {
+        transa[i] = (i % 2) ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
+        transb[i] = oneapi::mkl::transpose::nontrans;
+        m[i] = (i % 2) ? 48 : 64;
+        n[i] = (i % 2) ? 40 : 64;
+        k[i] = (i % 2) ? 56 : 64;
+        A.emplace_back(ua);
+        B.emplace_back(ua);
+        C.emplace_back(ua);
+        rand_matrix(A[i], transa[i], m[i], k[i], 64);
+        rand_matrix(B[i], transb[i], k[i], n[i], 64);
+        rand_matrix(C[i], oneapi::mkl::transpose::nontrans, m[i], n[i], 64);
+        C_ref[i].assign(C[i].begin(), C[i].end());
+    }
+
+    // Call Reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int ld_ref = 64;
+
+    for (int i = 0; i < num_calls; i++) {
+        ::gemm(convert_to_cblas_trans(transa[i]), convert_to_cblas_trans(transb[i]), &m[i], &n[i],
+               &k[i], (fp_ref*)&alpha, (fp_ref*)A[i].data(), &ld_ref, (fp_ref*)B[i].data(),
+               &ld_ref, (fp_ref*)&beta, (fp_ref*)C_ref[i].data(), &ld_ref);
+    }
+
+    // Call DPC++ GEMM either from one thread per call, as independent request
+    // handlers would, or all from this thread, where each call returns once
+    // its window closes.
+    std::atomic<bool> unsupported(false);
+    oneapi::mkl::blas::set_gemm_coalescing(max_batch, window_us);
+    vector<cl::sycl::event> done(num_calls);
+    auto call = [&](int i) {
+        done[i] = oneapi::mkl::blas::gemm(main_queue, transa[i], transb[i], m[i], n[i], k[i],
+                                          alpha, A[i].data(), 64, B[i].data(), 64, beta,
+                                          C[i].data(), 64);
+        if (threaded)
+            done[i].wait();
+    };
+    vector<std::thread> callers;
+    for (int i = 0; i < num_calls; i++) {
+        auto caller = [&, i]() {
+            try {
+                call(i);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught synchronous SYCL exception during GEMM:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+
+            catch (const oneapi::mkl::backend_unsupported_exception& e) {
+                unsupported = true;
+            }
+
+            catch (const std::runtime_error& error) {
+                std::cout << "Error raised during execution of GEMM:\n"
+                          << error.what() << std::endl;
+            }
+        };
+        if (threaded)
+            callers.emplace_back(caller);
+        else
+            caller();
+    }
+    for (auto& caller : callers)
+        caller.join();
+    if (!threaded)
+        cl::sycl::event::wait(done);
+    oneapi::mkl::blas::set_gemm_coalescing(0);
+
+    if (unsupported)
+        return test_skipped;
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = true;
+    for (int i = 0; i < num_calls; i++)
+        good = good && check_equal_matrix(C[i], C_ref[i], m[i], n[i], 64, 10 * k[i], std::cout);
+
+    return (int)good;
+#else
+    // Coalescing is a property of the run-time dispatch path.
+    return test_skipped;
+#endif
+}
+
+class GemmCoalescedUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmCoalescedUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 13, 4, 100000, true));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 13, 4, 1000, false));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, 64, 200, true));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5, 64, 200, false));
+}
+
+TEST_P(GemmCoalescedUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 13, 4, 100000, true));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 13, 4, 1000, false));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, 64, 200, true));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5, 64, 200, false));
+}
+
+TEST_P(GemmCoalescedUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 13, 4, 100000, true));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 13, 4, 1000, false));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, 64, 200, true));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5, 64, 200, false));
+}
+
+TEST_P(GemmCoalescedUsmTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 13, 4, 100000, true));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 13, 4, 1000, false));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, 64, 200, true));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5, 64, 200, false));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmCoalescedUsmTestSuite, GemmCoalescedUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
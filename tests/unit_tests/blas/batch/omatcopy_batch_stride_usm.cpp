@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int64_t batch_size) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during OMATCOPY_BATCH_STRIDE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    int64_t m, n;
+    int64_t lda, ldb;
+    oneapi::mkl::transpose trans;
+    fp alpha;
+
+    int64_t i, tmp;
+
+    batch_size = 1 + std::rand() % 20;
+    m = 1 + std::rand() % 500;
+    n = 1 + std::rand() % 500;
+    lda = m;
+    ldb = std::max(m, n);
+    alpha = rand_scalar<fp>();
+    if ((std::is_same<fp, float>::value) || (std::is_same<fp, double>::value)) {
+        trans = (oneapi::mkl::transpose)(std::rand() % 2);
+    }
+    else {
+        tmp = std::rand() % 3;
+        if (tmp == 2)
+            trans = oneapi::mkl::transpose::conjtrans;
+        else
+            trans = (oneapi::mkl::transpose)tmp;
+    }
+
+    int64_t stride_a, stride_b;
+
+    stride_a = lda * n;
+    stride_b = (trans == oneapi::mkl::transpose::nontrans) ? ldb * n : ldb * m;
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), B_ref(ua);
+
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, stride_a * batch_size, 1,
+                stride_a * batch_size);
+    rand_matrix(B, oneapi::mkl::transpose::nontrans, stride_b * batch_size, 1,
+                stride_b * batch_size);
+    copy_matrix(B, oneapi::mkl::transpose::nontrans, stride_b * batch_size, 1,
+                stride_b * batch_size, B_ref);
+
+    // Call reference OMATCOPY_BATCH_STRIDE.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref = (int)m;
+    int n_ref = (int)n;
+    int lda_ref = (int)lda;
+    int ldb_ref = (int)ldb;
+    int batch_size_ref = (int)batch_size;
+    for (i = 0; i < batch_size_ref; i++) {
+        ::omatcopy(convert_to_cblas_trans(trans), (const int *)&m_ref, (const int *)&n_ref,
+                   (const fp_ref *)&alpha, (const fp_ref *)&A[i * stride_a],
+                   (const int *)&lda_ref, (fp_ref *)&B_ref[i * stride_b], (const int *)&ldb_ref);
+    }
+
+    // Call DPC++ OMATCOPY_BATCH_STRIDE.
+
+    try {
+#ifdef CALL_RT_API
+        done = oneapi::mkl::blas::omatcopy_batch(main_queue, trans, m, n, alpha, &A[0], lda,
+                                                 stride_a, &B[0], ldb, stride_b, batch_size,
+                                                 dependencies);
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::omatcopy_batch,
+                    (main_queue, trans, m, n, alpha, &A[0], lda, stride_a, &B[0], ldb, stride_b,
+                     batch_size, dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during OMATCOPY_BATCH_STRIDE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of OMATCOPY_BATCH_STRIDE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(B, B_ref, stride_b * batch_size, 1, stride_b * batch_size, 10,
+                                   std::cout);
+
+    return (int)good;
+}
+
+class OmatcopyBatchStrideUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(OmatcopyBatchStrideUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 5));
+}
+
+TEST_P(OmatcopyBatchStrideUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 5));
+}
+
+TEST_P(OmatcopyBatchStrideUsmTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 5));
+}
+
+TEST_P(OmatcopyBatchStrideUsmTests, ComplexDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(OmatcopyBatchStrideUsmTestSuite, OmatcopyBatchStrideUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -105,13 +105,13 @@ int test(const device &dev) {
     lda_ref = (int)lda;
     ldb_ref = (int)ldb;
     batch_size_ref = (int)batch_size;
-    for (i = 0; i < batch_size_ref; i++) {
+    blocked_ref::parallel_for(batch_size_ref, [&](int i) {
         ::trsm(convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
                convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int *)&m_ref,
                (const int *)&n_ref, (const fp_ref *)&alpha,
                (const fp_ref *)(A.data() + stride_a * i), (const int *)&lda_ref,
                (fp_ref *)(B_ref.data() + stride_b * i), (const int *)&ldb_ref);
-    }
+    });
 
     // Call DPC++ TRSM_BATCH_STRIDE.
 
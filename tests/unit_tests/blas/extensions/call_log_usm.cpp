@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/call_log.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Records an AXPY and a GEMM made through run-time dispatch, then reads the
+// log back and checks the routines, queues and arguments it holds.
+template <typename fp>
+int test(const device& dev, const char* axpy_entry, const char* gemm_entry) {
+#if defined(CALL_RT_API) && defined(__linux__)
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during CALL_LOG:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler), other_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    const int N = 37, incx = 2, incy = 1, m = 5, n = 4, k = 3;
+    fp alpha(2.0), beta(0.5);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), A(ua), B(ua), C(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, m, k, m);
+    rand_matrix(B, oneapi::mkl::transpose::trans, k, n, n);
+    rand_matrix(C, oneapi::mkl::transpose::nontrans, m, n, m);
+
+    const std::string path = "onemkl_call_log_test_" + std::string(gemm_entry) + ".log";
+
+    // Call DPC++ AXPY and GEMM while recording.
+    try {
+        oneapi::mkl::blas::start_call_recording(path);
+        done = oneapi::mkl::blas::axpy(main_queue, N, alpha, x.data(), incx, y.data(), incy,
+                                       dependencies);
+        done = oneapi::mkl::blas::gemm(other_queue, oneapi::mkl::transpose::nontrans,
+                                       oneapi::mkl::transpose::trans, m, n, k, alpha, A.data(), m,
+                                       B.data(), n, beta, C.data(), m, { done });
+        done.wait();
+        oneapi::mkl::blas::stop_call_recording();
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during CALL_LOG:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        oneapi::mkl::blas::stop_call_recording();
+        return false;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        oneapi::mkl::blas::stop_call_recording();
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of CALL_LOG:\n" << error.what() << std::endl;
+        oneapi::mkl::blas::stop_call_recording();
+        return false;
+    }
+
+    // Read the log back.
+    bool good = true;
+    {
+        oneapi::mkl::blas::call_log log(path);
+        oneapi::mkl::blas::call_entry call;
+
+        good = good && log.next(call) && call.routine == axpy_entry && call.queue == 0;
+        good = good && call.args.size() == 7;
+        good = good && call.args[0].value<std::int64_t>() == N;
+        good = good && call.args[1].value<fp>() == alpha;
+        good = good && call.args[2].kind == oneapi::mkl::blas::call_arg_kind::pointer;
+        good = good && call.args[2].address == std::uint64_t(std::uintptr_t(x.data()));
+        good = good && call.args[3].value<std::int64_t>() == incx;
+        good = good && call.args[6].kind == oneapi::mkl::blas::call_arg_kind::events;
+        good = good && call.args[6].count == 0;
+
+        good = good && log.next(call) && call.routine == gemm_entry && call.queue == 1;
+        good = good && call.args.size() == 14;
+        good = good && call.args[0].value<oneapi::mkl::transpose>() ==
+                           oneapi::mkl::transpose::nontrans;
+        good = good &&
+               call.args[1].value<oneapi::mkl::transpose>() == oneapi::mkl::transpose::trans;
+        good = good && call.args[2].value<std::int64_t>() == m;
+        good = good && call.args[3].value<std::int64_t>() == n;
+        good = good && call.args[4].value<std::int64_t>() == k;
+        good = good && call.args[10].value<fp>() == beta;
+        good = good && call.args[13].count == 1;
+
+        good = good && !log.next(call);
+    }
+    std::remove(path.c_str());
+
+    return (int)good;
+#else
+    // Call recording is part of the run-time dispatch library on Linux.
+    return test_skipped;
+#endif
+}
+
+class CallLogUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(CallLogUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "saxpy_usm", "sgemm_usm"));
+}
+TEST_P(CallLogUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "daxpy_usm", "dgemm_usm"));
+}
+
+INSTANTIATE_TEST_SUITE_P(CallLogUsmTestSuite, CallLogUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
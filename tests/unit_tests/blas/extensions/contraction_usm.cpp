@@ -0,0 +1,208 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/contraction.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using oneapi::mkl::blas::tensor_desc;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Describes a tensor stored in the order given by layout, slowest mode first,
+// without padding, and returns its number of elements.
+int describe(tensor_desc& desc, const std::string& modes, const std::string& layout,
+             const std::string& labels, const vector<int>& extents) {
+    desc.modes = modes;
+    desc.extents.assign(modes.size(), 0);
+    desc.strides.assign(modes.size(), 0);
+    int size = 1;
+    for (int i = int(layout.size()) - 1; i >= 0; i--) {
+        const auto pos = modes.find(layout[i]);
+        desc.extents[pos] = extents[labels.find(layout[i])];
+        desc.strides[pos] = size;
+        size *= desc.extents[pos];
+    }
+    return size;
+}
+
+// Offset of the element of desc at the given values of all labels.
+int offset(const tensor_desc& desc, const std::string& labels, const vector<int>& index) {
+    int result = 0;
+    for (std::size_t i = 0; i < desc.modes.size(); i++)
+        result += index[labels.find(desc.modes[i])] * desc.strides[i];
+    return result;
+}
+
+// Computes C[c_modes] = alpha*sum(A[a_modes]*B[b_modes]) + beta*C[c_modes] with
+// each operand stored in the given layout, and checks it against a direct
+// loop over every combination of labels.
+template <typename fp>
+int test(const device& dev, const std::string& a_modes, const std::string& a_layout,
+         const std::string& b_modes, const std::string& b_layout, const std::string& c_modes,
+         const std::string& c_layout, const std::string& labels, const vector<int>& extents,
+         fp alpha, fp beta) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during CONTRACT:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    tensor_desc a_desc, b_desc, c_desc;
+    const int a_size = describe(a_desc, a_modes, a_layout, labels, extents);
+    const int b_size = describe(b_desc, b_modes, b_layout, labels, extents);
+    const int c_size = describe(c_desc, c_modes, c_layout, labels, extents);
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_vector(A, a_size, 1);
+    rand_vector(B, b_size, 1);
+    rand_vector(C, c_size, 1);
+    auto C_in = C;
+
+    // Reference contraction.
+    vector<fp> sum(c_size, fp(0));
+    vector<int> index(labels.size(), 0);
+    int total = 1;
+    for (int extent : extents)
+        total *= extent;
+    int k = 1;
+    for (std::size_t i = 0; i < labels.size(); i++) {
+        if (c_modes.find(labels[i]) == std::string::npos)
+            k *= extents[i];
+    }
+    for (int t = 0; t < total; t++) {
+        for (std::size_t i = 0, rest = t; i < labels.size(); rest /= extents[i], i++)
+            index[i] = rest % extents[i];
+        sum[offset(c_desc, labels, index)] +=
+            A[offset(a_desc, labels, index)] * B[offset(b_desc, labels, index)];
+    }
+    vector<fp> C_ref(c_size);
+    for (int i = 0; i < c_size; i++)
+        C_ref[i] = alpha * sum[i] + beta * C[i];
+
+    // Call DPC++ CONTRACT twice, the second time with a cached plan.
+    try {
+        done = oneapi::mkl::blas::contract(main_queue, alpha, a_desc, A.data(), b_desc, B.data(),
+                                           beta, c_desc, C.data(), dependencies);
+        done.wait();
+        std::copy(C_in.begin(), C_in.end(), C.begin());
+        done = oneapi::mkl::blas::contract(main_queue, alpha, a_desc, A.data(), b_desc, B.data(),
+                                           beta, c_desc, C.data(), dependencies);
+        done.wait();
+        oneapi::mkl::blas::release_contraction_workspace(main_queue);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during CONTRACT:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of CONTRACT:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(C, C_ref, c_size, 1, 10 * k, std::cout);
+
+    return (int)good;
+#else
+    // Contractions are part of the run-time dispatch library.
+    return test_skipped;
+#endif
+}
+
+class ContractionUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ContractionUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    // Attention scores and weighted values: strided gemm_batch in place.
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "bhqd", "bhqd", "bhkd", "bhkd", "bhqk", "bhqk",
+                                  "bhqkd", { 2, 3, 17, 19, 8 }, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "bhqk", "bhqk", "bhkd", "bhkd", "bhqd", "bhqd",
+                                  "bhqkd", { 2, 3, 17, 19, 8 }, alpha, beta));
+    // CCSD-like terms: a single gemm, then with A and C needing a permute.
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "ijab", "ijab", "abcd", "abcd", "ijcd", "ijcd",
+                                  "ijabcd", { 5, 6, 4, 7, 3, 5 }, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "aibj", "jbia", "abcd", "abcd", "ijcd", "icjd",
+                                  "ijabcd", { 5, 6, 4, 7, 3, 5 }, alpha, beta));
+}
+
+TEST_P(ContractionUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    // Attention scores and weighted values: strided gemm_batch in place.
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "bhqd", "bhqd", "bhkd", "bhkd", "bhqk", "bhqk",
+                                   "bhqkd", { 2, 3, 17, 19, 8 }, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "bhqk", "bhqk", "bhkd", "bhkd", "bhqd", "bhqd",
+                                   "bhqkd", { 2, 3, 17, 19, 8 }, alpha, beta));
+    // CCSD-like terms: a single gemm, then with A and C needing a permute.
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "ijab", "ijab", "abcd", "abcd", "ijcd", "ijcd",
+                                   "ijabcd", { 5, 6, 4, 7, 3, 5 }, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "aibj", "jbia", "abcd", "abcd", "ijcd", "icjd",
+                                   "ijabcd", { 5, 6, 4, 7, 3, 5 }, alpha, beta));
+}
+
+INSTANTIATE_TEST_SUITE_P(ContractionUsmTestSuite, ContractionUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
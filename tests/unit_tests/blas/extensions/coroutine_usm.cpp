@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#if defined(CALL_RT_API) && defined(__cpp_impl_coroutine)
+#include "oneapi/mkl/blas/coroutine.hpp"
+#endif
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+#if defined(CALL_RT_API) && defined(__cpp_impl_coroutine)
+
+// A coroutine that starts eagerly and reports its end through a promise.
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() {
+            return {};
+        }
+        std::suspend_never initial_suspend() {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+// Computes y = scale*(alpha*x + y) with two awaited calls, the second one
+// submitted from the completion thread that resumes the coroutine.
+template <typename fp>
+detached_task axpy_scal(queue& main_queue, int n, fp alpha, const fp* x, fp* y, fp scale,
+                        std::promise<void>& finished) {
+    try {
+        co_await oneapi::mkl::blas::axpy_async(main_queue, n, alpha, x, 1, y, 1);
+        co_await oneapi::mkl::blas::scal_async(main_queue, n, scale, y, 1);
+        finished.set_value();
+    }
+    catch (...) {
+        finished.set_exception(std::current_exception());
+    }
+}
+
+#endif
+
+// Runs many coroutines concurrently, each on its own slice of x and y, and
+// checks every slice against a host computation.
+template <typename fp>
+int test(const device& dev, int n, int tasks, fp alpha, fp scale) {
+#if defined(CALL_RT_API) && defined(__cpp_impl_coroutine)
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY_ASYNC:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, n * tasks, 1);
+    rand_vector(y, n * tasks, 1);
+
+    vector<fp> y_ref(n * tasks);
+    for (int i = 0; i < n * tasks; i++)
+        y_ref[i] = scale * (alpha * x[i] + y[i]);
+
+    // Call DPC++ AXPY_ASYNC and SCAL_ASYNC from every coroutine.
+    vector<std::promise<void>> finished(tasks);
+    try {
+        for (int t = 0; t < tasks; t++)
+            axpy_scal(main_queue, n, alpha, x.data() + t * n, y.data() + t * n, scale,
+                      finished[t]);
+        for (auto& f : finished)
+            f.get_future().get();
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY_ASYNC:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of AXPY_ASYNC:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(y, y_ref, n * tasks, 1, 2, std::cout);
+
+    return (int)good;
+#else
+    // Awaitables need C++20 coroutines and the run-time dispatch library.
+    return test_skipped;
+#endif
+}
+
+class CoroutineUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(CoroutineUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float scale(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 64, alpha, scale));
+}
+
+TEST_P(CoroutineUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double scale(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 64, alpha, scale));
+}
+
+INSTANTIATE_TEST_SUITE_P(CoroutineUsmTestSuite, CoroutineUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/expressions.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using namespace oneapi::mkl::blas::expr;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Evaluates the residual of a Krylov step and a long linear combination:
+//   y = alpha*A*x + beta*y, r = b - y, rnorm = nrm2(r), z = r + 2y - b + 2r - 0.5z + w + u
+template <typename fp>
+int test(const device& dev, oneapi::mkl::transpose transa, int m, int n, int lda, int incx,
+         int incy, fp alpha, fp beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during EXPRESSIONS:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    int x_len = outer_dimension(transa, m, n);
+    int y_len = inner_dimension(transa, m, n);
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), x(ua), y(ua), b(ua), r(ua), z(ua), w(ua), u(ua);
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, m, n, lda);
+    rand_vector(x, x_len, incx);
+    rand_vector(y, y_len, incy);
+    rand_vector(b, y_len, 1);
+    rand_vector(r, y_len, 1);
+    rand_vector(z, y_len, 1);
+    rand_vector(w, y_len, 1);
+    rand_vector(u, y_len, 1);
+
+    auto rnorm_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), dev, cxt);
+
+    // Call Reference GEMV and the element-wise updates.
+    auto y_ref = y;
+    auto r_ref = r;
+    auto z_ref = z;
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int m_ref = m, n_ref = n, lda_ref = lda, incx_ref = incx, incy_ref = incy, one = 1;
+
+    ::gemv(convert_to_cblas_trans(transa), &m_ref, &n_ref, (fp_ref*)&alpha, (fp_ref*)A.data(),
+           &lda_ref, (fp_ref*)x.data(), &incx_ref, (fp_ref*)&beta, (fp_ref*)y_ref.data(),
+           &incy_ref);
+
+    auto y_at = [&](int i) { return y_ref[(incy > 0) ? i * incy : (y_len - 1 - i) * -incy]; };
+    for (int i = 0; i < y_len; i++)
+        r_ref[i] = b[i] - y_at(i);
+    const int y_len_ref = y_len;
+    fp rnorm_ref = ::nrm2<fp_ref, fp>(&y_len_ref, (fp_ref*)r_ref.data(), &one);
+    for (int i = 0; i < y_len; i++)
+        z_ref[i] = fp(3) * r_ref[i] + fp(2) * y_at(i) - b[i] - fp(0.5) * z[i] + w[i] + u[i];
+
+    // Evaluate the expressions. The last one scales by double and int
+    // literals, which convert to fp.
+    matrix_view<fp> A_v(A.data(), m, n, lda, transa);
+    vector_view<fp> x_v(x.data(), x_len, incx), y_v(y.data(), y_len, incy);
+    vector_view<fp> b_v(b.data(), y_len), r_v(r.data(), y_len), z_v(z.data(), y_len);
+    vector_view<fp> w_v(w.data(), y_len), u_v(u.data(), y_len);
+
+    try {
+#ifdef CALL_RT_API
+        done = evaluate(main_queue, y_v, alpha * A_v * x_v + beta * y_v, dependencies);
+        done = evaluate(main_queue, r_v, b_v - y_v, { done });
+        auto norm_done = oneapi::mkl::blas::nrm2(main_queue, y_len, r.data(), 1, rnorm_p, { done });
+        done = evaluate(main_queue, z_v,
+                        r_v + 2.0 * y_v - b_v + 2 * r_v - 0.5 * z_v + w_v + u_v,
+                        { done });
+        done.wait();
+        norm_done.wait();
+#else
+        TEST_RUN_CT(main_queue, evaluate, (main_queue, y_v, alpha * A_v * x_v + beta * y_v));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, evaluate, (main_queue, r_v, b_v - y_v));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::nrm2,
+                    (main_queue, y_len, r.data(), 1, rnorm_p, dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, evaluate,
+                    (main_queue, z_v,
+                     r_v + 2.0 * y_v - b_v + 2 * r_v - 0.5 * z_v + w_v + u_v));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during EXPRESSIONS:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of EXPRESSIONS:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(y, y_ref, y_len, incy, std::max<int>(m, n), std::cout);
+    good = good && check_equal_vector(r, r_ref, y_len, 1, std::max<int>(m, n), std::cout);
+    good = good && check_equal(rnorm_p[0], rnorm_ref, y_len, std::cout);
+    good = good && check_equal_vector(z, z_ref, y_len, 1, 10 * std::max<int>(m, n), std::cout);
+
+    oneapi::mkl::free_shared(rnorm_p, cxt);
+
+    return (int)good;
+}
+
+class ExpressionsUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ExpressionsUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans, 25, 25, 42, 2,
+                                  3, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans, 25, 25, 42, 1, 1,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans, 25, 30, 42, -2,
+                                  -3, alpha, beta));
+}
+
+TEST_P(ExpressionsUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans, 25, 25, 42, 2,
+                                   3, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans, 25, 25, 42, 1, 1,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans, 25, 30, 42, -2,
+                                   -3, alpha, beta));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExpressionsUsmTestSuite, ExpressionsUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// One step of a CG-like update followed by a dense layer applied to x:
+//   q = A p, pq = p.q, x += alpha p, r -= alpha q, rr = r.r, p = beta p + r, h = W x
+template <typename fp, typename vec>
+void reference_step(int n, vec& A, int lda, vec& W, vec& x, vec& r, vec& p, vec& q, vec& h,
+                    vec& dots, fp alpha, fp beta) {
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int n_ref = n, one = 1, lda_ref = lda;
+    fp one_fp(1), zero_fp(0), neg_alpha(-alpha);
+
+    ::gemv(CblasNoTrans, &n_ref, &n_ref, (fp_ref*)&one_fp, (fp_ref*)A.data(), &lda_ref,
+           (fp_ref*)p.data(), &one, (fp_ref*)&zero_fp, (fp_ref*)q.data(), &one);
+    dots[0] = ::dot<fp, fp>(&n_ref, p.data(), &one, q.data(), &one);
+    ::axpy(&n_ref, &alpha, p.data(), &one, x.data(), &one);
+    ::axpy(&n_ref, &neg_alpha, q.data(), &one, r.data(), &one);
+    dots[1] = ::dot<fp, fp>(&n_ref, r.data(), &one, r.data(), &one);
+    ::scal(&n_ref, &beta, p.data(), &one);
+    ::axpy(&n_ref, &one_fp, r.data(), &one, p.data(), &one);
+    ::gemm(CblasNoTrans, CblasNoTrans, &n_ref, &one, &n_ref, (fp_ref*)&one_fp, (fp_ref*)W.data(),
+           &n_ref, (fp_ref*)x.data(), &n_ref, (fp_ref*)&zero_fp, (fp_ref*)h.data(), &n_ref);
+}
+
+template <typename fp>
+int test(const device &dev, int n, int lda, int replays) {
+    // Prepare data.
+    vector<fp> A, W, x, r, p, q(n), h(n), pq(1), rr(1);
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, n, n, lda);
+    rand_matrix(W, oneapi::mkl::transpose::nontrans, n, n, n);
+    rand_vector(x, n, 1);
+    rand_vector(r, n, 1);
+    rand_vector(p, n, 1);
+
+    vector<fp> A_ref = A, W_ref = W, x_ref = x, r_ref = r, p_ref = p, q_ref = q, h_ref = h,
+               dots_ref(2);
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during GRAPH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> A_buffer = make_buffer(A);
+    buffer<fp, 1> W_buffer = make_buffer(W);
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> r_buffer = make_buffer(r);
+    buffer<fp, 1> p_buffer = make_buffer(p);
+    buffer<fp, 1> q_buffer = make_buffer(q);
+    buffer<fp, 1> h_buffer = make_buffer(h);
+    buffer<fp, 1> pq_buffer = make_buffer(pq);
+    buffer<fp, 1> rr_buffer = make_buffer(rr);
+
+    // Record the step once.
+    oneapi::mkl::blas::graph<fp> g;
+    auto alpha = g.add_scalar(fp(0));
+    auto neg_alpha = g.add_scalar(fp(0));
+    auto beta = g.add_scalar(fp(0));
+    g.gemv(oneapi::mkl::transpose::nontrans, n, n, fp(1), A_buffer, lda, p_buffer, 1, fp(0),
+           q_buffer, 1);
+    g.dot(n, p_buffer, 1, q_buffer, 1, pq_buffer);
+    g.axpy(n, alpha, p_buffer, 1, x_buffer, 1);
+    g.axpy(n, neg_alpha, q_buffer, 1, r_buffer, 1);
+    g.dot(n, r_buffer, 1, r_buffer, 1, rr_buffer);
+    g.scal(n, beta, p_buffer, 1);
+    g.axpy(n, fp(1), r_buffer, 1, p_buffer, 1);
+    g.gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n, 1, n, fp(1),
+           W_buffer, n, x_buffer, n, fp(0), h_buffer, n);
+
+    // Replay it with new scalars each time, against the reference step.
+    for (int i = 0; i < replays; i++) {
+        fp alpha_i = fp(0.25) / fp(i + 1), beta_i = fp(0.5) + fp(0.125) * fp(i);
+        g.set_scalar(alpha, alpha_i);
+        g.set_scalar(neg_alpha, -alpha_i);
+        g.set_scalar(beta, beta_i);
+
+        reference_step(n, A_ref, lda, W_ref, x_ref, r_ref, p_ref, q_ref, h_ref, dots_ref, alpha_i,
+                       beta_i);
+
+        try {
+#ifdef CALL_RT_API
+            oneapi::mkl::blas::replay(main_queue, g);
+#else
+            TEST_RUN_CT(main_queue, oneapi::mkl::blas::replay, (main_queue, g));
+#endif
+        }
+        catch (exception const &e) {
+            std::cout << "Caught synchronous SYCL exception during GRAPH:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+
+        catch (const oneapi::mkl::backend_unsupported_exception &e) {
+            return test_skipped;
+        }
+
+        catch (const std::runtime_error &error) {
+            std::cout << "Error raised during execution of GRAPH:\n" << error.what() << std::endl;
+        }
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto x_accessor = x_buffer.template get_access<access::mode::read>();
+        auto r_accessor = r_buffer.template get_access<access::mode::read>();
+        auto p_accessor = p_buffer.template get_access<access::mode::read>();
+        auto h_accessor = h_buffer.template get_access<access::mode::read>();
+        auto pq_accessor = pq_buffer.template get_access<access::mode::read>();
+        auto rr_accessor = rr_buffer.template get_access<access::mode::read>();
+        good = check_equal_vector(x_accessor, x_ref, n, 1, 10 * n, std::cout);
+        good = good && check_equal_vector(r_accessor, r_ref, n, 1, 10 * n, std::cout);
+        good = good && check_equal_vector(p_accessor, p_ref, n, 1, 10 * n, std::cout);
+        good = good && check_equal_vector(h_accessor, h_ref, n, 1, 10 * n, std::cout);
+        good = good && check_equal(pq_accessor[0], dots_ref[0], 10 * n, std::cout);
+        good = good && check_equal(rr_accessor[0], dots_ref[1], 10 * n, std::cout);
+    }
+
+    return (int)good;
+}
+
+class GraphTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GraphTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 37, 41, 3));
+}
+
+TEST_P(GraphTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 37, 41, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(GraphTestSuite, GraphTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// One step of a CG-like update followed by a dense layer applied to x:
+//   q = A p, pq = p.q, x += alpha p, r -= alpha q, rr = r.r, p = beta p + r, h = W x
+template <typename fp, typename vec>
+void reference_step(int n, vec& A, int lda, vec& W, vec& x, vec& r, vec& p, vec& q, vec& h,
+                    vec& dots, fp alpha, fp beta) {
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int n_ref = n, one = 1, lda_ref = lda;
+    fp one_fp(1), zero_fp(0), neg_alpha(-alpha);
+
+    ::gemv(CblasNoTrans, &n_ref, &n_ref, (fp_ref*)&one_fp, (fp_ref*)A.data(), &lda_ref,
+           (fp_ref*)p.data(), &one, (fp_ref*)&zero_fp, (fp_ref*)q.data(), &one);
+    dots[0] = ::dot<fp, fp>(&n_ref, p.data(), &one, q.data(), &one);
+    ::axpy(&n_ref, &alpha, p.data(), &one, x.data(), &one);
+    ::axpy(&n_ref, &neg_alpha, q.data(), &one, r.data(), &one);
+    dots[1] = ::dot<fp, fp>(&n_ref, r.data(), &one, r.data(), &one);
+    ::scal(&n_ref, &beta, p.data(), &one);
+    ::axpy(&n_ref, &one_fp, r.data(), &one, p.data(), &one);
+    ::gemm(CblasNoTrans, CblasNoTrans, &n_ref, &one, &n_ref, (fp_ref*)&one_fp, (fp_ref*)W.data(),
+           &n_ref, (fp_ref*)x.data(), &n_ref, (fp_ref*)&zero_fp, (fp_ref*)h.data(), &n_ref);
+}
+
+template <typename fp>
+int test(const device& dev, int n, int lda, int replays) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GRAPH:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), W(ua), x(ua), r(ua), p(ua), q(ua), h(ua), dots(ua);
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, n, n, lda);
+    rand_matrix(W, oneapi::mkl::transpose::nontrans, n, n, n);
+    rand_vector(x, n, 1);
+    rand_vector(r, n, 1);
+    rand_vector(p, n, 1);
+    q.resize(n);
+    h.resize(n);
+    dots.resize(2);
+
+    vector<fp, allocator_helper<fp, 64>> A_ref(A.begin(), A.end()), W_ref(W.begin(), W.end()),
+        x_ref(x.begin(), x.end()), r_ref(r.begin(), r.end()), p_ref(p.begin(), p.end()),
+        q_ref(n), h_ref(n), dots_ref(2);
+
+    // Record the step once.
+    oneapi::mkl::blas::graph<fp> g;
+    auto alpha = g.add_scalar(fp(0));
+    auto neg_alpha = g.add_scalar(fp(0));
+    auto beta = g.add_scalar(fp(0));
+    g.gemv(oneapi::mkl::transpose::nontrans, n, n, fp(1), A.data(), lda, p.data(), 1, fp(0),
+           q.data(), 1);
+    g.dot(n, p.data(), 1, q.data(), 1, dots.data());
+    g.axpy(n, alpha, p.data(), 1, x.data(), 1);
+    g.axpy(n, neg_alpha, q.data(), 1, r.data(), 1);
+    g.dot(n, r.data(), 1, r.data(), 1, dots.data() + 1);
+    g.scal(n, beta, p.data(), 1);
+    g.axpy(n, fp(1), r.data(), 1, p.data(), 1);
+    g.gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n, 1, n, fp(1),
+           W.data(), n, x.data(), n, fp(0), h.data(), n);
+
+    // Replay it with new scalars each time, against the reference step.
+    for (int i = 0; i < replays; i++) {
+        fp alpha_i = fp(0.25) / fp(i + 1), beta_i = fp(0.5) + fp(0.125) * fp(i);
+        g.set_scalar(alpha, alpha_i);
+        g.set_scalar(neg_alpha, -alpha_i);
+        g.set_scalar(beta, beta_i);
+
+        reference_step(n, A_ref, lda, W_ref, x_ref, r_ref, p_ref, q_ref, h_ref, dots_ref, alpha_i,
+                       beta_i);
+
+        try {
+#ifdef CALL_RT_API
+            done = oneapi::mkl::blas::replay(main_queue, g, dependencies);
+            done.wait();
+#else
+            TEST_RUN_CT(main_queue, oneapi::mkl::blas::replay, (main_queue, g, dependencies));
+            main_queue.wait();
+#endif
+        }
+        catch (exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during GRAPH:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.get_cl_code() << std::endl;
+        }
+
+        catch (const oneapi::mkl::backend_unsupported_exception& e) {
+            return test_skipped;
+        }
+
+        catch (const std::runtime_error& error) {
+            std::cout << "Error raised during execution of GRAPH:\n" << error.what() << std::endl;
+        }
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(x, x_ref, n, 1, 10 * n, std::cout);
+    good = good && check_equal_vector(r, r_ref, n, 1, 10 * n, std::cout);
+    good = good && check_equal_vector(p, p_ref, n, 1, 10 * n, std::cout);
+    good = good && check_equal_vector(h, h_ref, n, 1, 10 * n, std::cout);
+    good = good && check_equal_vector(dots, dots_ref, 2, 1, 10 * n, std::cout);
+
+    return (int)good;
+}
+
+// Scalar handles belong to the graph that created them.
+template <typename fp>
+int test_foreign_scalar() {
+    oneapi::mkl::blas::graph<fp> g, other;
+    auto alpha = g.add_scalar(fp(1));
+    other.add_scalar(fp(2));
+    try {
+        other.set_scalar(alpha, fp(3));
+        return false;
+    }
+    catch (const oneapi::mkl::InvalidArgumentsException& e) {
+    }
+    try {
+        other.scal(1, alpha, static_cast<fp*>(nullptr), 1);
+        return false;
+    }
+    catch (const oneapi::mkl::InvalidArgumentsException& e) {
+    }
+    g.set_scalar(alpha, fp(3));
+    return (int)(g.scalars()[0] == fp(3) && other.scalars()[0] == fp(2) && other.nodes().empty());
+}
+
+class GraphUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GraphUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 37, 41, 3));
+}
+
+TEST_P(GraphUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 37, 41, 3));
+}
+
+TEST_P(GraphUsmTests, ForeignScalar) {
+    EXPECT_TRUEORSKIP(test_foreign_scalar<float>());
+}
+
+INSTANTIATE_TEST_SUITE_P(GraphUsmTestSuite, GraphUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device& dev, oneapi::mkl::transpose trans, int m, int n, int lda, int ldb,
+         fp alpha) {
+    // Prepare data.
+    const int rows_b = inner_dimension(trans, m, n), cols_b = outer_dimension(trans, m, n);
+    vector<fp, allocator_helper<fp, 64>> AB, AB_ref;
+    rand_matrix(AB, oneapi::mkl::transpose::nontrans, m, n, lda);
+    AB.resize(std::max(AB.size(), (size_t)(ldb * cols_b)));
+    AB_ref = AB;
+
+    // Call Reference IMATCOPY.
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::imatcopy(convert_to_cblas_trans(trans), &m_ref, &n_ref, (fp_ref*)&alpha,
+               (fp_ref*)AB_ref.data(), &lda_ref, &ldb_ref);
+
+    // Call DPC++ IMATCOPY.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during IMATCOPY:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> AB_buffer(AB.data(), range<1>(AB.size()));
+
+    try {
+#ifdef CALL_RT_API
+        oneapi::mkl::blas::imatcopy(main_queue, trans, m, n, alpha, AB_buffer, lda, ldb);
+#else
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::imatcopy,
+                    (main_queue, trans, m, n, alpha, AB_buffer, lda, ldb));
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during IMATCOPY:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of IMATCOPY:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto AB_accessor = AB_buffer.template get_access<access::mode::read>();
+    bool good = check_equal_matrix(AB_accessor, AB_ref, rows_b, cols_b, ldb, 10, std::cout);
+
+    return (int)good;
+}
+
+class ImatcopyTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ImatcopyTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUEORSKIP(
+        test<float>(GetParam(), oneapi::mkl::transpose::nontrans, 79, 83, 103, 105, alpha));
+    EXPECT_TRUEORSKIP(
+        test<float>(GetParam(), oneapi::mkl::transpose::trans, 79, 83, 103, 105, alpha));
+}
+
+TEST_P(ImatcopyTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUEORSKIP(
+        test<double>(GetParam(), oneapi::mkl::transpose::nontrans, 79, 83, 103, 105, alpha));
+    EXPECT_TRUEORSKIP(
+        test<double>(GetParam(), oneapi::mkl::transpose::trans, 79, 83, 103, 105, alpha));
+}
+
+TEST_P(ImatcopyTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::nontrans, 79,
+                                                83, 103, 105, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::trans, 79, 83,
+                                                103, 105, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::conjtrans, 79,
+                                                83, 103, 105, alpha));
+}
+
+TEST_P(ImatcopyTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::nontrans, 79,
+                                                 83, 103, 105, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::trans, 79,
+                                                 83, 103, 105, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::conjtrans,
+                                                 79, 83, 103, 105, alpha));
+}
+
+INSTANTIATE_TEST_SUITE_P(ImatcopyTestSuite, ImatcopyTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
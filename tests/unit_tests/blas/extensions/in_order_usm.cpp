@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/in_order.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Applies y = scale*(alpha*x + y) rounds times on an in-order queue, first as
+// a chain of calls each depending on the event of the previous one, then with
+// the in_order variants, and checks both against a host computation.
+template <typename fp>
+int test(const device& dev, int n, int rounds, fp alpha, fp scale) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during IN_ORDER:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler, property::queue::in_order());
+    queue other_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, n, 1);
+    rand_vector(y, n, 1);
+    auto y_in = y;
+
+    vector<fp> y_ref(y.begin(), y.end());
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++)
+            y_ref[i] = scale * (alpha * x[i] + y_ref[i]);
+    }
+
+    // Call DPC++ AXPY and SCAL in a chain of events, then without events.
+    bool good = true;
+    try {
+        for (int r = 0; r < rounds; r++) {
+            done =
+                oneapi::mkl::blas::axpy(main_queue, n, alpha, x.data(), 1, y.data(), 1, { done });
+            done = oneapi::mkl::blas::scal(main_queue, n, scale, y.data(), 1, { done });
+        }
+        done.wait();
+        good = check_equal_vector(y, y_ref, n, 1, 2 * rounds, std::cout);
+
+        std::copy(y_in.begin(), y_in.end(), y.begin());
+        for (int r = 0; r < rounds; r++) {
+            oneapi::mkl::blas::in_order::axpy(main_queue, n, alpha, x.data(), 1, y.data(), 1);
+            oneapi::mkl::blas::in_order::scal(main_queue, n, scale, y.data(), 1);
+        }
+        main_queue.wait();
+        good = good && check_equal_vector(y, y_ref, n, 1, 2 * rounds, std::cout);
+
+        // The variants refuse queues that do not keep the calls in order.
+        try {
+            oneapi::mkl::blas::in_order::scal(other_queue, n, scale, y.data(), 1);
+            other_queue.wait();
+            good = false;
+        }
+        catch (const oneapi::mkl::InvalidArgumentsException& e) {
+        }
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during IN_ORDER:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        good = false;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of IN_ORDER:\n" << error.what() << std::endl;
+        good = false;
+    }
+
+    return (int)good;
+#else
+    // The in_order variants call the run-time dispatch library.
+    return test_skipped;
+#endif
+}
+
+class InOrderUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(InOrderUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float scale(0.5);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 16, alpha, scale));
+}
+
+TEST_P(InOrderUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double scale(0.5);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 16, alpha, scale));
+}
+
+INSTANTIATE_TEST_SUITE_P(InOrderUsmTestSuite, InOrderUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
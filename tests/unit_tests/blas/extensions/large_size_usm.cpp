@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Runs AXPY, DOT and IAMAX on vectors longer than 2^31 elements, which the
+// mklcpu backend splits into chunks when built with the LP64 MKL interface.
+// The data is chosen so that every result is known without a reference
+// computation; devices without memory for both vectors are skipped.
+template <typename fp>
+int test(const device& dev, int64_t N, fp alpha) {
+    const std::size_t bytes = N * sizeof(fp);
+    if (dev.get_info<info::device::max_mem_alloc_size>() < bytes ||
+        dev.get_info<info::device::global_mem_size>() < 3 * bytes)
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during LARGE_SIZE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data: x is all ones but for one larger entry past 2^31, and
+    // y is all zeros.
+    const int64_t max_index = N - 3;
+    auto x = (fp*)oneapi::mkl::malloc_shared(64, bytes, dev, cxt);
+    auto y = (fp*)oneapi::mkl::malloc_shared(64, bytes, dev, cxt);
+    auto dot_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), dev, cxt);
+    auto iamax_p = (int64_t*)oneapi::mkl::malloc_shared(64, sizeof(int64_t), dev, cxt);
+    if (!x || !y) {
+        oneapi::mkl::free_shared(x, cxt);
+        oneapi::mkl::free_shared(y, cxt);
+        oneapi::mkl::free_shared(dot_p, cxt);
+        oneapi::mkl::free_shared(iamax_p, cxt);
+        return test_skipped;
+    }
+    std::fill(x, x + N, fp(1));
+    std::fill(y, y + N, fp(0));
+    x[max_index] = fp(4);
+
+    // Call DPC++ AXPY, DOT and IAMAX.
+    bool good = true;
+    try {
+#ifdef CALL_RT_API
+        done = oneapi::mkl::blas::axpy(main_queue, N, alpha, x, 1, y, 1, dependencies);
+        done = oneapi::mkl::blas::dot(main_queue, N, x, -1, y, -1, dot_p, { done });
+        done = oneapi::mkl::blas::iamax(main_queue, N, x, 1, iamax_p, { done });
+        done.wait();
+#else
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::axpy,
+                    (main_queue, N, alpha, x, 1, y, 1, dependencies));
+        main_queue.wait();
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::dot,
+                    (main_queue, N, x, -1, y, -1, dot_p, dependencies));
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::iamax,
+                    (main_queue, N, x, 1, iamax_p, dependencies));
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during LARGE_SIZE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        good = false;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        oneapi::mkl::free_shared(x, cxt);
+        oneapi::mkl::free_shared(y, cxt);
+        oneapi::mkl::free_shared(dot_p, cxt);
+        oneapi::mkl::free_shared(iamax_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of LARGE_SIZE:\n" << error.what() << std::endl;
+        good = false;
+    }
+
+    // Check y at a stride that visits every chunk, and the entries around
+    // the 32-bit boundary.
+    if (good) {
+        for (int64_t i = 0; i < N; i += (int64_t(1) << 20) + 7) {
+            const fp expected = (i == max_index) ? 4 * alpha : alpha;
+            good = good && check_equal(y[i], expected, 1, std::cout);
+        }
+        for (int64_t i = (int64_t(1) << 31) - 2; i < N; i++) {
+            const fp expected = (i == max_index) ? 4 * alpha : alpha;
+            good = good && check_equal(y[i], expected, 1, std::cout);
+        }
+
+        // Partial sums are rounded to fp, so allow for a relative error.
+        const fp dot_ref = alpha * fp(N + 15);
+        good = good && std::abs(*dot_p - dot_ref) <= dot_ref * fp(1e-5);
+        good = good && check_equal(*iamax_p, max_index, 0, std::cout);
+    }
+
+    oneapi::mkl::free_shared(x, cxt);
+    oneapi::mkl::free_shared(y, cxt);
+    oneapi::mkl::free_shared(dot_p, cxt);
+    oneapi::mkl::free_shared(iamax_p, cxt);
+    return (int)good;
+}
+
+class LargeSizeUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(LargeSizeUsmTests, RealSinglePrecision) {
+    float alpha(0.5);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), (int64_t(1) << 31) + 4099, alpha));
+}
+
+INSTANTIATE_TEST_SUITE_P(LargeSizeUsmTestSuite, LargeSizeUsmTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Runs an AXPY and a GEMM on a queue with counters on, then an AXPY after
+// turning them off, and checks the records taken: one per counted call, with
+// its routine and shape, and counters that are either available or -1.
+template <typename fp>
+int test(const device& dev, const char* axpy_routine, const char* gemm_routine) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during PERF_COUNTERS:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    const int N = 1000, incx = 1, incy = 1, m = 40, n = 30, k = 20;
+    fp alpha(2.0), beta(0.5);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), A(ua), B(ua), C(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_matrix(A, oneapi::mkl::transpose::nontrans, m, k, m);
+    rand_matrix(B, oneapi::mkl::transpose::nontrans, k, n, k);
+    rand_matrix(C, oneapi::mkl::transpose::nontrans, m, n, m);
+
+    // Call DPC++ AXPY and GEMM with counters on, then AXPY without.
+    std::vector<oneapi::mkl::blas::perf_counter_record> records;
+    try {
+        oneapi::mkl::blas::set_perf_counters(main_queue, true);
+        done = oneapi::mkl::blas::axpy(main_queue, N, alpha, x.data(), incx, y.data(), incy,
+                                       dependencies);
+        done = oneapi::mkl::blas::gemm(main_queue, oneapi::mkl::transpose::nontrans,
+                                       oneapi::mkl::transpose::nontrans, m, n, k, alpha, A.data(),
+                                       m, B.data(), k, beta, C.data(), m, { done });
+        done.wait();
+        oneapi::mkl::blas::set_perf_counters(main_queue, false);
+        done = oneapi::mkl::blas::axpy(main_queue, N, alpha, x.data(), incx, y.data(), incy,
+                                       dependencies);
+        done.wait();
+        records = oneapi::mkl::blas::get_perf_counters(main_queue);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during PERF_COUNTERS:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        return false;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of PERF_COUNTERS:\n"
+                  << error.what() << std::endl;
+        return false;
+    }
+
+    bool good = (records.size() == 2);
+    good = good && records[0].routine == axpy_routine && records[0].n == N;
+    good = good && records[1].routine == gemm_routine && records[1].m == m &&
+           records[1].n == n && records[1].k == k;
+    for (auto& r : records) {
+        good = good && r.duration_ns > 0 && r.cycles >= -1 && r.instructions >= -1 &&
+               r.llc_misses >= -1;
+        good = good && (r.memory_bytes == ((r.llc_misses < 0) ? -1 : 64 * r.llc_misses));
+    }
+    good = good && oneapi::mkl::blas::get_perf_counters(main_queue).empty();
+
+    std::ostringstream csv;
+    oneapi::mkl::blas::write_perf_counters_csv(csv, records);
+    good = good && csv.str().find(std::string("\n") + gemm_routine + ",40,30,20,") !=
+                       std::string::npos;
+
+    return (int)good;
+#else
+    // set_perf_counters is part of the run-time dispatch library.
+    return test_skipped;
+#endif
+}
+
+class PerfCountersUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(PerfCountersUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), "saxpy_usm", "sgemm_usm"));
+}
+TEST_P(PerfCountersUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), "daxpy_usm", "dgemm_usm"));
+}
+
+INSTANTIATE_TEST_SUITE_P(PerfCountersUsmTestSuite, PerfCountersUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
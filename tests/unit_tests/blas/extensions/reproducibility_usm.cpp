@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// The strict reductions as documented: blocks of 8192 elements, each summed
+// into eight interleaved accumulators that are then added pairwise, and the
+// block sums added pairwise along a binary tree. Computed here on one thread,
+// so that matching it shows the result does not depend on the thread count.
+template <typename fp, typename F>
+fp strict_sum(int N, F term) {
+    const int block = 8192, lanes = 8;
+    vector<fp> partials;
+    for (int begin = 0; begin < N; begin += block) {
+        fp acc[lanes];
+        std::fill(acc, acc + lanes, fp(0));
+        const int count = std::min(block, N - begin);
+        for (int j = 0; j < count; j++)
+            acc[j % lanes] += term(begin + j);
+        for (int width = lanes / 2; width > 0; width /= 2) {
+            for (int l = 0; l < width; l++)
+                acc[l] += acc[l + width];
+        }
+        partials.push_back(acc[0]);
+    }
+    for (std::size_t step = 1; step < partials.size(); step *= 2) {
+        for (std::size_t i = 0; i + step < partials.size(); i += 2 * step)
+            partials[i] += partials[i + step];
+    }
+    return partials[0];
+}
+
+// Runs DOT, ASUM and NRM2 rounds times on a queue set to mode, checks that
+// every round returns the results of the first one to the bit, and those
+// against the reference. In strict mode, contiguous DOT and ASUM must also
+// match the single-threaded strict_sum exactly.
+template <typename fp>
+int test(const device& dev, int N, int incx, oneapi::mkl::reproducibility mode, int rounds) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during REPRODUCIBILITY:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incx);
+
+    // Call Reference DOT, ASUM and NRM2.
+    const int N_ref = N, incx_ref = incx;
+    const fp dot_ref =
+        ::dot<fp, fp>(&N_ref, (fp*)x.data(), &incx_ref, (fp*)y.data(), &incx_ref);
+    const fp asum_ref = ::asum<fp, fp>(&N_ref, (fp*)x.data(), &incx_ref);
+    const fp nrm2_ref = ::nrm2<fp, fp>(&N_ref, (fp*)x.data(), &incx_ref);
+
+    // Call DPC++ DOT, ASUM and NRM2.
+    auto result_p = (fp*)oneapi::mkl::malloc_shared(64, 3 * rounds * sizeof(fp), dev, cxt);
+
+    bool good = true;
+    try {
+        oneapi::mkl::blas::set_reproducibility(main_queue, mode);
+        for (int r = 0; r < rounds; r++) {
+            fp* results = result_p + 3 * r;
+            dependencies.push_back(oneapi::mkl::blas::dot(main_queue, N, x.data(), incx, y.data(),
+                                                          incx, results, dependencies));
+            dependencies.push_back(
+                oneapi::mkl::blas::asum(main_queue, N, x.data(), incx, results + 1, dependencies));
+            dependencies.push_back(
+                oneapi::mkl::blas::nrm2(main_queue, N, x.data(), incx, results + 2, dependencies));
+        }
+        main_queue.wait();
+        oneapi::mkl::blas::set_reproducibility(main_queue, oneapi::mkl::reproducibility::off);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during REPRODUCIBILITY:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+        good = false;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        oneapi::mkl::free_shared(result_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of REPRODUCIBILITY:\n"
+                  << error.what() << std::endl;
+        good = false;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    good = good && check_equal(result_p[0], dot_ref, N, std::cout);
+    good = good && check_equal(result_p[1], asum_ref, N, std::cout);
+    good = good && check_equal(result_p[2], nrm2_ref, N, std::cout);
+    for (int i = 3; i < 3 * rounds; i++) {
+        if (result_p[i] != result_p[i % 3]) {
+            std::cout << "Round " << i / 3 << " differs from round 0: " << result_p[i]
+                      << " != " << result_p[i % 3] << std::endl;
+            good = false;
+        }
+    }
+
+    if (mode == oneapi::mkl::reproducibility::strict && incx == 1) {
+        const fp dot_strict = strict_sum<fp>(N, [&](int i) { return x[i] * y[i]; });
+        const fp asum_strict = strict_sum<fp>(N, [&](int i) { return std::abs(x[i]); });
+        good = good && (result_p[0] == dot_strict) && (result_p[1] == asum_strict);
+    }
+
+    oneapi::mkl::free_shared(result_p, cxt);
+    return (int)good;
+#else
+    // set_reproducibility is part of the run-time dispatch library.
+    return test_skipped;
+#endif
+}
+
+class ReproducibilityUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(ReproducibilityUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 100003, 1, oneapi::mkl::reproducibility::on, 8));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 100003, -2, oneapi::mkl::reproducibility::on, 8));
+    EXPECT_TRUEORSKIP(
+        test<float>(GetParam(), 100003, 1, oneapi::mkl::reproducibility::strict, 8));
+    EXPECT_TRUEORSKIP(
+        test<float>(GetParam(), 100003, -2, oneapi::mkl::reproducibility::strict, 8));
+}
+TEST_P(ReproducibilityUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 100003, 1, oneapi::mkl::reproducibility::on, 8));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 100003, -2, oneapi::mkl::reproducibility::on, 8));
+    EXPECT_TRUEORSKIP(
+        test<double>(GetParam(), 100003, 1, oneapi::mkl::reproducibility::strict, 8));
+    EXPECT_TRUEORSKIP(
+        test<double>(GetParam(), 100003, -2, oneapi::mkl::reproducibility::strict, 8));
+}
+
+INSTANTIATE_TEST_SUITE_P(ReproducibilityUsmTestSuite, ReproducibilityUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
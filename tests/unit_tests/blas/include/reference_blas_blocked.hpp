@@ -0,0 +1,406 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _REFERENCE_BLAS_BLOCKED_HPP__
+#define _REFERENCE_BLAS_BLOCKED_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "cblas.h"
+
+// Cache-blocked, multithreaded reference for the level 2 and level 3
+// products, which reference_blas_templates.hpp uses instead of the reference
+// CBLAS on problems large enough for that to be slow. Sums are accumulated in
+// a wider type (double for float and long double for double) and rounded
+// once, so the reference stays more accurate than the routines under test
+// at any size. ONEMKL_TEST_REF=netlib turns it off, and
+// ONEMKL_TEST_REF_THREADS sets the number of threads.
+
+namespace blocked_ref {
+
+template <typename fp>
+struct wide {
+    using type = fp;
+};
+template <>
+struct wide<float> {
+    using type = double;
+};
+template <>
+struct wide<double> {
+    using type = long double;
+};
+template <>
+struct wide<std::complex<float>> {
+    using type = std::complex<double>;
+};
+template <>
+struct wide<std::complex<double>> {
+    using type = std::complex<long double>;
+};
+template <typename fp>
+using wide_t = typename wide<fp>::type;
+
+static bool enabled() {
+    static const bool on = [] {
+        const char *ref = std::getenv("ONEMKL_TEST_REF");
+        return !(ref && std::strcmp(ref, "netlib") == 0);
+    }();
+    return on;
+}
+
+static int thread_count() {
+    static const int count = [] {
+        const char *threads = std::getenv("ONEMKL_TEST_REF_THREADS");
+        const int n = threads ? std::atoi(threads) : int(std::thread::hardware_concurrency());
+        return std::max(n, 1);
+    }();
+    return count;
+}
+
+// Whether a problem of fmas multiply-adds is worth the blocked reference.
+static bool worthwhile(double fmas) {
+    return enabled() && fmas >= double(1 << 22);
+}
+
+static bool &in_parallel() {
+    static thread_local bool inside = false;
+    return inside;
+}
+
+// Runs f(i) for every i in [0, count) on up to thread_count() threads. Calls
+// made from within f run on the calling thread only.
+template <typename F>
+void parallel_for(int count, F f) {
+    const int threads = (enabled() && !in_parallel()) ? std::min(thread_count(), count) : 1;
+    if (threads <= 1) {
+        for (int i = 0; i < count; i++)
+            f(i);
+        return;
+    }
+    std::atomic<int> next(0);
+    auto work = [&] {
+        in_parallel() = true;
+        for (int i = next++; i < count; i = next++)
+            f(i);
+        in_parallel() = false;
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++)
+        workers.emplace_back(work);
+    work();
+    for (auto &worker : workers)
+        worker.join();
+}
+
+// Element helpers, in the wide type.
+template <typename T>
+T conjugate(T v) {
+    return v;
+}
+template <typename T>
+std::complex<T> conjugate(std::complex<T> v) {
+    return std::conj(v);
+}
+
+template <typename T>
+void multiply_add(T &sum, const T &x, const T &y) {
+    sum += x * y;
+}
+template <typename T>
+void multiply_add(std::complex<T> &sum, const std::complex<T> &x, const std::complex<T> &y) {
+    sum = std::complex<T>(sum.real() + x.real() * y.real() - x.imag() * y.imag(),
+                          sum.imag() + x.real() * y.imag() + x.imag() * y.real());
+}
+
+// c = alpha * sum + beta * c, without reading c when beta is zero.
+template <typename fp>
+void update(fp &c, wide_t<fp> alpha, wide_t<fp> sum, wide_t<fp> beta) {
+    wide_t<fp> result = alpha * sum;
+    if (beta != wide_t<fp>(0))
+        result += beta * wide_t<fp>(c);
+    c = fp(result);
+}
+
+// op(A)(i, j) of a general matrix.
+template <typename fp>
+wide_t<fp> general(const fp *a, int lda, CBLAS_TRANSPOSE trans, int i, int j) {
+    if (trans == CblasNoTrans)
+        return wide_t<fp>(a[i + j * lda]);
+    const wide_t<fp> v(a[j + i * lda]);
+    return (trans == CblasConjTrans) ? conjugate(v) : v;
+}
+
+// A(i, j) of a symmetric or Hermitian matrix stored in one triangle.
+template <typename fp>
+wide_t<fp> symmetric(const fp *a, int lda, CBLAS_UPLO uplo, bool hermitian, int i, int j) {
+    if ((uplo == CblasUpper) ? (i <= j) : (i >= j)) {
+        const wide_t<fp> v(a[i + j * lda]);
+        return (hermitian && i == j) ? wide_t<fp>(std::real(v)) : v;
+    }
+    const wide_t<fp> v(a[j + i * lda]);
+    return hermitian ? conjugate(v) : v;
+}
+
+// op(A)(i, j) of a triangular matrix.
+template <typename fp>
+wide_t<fp> triangular(const fp *a, int lda, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                      CBLAS_DIAG diag, int i, int j) {
+    const int r = (trans == CblasNoTrans) ? i : j, c = (trans == CblasNoTrans) ? j : i;
+    if (r == c && diag == CblasUnit)
+        return wide_t<fp>(1);
+    if ((uplo == CblasUpper) ? (r > c) : (r < c))
+        return wide_t<fp>(0);
+    const wide_t<fp> v(a[r + c * lda]);
+    return (trans == CblasConjTrans) ? conjugate(v) : v;
+}
+
+// Offset of element i of a vector of n elements with increment inc.
+static int vector_index(int i, int n, int inc) {
+    return (inc > 0) ? i * inc : (n - 1 - i) * -inc;
+}
+
+static bool all_tiles(int, int, int, int) {
+    return true;
+}
+
+constexpr int tile_m = 64, tile_n = 64, tile_k = 256;
+
+// For every (i, j) of the m x n tiles [i0, i1) x [j0, j1) for which
+// keep(i0, i1, j0, j1) holds, calls store(i, j, s) with s the sum over p of
+// a(i, p) * b(p, j). a and b return wide values, and the tiles of a and b are
+// packed before they are multiplied.
+template <typename fp, typename A, typename B, typename Store, typename Keep>
+void product(int m, int n, int k, A a, B b, Store store, Keep keep) {
+    using acc = wide_t<fp>;
+    const int tiles_m = (m + tile_m - 1) / tile_m, tiles_n = (n + tile_n - 1) / tile_n;
+    parallel_for(tiles_m * tiles_n, [&](int t) {
+        const int i0 = (t % tiles_m) * tile_m, j0 = (t / tiles_m) * tile_n;
+        const int i1 = std::min(i0 + tile_m, m), j1 = std::min(j0 + tile_n, n);
+        if (!keep(i0, i1, j0, j1))
+            return;
+        const int rows = i1 - i0, cols = j1 - j0;
+        std::vector<acc> sum(rows * cols, acc(0)), a_tile(rows * tile_k), b_tile(cols * tile_k);
+        for (int p0 = 0; p0 < k; p0 += tile_k) {
+            const int depth = std::min(tile_k, k - p0);
+            for (int p = 0; p < depth; p++)
+                for (int i = 0; i < rows; i++)
+                    a_tile[p * rows + i] = a(i0 + i, p0 + p);
+            for (int j = 0; j < cols; j++)
+                for (int p = 0; p < depth; p++)
+                    b_tile[j * depth + p] = b(p0 + p, j0 + j);
+            // Four rows of a column at a time, as independent sums that are
+            // each taken in the order of p.
+            for (int j = 0; j < cols; j++) {
+                const acc *y = &b_tile[j * depth];
+                int i = 0;
+                for (; i + 4 <= rows; i += 4) {
+                    acc s0 = sum[i + j * rows], s1 = sum[i + 1 + j * rows],
+                        s2 = sum[i + 2 + j * rows], s3 = sum[i + 3 + j * rows];
+                    for (int p = 0; p < depth; p++) {
+                        const acc *x = &a_tile[p * rows + i];
+                        multiply_add(s0, x[0], y[p]);
+                        multiply_add(s1, x[1], y[p]);
+                        multiply_add(s2, x[2], y[p]);
+                        multiply_add(s3, x[3], y[p]);
+                    }
+                    sum[i + j * rows] = s0;
+                    sum[i + 1 + j * rows] = s1;
+                    sum[i + 2 + j * rows] = s2;
+                    sum[i + 3 + j * rows] = s3;
+                }
+                for (; i < rows; i++) {
+                    acc s = sum[i + j * rows];
+                    for (int p = 0; p < depth; p++)
+                        multiply_add(s, a_tile[p * rows + i], y[p]);
+                    sum[i + j * rows] = s;
+                }
+            }
+        }
+        for (int j = 0; j < cols; j++)
+            for (int i = 0; i < rows; i++)
+                store(i0 + i, j0 + j, sum[i + j * rows]);
+    });
+}
+
+/* Level 2 */
+
+template <typename fp>
+void gemv(CBLAS_TRANSPOSE trans, int m, int n, fp alpha, const fp *a, int lda, const fp *x,
+          int incx, fp beta, fp *y, int incy) {
+    using acc = wide_t<fp>;
+    const int rows = (trans == CblasNoTrans) ? m : n, cols = (trans == CblasNoTrans) ? n : m;
+    product<fp>(
+        rows, 1, cols, [=](int i, int p) { return general(a, lda, trans, i, p); },
+        [=](int p, int) { return acc(x[vector_index(p, cols, incx)]); },
+        [=](int i, int, acc s) {
+            update(y[vector_index(i, rows, incy)], acc(alpha), s, acc(beta));
+        },
+        all_tiles);
+}
+
+template <typename fp>
+void symv(CBLAS_UPLO uplo, bool hermitian, int n, fp alpha, const fp *a, int lda, const fp *x,
+          int incx, fp beta, fp *y, int incy) {
+    using acc = wide_t<fp>;
+    product<fp>(
+        n, 1, n, [=](int i, int p) { return symmetric(a, lda, uplo, hermitian, i, p); },
+        [=](int p, int) { return acc(x[vector_index(p, n, incx)]); },
+        [=](int i, int, acc s) { update(y[vector_index(i, n, incy)], acc(alpha), s, acc(beta)); },
+        all_tiles);
+}
+
+template <typename fp>
+void trmv(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, const fp *a, int lda,
+          fp *x, int incx) {
+    using acc = wide_t<fp>;
+    std::vector<fp> x_in(n);
+    for (int i = 0; i < n; i++)
+        x_in[i] = x[vector_index(i, n, incx)];
+    const fp *x_copy = x_in.data();
+    product<fp>(
+        n, 1, n, [=](int i, int p) { return triangular(a, lda, uplo, trans, diag, i, p); },
+        [=](int p, int) { return acc(x_copy[p]); },
+        [=](int i, int, acc s) { update(x[vector_index(i, n, incx)], acc(1), s, acc(0)); },
+        all_tiles);
+}
+
+/* Level 3 */
+
+template <typename fp>
+void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int m, int n, int k, fp alpha,
+          const fp *a, int lda, const fp *b, int ldb, fp beta, fp *c, int ldc) {
+    using acc = wide_t<fp>;
+    product<fp>(
+        m, n, k, [=](int i, int p) { return general(a, lda, transa, i, p); },
+        [=](int p, int j) { return general(b, ldb, transb, p, j); },
+        [=](int i, int j, acc s) { update(c[i + j * ldc], acc(alpha), s, acc(beta)); },
+        all_tiles);
+}
+
+template <typename fp>
+void symm(CBLAS_SIDE side, CBLAS_UPLO uplo, bool hermitian, int m, int n, fp alpha, const fp *a,
+          int lda, const fp *b, int ldb, fp beta, fp *c, int ldc) {
+    using acc = wide_t<fp>;
+    auto store = [=](int i, int j, acc s) {
+        update(c[i + j * ldc], acc(alpha), s, acc(beta));
+    };
+    if (side == CblasLeft)
+        product<fp>(
+            m, n, m, [=](int i, int p) { return symmetric(a, lda, uplo, hermitian, i, p); },
+            [=](int p, int j) { return acc(b[p + j * ldb]); }, store, all_tiles);
+    else
+        product<fp>(
+            m, n, n, [=](int i, int p) { return acc(b[i + p * ldb]); },
+            [=](int p, int j) { return symmetric(a, lda, uplo, hermitian, p, j); }, store,
+            all_tiles);
+}
+
+// The tiles of C an update of the uplo triangle touches, and that update,
+// which leaves the imaginary part of the diagonal zero for Hermitian C.
+struct triangle_tiles {
+    CBLAS_UPLO uplo;
+    bool operator()(int i0, int i1, int j0, int j1) const {
+        return (uplo == CblasUpper) ? (i0 < j1) : (i1 > j0);
+    }
+};
+
+template <typename fp>
+struct triangle_update {
+    CBLAS_UPLO uplo;
+    bool hermitian;
+    fp *c;
+    int ldc;
+    wide_t<fp> alpha, beta;
+    void operator()(int i, int j, wide_t<fp> s) const {
+        if ((uplo == CblasUpper) ? (i > j) : (i < j))
+            return;
+        fp &cij = c[i + j * ldc];
+        if (hermitian && i == j)
+            cij = fp(std::real(cij));
+        update(cij, alpha, s, beta);
+        if (hermitian && i == j)
+            cij = fp(std::real(cij));
+    }
+};
+
+// C = alpha * op(A) * op(A)^T + beta * C, or op(A)^H for herk.
+template <typename fp, typename fp_scalar>
+void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, bool hermitian, int n, int k, fp_scalar alpha,
+          const fp *a, int lda, fp_scalar beta, fp *c, int ldc) {
+    using acc = wide_t<fp>;
+    auto op_a = [=](int i, int p) { return general(a, lda, trans, i, p); };
+    product<fp>(
+        n, n, k, op_a,
+        [=](int p, int j) { return hermitian ? conjugate(op_a(j, p)) : op_a(j, p); },
+        triangle_update<fp>{ uplo, hermitian, c, ldc, acc(alpha), acc(beta) },
+        triangle_tiles{ uplo });
+}
+
+// C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C, or with
+// ^H and conj(alpha) on the second product for her2k, as a single product of
+// depth 2k.
+template <typename fp, typename fp_scalar>
+void syr2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, bool hermitian, int n, int k, fp alpha,
+           const fp *a, int lda, const fp *b, int ldb, fp_scalar beta, fp *c, int ldc) {
+    using acc = wide_t<fp>;
+    const acc alpha_a(alpha), alpha_b = hermitian ? conjugate(alpha_a) : alpha_a;
+    auto op = [=](const fp *x, int ldx, int i, int p) { return general(x, ldx, trans, i, p); };
+    product<fp>(
+        n, n, 2 * k,
+        [=](int i, int p) {
+            return (p < k) ? alpha_a * op(a, lda, i, p) : alpha_b * op(b, ldb, i, p - k);
+        },
+        [=](int p, int j) {
+            const acc v = (p < k) ? op(b, ldb, j, p) : op(a, lda, j, p - k);
+            return hermitian ? conjugate(v) : v;
+        },
+        triangle_update<fp>{ uplo, hermitian, c, ldc, acc(1), acc(beta) }, triangle_tiles{ uplo });
+}
+
+template <typename fp>
+void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transa, CBLAS_DIAG diag, int m, int n,
+          fp alpha, const fp *a, int lda, fp *b, int ldb) {
+    using acc = wide_t<fp>;
+    if (m == 0 || n == 0)
+        return;
+    std::vector<fp> b_in(b, b + ldb * (n - 1) + m);
+    const fp *b_copy = b_in.data();
+    auto store = [=](int i, int j, acc s) {
+        update(b[i + j * ldb], acc(alpha), s, acc(0));
+    };
+    if (side == CblasLeft)
+        product<fp>(
+            m, n, m, [=](int i, int p) { return triangular(a, lda, uplo, transa, diag, i, p); },
+            [=](int p, int j) { return acc(b_copy[p + j * ldb]); }, store, all_tiles);
+    else
+        product<fp>(
+            m, n, n, [=](int i, int p) { return acc(b_copy[i + p * ldb]); },
+            [=](int p, int j) { return triangular(a, lda, uplo, transa, diag, p, j); }, store,
+            all_tiles);
+}
+
+} // namespace blocked_ref
+
+#endif /* header guard */
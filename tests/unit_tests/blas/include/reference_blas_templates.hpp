@@ -24,6 +24,7 @@
 #include <complex>
 #include "cblas.h"
 #include "test_helper.hpp"
+#include "reference_blas_blocked.hpp"
 
 #ifdef __linux__
 #include <dlfcn.h>
@@ -231,6 +232,10 @@ template <>
 void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n, const int *k,
           const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
           const float *beta, float *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_sgemm(CblasColMajor, transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c,
                 *ldc);
 }
@@ -239,6 +244,10 @@ template <>
 void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n, const int *k,
           const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
           const double *beta, double *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_dgemm(CblasColMajor, transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c,
                 *ldc);
 }
@@ -248,6 +257,10 @@ void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const in
           const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
           const std::complex<float> *b, const int *ldb, const std::complex<float> *beta,
           std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_cgemm(CblasColMajor, transa, transb, *m, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -256,6 +269,10 @@ void gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const in
           const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
           const std::complex<double> *b, const int *ldb, const std::complex<double> *beta,
           std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_zgemm(CblasColMajor, transa, transb, *m, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -268,6 +285,11 @@ template <>
 void symm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n, const float *alpha,
           const float *a, const int *lda, const float *b, const int *ldb, const float *beta,
           float *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, false, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c,
+                          *ldc);
+        return;
+    }
     cblas_ssymm(CblasColMajor, left_right, uplo, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -275,6 +297,11 @@ template <>
 void symm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n, const double *alpha,
           const double *a, const int *lda, const double *b, const int *ldb, const double *beta,
           double *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, false, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c,
+                          *ldc);
+        return;
+    }
     cblas_dsymm(CblasColMajor, left_right, uplo, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -283,6 +310,11 @@ void symm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n,
           const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
           const std::complex<float> *b, const int *ldb, const std::complex<float> *beta,
           std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, false, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c,
+                          *ldc);
+        return;
+    }
     cblas_csymm(CblasColMajor, left_right, uplo, *m, *n, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -291,6 +323,11 @@ void symm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n,
           const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
           const std::complex<double> *b, const int *ldb, const std::complex<double> *beta,
           std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, false, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c,
+                          *ldc);
+        return;
+    }
     cblas_zsymm(CblasColMajor, left_right, uplo, *m, *n, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -302,12 +339,20 @@ static void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int
 template <>
 void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const float *alpha,
           const float *a, const int *lda, const float *beta, float *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, false, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_ssyrk(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
 }
 
 template <>
 void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const double *alpha,
           const double *a, const int *lda, const double *beta, double *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, false, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_dsyrk(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
 }
 
@@ -315,6 +360,10 @@ template <>
 void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
           const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
           const std::complex<float> *beta, std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, false, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_csyrk(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, beta, c, *ldc);
 }
 
@@ -322,6 +371,10 @@ template <>
 void syrk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
           const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
           const std::complex<double> *beta, std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, false, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_zsyrk(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, beta, c, *ldc);
 }
 
@@ -335,6 +388,10 @@ void hemm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n,
           const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
           const std::complex<float> *b, const int *ldb, const std::complex<float> *beta,
           std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, true, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_chemm(CblasColMajor, left_right, uplo, *m, *n, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -343,6 +400,10 @@ void hemm(CBLAS_SIDE left_right, CBLAS_UPLO uplo, const int *m, const int *n,
           const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
           const std::complex<double> *b, const int *ldb, const std::complex<double> *beta,
           std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (left_right == CblasLeft ? *m : *n))) {
+        blocked_ref::symm(left_right, uplo, true, *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_zhemm(CblasColMajor, left_right, uplo, *m, *n, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -355,6 +416,10 @@ template <>
 void herk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const float *alpha,
           const std::complex<float> *a, const int *lda, const float *beta, std::complex<float> *c,
           const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, true, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_cherk(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
 }
 
@@ -362,6 +427,10 @@ template <>
 void herk(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const double *alpha,
           const std::complex<double> *a, const int *lda, const double *beta,
           std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*n) * *n * *k)) {
+        blocked_ref::syrk(uplo, trans, true, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+        return;
+    }
     cblas_zherk(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, *beta, c, *ldc);
 }
 
@@ -374,6 +443,10 @@ template <>
 void syr2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const float *alpha,
            const float *a, const int *lda, const float *b, const int *ldb, const float *beta,
            float *c, const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, false, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_ssyr2k(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -381,6 +454,10 @@ template <>
 void syr2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k, const double *alpha,
            const double *a, const int *lda, const double *b, const int *ldb, const double *beta,
            double *c, const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, false, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_dsyr2k(CblasColMajor, uplo, trans, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -389,6 +466,10 @@ void syr2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
            const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
            const std::complex<float> *b, const int *ldb, const std::complex<float> *beta,
            std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, false, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_csyr2k(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -397,6 +478,10 @@ void syr2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
            const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
            const std::complex<double> *b, const int *ldb, const std::complex<double> *beta,
            std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, false, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_zsyr2k(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -410,6 +495,10 @@ void her2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
            const std::complex<float> *alpha, const std::complex<float> *a, const int *lda,
            const std::complex<float> *b, const int *ldb, const float *beta, std::complex<float> *c,
            const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, true, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_cher2k(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -418,6 +507,10 @@ void her2k(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int *n, const int *k,
            const std::complex<double> *alpha, const std::complex<double> *a, const int *lda,
            const std::complex<double> *b, const int *ldb, const double *beta,
            std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(2.0 * *n * *n * *k)) {
+        blocked_ref::syr2k(uplo, trans, true, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_zher2k(CblasColMajor, uplo, trans, *n, *k, alpha, a, *lda, b, *ldb, *beta, c, *ldc);
 }
 
@@ -430,6 +523,10 @@ template <>
 void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transa, CBLAS_DIAG diag, const int *m,
           const int *n, const float *alpha, const float *a, const int *lda, float *b,
           const int *ldb) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (side == CblasLeft ? *m : *n))) {
+        blocked_ref::trmm(side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
+        return;
+    }
     cblas_strmm(CblasColMajor, side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
 }
 
@@ -437,6 +534,10 @@ template <>
 void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transa, CBLAS_DIAG diag, const int *m,
           const int *n, const double *alpha, const double *a, const int *lda, double *b,
           const int *ldb) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (side == CblasLeft ? *m : *n))) {
+        blocked_ref::trmm(side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
+        return;
+    }
     cblas_dtrmm(CblasColMajor, side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
 }
 
@@ -444,6 +545,10 @@ template <>
 void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transa, CBLAS_DIAG diag, const int *m,
           const int *n, const std::complex<float> *alpha, const std::complex<float> *a,
           const int *lda, std::complex<float> *b, const int *ldb) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (side == CblasLeft ? *m : *n))) {
+        blocked_ref::trmm(side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
+        return;
+    }
     cblas_ctrmm(CblasColMajor, side, uplo, transa, diag, *m, *n, alpha, a, *lda, b, *ldb);
 }
 
@@ -451,6 +556,10 @@ template <>
 void trmm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transa, CBLAS_DIAG diag, const int *m,
           const int *n, const std::complex<double> *alpha, const std::complex<double> *a,
           const int *lda, std::complex<double> *b, const int *ldb) {
+    if (blocked_ref::worthwhile(double(*m) * *n * (side == CblasLeft ? *m : *n))) {
+        blocked_ref::trmm(side, uplo, transa, diag, *m, *n, *alpha, a, *lda, b, *ldb);
+        return;
+    }
     cblas_ztrmm(CblasColMajor, side, uplo, transa, diag, *m, *n, alpha, a, *lda, b, *ldb);
 }
 
@@ -498,6 +607,10 @@ template <>
 void gemv(CBLAS_TRANSPOSE trans, const int *m, const int *n, const float *alpha, const float *a,
           const int *lda, const float *x, const int *incx, const float *beta, float *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*m) * *n)) {
+        blocked_ref::gemv(trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_sgemv(CblasColMajor, trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
 }
 
@@ -505,6 +618,10 @@ template <>
 void gemv(CBLAS_TRANSPOSE trans, const int *m, const int *n, const double *alpha, const double *a,
           const int *lda, const double *x, const int *incx, const double *beta, double *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*m) * *n)) {
+        blocked_ref::gemv(trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_dgemv(CblasColMajor, trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
 }
 
@@ -513,6 +630,10 @@ void gemv(CBLAS_TRANSPOSE trans, const int *m, const int *n, const std::complex<
           const std::complex<float> *a, const int *lda, const std::complex<float> *x,
           const int *incx, const std::complex<float> *beta, std::complex<float> *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*m) * *n)) {
+        blocked_ref::gemv(trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_cgemv(CblasColMajor, trans, *m, *n, alpha, a, *lda, x, *incx, beta, y, *incy);
 }
 
@@ -521,6 +642,10 @@ void gemv(CBLAS_TRANSPOSE trans, const int *m, const int *n, const std::complex<
           const std::complex<double> *a, const int *lda, const std::complex<double> *x,
           const int *incx, const std::complex<double> *beta, std::complex<double> *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*m) * *n)) {
+        blocked_ref::gemv(trans, *m, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_zgemv(CblasColMajor, trans, *m, *n, alpha, a, *lda, x, *incx, beta, y, *incy);
 }
 
@@ -641,6 +766,10 @@ void hemv(CBLAS_UPLO upper_lower, const int *n, const std::complex<float> *alpha
           const std::complex<float> *a, const int *lda, const std::complex<float> *x,
           const int *incx, const std::complex<float> *beta, std::complex<float> *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::symv(upper_lower, true, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_chemv(CblasColMajor, upper_lower, *n, alpha, a, *lda, x, *incx, beta, y, *incy);
 }
 
@@ -649,6 +778,10 @@ void hemv(CBLAS_UPLO upper_lower, const int *n, const std::complex<double> *alph
           const std::complex<double> *a, const int *lda, const std::complex<double> *x,
           const int *incx, const std::complex<double> *beta, std::complex<double> *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::symv(upper_lower, true, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_zhemv(CblasColMajor, upper_lower, *n, alpha, a, *lda, x, *incx, beta, y, *incy);
 }
 
@@ -764,6 +897,10 @@ static void symv(CBLAS_UPLO upper_lower, const int *n, const fp *alpha, const fp
 template <>
 void symv(CBLAS_UPLO upper_lower, const int *n, const float *alpha, const float *a, const int *lda,
           const float *x, const int *incx, const float *beta, float *y, const int *incy) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::symv(upper_lower, false, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_ssymv(CblasColMajor, upper_lower, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
 }
 
@@ -771,6 +908,10 @@ template <>
 void symv(CBLAS_UPLO upper_lower, const int *n, const double *alpha, const double *a,
           const int *lda, const double *x, const int *incx, const double *beta, double *y,
           const int *incy) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::symv(upper_lower, false, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
+        return;
+    }
     cblas_dsymv(CblasColMajor, upper_lower, *n, *alpha, a, *lda, x, *incx, *beta, y, *incy);
 }
 
@@ -977,24 +1118,40 @@ static void trmv(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_
 template <>
 void trmv(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, const int *n,
           const float *a, const int *lda, float *x, const int *incx) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::trmv(upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
+        return;
+    }
     cblas_strmv(CblasColMajor, upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
 }
 
 template <>
 void trmv(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, const int *n,
           const double *a, const int *lda, double *x, const int *incx) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::trmv(upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
+        return;
+    }
     cblas_dtrmv(CblasColMajor, upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
 }
 
 template <>
 void trmv(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, const int *n,
           const std::complex<float> *a, const int *lda, std::complex<float> *x, const int *incx) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::trmv(upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
+        return;
+    }
     cblas_ctrmv(CblasColMajor, upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
 }
 
 template <>
 void trmv(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, const int *n,
           const std::complex<double> *a, const int *lda, std::complex<double> *x, const int *incx) {
+    if (blocked_ref::worthwhile(double(*n) * *n)) {
+        blocked_ref::trmv(upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
+        return;
+    }
     cblas_ztrmv(CblasColMajor, upper_lower, trans, unit_diag, *n, a, *lda, x, *incx);
 }
 
@@ -1469,6 +1626,10 @@ template <>
 void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n,
               const int *k, const float *alpha, const float *a, const int *lda, const float *b,
               const int *ldb, const float *beta, float *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_sgemm(CblasColMajor, transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c,
                 *ldc);
 }
@@ -1477,6 +1638,10 @@ template <>
 void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n,
               const int *k, const double *alpha, const double *a, const int *lda, const double *b,
               const int *ldb, const double *beta, double *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_dgemm(CblasColMajor, transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c,
                 *ldc);
 }
@@ -1486,6 +1651,10 @@ void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, cons
               const int *k, const std::complex<float> *alpha, const std::complex<float> *a,
               const int *lda, const std::complex<float> *b, const int *ldb,
               const std::complex<float> *beta, std::complex<float> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_cgemm(CblasColMajor, transa, transb, *m, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -1494,6 +1663,10 @@ void gemm_ext(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, cons
               const int *k, const std::complex<double> *alpha, const std::complex<double> *a,
               const int *lda, const std::complex<double> *b, const int *ldb,
               const std::complex<double> *beta, std::complex<double> *c, const int *ldc) {
+    if (blocked_ref::worthwhile(double(*m) * *n * *k)) {
+        blocked_ref::gemm(transa, transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+        return;
+    }
     cblas_zgemm(CblasColMajor, transa, transb, *m, *n, *k, alpha, a, *lda, b, *ldb, beta, c, *ldc);
 }
 
@@ -1621,4 +1794,61 @@ void gemmt(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE trans
     oneapi::mkl::aligned_free(cf);
 }
 
+
+/* Matrix copy and add extensions */
+
+template <typename fp>
+static inline fp conj_if_complex(fp x) {
+    return x;
+}
+
+template <typename fp>
+static inline std::complex<fp> conj_if_complex(std::complex<fp> x) {
+    return std::conj(x);
+}
+
+template <typename fp>
+static inline fp op_entry(CBLAS_TRANSPOSE trans, const fp *a, int lda, int i, int j) {
+    if (trans == CblasNoTrans)
+        return a[i + j * lda];
+    else if (trans == CblasTrans)
+        return a[j + i * lda];
+    else
+        return conj_if_complex(a[j + i * lda]);
+}
+
+template <typename fp>
+static void omatcopy(CBLAS_TRANSPOSE trans, const int *m, const int *n, const fp *alpha,
+                     const fp *a, const int *lda, fp *b, const int *ldb) {
+    // Not supported in NETLIB. B := alpha * op(A) is computed entry by entry.
+    int rows = (trans == CblasNoTrans) ? *m : *n;
+    int cols = (trans == CblasNoTrans) ? *n : *m;
+    for (int j = 0; j < cols; j++)
+        for (int i = 0; i < rows; i++)
+            b[i + j * *ldb] = *alpha * op_entry(trans, a, *lda, i, j);
+}
+
+template <typename fp>
+static void imatcopy(CBLAS_TRANSPOSE trans, const int *m, const int *n, const fp *alpha, fp *ab,
+                     const int *lda, const int *ldb) {
+    // Not supported in NETLIB. The input is copied aside and omatcopy is used as reference.
+    int sizea = *lda * *n;
+    fp *af = (fp *)oneapi::mkl::aligned_alloc(64, sizeof(fp) * sizea);
+    for (int i = 0; i < sizea; i++)
+        af[i] = ab[i];
+    omatcopy(trans, m, n, alpha, af, lda, ab, ldb);
+    oneapi::mkl::aligned_free(af);
+}
+
+template <typename fp>
+static void omatadd(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, const int *m, const int *n,
+                    const fp *alpha, const fp *a, const int *lda, const fp *beta, const fp *b,
+                    const int *ldb, fp *c, const int *ldc) {
+    // Not supported in NETLIB. C := alpha * op(A) + beta * op(B) is computed entry by entry.
+    for (int j = 0; j < *n; j++)
+        for (int i = 0; i < *m; i++)
+            c[i + j * *ldc] = *alpha * op_entry(transa, a, *lda, i, j) +
+                              *beta * op_entry(transb, b, *ldb, i, j);
+}
+
 #endif /* header guard */
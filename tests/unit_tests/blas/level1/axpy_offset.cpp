@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device &dev, int N, int incx, int incy, int offset_x, int offset_y, fp alpha) {
+    // Prepare data. Both vectors start part way into their buffers.
+    vector<fp> x, y, y_ref;
+
+    rand_vector(x, N + offset_x, incx);
+    rand_vector(y, N + offset_y, incy);
+    y_ref = y;
+
+    const int start_x = offset_x * std::abs(incx), start_y = offset_y * std::abs(incy);
+
+    // Call Reference AXPY.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx, incy_ref = incy;
+
+    ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)(x.data() + start_x), &incx_ref,
+           (fp_ref *)(y_ref.data() + start_y), &incy_ref);
+
+    // Call DPC++ AXPY.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> y_buffer = make_buffer(y);
+
+    try {
+#ifdef CALL_RT_API
+        oneapi::mkl::blas::axpy(main_queue, N, alpha, x_buffer, start_x, incx, y_buffer, start_y,
+                                incy);
+#else
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::axpy,
+                    (main_queue, N, alpha, x_buffer, start_x, incx, y_buffer, start_y, incy));
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of AXPY:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good;
+    {
+        auto y_accessor = y_buffer.template get_access<access::mode::read>();
+        good = check_equal_vector(y_accessor, y_ref, N + offset_y, incy, N, std::cout);
+    }
+
+    return (int)good;
+}
+
+// Offsets that would place x partly outside its buffer are rejected before
+// anything is submitted.
+template <typename fp>
+int test_out_of_range(const device &dev, int N, int offset_x) {
+    vector<fp> x, y;
+    rand_vector(x, N, 1);
+    rand_vector(y, N, 1);
+
+    queue main_queue(dev);
+
+    buffer<fp, 1> x_buffer = make_buffer(x);
+    buffer<fp, 1> y_buffer = make_buffer(y);
+
+    try {
+#ifdef CALL_RT_API
+        oneapi::mkl::blas::axpy(main_queue, N, fp(2.0), x_buffer, offset_x, 1, y_buffer, 0, 1);
+#else
+        TEST_RUN_CT(main_queue, oneapi::mkl::blas::axpy,
+                    (main_queue, N, fp(2.0), x_buffer, offset_x, 1, y_buffer, 0, 1));
+#endif
+    }
+    catch (const oneapi::mkl::InvalidArgumentsException &e) {
+        return 1;
+    }
+    catch (const oneapi::mkl::backend_unsupported_exception &e) {
+        return test_skipped;
+    }
+
+    std::cout << "AXPY accepted offset_x = " << offset_x << " into a buffer of " << N
+              << " elements" << std::endl;
+    return 0;
+}
+
+class AxpyOffsetTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(AxpyOffsetTests, RealSinglePrecision) {
+    float alpha(2.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 2, 3, 7, 11, alpha));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, 1, 1, 5, 3, alpha));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357, -3, -2, 4, 9, alpha));
+}
+TEST_P(AxpyOffsetTests, RealDoublePrecision) {
+    double alpha(2.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 2, 3, 7, 11, alpha));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, 1, 1, 5, 3, alpha));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357, -3, -2, 4, 9, alpha));
+}
+TEST_P(AxpyOffsetTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, 2, 3, 7, 11, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, 1, 1, 5, 3, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), 1357, -3, -2, 4, 9, alpha));
+}
+TEST_P(AxpyOffsetTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, 2, 3, 7, 11, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, 1, 1, 5, 3, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), 1357, -3, -2, 4, 9, alpha));
+}
+
+TEST_P(AxpyOffsetTests, OutOfRangeOffset) {
+    EXPECT_TRUEORSKIP(test_out_of_range<float>(GetParam(), 1357, 1));
+    EXPECT_TRUEORSKIP(test_out_of_range<float>(GetParam(), 1357, -1));
+    EXPECT_TRUEORSKIP(test_out_of_range<double>(GetParam(), 1357, 1357));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyOffsetTestSuite, AxpyOffsetTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
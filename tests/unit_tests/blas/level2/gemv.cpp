@@ -137,6 +137,8 @@ TEST_P(GemvTests, RealSinglePrecision) {
         test<float>(GetParam(), oneapi::mkl::transpose::trans, 25, 30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(
         test<float>(GetParam(), oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans, 4099, 3001, alpha,
+                                  beta, 1, 1, 4100));
 }
 TEST_P(GemvTests, RealDoublePrecision) {
     double alpha(2.0);
@@ -153,6 +155,8 @@ TEST_P(GemvTests, RealDoublePrecision) {
         test<double>(GetParam(), oneapi::mkl::transpose::trans, 25, 30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(
         test<double>(GetParam(), oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans, 4099, 3001, alpha,
+                                   beta, 1, 1, 4100));
 }
 TEST_P(GemvTests, ComplexSinglePrecision) {
     std::complex<float> alpha(2.0, -0.5);
@@ -175,6 +179,8 @@ TEST_P(GemvTests, ComplexSinglePrecision) {
                                                 30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::conjtrans, 25,
                                                 30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::nontrans, 4099,
+                                                3001, alpha, beta, 1, 1, 4100));
 }
 TEST_P(GemvTests, ComplexDoublePrecision) {
     std::complex<double> alpha(2.0, -0.5);
@@ -197,6 +203,8 @@ TEST_P(GemvTests, ComplexDoublePrecision) {
                                                  30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::conjtrans, 25,
                                                  30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::nontrans, 4099,
+                                                 3001, alpha, beta, 1, 1, 4100));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemvTestSuite, GemvTests, ::testing::ValuesIn(devices),
@@ -133,6 +133,15 @@ TEST_P(GemmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
                                   beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, 12, 16, 40000, 13, 40001, 14,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, 12, 16, 40000, 40001, 17, 14,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::trans, 1537, 1601, 2003, 1540, 1610, 1540,
+                                  alpha, beta));
 }
 
 TEST_P(GemmTests, RealDoublePrecision) {
@@ -150,6 +159,15 @@ TEST_P(GemmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
                                    oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
                                    beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::nontrans, 12, 16, 40000, 13, 40001, 14,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::trans, 12, 16, 40000, 40001, 17, 14,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::trans, 1537, 1601, 2003, 1540, 1610,
+                                   1540, alpha, beta));
 }
 
 TEST_P(GemmTests, ComplexSinglePrecision) {
@@ -182,6 +200,9 @@ TEST_P(GemmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::conjtrans,
                                                 oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103,
                                                 105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                                oneapi::mkl::transpose::trans, 1537, 1601, 2003,
+                                                1540, 1610, 1540, alpha, beta));
 }
 
 TEST_P(GemmTests, ComplexDoublePrecision) {
@@ -214,6 +235,9 @@ TEST_P(GemmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::conjtrans,
                                                  oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103,
                                                  105, 106, alpha, beta));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                                 oneapi::mkl::transpose::trans, 1537, 1601, 2003,
+                                                 1540, 1610, 1540, alpha, beta));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmTestSuite, GemmTests, ::testing::ValuesIn(devices),
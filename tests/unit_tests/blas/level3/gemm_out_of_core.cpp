@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/out_of_core.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+// Bytes written before the first element of each matrix file.
+constexpr int file_offset = 40;
+
+template <typename fp>
+std::string write_matrix_file(const char* name, const vector<fp>& M) {
+    std::string path = std::string("onemkl_gemm_out_of_core_") + name;
+    FILE* f = std::fopen(path.c_str(), "wb");
+    const char header[file_offset] = {};
+    std::fwrite(header, 1, file_offset, f);
+    std::fwrite(M.data(), sizeof(fp), M.size(), f);
+    std::fclose(f);
+    return path;
+}
+
+template <typename fp>
+void read_matrix_file(const std::string& path, vector<fp>& M) {
+    FILE* f = std::fopen(path.c_str(), "rb");
+    std::fseek(f, file_offset, SEEK_SET);
+    if (std::fread(M.data(), sizeof(fp), M.size(), f) != M.size())
+        std::fill(M.begin(), M.end(), fp(std::numeric_limits<fp>::quiet_NaN()));
+    std::fclose(f);
+}
+
+template <typename fp>
+int test(const device& dev, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb, int m,
+         int n, int k, int lda, int ldb, int ldc, fp alpha, fp beta, int tile) {
+#if defined(CALL_RT_API) && !defined(_WIN64)
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_OUT_OF_CORE:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+
+    // Prepare data.
+    vector<fp> A, B, C;
+    rand_matrix(A, transa, m, k, lda);
+    rand_matrix(B, transb, k, n, ldb);
+    rand_matrix(C, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    auto C_ref = C;
+
+    const std::string a_path = write_matrix_file("a", A);
+    const std::string b_path = write_matrix_file("b", B);
+    const std::string c_path = write_matrix_file("c", C);
+
+    // Call Reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref,
+           (fp_ref*)&alpha, (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref,
+           (fp_ref*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM_OUT_OF_CORE with tiles much smaller than the matrices.
+    try {
+        oneapi::mkl::blas::gemm_out_of_core(main_queue, transa, transb, m, n, k, alpha,
+                                            { a_path, lda, file_offset },
+                                            { b_path, ldb, file_offset }, beta,
+                                            { c_path, ldc, file_offset }, tile);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_OUT_OF_CORE:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        std::remove(a_path.c_str());
+        std::remove(b_path.c_str());
+        std::remove(c_path.c_str());
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_OUT_OF_CORE:\n"
+                  << error.what() << std::endl;
+    }
+
+    read_matrix_file(c_path, C);
+    std::remove(a_path.c_str());
+    std::remove(b_path.c_str());
+    std::remove(c_path.c_str());
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(C, C_ref, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+#else
+    // Out-of-core gemm is part of the run-time dispatch library on POSIX systems.
+    return test_skipped;
+#endif
+}
+
+class GemmOutOfCoreTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmOutOfCoreTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                  alpha, beta, 32));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                  beta, 40));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                  0.0f, 17));
+}
+
+TEST_P(GemmOutOfCoreTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                   alpha, beta, 32));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                   beta, 40));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
+                                   0.0, 17));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmOutOfCoreTestSuite, GemmOutOfCoreTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
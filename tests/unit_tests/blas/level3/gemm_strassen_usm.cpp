@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device> devices;
+
+namespace {
+
+template <typename fp>
+int test(const device& dev, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb, int m,
+         int n, int k, int lda, int ldb, int ldc, fp alpha, fp beta, int cutoff) {
+#ifdef CALL_RT_API
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM:\n"
+                          << e.what() << std::endl
+                          << "OpenCL status: " << e.get_cl_code() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, transa, m, k, lda);
+    rand_matrix(B, transb, k, n, ldb);
+    rand_matrix(C, oneapi::mkl::transpose::nontrans, m, n, ldc);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    ::gemm(convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref,
+           (fp_ref*)&alpha, (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref,
+           (fp_ref*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM with the Strassen-Winograd hint on the queue.
+    try {
+        oneapi::mkl::blas::set_gemm_algorithm(main_queue, oneapi::mkl::gemm_algorithm::strassen,
+                                              cutoff);
+        done = oneapi::mkl::blas::gemm(main_queue, transa, transb, m, n, k, alpha, A.data(), lda,
+                                       B.data(), ldb, beta, C.data(), ldc, dependencies);
+        done.wait();
+        oneapi::mkl::blas::set_gemm_algorithm(main_queue, oneapi::mkl::gemm_algorithm::standard);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM:\n"
+                  << e.what() << std::endl
+                  << "OpenCL status: " << e.get_cl_code() << std::endl;
+    }
+
+    catch (const oneapi::mkl::backend_unsupported_exception& e) {
+        oneapi::mkl::blas::set_gemm_algorithm(main_queue, oneapi::mkl::gemm_algorithm::standard);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM:\n" << error.what() << std::endl;
+    }
+
+    // Report the accuracy lost to the Strassen-Winograd recursion, relative to
+    // the largest entry of the reference result.
+    fp max_error = 0, max_ref = 0;
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            max_error = std::max(max_error, std::abs(C[i + j * ldc] - C_ref[i + j * ldc]));
+            max_ref = std::max(max_ref, std::abs(C_ref[i + j * ldc]));
+        }
+    }
+    std::cout << "Strassen-Winograd GEMM " << m << "x" << n << "x" << k << " with cutoff "
+              << cutoff << ": max relative error " << max_error / max_ref << std::endl;
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    // Each level of recursion adds a few rounding steps, hence the wider bound.
+    bool good = check_equal_matrix(C, C_ref, m, n, ldc, 100 * k, std::cout);
+
+    return (int)good;
+#else
+    // Algorithm hints are a property of the run-time dispatch path.
+    return test_skipped;
+#endif
+}
+
+class GemmStrassenUsmTests : public ::testing::TestWithParam<cl::sycl::device> {};
+
+TEST_P(GemmStrassenUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, 256, 256, 256, 260, 260, 260,
+                                  alpha, beta, 32));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::nontrans, 193, 201, 187, 210, 210, 210,
+                                  alpha, beta, 40));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::trans, 129, 97, 151, 160, 160, 160,
+                                  alpha, 0.0f, 24));
+}
+
+TEST_P(GemmStrassenUsmTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::nontrans, 256, 256, 256, 260, 260, 260,
+                                   alpha, beta, 32));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::nontrans, 193, 201, 187, 210, 210, 210,
+                                   alpha, beta, 40));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::trans, 129, 97, 151, 160, 160, 160,
+                                   alpha, 0.0, 24));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmStrassenUsmTestSuite, GemmStrassenUsmTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
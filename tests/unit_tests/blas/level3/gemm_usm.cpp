@@ -135,6 +135,12 @@ TEST_P(GemmUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
                                   oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
                                   beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, 12, 16, 40000, 13, 40001, 14,
+                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, 12, 16, 40000, 40001, 17, 14,
+                                  alpha, beta));
 }
 
 TEST_P(GemmUsmTests, RealDoublePrecision) {
@@ -152,6 +158,12 @@ TEST_P(GemmUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
                                    oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha,
                                    beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::nontrans, 12, 16, 40000, 13, 40001, 14,
+                                   alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::transpose::trans,
+                                   oneapi::mkl::transpose::trans, 12, 16, 40000, 40001, 17, 14,
+                                   alpha, beta));
 }
 
 TEST_P(GemmUsmTests, ComplexSinglePrecision) {
@@ -130,6 +130,9 @@ TEST_P(SyrkTests, RealSinglePrecision) {
                                   oneapi::mkl::transpose::trans, 73, 27, 101, 103, alpha, beta));
     EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::uplo::upper,
                                   oneapi::mkl::transpose::trans, 73, 27, 101, 103, alpha, beta));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::uplo::upper,
+                                  oneapi::mkl::transpose::nontrans, 2003, 1601, 2010, 2010, alpha,
+                                  beta));
 }
 TEST_P(SyrkTests, RealDoublePrecision) {
     double alpha(3.0);
@@ -144,6 +147,9 @@ TEST_P(SyrkTests, RealDoublePrecision) {
                                    oneapi::mkl::transpose::trans, 73, 27, 101, 103, alpha, beta));
     EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::uplo::upper,
                                    oneapi::mkl::transpose::trans, 73, 27, 101, 103, alpha, beta));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::uplo::upper,
+                                   oneapi::mkl::transpose::nontrans, 2003, 1601, 2010, 2010, alpha,
+                                   beta));
 }
 TEST_P(SyrkTests, ComplexSinglePrecision) {
     std::complex<float> alpha(3.0, -0.5);
@@ -160,6 +166,9 @@ TEST_P(SyrkTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::uplo::upper,
                                                 oneapi::mkl::transpose::trans, 73, 27, 101, 103,
                                                 alpha, beta));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::uplo::upper,
+                                                oneapi::mkl::transpose::nontrans, 2003, 1601, 2010,
+                                                2010, alpha, beta));
 }
 TEST_P(SyrkTests, ComplexDoublePrecision) {
     std::complex<double> alpha(3.0, -0.5);
@@ -176,6 +185,9 @@ TEST_P(SyrkTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::uplo::upper,
                                                  oneapi::mkl::transpose::trans, 73, 27, 101, 103,
                                                  alpha, beta));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::uplo::upper,
+                                                 oneapi::mkl::transpose::nontrans, 2003, 1601, 2010,
+                                                 2010, alpha, beta));
 }
 
 INSTANTIATE_TEST_SUITE_P(SyrkTestSuite, SyrkTests, ::testing::ValuesIn(devices),
@@ -156,6 +156,9 @@ TEST_P(TrmmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::side::right, oneapi::mkl::uplo::upper,
                                   oneapi::mkl::transpose::trans, oneapi::mkl::diag::nonunit, 72, 27,
                                   101, 102, alpha));
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), oneapi::mkl::side::left, oneapi::mkl::uplo::upper,
+                                  oneapi::mkl::transpose::nontrans, oneapi::mkl::diag::nonunit,
+                                  1601, 1537, 1610, 1610, alpha));
 }
 TEST_P(TrmmTests, RealDoublePrecision) {
     double alpha(2.0);
@@ -189,6 +192,9 @@ TEST_P(TrmmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::side::right, oneapi::mkl::uplo::upper,
                                    oneapi::mkl::transpose::trans, oneapi::mkl::diag::nonunit, 72,
                                    27, 101, 102, alpha));
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), oneapi::mkl::side::left, oneapi::mkl::uplo::upper,
+                                   oneapi::mkl::transpose::nontrans, oneapi::mkl::diag::nonunit,
+                                   1601, 1537, 1610, 1610, alpha));
 }
 TEST_P(TrmmTests, ComplexSinglePrecision) {
     std::complex<float> alpha(2.0, -0.5);
@@ -234,6 +240,11 @@ TEST_P(TrmmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(
         GetParam(), oneapi::mkl::side::right, oneapi::mkl::uplo::upper,
         oneapi::mkl::transpose::conjtrans, oneapi::mkl::diag::nonunit, 72, 27, 101, 102, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(GetParam(), oneapi::mkl::side::left,
+                                                oneapi::mkl::uplo::upper,
+                                                oneapi::mkl::transpose::nontrans,
+                                                oneapi::mkl::diag::nonunit, 1601, 1537, 1610, 1610,
+                                                alpha));
 }
 TEST_P(TrmmTests, ComplexDoublePrecision) {
     std::complex<double> alpha(2.0, -0.5);
@@ -279,6 +290,11 @@ TEST_P(TrmmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<double>>(
         GetParam(), oneapi::mkl::side::right, oneapi::mkl::uplo::upper,
         oneapi::mkl::transpose::conjtrans, oneapi::mkl::diag::nonunit, 72, 27, 101, 102, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(GetParam(), oneapi::mkl::side::left,
+                                                 oneapi::mkl::uplo::upper,
+                                                 oneapi::mkl::transpose::nontrans,
+                                                 oneapi::mkl::diag::nonunit, 1601, 1537, 1610, 1610,
+                                                 alpha));
 }
 
 INSTANTIATE_TEST_SUITE_P(TrmmTestSuite, TrmmTests, ::testing::ValuesIn(devices),
@@ -97,7 +97,7 @@ int main(int argc, char** argv) {
                             std::string::npos)
                             continue;
 #endif
-#ifndef ENABLE_MKLCPU_BACKEND
+#if !defined(ENABLE_MKLCPU_BACKEND) && !defined(ENABLE_CBLAS_BACKEND)
                         if (dev.is_cpu())
                             continue;
 #endif
@@ -120,7 +120,7 @@ int main(int argc, char** argv) {
         }
     }
 
-#ifdef ENABLE_MKLCPU_BACKEND
+#if defined(ENABLE_MKLCPU_BACKEND) || defined(ENABLE_CBLAS_BACKEND)
     devices.push_back(cl::sycl::device(cl::sycl::host_selector()));
 #endif
 
@@ -0,0 +1,478 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Replays a call log written by oneapi::mkl::blas::start_call_recording, or
+// with ONEMKL_BLAS_RECORD set, on the device chosen on the command line, and
+// reports the time of each routine. Every call is run on its own and waited
+// for, on one queue per recorded queue, all in one context.
+//
+//  onemkl_blas_replay [--device cpu|gpu] [--repeat N] [--calls] log
+//
+// --calls also prints the time of each call as CSV. Operands are allocated
+// once per argument position and reused: buffer operands with their recorded
+// size, USM operands with the size implied by the call. They are filled with
+// the recorded samples, repeated, or else with random values in [-1, 1).
+// Routines without a replayer are counted and reported.
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/call_log.hpp"
+
+namespace {
+
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+using oneapi::mkl::blas::call_arg;
+using oneapi::mkl::blas::call_entry;
+
+template <typename T>
+T random_value(std::mt19937 &generator) {
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    return T(distribution(generator));
+}
+
+template <>
+std::complex<float> random_value(std::mt19937 &generator) {
+    return { random_value<float>(generator), random_value<float>(generator) };
+}
+
+template <>
+std::complex<double> random_value(std::mt19937 &generator) {
+    return { random_value<double>(generator), random_value<double>(generator) };
+}
+
+// Operand memory, one slot per argument position, reused as long as it is
+// large enough and of the same type.
+class operand_pool {
+public:
+    explicit operand_pool(cl::sycl::queue &queue) : queue_(queue) {}
+
+    operand_pool(const operand_pool &) = delete;
+    operand_pool &operator=(const operand_pool &) = delete;
+
+    ~operand_pool() {
+        for (auto &s : slots_) {
+            if (s.usm)
+                cl::sycl::free(s.usm, queue_.get_context());
+        }
+    }
+
+    template <typename T>
+    T *usm(std::size_t position, std::int64_t count, const call_arg &arg) {
+        slot &s = get_slot(position);
+        if (s.usm && s.type == &typeid(T) && s.count >= count)
+            return static_cast<T *>(s.usm);
+        if (s.usm)
+            cl::sycl::free(s.usm, queue_.get_context());
+        T *data = cl::sycl::malloc_shared<T>(std::max<std::int64_t>(count, 1), queue_.get_device(),
+                                             queue_.get_context());
+        if (!data)
+            throw std::bad_alloc();
+        fill(data, count, arg);
+        s.usm = data;
+        s.type = &typeid(T);
+        s.count = count;
+        return data;
+    }
+
+    template <typename T>
+    cl::sycl::buffer<T, 1> buffer(std::size_t position, std::int64_t count, const call_arg &arg) {
+        slot &s = get_slot(position);
+        if (!s.buffer || s.buffer_type != &typeid(T) || s.buffer_count != count) {
+            auto b = std::make_shared<cl::sycl::buffer<T, 1>>(
+                cl::sycl::range<1>(std::max<std::int64_t>(count, 1)));
+            {
+                auto host = b->template get_access<cl::sycl::access::mode::write>();
+                fill(&host[0], count, arg);
+            }
+            s.buffer = b;
+            s.buffer_type = &typeid(T);
+            s.buffer_count = count;
+        }
+        return *static_cast<cl::sycl::buffer<T, 1> *>(s.buffer.get());
+    }
+
+private:
+    struct slot {
+        void *usm = nullptr;
+        const std::type_info *type = nullptr;
+        std::int64_t count = 0;
+        std::shared_ptr<void> buffer;
+        const std::type_info *buffer_type = nullptr;
+        std::int64_t buffer_count = 0;
+    };
+
+    slot &get_slot(std::size_t position) {
+        if (slots_.size() <= position)
+            slots_.resize(position + 1);
+        return slots_[position];
+    }
+
+    template <typename T>
+    void fill(T *data, std::int64_t count, const call_arg &arg) {
+        if (arg.kind == oneapi::mkl::blas::call_arg_kind::buffer && arg.num_samples > 0 &&
+            oneapi::mkl::blas::call_value_size(arg.type) == sizeof(T)) {
+            for (std::int64_t i = 0; i < count; i++)
+                std::memcpy(&data[i], arg.data + (i % arg.num_samples) * sizeof(T), sizeof(T));
+            return;
+        }
+        for (std::int64_t i = 0; i < count; i++)
+            data[i] = random_value<T>(generator_);
+    }
+
+    cl::sycl::queue &queue_;
+    std::vector<slot> slots_;
+    std::mt19937 generator_{ 42 };
+};
+
+// Operands of a call through the USM or the buffer API, given their
+// position among the arguments and the number of elements the call uses.
+template <typename T>
+class usm_operands {
+public:
+    usm_operands(operand_pool &pool, const call_entry &call) : pool_(pool), call_(call) {}
+    T *operator()(std::size_t position, std::int64_t count) {
+        return pool_.usm<T>(position, count, call_.args.at(position));
+    }
+
+private:
+    operand_pool &pool_;
+    const call_entry &call_;
+};
+
+template <typename T>
+class buffer_operands {
+public:
+    buffer_operands(operand_pool &pool, const call_entry &call) : pool_(pool), call_(call) {}
+    cl::sycl::buffer<T, 1> operator()(std::size_t position, std::int64_t count) {
+        const call_arg &arg = call_.args.at(position);
+        return pool_.buffer<T>(position, std::max(count, arg.count), arg);
+    }
+
+private:
+    operand_pool &pool_;
+    const call_entry &call_;
+};
+
+template <typename T>
+T value(const call_entry &call, std::size_t position) {
+    const call_arg &arg = call.args.at(position);
+    if (arg.kind != oneapi::mkl::blas::call_arg_kind::scalar ||
+        oneapi::mkl::blas::call_value_size(arg.type) != sizeof(T))
+        throw std::runtime_error(call.routine + ": unexpected argument " +
+                                 std::to_string(position));
+    return arg.value<T>();
+}
+
+std::int64_t integer(const call_entry &call, std::size_t position) {
+    return value<std::int64_t>(call, position);
+}
+
+// Elements spanned by n elements at stride inc.
+std::int64_t vector_size(std::int64_t n, std::int64_t inc) {
+    return (n > 0) ? 1 + (n - 1) * std::abs(inc) : 0;
+}
+
+template <typename F>
+double time_call(cl::sycl::queue &queue, F f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    queue.wait_and_throw();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// One replayer per routine family. The argument positions are those of the
+// run-time API, after the queue.
+template <typename T, typename Operands>
+double replay_gemm(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const auto transa = value<transpose>(c, 0), transb = value<transpose>(c, 1);
+    const std::int64_t m = integer(c, 2), n = integer(c, 3), k = integer(c, 4);
+    const std::int64_t lda = integer(c, 7), ldb = integer(c, 9), ldc = integer(c, 12);
+    auto a = op(6, lda * (transa == transpose::nontrans ? k : m));
+    auto b = op(8, ldb * (transb == transpose::nontrans ? n : k));
+    auto cc = op(11, ldc * n);
+    return time_call(queue, [&] {
+        oneapi::mkl::blas::gemm(queue, transa, transb, m, n, k, value<T>(c, 5), a, lda, b, ldb,
+                                value<T>(c, 10), cc, ldc);
+    });
+}
+
+template <typename T, typename Operands>
+double replay_gemv(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const auto trans = value<transpose>(c, 0);
+    const std::int64_t m = integer(c, 1), n = integer(c, 2), lda = integer(c, 5);
+    const std::int64_t incx = integer(c, 7), incy = integer(c, 10);
+    const bool nontrans = (trans == transpose::nontrans);
+    auto a = op(4, lda * n);
+    auto x = op(6, vector_size(nontrans ? n : m, incx));
+    auto y = op(9, vector_size(nontrans ? m : n, incy));
+    return time_call(queue, [&] {
+        oneapi::mkl::blas::gemv(queue, trans, m, n, value<T>(c, 3), a, lda, x, incx,
+                                value<T>(c, 8), y, incy);
+    });
+}
+
+template <typename T, typename Operands>
+double replay_trsm(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const auto left_right = value<side>(c, 0);
+    const auto upper_lower = value<uplo>(c, 1);
+    const auto trans = value<transpose>(c, 2);
+    const auto unit_diag = value<diag>(c, 3);
+    const std::int64_t m = integer(c, 4), n = integer(c, 5);
+    const std::int64_t lda = integer(c, 8), ldb = integer(c, 10);
+    auto a = op(7, lda * (left_right == side::left ? m : n));
+    auto b = op(9, ldb * n);
+    return time_call(queue, [&] {
+        oneapi::mkl::blas::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n,
+                                value<T>(c, 6), a, lda, b, ldb);
+    });
+}
+
+template <typename T, typename Operands>
+double replay_syrk(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const auto upper_lower = value<uplo>(c, 0);
+    const auto trans = value<transpose>(c, 1);
+    const std::int64_t n = integer(c, 2), k = integer(c, 3);
+    const std::int64_t lda = integer(c, 6), ldc = integer(c, 9);
+    auto a = op(5, lda * (trans == transpose::nontrans ? k : n));
+    auto cc = op(8, ldc * n);
+    return time_call(queue, [&] {
+        oneapi::mkl::blas::syrk(queue, upper_lower, trans, n, k, value<T>(c, 4), a, lda,
+                                value<T>(c, 7), cc, ldc);
+    });
+}
+
+template <typename T, typename Operands>
+double replay_axpy(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 3), incy = integer(c, 5);
+    auto x = op(2, vector_size(n, incx));
+    auto y = op(4, vector_size(n, incy));
+    return time_call(queue, [&] {
+        oneapi::mkl::blas::axpy(queue, n, value<T>(c, 1), x, incx, y, incy);
+    });
+}
+
+template <typename T, typename Operands>
+double replay_scal(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 3);
+    auto x = op(2, vector_size(n, incx));
+    return time_call(queue, [&] { oneapi::mkl::blas::scal(queue, n, value<T>(c, 1), x, incx); });
+}
+
+template <typename T, typename Operands>
+double replay_copy(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 2), incy = integer(c, 4);
+    auto x = op(1, vector_size(n, incx));
+    auto y = op(3, vector_size(n, incy));
+    return time_call(queue, [&] { oneapi::mkl::blas::copy(queue, n, x, incx, y, incy); });
+}
+
+template <typename T, typename Operands>
+double replay_dot(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 2), incy = integer(c, 4);
+    auto x = op(1, vector_size(n, incx));
+    auto y = op(3, vector_size(n, incy));
+    auto result = op(5, 1);
+    return time_call(queue,
+                     [&] { oneapi::mkl::blas::dot(queue, n, x, incx, y, incy, result); });
+}
+
+template <typename T, typename Operands>
+double replay_asum(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 2);
+    auto x = op(1, vector_size(n, incx));
+    auto result = op(3, 1);
+    return time_call(queue, [&] { oneapi::mkl::blas::asum(queue, n, x, incx, result); });
+}
+
+template <typename T, typename Operands>
+double replay_nrm2(cl::sycl::queue &queue, const call_entry &c, Operands &op) {
+    const std::int64_t n = integer(c, 0), incx = integer(c, 2);
+    auto x = op(1, vector_size(n, incx));
+    auto result = op(3, 1);
+    return time_call(queue, [&] { oneapi::mkl::blas::nrm2(queue, n, x, incx, result); });
+}
+
+using replayer = double (*)(cl::sycl::queue &, const call_entry &, operand_pool &);
+
+// The buffer and USM replayers of a function table entry.
+#define REPLAYERS(ENTRY, T, ROUTINE)                                               \
+    { ENTRY,                                                                       \
+      [](cl::sycl::queue &q, const call_entry &c, operand_pool &p) {               \
+          buffer_operands<T> op(p, c);                                             \
+          return replay_##ROUTINE<T>(q, c, op);                                    \
+      } },                                                                         \
+    { ENTRY "_usm", [](cl::sycl::queue &q, const call_entry &c, operand_pool &p) { \
+          usm_operands<T> op(p, c);                                                \
+          return replay_##ROUTINE<T>(q, c, op);                                    \
+      } }
+
+#define REPLAYERS_ALL_TYPES(ROUTINE)                                                   \
+    REPLAYERS("s" #ROUTINE, float, ROUTINE), REPLAYERS("d" #ROUTINE, double, ROUTINE), \
+        REPLAYERS("c" #ROUTINE, std::complex<float>, ROUTINE),                         \
+        REPLAYERS("z" #ROUTINE, std::complex<double>, ROUTINE)
+
+#define REPLAYERS_REAL_TYPES(ROUTINE) \
+    REPLAYERS("s" #ROUTINE, float, ROUTINE), REPLAYERS("d" #ROUTINE, double, ROUTINE)
+
+const std::map<std::string, replayer> replayers = {
+    REPLAYERS_ALL_TYPES(gemm), REPLAYERS_ALL_TYPES(gemv), REPLAYERS_ALL_TYPES(trsm),
+    REPLAYERS_ALL_TYPES(syrk), REPLAYERS_ALL_TYPES(axpy), REPLAYERS_ALL_TYPES(scal),
+    REPLAYERS_ALL_TYPES(copy), REPLAYERS_REAL_TYPES(dot), REPLAYERS_REAL_TYPES(asum),
+    REPLAYERS_REAL_TYPES(nrm2)
+};
+
+#undef REPLAYERS_REAL_TYPES
+#undef REPLAYERS_ALL_TYPES
+#undef REPLAYERS
+
+struct routine_times {
+    std::int64_t calls = 0;
+    double total = 0;
+    double min = 0;
+    double max = 0;
+
+    void add(double seconds) {
+        min = (calls == 0) ? seconds : std::min(min, seconds);
+        max = std::max(max, seconds);
+        total += seconds;
+        calls++;
+    }
+};
+
+int usage() {
+    std::cerr << "usage: onemkl_blas_replay [--device cpu|gpu] [--repeat N] [--calls] log"
+              << std::endl;
+    return 2;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+    std::string device_name = "cpu", path;
+    std::int64_t repeat = 1;
+    bool print_calls = false;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--device" && i + 1 < argc)
+            device_name = argv[++i];
+        else if (arg == "--repeat" && i + 1 < argc)
+            repeat = std::max(std::atoll(argv[++i]), 1ll);
+        else if (arg == "--calls")
+            print_calls = true;
+        else if (path.empty() && arg[0] != '-')
+            path = arg;
+        else
+            return usage();
+    }
+    if (path.empty() || (device_name != "cpu" && device_name != "gpu"))
+        return usage();
+
+    try {
+        const cl::sycl::device device = (device_name == "gpu")
+                                            ? cl::sycl::device(cl::sycl::gpu_selector())
+                                            : cl::sycl::device(cl::sycl::cpu_selector());
+        auto exception_handler = [](cl::sycl::exception_list exceptions) {
+            for (std::exception_ptr const &e : exceptions) {
+                try {
+                    std::rethrow_exception(e);
+                }
+                catch (cl::sycl::exception const &e) {
+                    std::cerr << "Caught asynchronous SYCL exception:\n" << e.what() << std::endl;
+                }
+            }
+        };
+
+        // The queues share a context, so that they can share USM operands.
+        const cl::sycl::context context(device, exception_handler);
+        std::vector<std::unique_ptr<cl::sycl::queue>> queues;
+        queues.emplace_back(new cl::sycl::queue(context, device));
+        operand_pool pool(*queues[0]);
+
+        oneapi::mkl::blas::call_log log(path);
+        std::map<std::string, routine_times> times;
+        std::map<std::string, std::int64_t> skipped;
+        call_entry call;
+
+        if (print_calls)
+            std::cout << "call,routine,queue,seconds" << std::endl;
+        for (std::int64_t r = 0; r < repeat; r++) {
+            log.rewind();
+            for (std::int64_t index = 0; log.next(call); index++) {
+                auto it = replayers.find(call.routine);
+                if (it == replayers.end()) {
+                    if (r == 0)
+                        skipped[call.routine]++;
+                    continue;
+                }
+                if (queues.size() <= call.queue)
+                    queues.resize(call.queue + 1);
+                if (!queues[call.queue])
+                    queues[call.queue].reset(new cl::sycl::queue(context, device));
+                const double seconds = it->second(*queues[call.queue], call, pool);
+                times[call.routine].add(seconds);
+                if (print_calls)
+                    std::cout << index << "," << call.routine << "," << call.queue << ","
+                              << seconds << std::endl;
+            }
+        }
+
+        std::int64_t total_calls = 0;
+        double total_seconds = 0;
+        std::cout << std::left << std::setw(24) << "routine" << std::right << std::setw(12)
+                  << "calls" << std::setw(14) << "total_ms" << std::setw(12) << "mean_us"
+                  << std::setw(12) << "min_us" << std::setw(12) << "max_us" << std::endl;
+        for (auto &t : times) {
+            std::cout << std::left << std::setw(24) << t.first << std::right << std::setw(12)
+                      << t.second.calls << std::fixed << std::setprecision(3) << std::setw(14)
+                      << t.second.total * 1e3 << std::setw(12)
+                      << t.second.total * 1e6 / t.second.calls << std::setw(12)
+                      << t.second.min * 1e6 << std::setw(12) << t.second.max * 1e6 << std::endl;
+            total_calls += t.second.calls;
+            total_seconds += t.second.total;
+        }
+        std::cout << "replayed " << total_calls << " calls in " << total_seconds << " s"
+                  << std::endl;
+        for (auto &s : skipped)
+            std::cout << "not replayed: " << s.first << " (" << s.second << " calls)" << std::endl;
+    }
+    catch (std::exception const &e) {
+        std::cerr << "onemkl_blas_replay: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
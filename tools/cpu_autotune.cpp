@@ -0,0 +1,266 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Tunes the mklcpu backend for this machine and stores the result in its
+//  tuning file (see cpu_tuning.hpp), replacing any earlier section for the
+//  same CPU model and count:
+//
+//   onemkl_cpu_autotune [--quick] [--output path]
+//
+//  It sweeps the MKL thread count of real gemm per size class, and the
+//  split-K threshold and chunk length on K-dominant shapes, then prints the
+//  time of each tested shape with the default and the tuned settings.
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_split_k.hpp"
+#include "cpu_tuning.hpp"
+
+using namespace oneapi::mkl::mklcpu;
+
+namespace {
+
+// Best time of f in seconds, over enough runs to fill about 50 ms.
+template <typename F>
+double best_time(F f) {
+    using clock = std::chrono::steady_clock;
+    f();
+    double best = 1e30, total = 0.0;
+    for (int run = 0; run < 1000 && (run < 3 || total < 0.05); run++) {
+        const auto start = clock::now();
+        f();
+        const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+        best = std::min(best, seconds);
+        total += seconds;
+    }
+    return best;
+}
+
+struct gemm_problem {
+    int64_t m, n, k;
+    std::vector<double> a, b, c;
+
+    gemm_problem(int64_t m, int64_t n, int64_t k)
+            : m(m),
+              n(n),
+              k(k),
+              a(m * k, 1.0 / 3.0),
+              b(k * n, 2.0 / 3.0),
+              c(m * n, 0.0) {}
+
+    void gemm(int threads) {
+        const local_threads guard(threads);
+        const char trans = 'N';
+        const MKL_INT m_ = m, n_ = n, k_ = k;
+        const double alpha = 1.0, beta = 0.0;
+        split_k_gemm_call(&trans, &trans, &m_, &n_, &k_, &alpha, a.data(), &m_, b.data(), &k_,
+                          &beta, c.data(), &m_);
+    }
+
+    // Split-K gemm under the given settings, plain gemm when they decline.
+    void split_gemm(const split_k_settings &settings, int threads) {
+        if (!split_k_gemm(settings, 'N', 'N', m, n, k, 1.0, a.data(), m, b.data(), k, 0.0,
+                          c.data(), m))
+            gemm(threads);
+    }
+};
+
+// Fastest thread count for real gemm in each size class, measured on cubes
+//  in the middle of the class; 0 where the MKL default is as good or the
+//  class is too large to sweep.
+void tune_gemm_threads(cpu_tuning &tuning, bool quick) {
+    const int max_threads = mkl_get_max_threads();
+    const int last_class = quick ? 5 : 7;
+    std::vector<int> candidates;
+    for (int threads = 1; threads < max_threads; threads *= 2)
+        candidates.push_back(threads);
+    candidates.push_back(max_threads);
+
+    for (int size_class = 0; size_class <= last_class; size_class++) {
+        const int64_t side = std::max<int64_t>(3 * (int64_t(1) << size_class) / 2, 1);
+        gemm_problem problem(side, side, side);
+        double best = 1e30;
+        int best_threads = 0;
+        for (int threads : candidates) {
+            const double seconds = best_time([&] { problem.gemm(threads); });
+            if (seconds < best * 0.97) {
+                best = seconds;
+                best_threads = threads;
+            }
+        }
+        tuning.gemm_threads[size_class] = (best_threads == max_threads) ? 0 : best_threads;
+    }
+}
+
+// The chunk length with the lowest total split-K time over K-dominant shapes,
+//  then the smallest k / max(m, n) from which split-K beats plain gemm at
+//  that and every larger ratio; 0 when it never does.
+void tune_split_k(cpu_tuning &tuning, std::vector<gemm_problem> &problems) {
+    const std::vector<int64_t> min_chunks = { 512, 1024, 2048, 4096, 8192 };
+    std::vector<double> totals(min_chunks.size(), 0.0);
+    std::vector<double> plain(problems.size());
+    for (size_t p = 0; p < problems.size(); p++) {
+        plain[p] = best_time([&] { problems[p].gemm(0); });
+        for (size_t i = 0; i < min_chunks.size(); i++) {
+            const split_k_settings settings = { 1, 0, min_chunks[i] };
+            totals[i] += best_time([&] { problems[p].split_gemm(settings, 0); });
+        }
+    }
+    const size_t best = std::min_element(totals.begin(), totals.end()) - totals.begin();
+    tuning.split_k_min_chunk = min_chunks[best];
+
+    const split_k_settings settings = { 1, 0, tuning.split_k_min_chunk };
+    tuning.split_k_ratio = 0;
+    for (size_t p = problems.size(); p-- > 0;) {
+        if (best_time([&] { problems[p].split_gemm(settings, 0); }) >= plain[p])
+            break;
+        tuning.split_k_ratio = problems[p].k / std::max(problems[p].m, problems[p].n);
+    }
+}
+
+void compare(const cpu_tuning &defaults, const cpu_tuning &tuned,
+             std::vector<gemm_problem> &problems) {
+    const split_k_settings default_settings = { defaults.split_k_ratio, 0,
+                                                defaults.split_k_min_chunk };
+    const split_k_settings tuned_settings = { tuned.split_k_ratio, 0, tuned.split_k_min_chunk };
+    std::printf("%8s %8s %10s %14s %14s %8s\n", "m", "n", "k", "default (us)", "tuned (us)",
+                "speedup");
+    for (auto &problem : problems) {
+        const int threads = tuned.gemm_threads[gemm_size_class(problem.m, problem.n, problem.k)];
+        const double before = best_time([&] { problem.split_gemm(default_settings, 0); });
+        const double after = best_time([&] { problem.split_gemm(tuned_settings, threads); });
+        std::printf("%8lld %8lld %10lld %14.1f %14.1f %8.2f\n", (long long)problem.m,
+                    (long long)problem.n, (long long)problem.k, before * 1e6, after * 1e6,
+                    before / after);
+    }
+}
+
+void make_parent_directories(const std::string &path) {
+    for (size_t slash = path.find('/', 1); slash != std::string::npos;
+         slash = path.find('/', slash + 1))
+        ::mkdir(path.substr(0, slash).c_str(), 0755);
+}
+
+// Rewrites the tuning file with this machine's section replaced. Sections
+//  of a file of another version are dropped.
+bool write_tuning(const std::string &path, int64_t cpus, const std::string &model,
+                  const cpu_tuning &tuning) {
+    std::ostringstream out;
+    out << "onemkl_cpu_tuning " << cpu_tuning_version << "\n";
+    out << "machine " << cpus << " " << model << "\n";
+    out << "split_k_ratio " << tuning.split_k_ratio << "\n";
+    out << "split_k_min_chunk " << tuning.split_k_min_chunk << "\n";
+    out << "gemm_threads";
+    for (int threads : tuning.gemm_threads)
+        out << " " << threads;
+    out << "\n";
+
+    std::ifstream old(path);
+    std::string magic, line;
+    int version = 0;
+    if (old >> magic >> version && magic == "onemkl_cpu_tuning" &&
+        version == cpu_tuning_version) {
+        const std::string ours = "machine " + std::to_string(cpus) + " " + model;
+        bool keep = false;
+        while (std::getline(old, line)) {
+            if (line.compare(0, 8, "machine ") == 0)
+                keep = (line != ours);
+            if (keep)
+                out << line << "\n";
+        }
+    }
+    old.close();
+
+    make_parent_directories(path);
+    const std::string temporary = path + ".tmp";
+    std::ofstream file(temporary);
+    file << out.str();
+    file.close();
+    return file && std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    std::string path = cpu_tuning_path();
+    bool quick = false;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--quick"))
+            quick = true;
+        else if (!std::strcmp(argv[i], "--output") && i + 1 < argc)
+            path = argv[++i];
+        else {
+            std::cerr << "usage: " << argv[0] << " [--quick] [--output path]" << std::endl;
+            return 2;
+        }
+    }
+    if (path.empty()) {
+        std::cerr << "no tuning file path; set HOME, ONEMKL_CPU_TUNING_FILE or --output"
+                  << std::endl;
+        return 2;
+    }
+
+    const int64_t cpus = cpu_count();
+    const std::string model = cpu_model_name();
+    std::cout << "Tuning for " << model << ", " << cpus << " CPUs" << std::endl;
+
+    // K-dominant shapes in increasing k / max(m, n).
+    std::vector<gemm_problem> k_dominant;
+    const int64_t side = 64;
+    for (int64_t ratio = 32; ratio <= (quick ? 512 : 2048); ratio *= 2)
+        k_dominant.emplace_back(side, side, ratio * side);
+
+    const cpu_tuning defaults;
+    cpu_tuning tuned;
+    tune_gemm_threads(tuned, quick);
+    tune_split_k(tuned, k_dominant);
+
+    std::vector<gemm_problem> problems;
+    for (int size_class = 0; size_class <= (quick ? 5 : 7); size_class += 2) {
+        const int64_t cube = std::max<int64_t>(3 * (int64_t(1) << size_class) / 2, 1);
+        problems.emplace_back(cube, cube, cube);
+    }
+    for (auto &problem : k_dominant)
+        problems.emplace_back(problem.m, problem.n, problem.k);
+    compare(defaults, tuned, problems);
+
+    std::cout << "split_k_ratio " << tuned.split_k_ratio << ", split_k_min_chunk "
+              << tuned.split_k_min_chunk << ", gemm_threads";
+    for (int threads : tuned.gemm_threads)
+        std::cout << " " << threads;
+    std::cout << std::endl;
+
+    if (!write_tuning(path, cpus, model, tuned)) {
+        std::cerr << "cannot write " << path << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << path << std::endl;
+    return 0;
+}